@@ -0,0 +1,200 @@
+/*
+ * File:   SetKernelBenchmark.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <htd/main.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ *  Description of a class of set pairs which are intersected during the benchmark.
+ */
+struct Workload
+{
+    /**
+     *  The name of the workload.
+     */
+    std::string name;
+
+    /**
+     *  The number of vertices of the universe from which the sets are drawn.
+     */
+    std::size_t universeSize;
+
+    /**
+     *  The minimum and maximum size of the first set of each pair.
+     */
+    std::pair<std::size_t, std::size_t> sizeRange1;
+
+    /**
+     *  The minimum and maximum size of the second set of each pair.
+     */
+    std::pair<std::size_t, std::size_t> sizeRange2;
+};
+
+/**
+ *  Draw a sorted set of distinct vertices whose size follows a power law within the given range.
+ *
+ *  Neighborhoods in sparse real-world graphs are mostly small with a heavy tail of large ones, which is mimicked
+ *  by sampling the size from a log-uniform distribution.
+ */
+std::vector<htd::vertex_t> randomSet(std::mt19937_64 & generator, std::size_t universeSize, const std::pair<std::size_t, std::size_t> & sizeRange)
+{
+    std::uniform_real_distribution<double> exponentDistribution(std::log(static_cast<double>(sizeRange.first)),
+                                                                std::log(static_cast<double>(sizeRange.second)));
+
+    std::size_t size = std::min(universeSize, static_cast<std::size_t>(std::exp(exponentDistribution(generator))));
+
+    std::uniform_int_distribution<htd::vertex_t> vertexDistribution(0, universeSize - 1);
+
+    std::vector<htd::vertex_t> ret;
+
+    ret.reserve(size);
+
+    while (ret.size() < size)
+    {
+        ret.push_back(vertexDistribution(generator));
+
+        if (ret.size() == size)
+        {
+            std::sort(ret.begin(), ret.end());
+
+            ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+        }
+    }
+
+    return ret;
+}
+
+/**
+ *  Get a human-readable name of a kernel implementation.
+ */
+std::string kernelName(htd::SetKernel kernel)
+{
+    switch (kernel)
+    {
+        case htd::SetKernel::AVX2:
+        {
+            return "avx2";
+        }
+        case htd::SetKernel::SSE4_2:
+        {
+            return "sse4.2";
+        }
+        default:
+        {
+            return "scalar";
+        }
+    }
+}
+
+int main(int argc, const char * const * const argv)
+{
+    std::size_t pairCount = argc > 1 ? static_cast<std::size_t>(std::atol(argv[1])) : 2000;
+
+    std::size_t repetitions = argc > 2 ? static_cast<std::size_t>(std::atol(argv[2])) : 50;
+
+    std::vector<Workload> workloads {
+        { "sparse neighborhoods", 1000000, { 2, 64 }, { 2, 64 } },
+        { "skewed neighborhoods", 1000000, { 2, 32 }, { 1024, 65536 } },
+        { "elimination front", 4096, { 256, 2048 }, { 256, 2048 } },
+        { "dense bags", 512, { 128, 512 }, { 128, 512 } }
+    };
+
+    std::vector<htd::SetKernel> kernels { htd::SetKernel::SCALAR, htd::SetKernel::SSE4_2, htd::SetKernel::AVX2 };
+
+    std::cout << "Active kernel: " << kernelName(htd::activeSetKernel()) << std::endl << std::endl;
+
+    std::cout << std::left << std::setw(24) << "workload" << std::setw(10) << "kernel" << std::right << std::setw(16) << "ns / pair" << std::setw(12) << "speedup" << std::endl;
+
+    std::mt19937_64 generator(42);
+
+    for (const Workload & workload : workloads)
+    {
+        std::vector<std::pair<std::vector<htd::vertex_t>, std::vector<htd::vertex_t>>> pairs;
+
+        pairs.reserve(pairCount);
+
+        for (std::size_t index = 0; index < pairCount; ++index)
+        {
+            pairs.emplace_back(randomSet(generator, workload.universeSize, workload.sizeRange1),
+                               randomSet(generator, workload.universeSize, workload.sizeRange2));
+        }
+
+        double scalarTime = 0;
+
+        std::size_t expectedResult = 0;
+
+        for (htd::SetKernel kernel : kernels)
+        {
+            if (!htd::isSetKernelSupported(kernel))
+            {
+                continue;
+            }
+
+            std::size_t result = 0;
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            for (std::size_t repetition = 0; repetition < repetitions; ++repetition)
+            {
+                for (const auto & pair : pairs)
+                {
+                    result += htd::set_intersection_size(pair.first.data(), pair.first.data() + pair.first.size(),
+                                                         pair.second.data(), pair.second.data() + pair.second.size(),
+                                                         kernel);
+                }
+            }
+
+            double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(pairCount * repetitions);
+
+            if (kernel == htd::SetKernel::SCALAR)
+            {
+                scalarTime = time;
+
+                expectedResult = result;
+            }
+            else if (result != expectedResult)
+            {
+                std::cerr << "MISMATCH: Kernel " << kernelName(kernel) << " computed a wrong result for workload \"" << workload.name << "\"!" << std::endl;
+
+                return 1;
+            }
+
+            std::cout << std::left << std::setw(24) << workload.name << std::setw(10) << kernelName(kernel)
+                      << std::right << std::setw(16) << std::fixed << std::setprecision(1) << time
+                      << std::setw(11) << std::setprecision(2) << scalarTime / time << "x" << std::endl;
+        }
+    }
+
+    return 0;
+}
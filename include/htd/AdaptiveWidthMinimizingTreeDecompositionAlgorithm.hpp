@@ -48,7 +48,8 @@ namespace htd
      *  In contrast to the class htd::CombinedWidthMinimizingTreeDecompositionAlgorithm which executes each of the provided
      *  algorithms only once, this class first performs a number of decision rounds to determine the most promising
      *  decomposition algorithm for the given instance. Then the algorithm performing best is called repeatedly in order to
-     *  find decompositions of lower width.
+     *  find decompositions of lower width. As soon as an htd::ExactTreeDecompositionAlgorithm among the base algorithms
+     *  returns a decomposition, its width is known to be optimal and the search stops.
      *
      *  @note The algorithm always returns a valid tree decomposition according to the provided base
      *  decomposition algorithms and the given manipulations (or nullptr) also if it was interrupted
@@ -260,6 +261,10 @@ namespace htd
             /**
              *  Set the number of iterations which shall be performed (0=infinite).
              *
+             *  @note The algorithm stops early as soon as the width of the best decomposition found so far matches a lower bound
+             *  for the treewidth, i.e., the one provided by the preprocessed input graph (see htd::IPreprocessedGraph::minTreeWidth())
+             *  or the one computed by htd::TreeWidthLowerBoundAlgorithm once the first decomposition is found.
+             *
              *  @param[in] iterationCount   The number of iterations which shall be performed.
              */
             HTD_API void setIterationCount(std::size_t iterationCount);
@@ -0,0 +1,93 @@
+/* 
+ * File:   ApproximateMinimumDegreeOrderingAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_APPROXIMATEMINIMUMDEGREEORDERINGALGORITHM_HPP
+#define HTD_HTD_APPROXIMATEMINIMUMDEGREEORDERINGALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IWidthLimitableOrderingAlgorithm.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the IOrderingAlgorithm interface based on the approximate minimum-degree elimination ordering algorithm.
+     *
+     *  Instead of adding the fill edges to the graph, the elimination is simulated on a quotient graph in which each
+     *  eliminated vertex is represented by an element holding its neighborhood at the time of elimination. Elements
+     *  which are covered by newer elements are absorbed, vertices with identical neighborhoods are merged into
+     *  supervariables and the degrees of the vertices are replaced by upper bounds which can be updated cheaply.
+     *  Hence, the memory consumption is bounded by the size of the input graph.
+     */
+    class ApproximateMinimumDegreeOrderingAlgorithm : public virtual htd::IWidthLimitableOrderingAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new ordering algorithm of type ApproximateMinimumDegreeOrderingAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API ApproximateMinimumDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager);
+            
+            HTD_API virtual ~ApproximateMinimumDegreeOrderingAlgorithm();
+            
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitedVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API bool supportsComponentOrdering(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API ApproximateMinimumDegreeOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
+#else
+            HTD_API ApproximateMinimumDegreeOrderingAlgorithm * clone(void) const;
+
+            HTD_API htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE;
+
+            HTD_API htd::IWidthLimitableOrderingAlgorithm * cloneWidthLimitableOrderingAlgorithm(void) const HTD_OVERRIDE;
+#endif
+
+        protected:
+            /**
+             *  Copy assignment operator for an ordering algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            ApproximateMinimumDegreeOrderingAlgorithm & operator=(const ApproximateMinimumDegreeOrderingAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_APPROXIMATEMINIMUMDEGREEORDERINGALGORITHM_HPP */
@@ -0,0 +1,370 @@
+/*
+ * File:   Bag.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BAG_HPP
+#define HTD_HTD_BAG_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/VertexSpan.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    class BagArena;
+
+    /**
+     *  Immutable view on the content of a bag stored in a bag arena.
+     *
+     *  The bag arena updates its views in place, hence a reference to a view always reflects the current
+     *  content of the bag. Iterators and pointers obtained from a view are invalidated by modifications of
+     *  the bag arena, just like the iterators of a std::vector. Views cannot be copied, use span() to obtain
+     *  a htd::VertexSpan referring to the current content or toVector() to obtain a copy of the content which
+     *  outlives the modifications of the bag arena.
+     */
+    class Bag
+    {
+        public:
+            /**
+             *  The value type of the bag.
+             */
+            typedef htd::VertexSpan::value_type value_type;
+
+            /**
+             *  The size type of the bag.
+             */
+            typedef htd::VertexSpan::size_type size_type;
+
+            /**
+             *  The reference type of the bag.
+             */
+            typedef htd::VertexSpan::const_reference const_reference;
+
+            /**
+             *  The reference type of the bag.
+             */
+            typedef const_reference reference;
+
+            /**
+             *  The iterator type of the bag.
+             */
+            typedef htd::VertexSpan::const_iterator const_iterator;
+
+            /**
+             *  The iterator type of the bag.
+             */
+            typedef const_iterator iterator;
+
+            /**
+             *  Constructor for a view on an empty bag.
+             */
+            Bag(void) HTD_NOEXCEPT : content_(nullptr), size_(0), capacity_(0), materializedContent_(nullptr)
+            {
+
+            }
+
+            /**
+             *  Move constructor for a view on a bag.
+             *
+             *  @param[in] original  The original view.
+             */
+            Bag(Bag && original) HTD_NOEXCEPT = default;
+
+            /**
+             *  Copy constructor for a view on a bag.
+             *
+             *  A copied view would not be updated by the bag arena, hence copying is not supported.
+             *
+             *  @param[in] original  The original view.
+             */
+            Bag(const Bag & original) = delete;
+
+            /**
+             *  Move assignment operator for a view on a bag.
+             *
+             *  @param[in] original  The original view.
+             *
+             *  @return A reference to the view.
+             */
+            Bag & operator=(Bag && original) HTD_NOEXCEPT = default;
+
+            /**
+             *  Copy assignment operator for a view on a bag.
+             *
+             *  A copied view would not be updated by the bag arena, hence copying is not supported.
+             *
+             *  @param[in] original  The original view.
+             *
+             *  @return A reference to the view.
+             */
+            Bag & operator=(const Bag & original) = delete;
+
+            /**
+             *  Getter for a span referring to the current content of the bag.
+             *
+             *  The span is invalidated by every modification of the bag arena, while the view itself is updated in place.
+             *
+             *  @return A span referring to the current content of the bag.
+             */
+            htd::VertexSpan span(void) const HTD_NOEXCEPT
+            {
+                return materializedContent_ != nullptr ? htd::VertexSpan(*materializedContent_) : htd::VertexSpan(content_, size_);
+            }
+
+            /**
+             *  Conversion operator for a bag.
+             *
+             *  @return A span referring to the current content of the bag.
+             */
+            operator htd::VertexSpan(void) const HTD_NOEXCEPT
+            {
+                return span();
+            }
+
+            /**
+             *  Getter for the iterator to the first vertex of the bag.
+             *
+             *  @return An iterator to the first vertex of the bag.
+             */
+            const_iterator begin(void) const HTD_NOEXCEPT
+            {
+                return span().begin();
+            }
+
+            /**
+             *  Getter for the iterator to the end of the bag.
+             *
+             *  @return An iterator to the end of the bag.
+             */
+            const_iterator end(void) const HTD_NOEXCEPT
+            {
+                return span().end();
+            }
+
+            /**
+             *  Getter for the iterator to the first vertex of the bag.
+             *
+             *  @return An iterator to the first vertex of the bag.
+             */
+            const_iterator cbegin(void) const HTD_NOEXCEPT
+            {
+                return begin();
+            }
+
+            /**
+             *  Getter for the iterator to the end of the bag.
+             *
+             *  @return An iterator to the end of the bag.
+             */
+            const_iterator cend(void) const HTD_NOEXCEPT
+            {
+                return end();
+            }
+
+            /**
+             *  Getter for a pointer to the first vertex of the bag.
+             *
+             *  @return A pointer to the first vertex of the bag.
+             */
+            const htd::vertex_t * data(void) const HTD_NOEXCEPT
+            {
+                return span().data();
+            }
+
+            /**
+             *  Getter for the size of the bag.
+             *
+             *  @return The size of the bag.
+             */
+            std::size_t size(void) const HTD_NOEXCEPT
+            {
+                return span().size();
+            }
+
+            /**
+             *  Check whether the bag is empty.
+             *
+             *  @return True if the bag is empty, false otherwise.
+             */
+            bool empty(void) const HTD_NOEXCEPT
+            {
+                return span().empty();
+            }
+
+            /**
+             *  Access the vertex at the specific position within the bag.
+             *
+             *  @param[in] index    The position of the vertex.
+             *
+             *  @return The vertex at the specific position.
+             */
+            const htd::vertex_t & operator[](htd::index_t index) const
+            {
+                return span()[index];
+            }
+
+            /**
+             *  Access the vertex at the specific position within the bag.
+             *
+             *  @param[in] index    The position of the vertex.
+             *
+             *  @return The vertex at the specific position.
+             *
+             *  @throws std::out_of_range If the position is not less than the size of the bag.
+             */
+            const htd::vertex_t & at(htd::index_t index) const
+            {
+                return span().at(index);
+            }
+
+            /**
+             *  Access the first vertex of the bag.
+             *
+             *  @return The first vertex of the bag.
+             */
+            const htd::vertex_t & front(void) const
+            {
+                return span().front();
+            }
+
+            /**
+             *  Access the last vertex of the bag.
+             *
+             *  @return The last vertex of the bag.
+             */
+            const htd::vertex_t & back(void) const
+            {
+                return span().back();
+            }
+
+            /**
+             *  Copy the content of the bag into a new vector.
+             *
+             *  @return A vector containing the vertices of the bag in the same order.
+             */
+            std::vector<htd::vertex_t> toVector(void) const
+            {
+                return span().toVector();
+            }
+
+            /**
+             *  Equality operator for a bag.
+             *
+             *  @param[in] rhs  The bag at the right-hand side of the operator.
+             *
+             *  @return True if the bag is equal to the bag at the right-hand side of the operator, false otherwise.
+             */
+            bool operator==(const Bag & rhs) const
+            {
+                return span() == rhs.span();
+            }
+
+            /**
+             *  Inequality operator for a bag.
+             *
+             *  @param[in] rhs  The bag at the right-hand side of the operator.
+             *
+             *  @return True if the bag is not equal to the bag at the right-hand side of the operator, false otherwise.
+             */
+            bool operator!=(const Bag & rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+            /**
+             *  Equality operator for a bag.
+             *
+             *  @param[in] rhs  The vector at the right-hand side of the operator.
+             *
+             *  @return True if the bag contains the same vertices in the same order as the vector at the right-hand side of the operator, false otherwise.
+             */
+            bool operator==(const std::vector<htd::vertex_t> & rhs) const
+            {
+                return span() == rhs;
+            }
+
+            /**
+             *  Inequality operator for a bag.
+             *
+             *  @param[in] rhs  The vector at the right-hand side of the operator.
+             *
+             *  @return True if the bag does not contain the same vertices in the same order as the vector at the right-hand side of the operator, false otherwise.
+             */
+            bool operator!=(const std::vector<htd::vertex_t> & rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+        private:
+            friend class htd::BagArena;
+
+            /**
+             *  A pointer to the first vertex of the bag within the storage of the bag arena.
+             */
+            htd::vertex_t * content_;
+
+            /**
+             *  The number of vertices in the bag.
+             */
+            std::size_t size_;
+
+            /**
+             *  The number of vertices which fit into the storage reserved for the bag.
+             */
+            std::size_t capacity_;
+
+            /**
+             *  The vector holding the content of the bag if it was handed out for modification, nullptr otherwise.
+             */
+            std::vector<htd::vertex_t> * materializedContent_;
+    };
+
+    /**
+     *  Equality operator for a bag.
+     *
+     *  @param[in] lhs  The vector at the left-hand side of the operator.
+     *  @param[in] rhs  The bag at the right-hand side of the operator.
+     *
+     *  @return True if the vector contains the same vertices in the same order as the bag, false otherwise.
+     */
+    inline bool operator==(const std::vector<htd::vertex_t> & lhs, const htd::Bag & rhs)
+    {
+        return rhs == lhs;
+    }
+
+    /**
+     *  Inequality operator for a bag.
+     *
+     *  @param[in] lhs  The vector at the left-hand side of the operator.
+     *  @param[in] rhs  The bag at the right-hand side of the operator.
+     *
+     *  @return True if the vector does not contain the same vertices in the same order as the bag, false otherwise.
+     */
+    inline bool operator!=(const std::vector<htd::vertex_t> & lhs, const htd::Bag & rhs)
+    {
+        return rhs != lhs;
+    }
+}
+
+#endif /* HTD_HTD_BAG_HPP */
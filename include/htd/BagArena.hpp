@@ -0,0 +1,174 @@
+/*
+ * File:   BagArena.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BAGARENA_HPP
+#define HTD_HTD_BAGARENA_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/Bag.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Storage for the bags of a graph decomposition.
+     *
+     *  The contents of the bags are kept back to back in a sequence of large blocks instead of one heap
+     *  allocation per bag. A bag keeps its location until it outgrows it, in which case its new content is
+     *  placed at the end of the last block. A bag which is handed out for modification via mutableBagContent()
+     *  is materialized into a std::vector which backs the bag until its content is set again or compact() is
+     *  called, so modifications should rather go through setBagContent(). Setting or removing a bag never
+     *  moves the content of any other bag, so views on and iterators into the other bags stay valid. The slots
+     *  abandoned by removed, relocated and materialized bags are only reclaimed by compact() and when the arena
+     *  is copied.
+     */
+    class BagArena
+    {
+        public:
+            /**
+             *  Constructor for an empty bag arena.
+             */
+            HTD_API BagArena(void);
+
+            /**
+             *  Copy constructor for a bag arena.
+             *
+             *  The bags of the new arena are laid out back to back in a single block.
+             *
+             *  @param[in] original  The original bag arena.
+             */
+            HTD_API BagArena(const BagArena & original);
+
+            HTD_API virtual ~BagArena();
+
+            /**
+             *  Getter for the number of bags stored in the arena.
+             *
+             *  @return The number of bags stored in the arena.
+             */
+            HTD_API std::size_t bagCount(void) const;
+
+            /**
+             *  Check whether a bag is stored for the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return True if a bag is stored for the given vertex, false otherwise.
+             */
+            HTD_API bool isBag(htd::vertex_t vertex) const;
+
+            /**
+             *  Access the bag content of a specific vertex.
+             *
+             *  The returned reference remains valid and reflects all changes of the bag until the bag is removed.
+             *
+             *  @param[in] vertex   The vertex for which the bag content shall be returned.
+             *
+             *  @return The bag content of the specific vertex.
+             *
+             *  @throws std::out_of_range If no bag is stored for the given vertex.
+             */
+            HTD_API const htd::Bag & bagContent(htd::vertex_t vertex) const;
+
+            /**
+             *  Access the bag content of a specific vertex for modification.
+             *
+             *  The bag is copied into a std::vector which backs it until its content is set again, the bag is removed or
+             *  compact() is called. The returned reference remains valid until then. The slot of the bag within the
+             *  arena is released immediately.
+             *
+             *  @param[in] vertex   The vertex for which the bag content shall be returned.
+             *
+             *  @return The bag content of the specific vertex.
+             *
+             *  @throws std::out_of_range If no bag is stored for the given vertex.
+             */
+            HTD_API std::vector<htd::vertex_t> & mutableBagContent(htd::vertex_t vertex);
+
+            /**
+             *  Set the bag content of a specific vertex. If no bag is stored for the vertex so far, a new bag is created.
+             *
+             *  @param[in] vertex   The vertex for which the bag content shall be set.
+             *  @param[in] content  The new bag content.
+             */
+            HTD_API void setBagContent(htd::vertex_t vertex, const std::vector<htd::vertex_t> & content);
+
+            /**
+             *  Set the bag content of a specific vertex. If no bag is stored for the vertex so far, a new bag is created.
+             *
+             *  @param[in] vertex   The vertex for which the bag content shall be set.
+             *  @param[in] content  The new bag content. It may be the bag of another vertex stored in the arena.
+             */
+            HTD_API void setBagContent(htd::vertex_t vertex, const htd::Bag & content);
+
+            /**
+             *  Remove the bag of a specific vertex.
+             *
+             *  @param[in] vertex   The vertex whose bag shall be removed.
+             */
+            HTD_API void removeBag(htd::vertex_t vertex);
+
+            /**
+             *  Remove all bags from the arena and release the storage.
+             */
+            HTD_API void clear(void);
+
+            /**
+             *  Getter for the total number of vertices stored in all bags.
+             *
+             *  @return The total number of vertices stored in all bags.
+             */
+            HTD_API std::size_t contentSize(void) const;
+
+            /**
+             *  Getter for the number of vertices which fit into the blocks allocated by the arena, including unused space.
+             *
+             *  @return The number of vertices which fit into the blocks allocated by the arena.
+             */
+            HTD_API std::size_t storageSize(void) const;
+
+            /**
+             *  Move all bags, including the materialized ones, back to back into a single block and release the unused space.
+             *
+             *  References returned by bagContent() remain valid, references returned by mutableBagContent() are invalidated.
+             */
+            HTD_API void compact(void);
+
+            /**
+             *  Copy assignment operator for a bag arena.
+             *
+             *  @param[in] original  The original bag arena.
+             */
+            HTD_API BagArena & operator=(const BagArena & original);
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_BAGARENA_HPP */
@@ -222,6 +222,24 @@ namespace htd
              */
             HTD_API void setCompressionEnabled(bool compressionEnabled);
 
+            /**
+             *  Check whether the connected components of the input graph shall be ordered separately even if only a single thread may be used.
+             *
+             *  If the management instance allows more than one thread, the components are ordered separately in any case.
+             *
+             *  @return A boolean flag indicating whether the connected components of the input graph shall be ordered separately even if only a single thread may be used.
+             */
+            HTD_API bool isComponentOrderingEnabled(void) const;
+
+            /**
+             *  Set whether the connected components of the input graph shall be ordered separately even if only a single thread may be used.
+             *
+             *  If the management instance allows more than one thread, the components are ordered separately in any case.
+             *
+             *  @param[in] componentOrderingEnabled A boolean flag indicating whether the connected components of the input graph shall be ordered separately even if only a single thread may be used.
+             */
+            HTD_API void setComponentOrderingEnabled(bool componentOrderingEnabled);
+
             HTD_API BucketEliminationTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE;
 
         protected:
@@ -0,0 +1,363 @@
+/*
+ * File:   BucketPriorityQueue.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BUCKETPRIORITYQUEUE_HPP
+#define HTD_HTD_BUCKETPRIORITYQUEUE_HPP
+
+#include <htd/Globals.hpp>
+
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Priority queue for small, non-negative integral priorities and values which can be used as indices.
+     *
+     *  The priority queue provides the same interface as htd::PriorityQueue. The elements are kept in one bucket per
+     *  priority and each element remembers its priority and its position within its bucket. Hence, insertion, removal
+     *  and priority updates of a given element take constant time. Buckets which run empty keep their storage, so
+     *  that no allocations are needed once the priorities have been seen for the first time.
+     *
+     *  @note The memory consumption is linear in the largest priority and the largest value ever inserted into the
+     *  priority queue. Priorities which may grow quadratically in the size of the input should use htd::PriorityQueue.
+     */
+    template < typename ValueType, typename Compare = std::less<std::size_t> >
+    class BucketPriorityQueue
+    {
+        static_assert(std::is_integral<ValueType>::value, "The value type of a bucket priority queue must be integral.");
+
+        public:
+            /**
+             *  Constructor of a new priority queue.
+             */
+            BucketPriorityQueue(void) : compare_(), buckets_(), priorities_(), positions_(), topPriority_(0), size_(0)
+            {
+
+            }
+
+            /**
+             *  Check whether the priority queue is emtpy.
+             *
+             *  @return True if the priority queue is empty, false otherwise.
+             */
+            bool empty(void) const
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Getter for the number of elements in the priority queue.
+             *
+             *  @return The number of elements in the priority queue.
+             */
+            std::size_t size(void) const
+            {
+                return size_;
+            }
+
+            /**
+             *  Access the top element.
+             *
+             *  @return The top element.
+             */
+            const ValueType & top(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return topCollection()[0];
+            }
+
+            /**
+             *  Access the top priority.
+             *
+             *  @return The top priority.
+             */
+            const std::size_t & topPriority(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return topPriority_;
+            }
+
+            /**
+             *  Access the collection of elements with top priority.
+             *
+             *  @note The order of the elements within the collection is unspecified.
+             *
+             *  @return The collection of elements with top priority.
+             */
+            const std::vector<ValueType> & topCollection(void) const
+            {
+                HTD_ASSERT(size_ > 0)
+
+                return buckets_[topPriority_];
+            }
+
+            /**
+             *  Check whether the priority queue contains the given element.
+             *
+             *  @param[in] value    The element.
+             *
+             *  @return True if the priority queue contains the given element, false otherwise.
+             */
+            bool contains(const ValueType & value) const
+            {
+                return static_cast<std::size_t>(value) < positions_.size() && positions_[value] != UNUSED;
+            }
+
+            /**
+             *  Insert a new element with the given priority.
+             *
+             *  @note The element must not be contained in the priority queue already.
+             *
+             *  @param[in] value    The element which shall be inserted.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void push(const ValueType & value, std::size_t priority)
+            {
+                HTD_ASSERT(!contains(value))
+
+                std::size_t index = static_cast<std::size_t>(value);
+
+                if (index >= positions_.size())
+                {
+                    positions_.resize(index + 1, UNUSED);
+
+                    priorities_.resize(index + 1, 0);
+                }
+
+                insert(value, priority);
+
+                if (size_ == 0 || compare_(topPriority_, priority))
+                {
+                    topPriority_ = priority;
+                }
+
+                ++size_;
+            }
+
+            /**
+             *  Remove the top element.
+             */
+            void pop(void)
+            {
+                HTD_ASSERT(size_ > 0)
+
+                remove(buckets_[topPriority_][0]);
+
+                --size_;
+
+                updateTopPriority();
+            }
+
+            /**
+             *  Erase the specific element.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased, false otherwise.
+             */
+            bool erase(const ValueType & value)
+            {
+                bool ret = contains(value);
+
+                if (ret)
+                {
+                    remove(value);
+
+                    --size_;
+
+                    updateTopPriority();
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Erase the specific element from the collection of elements with the given priority.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *  @param[in] priority The priority of the element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the collection of elements with the given priority, false otherwise.
+             */
+            bool erase(const ValueType & value, std::size_t priority)
+            {
+                return contains(value) && priorities_[value] == priority && erase(value);
+            }
+
+            /**
+             *  Erase the specific element from the top collection.
+             *
+             *  @param[in] value    The element which shall be deleted.
+             *
+             *  @return True if the element was successfully erased from the top collection, false otherwise.
+             */
+            bool eraseFromTopCollection(const ValueType & value)
+            {
+                return size_ > 0 && erase(value, topPriority_);
+            }
+
+            /**
+             *  Update the priority of a specific, existing element.
+             *
+             *  @param[in] value        The element which shall be updated.
+             *  @param[in] oldPriority  The old priority of the element which shall be updated.
+             *  @param[in] newPriority  The new priority of the element which shall be updated.
+             */
+            void updatePriority(const ValueType & value, std::size_t oldPriority, std::size_t newPriority)
+            {
+                HTD_ASSERT(contains(value) && priorities_[value] == oldPriority)
+
+                HTD_UNUSED(oldPriority)
+
+                if (oldPriority != newPriority)
+                {
+                    remove(value);
+
+                    insert(value, newPriority);
+
+                    if (compare_(topPriority_, newPriority))
+                    {
+                        topPriority_ = newPriority;
+                    }
+                    else
+                    {
+                        updateTopPriority();
+                    }
+                }
+            }
+
+        private:
+            /**
+             *  Marker for elements which are not contained in the priority queue.
+             */
+            static const htd::index_t UNUSED = std::numeric_limits<htd::index_t>::max();
+
+            /**
+             *  A comparison operator defining the order of the priorities.
+             */
+            Compare compare_;
+
+            /**
+             *  The elements of the priority queue, grouped by their priority.
+             */
+            std::vector<std::vector<ValueType>> buckets_;
+
+            /**
+             *  The priority of each element, indexed by the element.
+             */
+            std::vector<std::size_t> priorities_;
+
+            /**
+             *  The position of each element within its bucket, indexed by the element.
+             */
+            std::vector<htd::index_t> positions_;
+
+            /**
+             *  The top priority.
+             */
+            std::size_t topPriority_;
+
+            /**
+             *  The number of elements in the priority queue.
+             */
+            std::size_t size_;
+
+            /**
+             *  Append an element to the bucket of the given priority.
+             *
+             *  @param[in] value    The element which shall be inserted.
+             *  @param[in] priority The priority of the element which shall be inserted.
+             */
+            void insert(const ValueType & value, std::size_t priority)
+            {
+                if (priority >= buckets_.size())
+                {
+                    buckets_.resize(priority + 1);
+                }
+
+                std::vector<ValueType> & bucket = buckets_[priority];
+
+                priorities_[value] = priority;
+
+                positions_[value] = bucket.size();
+
+                bucket.push_back(value);
+            }
+
+            /**
+             *  Remove an element from its bucket by replacing it with the last element of the bucket.
+             *
+             *  @param[in] value    The element which shall be removed.
+             */
+            void remove(ValueType value)
+            {
+                std::vector<ValueType> & bucket = buckets_[priorities_[value]];
+
+                htd::index_t position = positions_[value];
+
+                ValueType last = bucket.back();
+
+                bucket[position] = last;
+
+                positions_[last] = position;
+
+                bucket.pop_back();
+
+                positions_[value] = UNUSED;
+            }
+
+            /**
+             *  Move the top priority towards the lower priorities until a non-empty bucket is found.
+             */
+            void updateTopPriority(void)
+            {
+                if (size_ > 0)
+                {
+                    bool descending = compare_(0, 1);
+
+                    while (buckets_[topPriority_].empty())
+                    {
+                        if (descending)
+                        {
+                            --topPriority_;
+                        }
+                        else
+                        {
+                            ++topPriority_;
+                        }
+                    }
+                }
+            }
+    };
+
+    template < typename ValueType, typename Compare >
+    const htd::index_t BucketPriorityQueue<ValueType, Compare>::UNUSED;
+}
+
+#endif /* HTD_HTD_BUCKETPRIORITYQUEUE_HPP */
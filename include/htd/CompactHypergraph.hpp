@@ -0,0 +1,204 @@
+/* 
+ * File:   CompactHypergraph.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_COMPACTHYPERGRAPH_HPP
+#define HTD_HTD_COMPACTHYPERGRAPH_HPP
+
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/LibraryInstance.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Immutable implementation of the IMultiHypergraph interface.
+     *
+     *  The neighborhoods of all vertices and the incidence relation between vertices and hyperedges are
+     *  stored in compressed sparse row format, i.e., in a single array of entries per relation together
+     *  with an array of offsets pointing to the first entry of each vertex. This avoids one heap-allocated
+     *  vector per vertex and makes read-only passes over large graphs considerably more cache-friendly.
+     *
+     *  Because the graph cannot be modified, copies share the same underlying arrays, hence copying and
+     *  cloning a compact multi-hypergraph take constant time.
+     */
+    class CompactHypergraph : public virtual htd::IMultiHypergraph
+    {
+        public:
+            /**
+             *  Copy constructor for a compact multi-hypergraph.
+             *
+             *  The copy shares the immutable graph data of the original.
+             *
+             *  @param[in] original  The original compact multi-hypergraph.
+             */
+            HTD_API CompactHypergraph(const CompactHypergraph & original);
+
+            /**
+             *  Constructor for a compact multi-hypergraph.
+             *
+             *  The vertex identifiers, edge identifiers and the order of the hyperedges of the original graph are preserved.
+             *
+             *  @param[in] original  The multi-hypergraph which shall be represented by the new compact multi-hypergraph.
+             */
+            HTD_API CompactHypergraph(const htd::IMultiHypergraph & original);
+
+            /**
+             *  Constructor for a compact multi-hypergraph with the vertices 1, ..., vertexCount and the given hyperedges.
+             *
+             *  This constructor allows to create a compact multi-hypergraph without building a mutable graph first.
+             *
+             *  @param[in] manager      The management instance to which the new compact multi-hypergraph belongs.
+             *  @param[in] vertexCount  The number of vertices of the new compact multi-hypergraph.
+             *  @param[in] hyperedges   The hyperedges of the new compact multi-hypergraph. The hyperedges must be sorted by ID in ascending order and all their endpoints must be vertices of the graph.
+             */
+            HTD_API CompactHypergraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, std::vector<htd::Hyperedge> && hyperedges);
+
+            HTD_API virtual ~CompactHypergraph();
+
+            HTD_API std::size_t vertexCount(void) const HTD_OVERRIDE;
+
+            HTD_API std::size_t edgeCount(void) const HTD_OVERRIDE;
+
+            HTD_API std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(htd::id_t edgeId) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(const std::vector<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API bool isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::id_t> associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE;
+
+            /**
+             *  Access the vector of all vertices in the graph.
+             *
+             *  @return The vector of all vertices in the graph sorted in ascending order.
+             */
+            HTD_API const std::vector<htd::vertex_t> & vertexVector(void) const;
+
+            HTD_API void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API bool isConnected(void) const HTD_OVERRIDE;
+
+            HTD_API bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE;
+
+            HTD_API bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE;
+
+            HTD_API std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API std::size_t isolatedVertexCount(void) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE;
+
+            HTD_API htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(void) const HTD_OVERRIDE;
+
+            HTD_API htd::ConstCollection<htd::Hyperedge> hyperedges(htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedge(htd::id_t edgeId) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index) const HTD_OVERRIDE;
+
+            HTD_API const htd::Hyperedge & hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const HTD_OVERRIDE;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const HTD_OVERRIDE;
+
+            HTD_API htd::FilteredHyperedgeCollection hyperedgesAtPositions(std::vector<htd::index_t> && indices) const HTD_OVERRIDE;
+
+            /**
+             *  Getter for the ID the next vertex added to the original graph would have got.
+             *
+             *  @return The ID the next vertex added to the original graph would have got.
+             */
+            HTD_API htd::vertex_t nextVertex(void) const;
+
+            /**
+             *  Getter for the ID the next edge added to the original graph would have got.
+             *
+             *  @return The ID the next edge added to the original graph would have got.
+             */
+            HTD_API htd::id_t nextEdgeId(void) const;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API CompactHypergraph * clone(void) const HTD_OVERRIDE;
+#else
+            /**
+             *  Create a deep copy of the current compact multi-hypergraph.
+             *
+             *  @return A new CompactHypergraph object identical to the current compact multi-hypergraph.
+             */
+            HTD_API CompactHypergraph * clone(void) const;
+
+            HTD_API htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE;
+
+            HTD_API htd::IMultiHypergraph * cloneMultiHypergraph(void) const HTD_OVERRIDE;
+#endif
+
+            /**
+             *  Copy assignment operator for a compact multi-hypergraph.
+             *
+             *  @param[in] original  The original compact multi-hypergraph.
+             */
+            HTD_API CompactHypergraph & operator=(const CompactHypergraph & original);
+
+        private:
+            struct Implementation;
+
+            /**
+             *  The management instance to which the current object instance belongs.
+             */
+            const htd::LibraryInstance * managementInstance_;
+
+            std::shared_ptr<const Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_COMPACTHYPERGRAPH_HPP */
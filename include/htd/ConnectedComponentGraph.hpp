@@ -0,0 +1,109 @@
+/*
+ * File:   ConnectedComponentGraph.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONNECTEDCOMPONENTGRAPH_HPP
+#define HTD_HTD_CONNECTEDCOMPONENTGRAPH_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IMultiHypergraph.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  This class represents a connected component of a preprocessed graph as a graph of its own.
+     *
+     *  The component is provided both as an input graph and as a preprocessed graph without a partial vertex
+     *  elimination ordering, so that an ordering algorithm applied to the component never sees vertices
+     *  outside of it. Vertex i of the component graph (1-based) corresponds to the i-th smallest vertex of
+     *  the component within the original preprocessed graph.
+     *
+     *  The graph of a component holds copies of the neighborhoods of its vertices, hence it is meant to be built
+     *  when the component is processed and to be discarded afterwards.
+     */
+    class ConnectedComponentGraph
+    {
+        public:
+            /**
+             *  Constructor for a new component of a preprocessed graph.
+             *
+             *  @param[in] manager              The management instance to which the graph of the component shall belong.
+             *  @param[in] preprocessedGraph    The preprocessed graph containing the component.
+             *  @param[in] vertices             The vertices (with 0-based IDs) of the component, sorted in ascending order.
+             */
+            HTD_API ConnectedComponentGraph(const htd::LibraryInstance * const manager, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::vertex_t> & vertices);
+
+            /**
+             *  Move constructor for a component of a preprocessed graph.
+             *
+             *  @param[in] original  The original component of a preprocessed graph.
+             */
+            HTD_API ConnectedComponentGraph(ConnectedComponentGraph && original);
+
+            /**
+             *  Destructor for a component of a preprocessed graph.
+             */
+            HTD_API virtual ~ConnectedComponentGraph();
+
+            /**
+             *  Getter for the vertices of the component.
+             *
+             *  @return The vertices (with 0-based IDs) of the component within the original preprocessed graph, sorted in ascending order.
+             */
+            HTD_API const std::vector<htd::vertex_t> & vertices(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the identifier a vertex of the component graph has in the original input graph.
+             *
+             *  @param[in] vertex   The vertex of the component graph.
+             *
+             *  @return The identifier of the vertex in the original input graph.
+             */
+            HTD_API htd::vertex_t vertexName(htd::vertex_t vertex) const;
+
+            /**
+             *  Getter for the component in the form of an input graph.
+             *
+             *  @return The component in the form of an input graph.
+             */
+            HTD_API const htd::IMultiHypergraph & graph(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the component in the form of a preprocessed graph.
+             *
+             *  @return The component in the form of a preprocessed graph.
+             */
+            HTD_API const htd::IPreprocessedGraph & preprocessedGraph(void) const HTD_NOEXCEPT;
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_CONNECTEDCOMPONENTGRAPH_HPP */
@@ -224,6 +224,20 @@ namespace htd
                 return ConstCollection<T>(std::begin(collection), std::end(collection), collection.size());
             }
 
+            /**
+             *  Create a new ConstCollection object wrapping the provided range of elements.
+             *
+             *  In contrast to the constructor accepting two iterators, the size of the range is not determined by iterating over it.
+             *
+             *  @param[in] begin    An iterator to the first element of the range.
+             *  @param[in] end      An iterator to the end of the range.
+             *  @param[in] size     The number of elements within the range.
+             */
+            static ConstCollection<T> getInstance(const htd::ConstIterator<T> & begin, const htd::ConstIterator<T> & end, std::size_t size)
+            {
+                return ConstCollection<T>(begin, end, size);
+            }
+
         private:
             /**
              *  An iterator to the first element of the collection.
@@ -0,0 +1,196 @@
+/* 
+ * File:   ConstIndexedIteratorWrapper.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONSTINDEXEDITERATORWRAPPER_HPP
+#define HTD_HTD_CONSTINDEXEDITERATORWRAPPER_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ConstIteratorBase.hpp>
+
+#include <iterator>
+#include <memory>
+
+namespace htd
+{
+    /**
+     *  Implementation of a wrapper for iterators over positions within an immutable, random-access collection.
+     *
+     *  Dereferencing the wrapper yields the element of the underlying collection at the current position.
+     */
+    template <typename Iter, typename Container, typename T = typename Container::value_type>
+    class ConstIndexedIteratorWrapper : public std::iterator<std::forward_iterator_tag, T>, public htd::ConstIteratorBase<T>
+    {
+        public:
+            /**
+             *  Constructor for a wrapper of an iterator over positions within a collection.
+             *
+             *  @param[in] baseIterator The underlying iterator over the positions which shall be wrapped.
+             *  @param[in] container    The collection into which the positions point.
+             */
+            ConstIndexedIteratorWrapper(Iter baseIterator, const Container & container) HTD_NOEXCEPT : baseIterator_(baseIterator), container_(&container), anchor_()
+            {
+
+            }
+
+            /**
+             *  Constructor for a wrapper of an iterator over positions within a collection which keeps the collection alive.
+             *
+             *  @param[in] baseIterator The underlying iterator over the positions which shall be wrapped. It must stay valid as long as the collection exists.
+             *  @param[in] container    The collection into which the positions point.
+             */
+            ConstIndexedIteratorWrapper(Iter baseIterator, const std::shared_ptr<const Container> & container) HTD_NOEXCEPT : baseIterator_(baseIterator), container_(container.get()), anchor_(container)
+            {
+
+            }
+
+            /**
+             *  Copy constructor for a wrapper of an iterator over positions within a collection.
+             *
+             *  @param[in] original  The original iterator wrapper.
+             */
+            ConstIndexedIteratorWrapper<Iter, Container, T>(const ConstIndexedIteratorWrapper<Iter, Container, T> & original) HTD_NOEXCEPT : baseIterator_(original.baseIterator_), container_(original.container_), anchor_(original.anchor_)
+            {
+
+            }
+
+            /**
+             *  Move constructor for a wrapper of an iterator over positions within a collection.
+             *
+             *  @param[in] original  The original iterator wrapper.
+             */
+            ConstIndexedIteratorWrapper<Iter, Container, T>(ConstIndexedIteratorWrapper<Iter, Container, T> && original) HTD_NOEXCEPT : baseIterator_(std::move(original.baseIterator_)), container_(original.container_), anchor_(std::move(original.anchor_))
+            {
+
+            }
+
+            virtual ~ConstIndexedIteratorWrapper()
+            {
+
+            }
+
+            /**
+             *  Copy assignment operator for a wrapper of an iterator over positions within a collection.
+             *
+             *  @param[in] original  The original iterator wrapper.
+             */
+            ConstIndexedIteratorWrapper & operator=(const ConstIndexedIteratorWrapper & original) HTD_NOEXCEPT
+            {
+                baseIterator_ = original.baseIterator_;
+
+                container_ = original.container_;
+
+                anchor_ = original.anchor_;
+
+                return *this;
+            }
+
+            ConstIndexedIteratorWrapper<Iter, Container, T> & operator++(void) HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                ++baseIterator_;
+
+                return *this;
+            }
+
+            /**
+             *  Increment the iterator.
+             *
+             *  @return A copy of the iterator reflecting the state before the increment operation took place.
+             */
+            ConstIndexedIteratorWrapper<Iter, Container, T> operator++(int)
+            {
+                ConstIndexedIteratorWrapper<Iter, Container, T> ret(*this);
+
+                operator++();
+
+                return ret;
+            }
+
+            bool operator==(const htd::ConstIteratorBase<T> & rhs) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return baseIterator_ == static_cast<const ConstIndexedIteratorWrapper<Iter, Container, T> *>(&rhs)->baseIterator_;
+            }
+
+            /**
+             *  Equality operator for an iterator.
+             *
+             *  @param[in] rhs  The iterator at the right-hand side of the operator.
+             *
+             *  @return True if the iterator points to the same element as the iterator at the right-hand side of the operator, false otherwise.
+             */
+            bool operator==(const ConstIndexedIteratorWrapper<Iter, Container, T> & rhs) const
+            {
+                return baseIterator_ == rhs.baseIterator_;
+            }
+
+            bool operator!=(const htd::ConstIteratorBase<T> & rhs) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return baseIterator_ != static_cast<const ConstIndexedIteratorWrapper<Iter, Container, T> *>(&rhs)->baseIterator_;
+            }
+
+            /**
+             *  Inequality operator for an iterator.
+             *
+             *  @param[in] rhs  The iterator at the right-hand side of the operator.
+             *
+             *  @return True if the iterator does not point to the same element as the iterator at the right-hand side of the operator, false otherwise.
+             */
+            bool operator!=(const ConstIndexedIteratorWrapper<Iter, Container, T> & rhs) const
+            {
+                return baseIterator_ != rhs.baseIterator_;
+            }
+
+            const T * operator->(void) const HTD_OVERRIDE
+            {
+                return &((*container_)[*baseIterator_]);
+            }
+
+            const T & operator*(void) const HTD_OVERRIDE
+            {
+                return (*container_)[*baseIterator_];
+            }
+
+            ConstIndexedIteratorWrapper<Iter, Container, T> * clone(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return new ConstIndexedIteratorWrapper<Iter, Container, T>(*this);
+            }
+
+        private:
+            /**
+             *  The underlying iterator over the positions.
+             */
+            Iter baseIterator_;
+
+            /**
+             *  A pointer to the collection into which the positions point.
+             */
+            const Container * container_;
+
+            /**
+             *  The owner of the collection if the wrapper shall keep the collection alive, an empty pointer otherwise.
+             */
+            std::shared_ptr<const Container> anchor_;
+    };
+}
+
+#endif /* HTD_HTD_CONSTINDEXEDITERATORWRAPPER_HPP */
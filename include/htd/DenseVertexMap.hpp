@@ -0,0 +1,298 @@
+/*
+ * File:   DenseVertexMap.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_DENSEVERTEXMAP_HPP
+#define HTD_HTD_DENSEVERTEXMAP_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/Vertex.hpp>
+
+#include <deque>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Associative container mapping vertices to values.
+     *
+     *  Vertex identifiers are allocated densely and never re-used, hence the values are stored in a single
+     *  sequence indexed by the vertex identifier. Removed entries are kept as tombstones so that a lookup is
+     *  a plain index computation. The sequence only grows at its end, so references to stored values remain
+     *  valid until the respective vertex is removed.
+     */
+    template <typename T>
+    class DenseVertexMap
+    {
+        public:
+            /**
+             *  The value type of the map.
+             */
+            typedef T mapped_type;
+
+            /**
+             *  Constructor of a new, empty map.
+             */
+            DenseVertexMap(void) : values_(), occupied_(), size_(0)
+            {
+
+            }
+
+            /**
+             *  Getter for the number of vertices stored in the map.
+             *
+             *  @return The number of vertices stored in the map.
+             */
+            std::size_t size(void) const HTD_NOEXCEPT
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the map is empty.
+             *
+             *  @return True if the map is empty, false otherwise.
+             */
+            bool empty(void) const HTD_NOEXCEPT
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Check whether a value is stored for the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return True if a value is stored for the given vertex, false otherwise.
+             */
+            bool contains(htd::vertex_t vertex) const HTD_NOEXCEPT
+            {
+                return vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < occupied_.size() && occupied_[vertex - htd::Vertex::FIRST];
+            }
+
+            /**
+             *  Get the number of values stored for the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return 1 if a value is stored for the given vertex, 0 otherwise.
+             */
+            std::size_t count(htd::vertex_t vertex) const HTD_NOEXCEPT
+            {
+                return contains(vertex) ? 1 : 0;
+            }
+
+            /**
+             *  Access the value stored for the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The value stored for the given vertex.
+             *
+             *  @throws std::out_of_range If no value is stored for the given vertex.
+             */
+            T & at(htd::vertex_t vertex)
+            {
+                if (!contains(vertex))
+                {
+                    throw std::out_of_range("T & htd::DenseVertexMap<T>::at(htd::vertex_t)");
+                }
+
+                return values_[vertex - htd::Vertex::FIRST];
+            }
+
+            /**
+             *  Access the value stored for the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The value stored for the given vertex.
+             *
+             *  @throws std::out_of_range If no value is stored for the given vertex.
+             */
+            const T & at(htd::vertex_t vertex) const
+            {
+                if (!contains(vertex))
+                {
+                    throw std::out_of_range("const T & htd::DenseVertexMap<T>::at(htd::vertex_t) const");
+                }
+
+                return values_[vertex - htd::Vertex::FIRST];
+            }
+
+            /**
+             *  Access the value stored for the given vertex. If no value is stored for the vertex so far, a default-constructed value is inserted.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The value stored for the given vertex.
+             */
+            T & operator[](htd::vertex_t vertex)
+            {
+                HTD_ASSERT(vertex >= htd::Vertex::FIRST)
+
+                htd::index_t index = vertex - htd::Vertex::FIRST;
+
+                if (!contains(vertex))
+                {
+                    allocate(index);
+
+                    occupied_[index] = true;
+
+                    ++size_;
+                }
+
+                return values_[index];
+            }
+
+            /**
+             *  Store a new value for the given vertex. If a value is already stored for the vertex, the map remains unchanged.
+             *
+             *  @param[in] vertex   The vertex.
+             *  @param[in] args     The arguments which shall be used to construct the new value.
+             *
+             *  @return True if the value was inserted, false otherwise.
+             */
+            template <typename ... Args>
+            bool emplace(htd::vertex_t vertex, Args && ... args)
+            {
+                HTD_ASSERT(vertex >= htd::Vertex::FIRST)
+
+                if (contains(vertex))
+                {
+                    return false;
+                }
+
+                htd::index_t index = vertex - htd::Vertex::FIRST;
+
+                allocate(index);
+
+                values_[index] = T(std::forward<Args>(args)...);
+
+                occupied_[index] = true;
+
+                ++size_;
+
+                return true;
+            }
+
+            /**
+             *  Remove the value stored for the given vertex.
+             *
+             *  @param[in] vertex   The vertex.
+             *
+             *  @return The number of removed values.
+             */
+            std::size_t erase(htd::vertex_t vertex)
+            {
+                if (!contains(vertex))
+                {
+                    return 0;
+                }
+
+                htd::index_t index = vertex - htd::Vertex::FIRST;
+
+                values_[index] = T();
+
+                occupied_[index] = false;
+
+                --size_;
+
+                return 1;
+            }
+
+            /**
+             *  Reserve storage for all vertices less than the given bound.
+             *
+             *  @param[in] bound    The exclusive upper bound of the vertex identifiers for which storage shall be reserved.
+             */
+            void reserve(htd::vertex_t bound)
+            {
+                if (bound > htd::Vertex::FIRST)
+                {
+                    occupied_.reserve(bound - htd::Vertex::FIRST);
+                }
+            }
+
+            /**
+             *  Remove all values from the map.
+             */
+            void clear(void)
+            {
+                values_.clear();
+
+                occupied_.clear();
+
+                size_ = 0;
+            }
+
+            /**
+             *  Swap the content of the map with the content of another map.
+             *
+             *  @param[in] other    The other map.
+             */
+            void swap(DenseVertexMap<T> & other) HTD_NOEXCEPT
+            {
+                values_.swap(other.values_);
+
+                occupied_.swap(other.occupied_);
+
+                std::swap(size_, other.size_);
+            }
+
+        private:
+            /**
+             *  The values stored in the map, indexed by the vertex identifier.
+             */
+            std::deque<T> values_;
+
+            /**
+             *  The information whether a value is stored for the vertex corresponding to the respective position.
+             */
+            std::vector<bool> occupied_;
+
+            /**
+             *  The number of vertices stored in the map.
+             */
+            std::size_t size_;
+
+            /**
+             *  Ensure that the storage is large enough for the given position.
+             *
+             *  @param[in] index    The position which shall be accessible.
+             */
+            void allocate(htd::index_t index)
+            {
+                if (index >= values_.size())
+                {
+                    values_.resize(index + 1);
+
+                    occupied_.resize(index + 1, false);
+                }
+            }
+    };
+}
+
+#endif /* HTD_HTD_DENSEVERTEXMAP_HPP */
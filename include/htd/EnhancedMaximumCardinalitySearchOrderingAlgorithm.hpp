@@ -28,10 +28,16 @@
 #include <htd/Globals.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
      *  Implementation of the IOrderingAlgorithm interface based on the MCS-M elimination ordering algorithm.
+     *
+     *  The vertex elimination orderings computed by this algorithm are minimal, i.e., the triangulation induced by
+     *  them does not contain a proper subset of fill edges which also yields a triangulation of the input graph.
      */
     class EnhancedMaximumCardinalitySearchOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
     {
@@ -49,6 +55,19 @@ namespace htd
 
             HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            /**
+             *  Compute a vertex elimination ordering and the fill edges of the minimal triangulation induced by it.
+             *
+             *  @param[in] graph                The input graph.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[out] fillEdges           The vector to which the fill edges shall be appended. The fill edges refer to the remaining vertices of the preprocessed graph, use their actual identifiers and the smaller endpoint is stored first.
+             *
+             *  @return The vertex elimination ordering computed for the given graph.
+             */
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges) const HTD_NOEXCEPT;
+
+            HTD_API bool supportsComponentOrdering(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
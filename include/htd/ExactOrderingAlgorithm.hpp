@@ -0,0 +1,155 @@
+/* 
+ * File:   ExactOrderingAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_EXACTORDERINGALGORITHM_HPP
+#define HTD_HTD_EXACTORDERINGALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IOrderingAlgorithm.hpp>
+
+namespace htd
+{
+    /**
+     *  Implementation of the IOrderingAlgorithm interface which computes a vertex elimination ordering of minimum width.
+     *
+     *  Each connected component of the preprocessed graph is handled separately. Starting from the width of the min-fill
+     *  ordering restricted to the component, the algorithm repeatedly decides whether the component admits an elimination
+     *  ordering of width at most one less than the best known width. The decision is made by a positive-instance-driven
+     *  search which represents vertex sets by bitsets and combines feasible connected vertex sets, i.e., sets with a small
+     *  neighborhood that can be eliminated within the bound, largest-first into larger ones. A refuted bound proves the
+     *  optimality of the best known ordering. Components which fit into a bag of the lower bound for the treewidth are not
+     *  searched at all.
+     *
+     *  Components which are larger than the maximum component size are handled by the min-fill heuristic and searches
+     *  which exceed the search limit or the memory limit return the best ordering found so far. In these cases, the
+     *  width of the returned ordering is not guaranteed to be optimal.
+     */
+    class ExactOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new ordering algorithm of type ExactOrderingAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API ExactOrderingAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a htd::ExactOrderingAlgorithm object.
+             *
+             *  @param[in] original The original htd::ExactOrderingAlgorithm object.
+             */
+            HTD_API ExactOrderingAlgorithm(const htd::ExactOrderingAlgorithm & original);
+
+            HTD_API virtual ~ExactOrderingAlgorithm();
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            /**
+             *  Compute a vertex ordering of the given graph and report whether its width is proven to be optimal.
+             *
+             *  @param[in] graph                The input graph.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[out] optimal             A boolean flag which is set to true if and only if the width of the returned ordering is the treewidth of the input graph.
+             *
+             *  @return The vertex elimination ordering of the given graph.
+             */
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, bool & optimal) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for the maximum number of vertices of a connected component for which an optimal ordering is computed.
+             *
+             *  @return The maximum number of vertices of a connected component for which an optimal ordering is computed.
+             */
+            HTD_API std::size_t maximumComponentSize(void) const;
+
+            /**
+             *  Set the maximum number of vertices of a connected component for which an optimal ordering is computed.
+             *
+             *  @param[in] maximumComponentSize The maximum number of vertices of a connected component for which an optimal ordering is computed.
+             */
+            HTD_API void setMaximumComponentSize(std::size_t maximumComponentSize);
+
+            /**
+             *  Getter for the maximum number of combinations of feasible sets which are tested per connected component.
+             *
+             *  @return The maximum number of combinations of feasible sets which are tested per connected component.
+             */
+            HTD_API std::size_t searchLimit(void) const;
+
+            /**
+             *  Set the maximum number of combinations of feasible sets which are tested per connected component.
+             *
+             *  @param[in] searchLimit  The maximum number of combinations of feasible sets which are tested per connected component.
+             */
+            HTD_API void setSearchLimit(std::size_t searchLimit);
+
+            /**
+             *  Getter for the maximum number of bytes which are used for the feasible sets and partial blocks of a connected component.
+             *
+             *  @return The maximum number of bytes which are used for the feasible sets and partial blocks of a connected component.
+             */
+            HTD_API std::size_t memoryLimit(void) const;
+
+            /**
+             *  Set the maximum number of bytes which are used for the feasible sets and partial blocks of a connected component.
+             *
+             *  @param[in] memoryLimit  The maximum number of bytes which are used for the feasible sets and partial blocks of a connected component.
+             *
+             *  @note The memory usage is estimated from the number of stored vertex sets, hence the actual memory usage may deviate slightly.
+             */
+            HTD_API void setMemoryLimit(std::size_t memoryLimit);
+
+            HTD_API bool supportsComponentOrdering(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API ExactOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
+#else
+            HTD_API ExactOrderingAlgorithm * clone(void) const;
+
+            HTD_API htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE;
+#endif
+
+        protected:
+            /**
+             *  Copy assignment operator for an ordering algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            ExactOrderingAlgorithm & operator=(const ExactOrderingAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_EXACTORDERINGALGORITHM_HPP */
@@ -0,0 +1,205 @@
+/* 
+ * File:   ExactTreeDecompositionAlgorithm.hpp
+ * 
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_EXACTTREEDECOMPOSITIONALGORITHM_HPP
+#define HTD_HTD_EXACTTREEDECOMPOSITIONALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/ITreeDecompositionAlgorithm.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+
+#include <utility>
+
+namespace htd
+{
+    /**
+     *  Implementation of the ITreeDecompositionAlgorithm interface which computes a tree decomposition of minimum width.
+     *
+     *  The decomposition is based on a vertex elimination ordering computed by htd::ExactOrderingAlgorithm. The algorithm
+     *  is intended for (preprocessed) graphs whose connected components are small. If the optimality of the ordering
+     *  cannot be proven, because a connected component exceeds the maximum component size or the search limit or the
+     *  memory limit is reached, the return value of computeDecomposition() is nullptr.
+     */
+    class ExactTreeDecompositionAlgorithm : public htd::ITreeDecompositionAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a exact tree decomposition algorithm.
+             *
+             *  @param[in] manager  The management instance to which the new algorithm belongs.
+             */
+            HTD_API ExactTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Constructor for a exact tree decomposition algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @param[in] manager                  The management instance to which the new algorithm belongs.
+             *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
+             */
+            HTD_API ExactTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations);
+
+            /**
+             *  Copy constructor for a htd::ExactTreeDecompositionAlgorithm object.
+             *
+             *  @param[in] original The original htd::ExactTreeDecompositionAlgorithm object.
+             */
+            HTD_API ExactTreeDecompositionAlgorithm(const htd::ExactTreeDecompositionAlgorithm & original);
+
+            HTD_API virtual ~ExactTreeDecompositionAlgorithm();
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph) const HTD_OVERRIDE;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const HTD_OVERRIDE;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_OVERRIDE;
+
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const HTD_OVERRIDE;
+
+            /**
+             *  Compute a decomposition of the given graph and apply the given manipulation operations to it. The manipulation operations are applied in the given order.
+             *
+             *  @param[in] graph                        The input graph to decompose.
+             *  @param[in] preprocessedGraph            The input graph in preprocessed format.
+             *  @param[in] manipulationOperationCount   The number of manipulation operations which are provided to this function.
+             *
+             *  @note The manipulation operations provided to this function are applied right after the manipulation operations defined globally for the algorithm.
+             *
+             *  @note When calling this method the control over the memory regions of the manipulation operations is transferred to the
+             *  decomposition algorithm. Deleting a manipulation operation provided to this method outside the decomposition algorithm
+             *  or assigning the same manipulation operation multiple times will lead to undefined behavior.
+             *
+             *  @return A new ITreeDecomposition object representing the decomposition of the given graph.
+             */
+            HTD_API htd::ITreeDecomposition * computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const;
+
+            HTD_API void setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) HTD_OVERRIDE;
+
+            HTD_API void addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation) HTD_OVERRIDE;
+
+            HTD_API void addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) HTD_OVERRIDE;
+
+            HTD_API bool isSafelyInterruptible(void) const HTD_OVERRIDE;
+
+            HTD_API bool isComputeInducedEdgesEnabled(void) const HTD_OVERRIDE;
+
+            HTD_API void setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled) HTD_OVERRIDE;
+
+            /**
+             *  Check whether the computed decompositions shall contain only subset-maximal bags.
+             *
+             *  @return A boolean flag indicating whether the computed decompositions shall contain only subset-maximal bags.
+             */
+            HTD_API bool isCompressionEnabled(void) const;
+
+            /**
+             *  Set whether the computed decompositions shall contain only subset-maximal bags.
+             *
+             *  @param[in] compressionEnabled   A boolean flag indicating whether the computed decompositions shall contain only subset-maximal bags.
+             */
+            HTD_API void setCompressionEnabled(bool compressionEnabled);
+
+            /**
+             *  Getter for the maximum number of vertices of a connected component of the preprocessed graph for which the algorithm computes a decomposition.
+             *
+             *  @return The maximum number of vertices of a connected component of the preprocessed graph for which the algorithm computes a decomposition.
+             */
+            HTD_API std::size_t maximumComponentSize(void) const;
+
+            /**
+             *  Set the maximum number of vertices of a connected component of the preprocessed graph for which the algorithm computes a decomposition.
+             *
+             *  @param[in] maximumComponentSize The maximum number of vertices of a connected component of the preprocessed graph for which the algorithm computes a decomposition.
+             */
+            HTD_API void setMaximumComponentSize(std::size_t maximumComponentSize);
+
+            /**
+             *  Getter for the maximum number of search nodes which are visited per connected component.
+             *
+             *  @return The maximum number of search nodes which are visited per connected component.
+             */
+            HTD_API std::size_t searchLimit(void) const;
+
+            /**
+             *  Set the maximum number of search nodes which are visited per connected component.
+             *
+             *  @param[in] searchLimit  The maximum number of search nodes which are visited per connected component.
+             */
+            HTD_API void setSearchLimit(std::size_t searchLimit);
+
+            /**
+             *  Getter for the maximum number of bytes which are used by the search per connected component.
+             *
+             *  @return The maximum number of bytes which are used by the search per connected component.
+             */
+            HTD_API std::size_t memoryLimit(void) const;
+
+            /**
+             *  Set the maximum number of bytes which are used by the search per connected component.
+             *
+             *  @param[in] memoryLimit  The maximum number of bytes which are used by the search per connected component.
+             */
+            HTD_API void setMemoryLimit(std::size_t memoryLimit);
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            HTD_API ExactTreeDecompositionAlgorithm * clone(void) const HTD_OVERRIDE;
+
+        protected:
+            /**
+             *  Copy assignment operator for a exact tree decomposition algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            ExactTreeDecompositionAlgorithm & operator=(const ExactTreeDecompositionAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_EXACTTREEDECOMPOSITIONALGORITHM_HPP */
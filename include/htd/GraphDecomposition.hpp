@@ -26,12 +26,12 @@
 #define HTD_HTD_GRAPHDECOMPOSITION_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/BagArena.hpp>
+#include <htd/DenseVertexMap.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/IMutableGraphDecomposition.hpp>
 #include <htd/LabeledMultiHypergraph.hpp>
 
-#include <unordered_map>
-
 MSVC_PRAGMA_WARNING_PUSH
 MSVC_PRAGMA_DISABLE_WARNING_C4250
 
@@ -94,7 +94,11 @@ namespace htd
 
             HTD_API std::vector<htd::vertex_t> & mutableBagContent(htd::vertex_t vertex) HTD_OVERRIDE;
 
-            HTD_API const std::vector<htd::vertex_t> & bagContent(htd::vertex_t vertex) const HTD_OVERRIDE;
+            HTD_API void setBagContent(htd::vertex_t vertex, const std::vector<htd::vertex_t> & content) HTD_OVERRIDE;
+
+            HTD_API void setBagContent(htd::vertex_t vertex, const htd::Bag & content) HTD_OVERRIDE;
+
+            HTD_API const htd::Bag & bagContent(htd::vertex_t vertex) const HTD_OVERRIDE;
 
             HTD_API htd::FilteredHyperedgeCollection & mutableInducedHyperedges(htd::vertex_t vertex) HTD_OVERRIDE;
 
@@ -150,9 +154,9 @@ namespace htd
 #endif
 
         private:
-            std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> bagContent_;
+            htd::BagArena bagContent_;
 
-            std::unordered_map<htd::vertex_t, htd::FilteredHyperedgeCollection> inducedEdges_;
+            htd::DenseVertexMap<htd::FilteredHyperedgeCollection> inducedEdges_;
     };
 }
 
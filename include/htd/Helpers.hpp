@@ -26,6 +26,8 @@
 #define HTD_HTD_HELPERS_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/Bag.hpp>
+#include <htd/VertexSpan.hpp>
 #include <htd/Hyperedge.hpp>
 #include <htd/Collection.hpp>
 #include <htd/ConstCollection.hpp>
@@ -34,11 +36,14 @@
 #include <htd/FilteredHyperedgeCollection.hpp>
 #include <htd/LibraryInstance.hpp>
 #include <htd/ITreeDecomposition.hpp>
+#include <htd/RandomNumberGenerator.hpp>
+#include <htd/SetKernels.hpp>
 
 #include <algorithm>
 #include <cassert>
 #include <functional>
 #include <chrono>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <map>
@@ -154,6 +159,26 @@ namespace htd
     {
         print(input, std::cout, sorted);
     }
+
+    inline void print(const htd::Bag & input, std::ostream & stream, bool sorted = false)
+    {
+        print(std::vector<htd::vertex_t>(input.begin(), input.end()), stream, sorted);
+    }
+
+    inline void print(const htd::Bag & input, bool sorted = false)
+    {
+        print(input, std::cout, sorted);
+    }
+
+    inline void print(const htd::VertexSpan & input, std::ostream & stream, bool sorted = false)
+    {
+        print(input.toVector(), stream, sorted);
+    }
+
+    inline void print(const htd::VertexSpan & input, bool sorted = false)
+    {
+        print(input, std::cout, sorted);
+    }
     
     template < typename T >
     void print(const std::set<T> & input, std::ostream & stream)
@@ -325,7 +350,37 @@ namespace htd
         }
     }
 
+    /**
+     *  Select a random element of a non-empty collection.
+     *
+     *  @param[in] collection   The collection.
+     *  @param[in] generator    The random number generator which shall be used.
+     *
+     *  @return A reference to the selected element.
+     */
+    template < typename T, typename Collection >
+    const T & selectRandomElement(const Collection & collection, htd::RandomNumberGenerator & generator)
+    {
+        auto position = collection.begin();
+
+        std::advance(position, generator.nextIndex(collection.size()));
+
+        return *position;
+    }
+
+    /**
+     *  Select a random element of a non-empty collection using std::rand().
+     *
+     *  @deprecated The selection does not depend on the seed of the management instance and std::rand() is not
+     *  thread-safe. Use the overload taking the random number generator of the management instance instead, see
+     *  htd::LibraryInstance::randomNumberGenerator().
+     *
+     *  @param[in] collection   The collection.
+     *
+     *  @return A reference to the selected element.
+     */
     template < typename T, typename Collection >
+    HTD_DEPRECATED_MSG("Use htd::selectRandomElement(collection, generator) instead.")
     const T & selectRandomElement(const Collection & collection)
     {
         auto position = collection.begin();
@@ -374,8 +429,37 @@ namespace htd
                                   const std::vector<htd::vertex_t> & set2,
                                   std::vector<htd::vertex_t> & result);
 
+    /**
+     *  Compute the number of vertices only in the first set, the number of vertices in both sets and the number of vertices only in the second set.
+     *
+     *  @param[in] set1 The first set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] set2 The second set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *
+     *  @return A tuple containing the number of vertices only in the first set, the number of vertices in both sets and the number of vertices only in the second set.
+     */
     HTD_API std::tuple<std::size_t, std::size_t, std::size_t> analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2);
 
+    /**
+     *  Compute the number of vertices only in the first set, the number of vertices in both sets and the number of vertices only in the second set.
+     *
+     *  This overload accepts any combination of bags and vectors.
+     *
+     *  @param[in] set1 The first set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] set2 The second set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *
+     *  @return A tuple containing the number of vertices only in the first set, the number of vertices in both sets and the number of vertices only in the second set.
+     */
+    template <typename Set1, typename Set2>
+    std::tuple<std::size_t, std::size_t, std::size_t> analyze_sets(const Set1 & set1, const Set2 & set2)
+    {
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(set1.begin(), set1.end()))
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(set2.begin(), set2.end()))
+
+        std::size_t overlap = htd::set_intersection_size(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size());
+
+        return std::tuple<std::size_t, std::size_t, std::size_t>(set1.size() - overlap, overlap, set2.size() - overlap);
+    }
+
     /**
      *  Decompose two sets of vertices into vertices only in the first set, vertices only in the second set and vertices in both sets.
      *
@@ -391,12 +475,80 @@ namespace htd
                         std::vector<htd::vertex_t> & resultOnlySet2,
                         std::vector<htd::vertex_t> & resultIntersection) HTD_NOEXCEPT;
 
+    /**
+     *  Compute the number of vertices only in the first set and the number of vertices only in the second set.
+     *
+     *  @param[in] set1 The first set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] set2 The second set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *
+     *  @return A pair containing the number of vertices only in the first set and the number of vertices only in the second set.
+     */
     HTD_API std::pair<std::size_t, std::size_t> symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2);
 
+    /**
+     *  Compute the number of vertices only in the first set and the number of vertices only in the second set.
+     *
+     *  This overload accepts any combination of bags and vectors.
+     *
+     *  @param[in] set1 The first set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] set2 The second set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *
+     *  @return A pair containing the number of vertices only in the first set and the number of vertices only in the second set.
+     */
+    template <typename Set1, typename Set2>
+    std::pair<std::size_t, std::size_t> symmetric_difference_sizes(const Set1 & set1, const Set2 & set2)
+    {
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(set1.begin(), set1.end()))
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(set2.begin(), set2.end()))
+
+        std::size_t overlap = htd::set_intersection_size(set1.data(), set1.data() + set1.size(), set2.data(), set2.data() + set2.size());
+
+        return std::pair<std::size_t, std::size_t>(set1.size() - overlap, set2.size() - overlap);
+    }
+
+    /**
+     *  Count the number of bits which are set in a given word.
+     *
+     *  @param[in] word The word.
+     *
+     *  @return The number of bits which are set in the given word.
+     */
+    inline std::size_t popcount(std::uint64_t word) HTD_NOEXCEPT
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+        return static_cast<std::size_t>((word * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    /**
+     *  Compute the position of the least significant bit which is set in a given word.
+     *
+     *  @param[in] word The word. The word must not be 0.
+     *
+     *  @return The position of the least significant bit which is set in the given word.
+     */
+    inline std::size_t countTrailingZeros(std::uint64_t word) HTD_NOEXCEPT
+    {
+        HTD_ASSERT(word != 0)
+
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+        return htd::popcount((word & (0 - word)) - 1);
+#endif
+    }
+
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_union_size(InputIterator1 first1, InputIterator1 last1,
-                               InputIterator2 first2, InputIterator2 last2)
+                               InputIterator2 first2, InputIterator2 last2,
+                               std::false_type)
     {
         std::size_t ret = 0;
         
@@ -430,11 +582,50 @@ namespace htd
         
         return ret + std::distance(first2, last2);
     }
+
+    /**
+     *  Compute the size of the union of two sets of vertices using the vectorized set kernels.
+     *
+     *  @note The kernels count a vertex which occurs repeatedly in one of the sets several times, hence both sets must be free of duplicates.
+     *
+     *  @param[in] first1   An iterator to the begin of the first set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last1    An iterator to the end of the first set of vertices.
+     *  @param[in] first2   An iterator to the begin of the second set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last2    An iterator to the end of the second set of vertices.
+     *
+     *  @return The size of the union of both sets.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_union_size(InputIterator1 first1, InputIterator1 last1,
+                               InputIterator2 first2, InputIterator2 last2,
+                               std::true_type)
+    {
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(first1, last1))
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(first2, last2))
+
+        std::size_t size1 = std::distance(first1, last1);
+        std::size_t size2 = std::distance(first2, last2);
+
+        const htd::vertex_t * begin1 = htd::vertex_pointer(first1, last1);
+        const htd::vertex_t * begin2 = htd::vertex_pointer(first2, last2);
+
+        return size1 + size2 - htd::set_intersection_size(begin1, begin1 + size1, begin2, begin2 + size2);
+    }
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_union_size(InputIterator1 first1, InputIterator1 last1,
+                               InputIterator2 first2, InputIterator2 last2)
+    {
+        return set_union_size(first1, last1, first2, last2, typename htd::is_vertex_pointer_iterator_pair<InputIterator1, InputIterator2>::type());
+    }
     
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
-                                    InputIterator2 first2, InputIterator2 last2)
+                                    InputIterator2 first2, InputIterator2 last2,
+                                    std::false_type)
     {
         std::size_t ret = 0;
 
@@ -460,10 +651,49 @@ namespace htd
         return ret + std::distance(first1, last1);
     }
 
+    /**
+     *  Compute the number of vertices of the first set which are not contained in the second set using the vectorized set kernels.
+     *
+     *  @note The kernels count a vertex which occurs repeatedly in one of the sets several times, hence both sets must be free of duplicates.
+     *
+     *  @param[in] first1   An iterator to the begin of the first set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last1    An iterator to the end of the first set of vertices.
+     *  @param[in] first2   An iterator to the begin of the second set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last2    An iterator to the end of the second set of vertices.
+     *
+     *  @return The number of vertices of the first set which are not contained in the second set.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2,
+                                    std::true_type)
+    {
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(first1, last1))
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(first2, last2))
+
+        std::size_t size1 = std::distance(first1, last1);
+        std::size_t size2 = std::distance(first2, last2);
+
+        const htd::vertex_t * begin1 = htd::vertex_pointer(first1, last1);
+        const htd::vertex_t * begin2 = htd::vertex_pointer(first2, last2);
+
+        return size1 - htd::set_intersection_size(begin1, begin1 + size1, begin2, begin2 + size2);
+    }
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_difference_size(InputIterator1 first1, InputIterator1 last1,
+                                    InputIterator2 first2, InputIterator2 last2)
+    {
+        return set_difference_size(first1, last1, first2, last2, typename htd::is_vertex_pointer_iterator_pair<InputIterator1, InputIterator2>::type());
+    }
+
     template < class InputIterator1,
                class InputIterator2 >
     std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
-                                      InputIterator2 first2, InputIterator2 last2)
+                                      InputIterator2 first2, InputIterator2 last2,
+                                      std::false_type)
     {
         std::size_t ret = 0;
 
@@ -489,6 +719,41 @@ namespace htd
         return ret;
     }
 
+    /**
+     *  Compute the size of the intersection of two sets of vertices using the vectorized set kernels.
+     *
+     *  @note The kernels count a vertex which occurs repeatedly in one of the sets several times, hence both sets must be free of duplicates.
+     *
+     *  @param[in] first1   An iterator to the begin of the first set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last1    An iterator to the end of the first set of vertices.
+     *  @param[in] first2   An iterator to the begin of the second set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last2    An iterator to the end of the second set of vertices.
+     *
+     *  @return The size of the intersection of both sets.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
+                                      InputIterator2 first2, InputIterator2 last2,
+                                      std::true_type)
+    {
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(first1, last1))
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(first2, last2))
+
+        const htd::vertex_t * begin1 = htd::vertex_pointer(first1, last1);
+        const htd::vertex_t * begin2 = htd::vertex_pointer(first2, last2);
+
+        return htd::set_intersection_size(begin1, begin1 + std::distance(first1, last1), begin2, begin2 + std::distance(first2, last2));
+    }
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    std::size_t set_intersection_size(InputIterator1 first1, InputIterator1 last1,
+                                      InputIterator2 first2, InputIterator2 last2)
+    {
+        return set_intersection_size(first1, last1, first2, last2, typename htd::is_vertex_pointer_iterator_pair<InputIterator1, InputIterator2>::type());
+    }
+
     template < class InputIterator1,
                class InputIterator2 >
     bool has_non_empty_set_difference(InputIterator1 first1, InputIterator1 last1,
@@ -521,7 +786,8 @@ namespace htd
     template < class InputIterator1,
                class InputIterator2 >
     bool has_non_empty_set_intersection(InputIterator1 first1, InputIterator1 last1,
-                                        InputIterator2 first2, InputIterator2 last2)
+                                        InputIterator2 first2, InputIterator2 last2,
+                                        std::false_type)
     {
         bool ret = false;
 
@@ -547,6 +813,41 @@ namespace htd
         return ret;
     }
 
+    /**
+     *  Check whether two sets of vertices have at least one vertex in common using the vectorized set kernels.
+     *
+     *  @note The kernels count a vertex which occurs repeatedly in one of the sets several times, hence both sets must be free of duplicates.
+     *
+     *  @param[in] first1   An iterator to the begin of the first set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last1    An iterator to the end of the first set of vertices.
+     *  @param[in] first2   An iterator to the begin of the second set of vertices. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last2    An iterator to the end of the second set of vertices.
+     *
+     *  @return True if both sets have at least one vertex in common, false otherwise.
+     */
+    template < class InputIterator1,
+               class InputIterator2 >
+    bool has_non_empty_set_intersection(InputIterator1 first1, InputIterator1 last1,
+                                        InputIterator2 first2, InputIterator2 last2,
+                                        std::true_type)
+    {
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(first1, last1))
+        HTD_ASSERT(htd::is_sorted_and_duplicate_free(first2, last2))
+
+        const htd::vertex_t * begin1 = htd::vertex_pointer(first1, last1);
+        const htd::vertex_t * begin2 = htd::vertex_pointer(first2, last2);
+
+        return htd::has_non_empty_set_intersection(begin1, begin1 + std::distance(first1, last1), begin2, begin2 + std::distance(first2, last2));
+    }
+
+    template < class InputIterator1,
+               class InputIterator2 >
+    bool has_non_empty_set_intersection(InputIterator1 first1, InputIterator1 last1,
+                                        InputIterator2 first2, InputIterator2 last2)
+    {
+        return has_non_empty_set_intersection(first1, last1, first2, last2, typename htd::is_vertex_pointer_iterator_pair<InputIterator1, InputIterator2>::type());
+    }
+
     template < typename T >
     void inplace_merge(std::vector<T> & set1, const std::vector<T> & set2)
     {
@@ -554,7 +855,7 @@ namespace htd
         {
             auto it = set1.begin();
 
-            for (htd::vertex_t newElement : set2)
+            for (const T & newElement : set2)
             {
                 it = set1.insert(std::lower_bound(it, set1.end(), newElement), newElement) + 1;
             }
@@ -585,6 +886,19 @@ namespace htd
         }
     }
 
+    inline void inplace_set_union(std::vector<htd::vertex_t> & set1, const htd::VertexSpan & set2)
+    {
+        std::vector<htd::vertex_t> tmp;
+        tmp.reserve(set2.size());
+
+        std::set_difference(set2.begin(), set2.end(), set1.begin(), set1.end(), std::back_inserter(tmp));
+
+        if (!tmp.empty())
+        {
+            htd::inplace_merge(set1, tmp);
+        }
+    }
+
     /**
      *  Getter for the position of a hyperedge within a collection of hyperedges sorted by ID in ascending order.
      *
@@ -763,6 +1077,41 @@ namespace htd
      *  @return The collection of all vertices which are present in at least two child bags. The result is sorted in ascending order.
      */
     HTD_API std::vector<htd::vertex_t> * computeJoinVertices(const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex);
+
+    /**
+     *  Process the indices 0, ..., count - 1 using up to the given number of threads.
+     *
+     *  The indices are split into chunks of consecutive indices which are handed out to the threads on demand, so
+     *  that the load is balanced even if the work per index varies considerably. The calling thread takes part in
+     *  the computation and the function returns after all indices have been processed.
+     *
+     *  @note The function is invoked concurrently, hence it must only write to locations which are owned by the
+     *  indices it is called for.
+     *
+     *  If the function throws an exception, the remaining chunks are skipped and the first exception is rethrown on
+     *  the calling thread after all threads have finished.
+     *
+     *  @param[in] count        The number of indices which shall be processed.
+     *  @param[in] threadCount  The maximum number of threads which shall be used.
+     *  @param[in] function     The function processing the indices in the half-open range [first, last) given as its arguments.
+     */
+    HTD_API void parallelFor(std::size_t count, std::size_t threadCount, const std::function<void(std::size_t, std::size_t)> & function);
+
+    /**
+     *  Invoke the given function once per thread using up to the given number of threads.
+     *
+     *  The calling thread takes part in the computation as the thread with index 0 and the function returns after
+     *  all invocations have finished. Calls of htd::parallelFor() and htd::parallelInvoke() issued by one of the
+     *  invocations are executed by the respective thread alone, so that nested parallelism does not multiply the
+     *  number of threads. In particular, when called from within another parallel region, the function is invoked
+     *  only once with thread index 0, hence it must distribute its work dynamically among the threads. If one of the
+     *  invocations throws an exception, the first exception is rethrown on the calling thread after all invocations
+     *  have finished.
+     *
+     *  @param[in] threadCount  The maximum number of threads which shall be used.
+     *  @param[in] function     The function which shall be invoked, taking the index of the thread as its argument.
+     */
+    HTD_API void parallelInvoke(std::size_t threadCount, const std::function<void(std::size_t)> & function);
 }
 
 namespace std
@@ -785,6 +1134,13 @@ namespace std
 
     std::ostream & operator<<(std::ostream & stream, const htd::FilteredHyperedgeCollection & input);
 
+    inline std::ostream & operator<<(std::ostream & stream, const htd::VertexSpan & input)
+    {
+        htd::print(input, stream);
+
+        return stream;
+    }
+
     /**
      *  Combine the given seed with the hash code of the given input.
      *
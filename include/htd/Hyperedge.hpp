@@ -27,14 +27,20 @@
 
 #include <htd/Globals.hpp>
 #include <htd/ConstCollection.hpp>
+#include <htd/VertexSpan.hpp>
 
+#include <cstdint>
 #include <vector>
-#include <memory>
 
 namespace htd
 {
     /**
      *  Class for the efficient storage of hyperedges.
+     *
+     *  The endpoints and their sorted representation share one buffer. Hyperedges whose buffer needs at most
+     *  INLINE_CAPACITY vertices, in particular all binary hyperedges, store it inline without any heap
+     *  allocation. The spans returned by elements() and sortedElements() are invalidated by every modification
+     *  of the hyperedge and by moving the hyperedge.
      */
     class Hyperedge
     {
@@ -168,16 +174,16 @@ namespace htd
             /**
              *  Getter for the elements of the hyperedge.
              *
-             *  @return The elements of the hyperedge.
+             *  @return A view on the elements of the hyperedge.
              */
-            HTD_API const std::vector<htd::vertex_t> & elements(void) const HTD_NOEXCEPT;
+            HTD_API htd::VertexSpan elements(void) const HTD_NOEXCEPT;
 
             /**
              *  Getter for the elements of the hyperedge in ascending order without duplicates.
              *
-             *  @return The elements of the hyperedge in ascending order without duplicates.
+             *  @return A view on the elements of the hyperedge in ascending order without duplicates.
              */
-            HTD_API const std::vector<htd::vertex_t> & sortedElements(void) const HTD_NOEXCEPT;
+            HTD_API htd::VertexSpan sortedElements(void) const HTD_NOEXCEPT;
 
             /**
              *  Check whether the hyperedge contains no elements.
@@ -214,14 +220,14 @@ namespace htd
              *
              *  @return A const_iterator pointing to the first element in the hyperedge.
              */
-            HTD_API std::vector<htd::vertex_t>::const_iterator begin(void) const HTD_NOEXCEPT;
+            HTD_API htd::VertexSpan::const_iterator begin(void) const HTD_NOEXCEPT;
 
             /**
              *  Getter for a const_iterator pointing to the end of the elements in the hyperedge.
              *
              *  @return A const_iterator pointing to the end of the elements in the hyperedge.
              */
-            HTD_API std::vector<htd::vertex_t>::const_iterator end(void) const HTD_NOEXCEPT;
+            HTD_API htd::VertexSpan::const_iterator end(void) const HTD_NOEXCEPT;
 
             /**
              *  Access the element at the specific position within the hyperedge.
@@ -314,14 +320,85 @@ namespace htd
             HTD_API bool operator!=(const std::vector<htd::vertex_t> & rhs) const;
 
             /**
-             *  Forward declaration of internal class for storing the element information of a hyperedge.
+             *  The maximum number of vertices which a hyperedge stores without allocating heap memory.
              */
-            class IElementInformation;
+            static constexpr std::size_t INLINE_CAPACITY = 4;
 
         private:
+            /**
+             *  The ID of the hyperedge.
+             */
             htd::id_t id_;
 
-            std::unique_ptr<IElementInformation> content_;
+            /**
+             *  The number of endpoints of the hyperedge.
+             */
+            std::uint32_t size_;
+
+            /**
+             *  The number of endpoints of the hyperedge without duplicates.
+             */
+            std::uint32_t sortedSize_;
+
+            /**
+             *  A boolean flag indicating whether the endpoints are sorted in ascending order and free of duplicates.
+             */
+            bool sorted_;
+
+            /**
+             *  The buffer holding the endpoints in the order in which they were provided, followed by the
+             *  endpoints in ascending order without duplicates unless the former are already sorted and
+             *  free of duplicates.
+             */
+            union
+            {
+                /**
+                 *  The buffer of a hyperedge whose buffer fits into INLINE_CAPACITY vertices.
+                 */
+                htd::vertex_t inlineContent_[INLINE_CAPACITY];
+
+                /**
+                 *  The heap-allocated buffer of a hyperedge whose buffer exceeds INLINE_CAPACITY vertices.
+                 */
+                htd::vertex_t * content_;
+            };
+
+            /**
+             *  Getter for the number of vertices in the buffer of the hyperedge.
+             *
+             *  @return The number of vertices in the buffer of the hyperedge.
+             */
+            std::size_t bufferSize(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Getter for a pointer to the buffer of the hyperedge.
+             *
+             *  @return A pointer to the buffer of the hyperedge.
+             */
+            const htd::vertex_t * buffer(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Replace the endpoints of the hyperedge.
+             *
+             *  @param[in] elements         The first new endpoint.
+             *  @param[in] size             The number of new endpoints.
+             *  @param[in] sortedElements   The first new endpoint in ascending order without duplicates or nullptr if the new endpoints are sorted and free of duplicates.
+             *  @param[in] sortedSize       The number of new endpoints without duplicates.
+             */
+            void assign(const htd::vertex_t * elements, std::size_t size, const htd::vertex_t * sortedElements, std::size_t sortedSize);
+
+            /**
+             *  Replace the endpoints of the hyperedge and compute their sorted representation.
+             *
+             *  @param[in] elements The first new endpoint.
+             *  @param[in] size     The number of new endpoints.
+             */
+            void assign(const htd::vertex_t * elements, std::size_t size);
+
+            /**
+             *  Release the heap-allocated buffer of the hyperedge, if any, and reset it to an empty hyperedge.
+             */
+            void release(void) HTD_NOEXCEPT;
     };
 }
 
@@ -26,6 +26,7 @@
 #define HTD_HTD_IGRAPHDECOMPOSITION_HPP
 
 #include <htd/Globals.hpp>
+#include <htd/Bag.hpp>
 #include <htd/ILabeledMultiHypergraph.hpp>
 #include <htd/FilteredHyperedgeCollection.hpp>
 
@@ -55,9 +56,9 @@ namespace htd
              *
              *  @param[in] vertex   The vertex for which the bag content shall be returned.
              *
-             *  @return The bag content of the specific vertex.
+             *  @return The bag content of the specific vertex. The returned reference remains valid until the vertex is removed and it always reflects the current bag content.
              */
-            virtual const std::vector<htd::vertex_t> & bagContent(htd::vertex_t vertex) const = 0;
+            virtual const htd::Bag & bagContent(htd::vertex_t vertex) const = 0;
 
             /**
              *  Access the hyperedges induced by the bag content of a specific vertex.
@@ -39,6 +39,13 @@ namespace htd
 {
     /**
      * Interface for classes which represent hypergraphs with potentially duplicated edges.
+     *
+     * Implementations may share their state between copies until one of the copies is modified (copy-on-write). In this
+     * case, the first modification of a graph which shares its state moves the graph to a private copy of the state:
+     * References to vertices and hyperedges obtained from the graph before this modification keep referring to the
+     * shared state, they do not reflect the modification and they remain valid only as long as a copy sharing the state
+     * exists, unless the implementation states otherwise. Modifications of a graph which does not share its state
+     * invalidate references and iterators exactly as documented for the respective member functions.
      */
     class IMultiHypergraph : public virtual htd::IGraphStructure
     {
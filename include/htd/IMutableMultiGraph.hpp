@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/IMultiGraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -90,6 +93,19 @@ namespace htd
              */
             virtual htd::id_t addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) = 0;
 
+            /**
+             *  Add new edges to the multigraph.
+             *
+             *  In contrast to adding the edges one by one, the neighborhoods of the affected vertices are updated only once for the whole collection.
+             *
+             *  @param[in] edges    The endpoints of the new edges.
+             *
+             *  @return The ID of the first edge which was added to the graph. If the number of edges to add is greater than 1,
+             *          the additional edges are numbered in ascending order and without gaps starting from the returned ID + 1.
+             *          If the number of new edges is 0, the returned value is the ID of the last edge added to the graph.
+             */
+            virtual htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) = 0;
+
             /**
              *  Remove an edge from the multi-graph.
              *
@@ -28,6 +28,9 @@
 #include <htd/Globals.hpp>
 #include <htd/IMultiHypergraph.hpp>
 
+#include <utility>
+#include <vector>
+
 namespace htd
 {
     /**
@@ -135,6 +138,45 @@ namespace htd
              */
             virtual htd::id_t addEdge(htd::Hyperedge && hyperedge) = 0;
 
+            /**
+             *  Add new edges to the multi-hypergraph.
+             *
+             *  In contrast to adding the edges one by one, the neighborhoods of the affected vertices are updated only once for the whole collection.
+             *
+             *  @param[in] edges    The endpoints of the new edges.
+             *
+             *  @return The ID of the first edge which was added to the graph. If the number of edges to add is greater than 1,
+             *          the additional edges are numbered in ascending order and without gaps starting from the returned ID + 1.
+             *          If the number of new edges is 0, the returned value is the ID of the last edge added to the graph.
+             */
+            virtual htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) = 0;
+
+            /**
+             *  Add new edges to the multi-hypergraph.
+             *
+             *  In contrast to adding the edges one by one, the neighborhoods of the affected vertices are updated only once for the whole collection.
+             *
+             *  @param[in] edges    The endpoints of the new hyperedges.
+             *
+             *  @return The ID of the first edge which was added to the graph. If the number of edges to add is greater than 1,
+             *          the additional edges are numbered in ascending order and without gaps starting from the returned ID + 1.
+             *          If the number of new edges is 0, the returned value is the ID of the last edge added to the graph.
+             */
+            virtual htd::id_t addEdges(const std::vector<std::vector<htd::vertex_t>> & edges) = 0;
+
+            /**
+             *  Add new edges to the multi-hypergraph.
+             *
+             *  In contrast to adding the edges one by one, the neighborhoods of the affected vertices are updated only once for the whole collection.
+             *
+             *  @param[in] edges    The endpoints of the new hyperedges.
+             *
+             *  @return The ID of the first edge which was added to the graph. If the number of edges to add is greater than 1,
+             *          the additional edges are numbered in ascending order and without gaps starting from the returned ID + 1.
+             *          If the number of new edges is 0, the returned value is the ID of the last edge added to the graph.
+             */
+            virtual htd::id_t addEdges(std::vector<std::vector<htd::vertex_t>> && edges) = 0;
+
             /**
              *  Remove an edge from the multi-hypergraph.
              *
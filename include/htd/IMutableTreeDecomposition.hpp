@@ -125,9 +125,27 @@ namespace htd
              *  @param[in] vertex   The vertex for which the bag content shall be returned.
              *
              *  @return The bag content of the specific vertex.
+             *
+             *  @note The bag is copied out of the storage of the decomposition, hence setBagContent() shall be preferred for replacing the content of a bag.
              */
             virtual std::vector<htd::vertex_t> & mutableBagContent(htd::vertex_t vertex) = 0;
 
+            /**
+             *  Set the bag content of a specific vertex.
+             *
+             *  @param[in] vertex   The vertex for which the bag content shall be set.
+             *  @param[in] content  The new bag content.
+             */
+            virtual void setBagContent(htd::vertex_t vertex, const std::vector<htd::vertex_t> & content) = 0;
+
+            /**
+             *  Set the bag content of a specific vertex.
+             *
+             *  @param[in] vertex   The vertex for which the bag content shall be set.
+             *  @param[in] content  The new bag content. It may be the bag of another vertex of the same decomposition.
+             */
+            virtual void setBagContent(htd::vertex_t vertex, const htd::Bag & content) = 0;
+
             /**
              *  Access the hyperedges induced by the bag content of a specific vertex.
              *
@@ -73,6 +73,22 @@ namespace htd
              */
             virtual htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT = 0;
 
+            /**
+             *  Check whether the ordering algorithm can be applied to each connected component of a graph independently.
+             *
+             *  This is the case if the vertex ordering computed for a preprocessed graph consists of the partial vertex
+             *  elimination ordering of the preprocessing phase followed by an ordering of the remaining vertices, i.e.,
+             *  if the ordering algorithm never returns vertices which are not part of the given graphs.
+             *
+             *  The default implementation returns false, hence ordering algorithms have to opt in explicitly.
+             *
+             *  @return True if the ordering algorithm can be applied to each connected component of a graph independently, false otherwise.
+             */
+            virtual bool supportsComponentOrdering(void) const HTD_NOEXCEPT
+            {
+                return false;
+            }
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             /**
              *  Create a deep copy of the current ordering algorithm.
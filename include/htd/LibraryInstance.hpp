@@ -26,7 +26,9 @@
 #define HTD_HTD_LIBRARYINSTANCE_HPP
 
 #include <htd/Id.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 
+#include <cstddef>
 #include <memory>
 
 namespace htd
@@ -231,6 +233,34 @@ namespace htd
              */
             HTD_API void reset(void);
 
+            /**
+             *  Getter for the maximum number of threads which may be used by the algorithms of the library.
+             *
+             *  @return The maximum number of threads which may be used by the algorithms of the library.
+             */
+            HTD_API std::size_t threadCount(void) const;
+
+            /**
+             *  Set the maximum number of threads which may be used by the algorithms of the library.
+             *
+             *  @note By default, the algorithms of the library run single-threaded.
+             *
+             *  @param[in] threadCount  The maximum number of threads which may be used by the algorithms of the library. If the value is 0, the number of hardware threads is used.
+             */
+            HTD_API void setThreadCount(std::size_t threadCount);
+
+            /**
+             *  Access the random number generator which shall be used by the algorithms of the library in the calling thread.
+             *
+             *  Unless a different generator was bound to the management instance in the calling thread via an instance
+             *  of htd::RandomNumberGeneratorBinding, the generator owned by the management instance is returned. All
+             *  random decisions of the algorithms of the library are based on this generator, hence re-seeding it allows
+             *  to reproduce their results.
+             *
+             *  @return The random number generator which shall be used by the algorithms of the library in the calling thread.
+             */
+            HTD_API htd::RandomNumberGenerator & randomNumberGenerator(void) const;
+
             /**
              *  Access the factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
              */
@@ -516,6 +546,62 @@ namespace htd
 
             std::unique_ptr<Implementation> implementation_;
     };
+
+    /**
+     *  Scoped binding of a random number generator to a management instance in the calling thread.
+     *
+     *  Algorithms running on additional threads shall bind their own generator, e.g. one obtained via
+     *  htd::RandomNumberGenerator::fork(), so that the threads neither compete for the same generator nor
+     *  depend on the order in which they draw random numbers. While the binding exists, the calling thread
+     *  obtains the bound generator from htd::LibraryInstance::randomNumberGenerator(). Bindings for different
+     *  management instances do not affect each other and nested bindings for the same management instance
+     *  are undone in reverse order when they go out of scope, also if an exception is thrown.
+     */
+    class RandomNumberGeneratorBinding
+    {
+        public:
+            /**
+             *  Constructor for a random number generator binding.
+             *
+             *  @note The binding must be destroyed in the thread in which it was created and before the management instance and the generator are destroyed.
+             *
+             *  @param[in] managementInstance   The management instance to which the generator shall be bound in the calling thread.
+             *  @param[in] generator            The random number generator which shall be used by the algorithms of the management instance in the calling thread.
+             */
+            HTD_API RandomNumberGeneratorBinding(const htd::LibraryInstance & managementInstance, htd::RandomNumberGenerator & generator);
+
+            /**
+             *  Destructor for a random number generator binding.
+             *
+             *  The generator which was bound to the management instance before, if any, is used again afterwards.
+             */
+            HTD_API ~RandomNumberGeneratorBinding();
+
+            /**
+             *  Copy constructor for a random number generator binding.
+             *
+             *  @note This constructor is deleted because a binding must be undone exactly once.
+             */
+            HTD_API RandomNumberGeneratorBinding(const RandomNumberGeneratorBinding & original) = delete;
+
+            /**
+             *  Copy assignment operator for a random number generator binding.
+             *
+             *  @note This operator is deleted because a binding must be undone exactly once.
+             */
+            HTD_API RandomNumberGeneratorBinding & operator=(const RandomNumberGeneratorBinding & original) = delete;
+
+        private:
+            /**
+             *  The management instance to which the generator is bound.
+             */
+            const htd::LibraryInstance & managementInstance_;
+
+            /**
+             *  The bound random number generator.
+             */
+            htd::RandomNumberGenerator & generator_;
+    };
 }
 
 #endif /* HTD_HTD_LIBRARYINSTANCE_HPP */
@@ -25,6 +25,7 @@
 #ifndef HTD_HTD_MULTIHYPERGRAPH_HPP
 #define HTD_HTD_MULTIHYPERGRAPH_HPP
 
+#include <htd/CompactHypergraph.hpp>
 #include <htd/IMutableMultiHypergraph.hpp>
 #include <htd/LibraryInstance.hpp>
 
@@ -35,6 +36,13 @@ namespace htd
 {
     /**
      *  Default implementation of the IMutableMultiHypergraph interface.
+     *
+     *  Copying a multi-hypergraph takes constant time: The copy shares the vertices, hyperedges and all
+     *  auxiliary indices with the original until either of them is modified for the first time. The graph
+     *  which is modified moves to a private copy of the shared state, hence a reference obtained from it
+     *  before the modification, e.g. via hyperedge(), stays valid only as long as one of the other copies
+     *  exists. The collections returned by vertices(), neighbors() and hyperedges() keep the state they
+     *  refer to alive, hence they remain valid in this case.
      */
     class MultiHypergraph : public virtual htd::IMutableMultiHypergraph
     {
@@ -163,8 +171,25 @@ namespace htd
 
             HTD_API htd::id_t addEdge(htd::Hyperedge && hyperedge) HTD_OVERRIDE;
 
+            HTD_API htd::id_t addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges) HTD_OVERRIDE;
+
+            HTD_API htd::id_t addEdges(const std::vector<std::vector<htd::vertex_t>> & edges) HTD_OVERRIDE;
+
+            HTD_API htd::id_t addEdges(std::vector<std::vector<htd::vertex_t>> && edges) HTD_OVERRIDE;
+
             HTD_API void removeEdge(htd::id_t edgeId) HTD_OVERRIDE;
 
+            /**
+             *  Create an immutable snapshot of the current multi-hypergraph.
+             *
+             *  The snapshot stores all neighborhoods and the incidence relation between vertices and hyperedges
+             *  in contiguous arrays and therefore is well suited for algorithms which only read the graph. The
+             *  snapshot is not affected by subsequent modifications of the current multi-hypergraph.
+             *
+             *  @return A new CompactHypergraph object representing the current state of the multi-hypergraph.
+             */
+            HTD_API htd::CompactHypergraph * freeze(void) const;
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -204,7 +229,19 @@ namespace htd
         private:
             struct Implementation;
 
-            std::unique_ptr<Implementation> implementation_;
+            /**
+             *  The implementation details of the multi-hypergraph.
+             *
+             *  Copies of a multi-hypergraph share their implementation details until one of them is modified.
+             */
+            std::shared_ptr<Implementation> implementation_;
+
+            /**
+             *  Ensure that the implementation details are not shared with any copy of the multi-hypergraph.
+             *
+             *  This function must be called before any modification of the implementation details takes place.
+             */
+            void detach(void);
     };
 }
 
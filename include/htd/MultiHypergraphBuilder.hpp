@@ -0,0 +1,149 @@
+/* 
+ * File:   MultiHypergraphBuilder.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_MULTIHYPERGRAPHBUILDER_HPP
+#define HTD_HTD_MULTIHYPERGRAPHBUILDER_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/CompactHypergraph.hpp>
+#include <htd/IMutableMultiGraph.hpp>
+#include <htd/IMutableMultiHypergraph.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Helper class for loading large numbers of edges into a multi-hypergraph.
+     *
+     *  The builder only collects the endpoints of the edges. When populating a graph, all edges are
+     *  handed over in batches (see IMutableMultiHypergraph::addEdges), so that the neighborhood of
+     *  each vertex is sorted and merged once instead of once per incident edge.
+     */
+    class MultiHypergraphBuilder
+    {
+        public:
+            /**
+             *  Constructor for a multi-hypergraph builder.
+             */
+            HTD_API MultiHypergraphBuilder(void);
+
+            /**
+             *  Copy constructor for a multi-hypergraph builder.
+             *
+             *  @param[in] original  The original multi-hypergraph builder.
+             */
+            HTD_API MultiHypergraphBuilder(const MultiHypergraphBuilder & original);
+
+            HTD_API virtual ~MultiHypergraphBuilder();
+
+            /**
+             *  Getter for the number of edges collected so far.
+             *
+             *  @return The number of edges collected so far.
+             */
+            HTD_API std::size_t edgeCount(void) const;
+
+            /**
+             *  Add a new edge to the builder.
+             *
+             *  @param[in] vertex1  The first endpoint of the edge.
+             *  @param[in] vertex2  The second endpoint of the edge.
+             */
+            HTD_API void addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2);
+
+            /**
+             *  Add a new edge to the builder.
+             *
+             *  @param[in] elements The endpoints of the hyperedge.
+             */
+            HTD_API void addEdge(const std::vector<htd::vertex_t> & elements);
+
+            /**
+             *  Add a new edge to the builder.
+             *
+             *  @param[in] elements The endpoints of the hyperedge.
+             */
+            HTD_API void addEdge(std::vector<htd::vertex_t> && elements);
+
+            /**
+             *  Remove all edges collected so far.
+             */
+            HTD_API void clear(void);
+
+            /**
+             *  Add all edges collected so far to the given multi-hypergraph and clear the builder afterwards.
+             *
+             *  The edges are added in the order in which they were provided to the builder and all their
+             *  endpoints must be vertices of the given graph.
+             *
+             *  @param[in] graph    The multi-hypergraph which shall be populated.
+             *
+             *  @return The ID of the first edge which was added to the graph. If no edge was added, the returned value is the ID of the last edge added to the graph.
+             */
+            HTD_API htd::id_t populate(htd::IMutableMultiHypergraph & graph);
+
+            /**
+             *  Add all edges collected so far to the given multigraph and clear the builder afterwards.
+             *
+             *  The edges are added in the order in which they were provided to the builder and all their
+             *  endpoints must be vertices of the given graph. Only edges with exactly two endpoints are
+             *  supported by this function.
+             *
+             *  @param[in] graph    The multigraph which shall be populated.
+             *
+             *  @return The ID of the first edge which was added to the graph. If no edge was added, the returned value is the ID of the last edge added to the graph.
+             */
+            HTD_API htd::id_t populate(htd::IMutableMultiGraph & graph);
+
+            /**
+             *  Create an immutable multi-hypergraph with the vertices 1, ..., vertexCount which contains all edges collected so far and clear the builder afterwards.
+             *
+             *  The edges get the IDs 1, 2, ... in the order in which they were provided to the builder and all their
+             *  endpoints must be vertices of the new graph. No mutable graph is built in between, hence this is the
+             *  cheapest way to load a graph which is only read afterwards.
+             *
+             *  @param[in] manager      The management instance to which the new compact multi-hypergraph belongs.
+             *  @param[in] vertexCount  The number of vertices of the new compact multi-hypergraph.
+             *
+             *  @return A new compact multi-hypergraph which contains all edges collected so far.
+             */
+            HTD_API htd::CompactHypergraph * freeze(const htd::LibraryInstance * const manager, std::size_t vertexCount);
+
+            /**
+             *  Copy assignment operator for a multi-hypergraph builder.
+             *
+             *  @param[in] original  The original multi-hypergraph builder.
+             */
+            HTD_API MultiHypergraphBuilder & operator=(const MultiHypergraphBuilder & original);
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_MULTIHYPERGRAPHBUILDER_HPP */
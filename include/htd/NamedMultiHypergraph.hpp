@@ -30,6 +30,7 @@
 #include <htd/LabeledMultiHypergraphFactory.hpp>
 #include <htd/BidirectionalGraphNaming.hpp>
 #include <htd/Label.hpp>
+#include <htd/MultiHypergraphBuilder.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/NamedVertexHyperedge.hpp>
 
@@ -721,6 +722,30 @@ namespace htd
                 return base_->addEdge(addVertices(elements));
             }
 
+            /**
+             *  Add new edges to the multi-hypergraph.
+             *
+             *  Missing vertices are created in the order in which their names occur. In contrast to adding the
+             *  edges one by one, the neighborhoods of the affected vertices are updated only once for the whole collection.
+             *
+             *  @param[in] edges    The endpoints of the new hyperedges.
+             *
+             *  @return The ID of the first edge which was added to the graph. If the number of edges to add is greater than 1,
+             *          the additional edges are numbered in ascending order and without gaps starting from the returned ID + 1.
+             *          If the number of new edges is 0, the returned value is the ID of the last edge added to the graph.
+             */
+            htd::id_t addEdges(const std::vector<std::vector<VertexNameType>> & edges)
+            {
+                htd::MultiHypergraphBuilder builder;
+
+                for (const std::vector<VertexNameType> & elements : edges)
+                {
+                    builder.addEdge(addVertices(elements));
+                }
+
+                return builder.populate(*base_);
+            }
+
             /**
              *  Add a new edge to the multi-hypergraph.
              *
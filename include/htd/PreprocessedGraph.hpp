@@ -191,6 +191,18 @@ namespace htd
 
             HTD_API std::size_t minTreeWidth(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            /**
+             *  Access the vertices of the connected components of the preprocessed graph.
+             *
+             *  The components are computed on the first call and reused by subsequent calls. Only the vertices are stored,
+             *  a component can be turned into a graph of its own via htd::ConnectedComponentGraph when it is needed. Every
+             *  updatable getter and every modifier of the preprocessed graph discards the components, hence the graph must
+             *  not be modified through references obtained earlier once the components were requested.
+             *
+             *  @return The vertices (sorted in ascending order) of the connected components of the preprocessed graph, ordered by their smallest vertex, or an empty vector if the graph has less than two connected components.
+             */
+            HTD_API std::shared_ptr<const std::vector<std::vector<htd::vertex_t>>> components(void) const;
+
 #ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
             HTD_API PreprocessedGraph * clone(void) const HTD_OVERRIDE;
 #else
@@ -0,0 +1,271 @@
+/*
+ * File:   RandomNumberGenerator.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_RANDOMNUMBERGENERATOR_HPP
+#define HTD_HTD_RANDOMNUMBERGENERATOR_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace htd
+{
+    /**
+     *  Pseudo-random number generator based on the xoshiro256** algorithm.
+     *
+     *  The generator fulfills the requirements of a uniform random bit generator, so it can be passed to the random
+     *  number distributions and algorithms of the standard library. Its state consists of four 64-bit words and is
+     *  seeded via the SplitMix64 algorithm, so that arbitrary seeds (including 0) lead to well-distributed states.
+     *
+     *  @note The generator is not thread-safe. Threads which need random numbers shall obtain their own generator
+     *  via fork() or substream().
+     */
+    class RandomNumberGenerator
+    {
+        public:
+            /**
+             *  The type of the generated random numbers.
+             */
+            typedef std::uint64_t result_type;
+
+            /**
+             *  The seed used by default-constructed generators.
+             */
+            static const std::uint64_t DEFAULT_SEED = 1;
+
+            /**
+             *  Constructor for a new random number generator using the default seed.
+             */
+            RandomNumberGenerator(void) HTD_NOEXCEPT
+            {
+                seed(DEFAULT_SEED);
+            }
+
+            /**
+             *  Constructor for a new random number generator.
+             *
+             *  @param[in] seed The seed of the new random number generator.
+             */
+            explicit RandomNumberGenerator(std::uint64_t seed) HTD_NOEXCEPT
+            {
+                this->seed(seed);
+            }
+
+            /**
+             *  Getter for the smallest value which may be generated.
+             *
+             *  @return The smallest value which may be generated.
+             */
+            static constexpr result_type min(void)
+            {
+                return std::numeric_limits<result_type>::min();
+            }
+
+            /**
+             *  Getter for the largest value which may be generated.
+             *
+             *  @return The largest value which may be generated.
+             */
+            static constexpr result_type max(void)
+            {
+                return std::numeric_limits<result_type>::max();
+            }
+
+            /**
+             *  Reset the state of the random number generator.
+             *
+             *  @param[in] seed The new seed of the random number generator.
+             */
+            void seed(std::uint64_t seed) HTD_NOEXCEPT
+            {
+                for (std::uint64_t & word : state_)
+                {
+                    word = splitMix(seed);
+                }
+            }
+
+            /**
+             *  Generate the next random number.
+             *
+             *  @return The next random number.
+             */
+            result_type operator()(void) HTD_NOEXCEPT
+            {
+                std::uint64_t ret = rotateLeft(state_[1] * 5, 7) * 9;
+
+                std::uint64_t tmp = state_[1] << 17;
+
+                state_[2] ^= state_[0];
+                state_[3] ^= state_[1];
+                state_[1] ^= state_[2];
+                state_[0] ^= state_[3];
+
+                state_[2] ^= tmp;
+
+                state_[3] = rotateLeft(state_[3], 45);
+
+                return ret;
+            }
+
+            /**
+             *  Generate a uniformly distributed random index.
+             *
+             *  @param[in] bound    The number of possible indices. The value must be greater than 0.
+             *
+             *  @return A random index in the range [0, bound).
+             */
+            std::size_t nextIndex(std::size_t bound) HTD_NOEXCEPT
+            {
+                HTD_ASSERT(bound > 0)
+
+                std::uint64_t range = static_cast<std::uint64_t>(bound);
+
+                /* Reject the values in the incomplete block at the lower end of the range to avoid a modulo bias. */
+                std::uint64_t threshold = (0 - range) % range;
+
+                std::uint64_t value = (*this)();
+
+                while (value < threshold)
+                {
+                    value = (*this)();
+                }
+
+                return static_cast<std::size_t>(value % range);
+            }
+
+            /**
+             *  Split off a new random number generator.
+             *
+             *  The new generator continues with the current state, while the current generator skips 2^128 numbers
+             *  ahead. Hence, the sequences produced by both generators do not overlap in practice and repeated calls
+             *  of this function yield the same generators as long as the current generator was seeded identically.
+             *
+             *  @return The new random number generator.
+             */
+            RandomNumberGenerator fork(void) HTD_NOEXCEPT
+            {
+                RandomNumberGenerator ret(*this);
+
+                jump();
+
+                return ret;
+            }
+
+            /**
+             *  Derive a random number generator for a specific index from the current state.
+             *
+             *  In contrast to fork(), the current generator is not modified, so that the derived generators can be
+             *  created in an arbitrary order, e.g. one for each iteration of an algorithm whose iterations are
+             *  distributed among several threads.
+             *
+             *  @param[in] index    The index of the derived generator.
+             *
+             *  @return The random number generator for the given index.
+             */
+            RandomNumberGenerator substream(std::uint64_t index) const HTD_NOEXCEPT
+            {
+                std::uint64_t key = index;
+
+                for (std::uint64_t word : state_)
+                {
+                    std::uint64_t mixedKey = key ^ word;
+
+                    key = splitMix(mixedKey);
+                }
+
+                return RandomNumberGenerator(key);
+            }
+
+        private:
+            /**
+             *  The state of the random number generator.
+             */
+            std::uint64_t state_[4];
+
+            /**
+             *  Rotate a word to the left.
+             *
+             *  @param[in] word     The word.
+             *  @param[in] distance The number of bits by which the word shall be rotated.
+             *
+             *  @return The rotated word.
+             */
+            static std::uint64_t rotateLeft(std::uint64_t word, int distance) HTD_NOEXCEPT
+            {
+                return (word << distance) | (word >> (64 - distance));
+            }
+
+            /**
+             *  Advance a SplitMix64 state and return its next output.
+             *
+             *  @param[in,out] state    The SplitMix64 state.
+             *
+             *  @return The next output of the SplitMix64 generator.
+             */
+            static std::uint64_t splitMix(std::uint64_t & state) HTD_NOEXCEPT
+            {
+                std::uint64_t ret = (state += 0x9E3779B97F4A7C15ULL);
+
+                ret = (ret ^ (ret >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                ret = (ret ^ (ret >> 27)) * 0x94D049BB133111EBULL;
+
+                return ret ^ (ret >> 31);
+            }
+
+            /**
+             *  Advance the state of the random number generator by 2^128 steps.
+             */
+            void jump(void) HTD_NOEXCEPT
+            {
+                static const std::uint64_t JUMP[] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+
+                std::uint64_t result[4] = { 0, 0, 0, 0 };
+
+                for (std::uint64_t jumpWord : JUMP)
+                {
+                    for (int bit = 0; bit < 64; ++bit)
+                    {
+                        if (jumpWord & (static_cast<std::uint64_t>(1) << bit))
+                        {
+                            for (int index = 0; index < 4; ++index)
+                            {
+                                result[index] ^= state_[index];
+                            }
+                        }
+
+                        (*this)();
+                    }
+                }
+
+                for (int index = 0; index < 4; ++index)
+                {
+                    state_[index] = result[index];
+                }
+            }
+    };
+}
+
+#endif /* HTD_HTD_RANDOMNUMBERGENERATOR_HPP */
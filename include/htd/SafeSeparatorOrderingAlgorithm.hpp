@@ -0,0 +1,119 @@
+/* 
+ * File:   SafeSeparatorOrderingAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_SAFESEPARATORORDERINGALGORITHM_HPP
+#define HTD_HTD_SAFESEPARATORORDERINGALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IOrderingAlgorithm.hpp>
+
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Implementation of the IOrderingAlgorithm interface which decomposes the input graph along its safe
+     *  separators before computing the vertex elimination ordering.
+     *
+     *  The graph is split along all clique minimal separators and along the almost-clique minimal separators
+     *  of the minimal triangulation computed by the MCS-M algorithm. The resulting atoms are ordered
+     *  independently (and in parallel if the management instance allows multiple threads) by the given
+     *  ordering algorithm. The returned ordering is a perfect elimination ordering of the union of the
+     *  triangulations of the atoms, hence its width equals the maximum width over all atoms.
+     */
+    class SafeSeparatorOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new ordering algorithm of type SafeSeparatorOrderingAlgorithm.
+             *
+             *  @param[in] manager   The management instance to which the new algorithm belongs.
+             */
+            HTD_API SafeSeparatorOrderingAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a htd::SafeSeparatorOrderingAlgorithm object.
+             *
+             *  @param[in] original The original htd::SafeSeparatorOrderingAlgorithm object.
+             */
+            HTD_API SafeSeparatorOrderingAlgorithm(const htd::SafeSeparatorOrderingAlgorithm & original);
+
+            HTD_API virtual ~SafeSeparatorOrderingAlgorithm();
+            
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            /**
+             *  Compute a vertex ordering of the given graph and report the atoms which were ordered independently.
+             *
+             *  @param[in] graph                The input graph.
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[out] atoms               The vector to which the atoms of the decomposition along safe separators shall be appended. Each atom is given as sorted set of vertices.
+             *
+             *  @return The vertex elimination ordering of the union of the triangulations of the atoms.
+             */
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & atoms) const HTD_NOEXCEPT;
+
+            HTD_API bool supportsComponentOrdering(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
+
+            /**
+             *  Set the ordering algorithm which shall be used to compute the vertex elimination orderings of the atoms.
+             *
+             *  @param[in] algorithm    The ordering algorithm which shall be used to compute the vertex elimination orderings of the atoms.
+             *
+             *  @note When calling this method the control over the memory region of the ordering algorithm is transferred to the
+             *  ordering algorithm. Deleting the ordering algorithm provided to this method outside the current ordering algorithm or
+             *  assigning the same ordering algorithm multiple times will lead to undefined behavior.
+             */
+            HTD_API void setOrderingAlgorithm(htd::IOrderingAlgorithm * algorithm);
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            HTD_API SafeSeparatorOrderingAlgorithm * clone(void) const HTD_OVERRIDE;
+#else
+            HTD_API SafeSeparatorOrderingAlgorithm * clone(void) const;
+
+            HTD_API htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE;
+#endif
+
+        protected:
+            /**
+             *  Copy assignment operator for an ordering algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            SafeSeparatorOrderingAlgorithm & operator=(const SafeSeparatorOrderingAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_SAFESEPARATORORDERINGALGORITHM_HPP */
@@ -0,0 +1,157 @@
+/*
+ * File:   SetKernels.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_SETKERNELS_HPP
+#define HTD_HTD_SETKERNELS_HPP
+
+#include <htd/Globals.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Enumeration of the available implementations of the kernels operating on sorted sets of vertices.
+     */
+    enum class SetKernel
+    {
+        /**
+         *  Portable implementation based on a plain merge of the two sets.
+         */
+        SCALAR,
+
+        /**
+         *  Implementation comparing 128-bit blocks of vertices at once using SSE4.2 instructions.
+         */
+        SSE4_2,
+
+        /**
+         *  Implementation comparing 256-bit blocks of vertices at once using AVX2 instructions.
+         */
+        AVX2
+    };
+
+    /**
+     *  Check whether a specific kernel implementation can be used on the current machine.
+     *
+     *  @param[in] kernel   The kernel implementation.
+     *
+     *  @return True if the kernel implementation is compiled into the library and supported by the CPU, false otherwise.
+     */
+    HTD_API bool isSetKernelSupported(htd::SetKernel kernel) HTD_NOEXCEPT;
+
+    /**
+     *  Getter for the kernel implementation which is used by the set operations of the library.
+     *
+     *  The kernel implementation is selected once, based on the features of the CPU the library is running on.
+     *
+     *  @return The kernel implementation which is used by the set operations of the library.
+     */
+    HTD_API htd::SetKernel activeSetKernel(void) HTD_NOEXCEPT;
+
+    /**
+     *  Compute the number of vertices contained in two sets.
+     *
+     *  @note If the sizes of the sets differ considerably, the elements of the smaller set are looked up in the larger
+     *  set via galloping search instead of merging both sets.
+     *
+     *  @param[in] first1   A pointer to the first vertex of the first set. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last1    A pointer past the last vertex of the first set.
+     *  @param[in] first2   A pointer to the first vertex of the second set. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last2    A pointer past the last vertex of the second set.
+     *  @param[in] kernel   The kernel implementation which shall be used. The kernel implementation must be supported.
+     *
+     *  @return The number of vertices contained in both sets.
+     */
+    HTD_API std::size_t set_intersection_size(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                              const htd::vertex_t * first2, const htd::vertex_t * last2,
+                                              htd::SetKernel kernel) HTD_NOEXCEPT;
+
+    /**
+     *  Compute the number of vertices contained in two sets using the active kernel implementation.
+     *
+     *  @param[in] first1   A pointer to the first vertex of the first set. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last1    A pointer past the last vertex of the first set.
+     *  @param[in] first2   A pointer to the first vertex of the second set. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last2    A pointer past the last vertex of the second set.
+     *
+     *  @return The number of vertices contained in both sets.
+     */
+    HTD_API std::size_t set_intersection_size(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                              const htd::vertex_t * first2, const htd::vertex_t * last2) HTD_NOEXCEPT;
+
+    /**
+     *  Check whether two sets have at least one vertex in common using the active kernel implementation.
+     *
+     *  @param[in] first1   A pointer to the first vertex of the first set. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last1    A pointer past the last vertex of the first set.
+     *  @param[in] first2   A pointer to the first vertex of the second set. The vertices must be sorted in ascending order and free of duplicates.
+     *  @param[in] last2    A pointer past the last vertex of the second set.
+     *
+     *  @return True if the sets have at least one vertex in common, false otherwise.
+     */
+    HTD_API bool has_non_empty_set_intersection(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                                const htd::vertex_t * first2, const htd::vertex_t * last2) HTD_NOEXCEPT;
+
+    /**
+     *  Type trait identifying iterators over contiguously stored vertices, i.e., iterators which can be handled by the
+     *  kernel implementations.
+     */
+    template <typename Iterator>
+    struct is_vertex_pointer_iterator : public std::integral_constant<bool, std::is_same<Iterator, std::vector<htd::vertex_t>::iterator>::value ||
+                                                                            std::is_same<Iterator, std::vector<htd::vertex_t>::const_iterator>::value ||
+                                                                            std::is_same<Iterator, htd::vertex_t *>::value ||
+                                                                            std::is_same<Iterator, const htd::vertex_t *>::value>
+    {
+
+    };
+
+    /**
+     *  Type trait identifying pairs of iterator types which can both be handled by the kernel implementations.
+     */
+    template <typename Iterator1, typename Iterator2>
+    struct is_vertex_pointer_iterator_pair : public std::integral_constant<bool, is_vertex_pointer_iterator<Iterator1>::value && is_vertex_pointer_iterator<Iterator2>::value>
+    {
+
+    };
+
+    /**
+     *  Get a pointer to the vertex an iterator over contiguously stored vertices refers to.
+     *
+     *  @param[in] first    The iterator. It may only be dereferenced if the range it belongs to is not empty.
+     *  @param[in] last     The end of the range the iterator belongs to.
+     *
+     *  @return A pointer to the vertex the iterator refers to, or a null pointer if the range is empty.
+     */
+    template <typename Iterator>
+    const htd::vertex_t * vertex_pointer(Iterator first, Iterator last) HTD_NOEXCEPT
+    {
+        return first != last ? &(*first) : nullptr;
+    }
+}
+
+#endif /* HTD_HTD_SETKERNELS_HPP */
@@ -36,6 +36,11 @@ namespace htd
 {
     /**
      *  Default implementation of the IMutableTree interface.
+     *
+     *  References to hyperedges of the tree remain valid until the respective hyperedge is removed. Collections of
+     *  hyperedges refer to the hyperedges stored in the tree instead of copying them, hence they remain valid as long
+     *  as the tree exists and none of the contained hyperedges is removed. Concurrent calls of const member functions
+     *  are safe as long as the tree is not modified at the same time.
      */
     class Tree : public virtual htd::IMutableTree
     {
@@ -0,0 +1,155 @@
+/*
+ * File:   TreeWidthLowerBoundAlgorithm.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_HPP
+#define HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_HPP
+
+#include <htd/Globals.hpp>
+#include <htd/IPreprocessedGraph.hpp>
+#include <htd/LibraryInstance.hpp>
+
+namespace htd
+{
+    /**
+     *  Algorithm computing lower bounds for the treewidth of a graph.
+     *
+     *  All bounds are computed for the graph induced by the vertices which remain after the preprocessing phase. The
+     *  remaining graph is a minor of the input graph, hence each bound is also a lower bound for the treewidth of the
+     *  input graph.
+     */
+    class TreeWidthLowerBoundAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new treewidth lower bound algorithm.
+             *
+             *  @param[in] manager  The management instance to which the new algorithm belongs.
+             */
+            HTD_API TreeWidthLowerBoundAlgorithm(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Copy constructor for a treewidth lower bound algorithm.
+             *
+             *  @param[in] original  The original treewidth lower bound algorithm.
+             */
+            HTD_API TreeWidthLowerBoundAlgorithm(const TreeWidthLowerBoundAlgorithm & original);
+
+            /**
+             *  Destructor of a treewidth lower bound algorithm.
+             */
+            HTD_API virtual ~TreeWidthLowerBoundAlgorithm();
+
+            /**
+             *  Compute the best lower bound for the treewidth of the given graph, i.e., the maximum of its degeneracy,
+             *  its minor-min-width and the approximation of its contraction degeneracy.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return The best lower bound for the treewidth of the given graph.
+             */
+            HTD_API std::size_t computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph) const;
+
+            /**
+             *  Compute a lower bound for the treewidth of the given graph which is only as good as required.
+             *
+             *  The bounds are computed in the order of their running time, i.e., the degeneracy first, and the computation
+             *  stops as soon as one of them reaches the given target width.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *  @param[in] targetWidth          The width at which the computation of further bounds can be skipped, e.g., the width of the best known decomposition minus one.
+             *
+             *  @return A lower bound for the treewidth of the given graph. If the value is less than targetWidth, it is the best lower bound for the treewidth of the given graph.
+             */
+            HTD_API std::size_t computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph, std::size_t targetWidth) const;
+
+            /**
+             *  Compute the degeneracy of the given graph, i.e., the maximum over all subgraphs of their minimum degree.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return The degeneracy of the given graph.
+             */
+            HTD_API std::size_t computeDegeneracy(const htd::IPreprocessedGraph & preprocessedGraph) const;
+
+            /**
+             *  Compute the minor-min-width of the given graph.
+             *
+             *  The minor-min-width is obtained by repeatedly contracting a vertex of minimum degree into its neighbor of minimum
+             *  degree. The largest minimum degree encountered during this process is a lower bound for the treewidth.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return The minor-min-width of the given graph.
+             */
+            HTD_API std::size_t computeMinorMinWidth(const htd::IPreprocessedGraph & preprocessedGraph) const;
+
+            /**
+             *  Compute a lower bound for the contraction degeneracy of the given graph.
+             *
+             *  The contraction degeneracy is approximated by repeatedly contracting a vertex of minimum degree into the neighbor
+             *  with which it shares the least number of common neighbors, so that the contracted graph loses as few edges as possible.
+             *
+             *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+             *
+             *  @return A lower bound for the contraction degeneracy of the given graph.
+             */
+            HTD_API std::size_t computeContractionDegeneracy(const htd::IPreprocessedGraph & preprocessedGraph) const;
+
+            /**
+             *  Getter for the associated management class.
+             *
+             *  @return The associated management class.
+             */
+            HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT;
+
+            /**
+             *  Set a new management class for the library object.
+             *
+             *  @param[in] manager   The new management class for the library object.
+             */
+            HTD_API void setManagementInstance(const htd::LibraryInstance * const manager);
+
+            /**
+             *  Create a deep copy of the current treewidth lower bound algorithm.
+             *
+             *  @return A new TreeWidthLowerBoundAlgorithm object identical to the current algorithm.
+             */
+            HTD_API TreeWidthLowerBoundAlgorithm * clone(void) const;
+
+        protected:
+            /**
+             *  Copy assignment operator for a treewidth lower bound algorithm.
+             *
+             *  @note This operator is protected to prevent assignments to an already initialized algorithm.
+             */
+            TreeWidthLowerBoundAlgorithm & operator=(const TreeWidthLowerBoundAlgorithm &) { return *this; }
+
+        private:
+            struct Implementation;
+
+            std::unique_ptr<Implementation> implementation_;
+    };
+}
+
+#endif /* HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_HPP */
@@ -28,12 +28,17 @@
 #include <htd/Globals.hpp>
 #include <htd/IOrderingAlgorithm.hpp>
 
+#include <cstddef>
+
 namespace htd
 {
     /**
      *  Implementation of the IOrderingAlgorithm interface which operates by
      *  computing a minimal triangulation based on a given vertex elimination
      *  ordering algorithm.
+     *
+     *  The fill edges of the triangulation induced by the initial ordering are
+     *  minimized via the MinimalChordal algorithm of Blair, Heggernes and Telle.
      */
     class TriangulationMinimizationOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
     {
@@ -58,6 +63,20 @@ namespace htd
 
             HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE;
 
+            /**
+             *  Compute a vertex ordering of the given graph and report how many fill edges were removed by the minimization.
+             *
+             *  @param[in] graph                    The input graph.
+             *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+             *  @param[out] initialFillEdgeCount    The number of fill edges of the triangulation induced by the initial vertex elimination ordering.
+             *  @param[out] removedFillEdgeCount    The number of fill edges which were removed from the initial triangulation.
+             *
+             *  @return The vertex elimination ordering of the computed minimal triangulation.
+             */
+            HTD_API htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t & initialFillEdgeCount, std::size_t & removedFillEdgeCount) const HTD_NOEXCEPT;
+
+            HTD_API bool supportsComponentOrdering(void) const HTD_NOEXCEPT HTD_OVERRIDE;
+
             HTD_API const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE;
 
             HTD_API void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE;
@@ -68,6 +68,11 @@ namespace htd
 
             }
 
+            VectorAdapterConstIteratorWrapper<Iter, T, Allocator> * clone(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return new VectorAdapterConstIteratorWrapper<Iter, T, Allocator>(*this);
+            }
+
         private:
             std::shared_ptr<std::vector<T, Allocator>> collection_;
     };
@@ -0,0 +1,343 @@
+/*
+ * File:   VertexSpan.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_VERTEXSPAN_HPP
+#define HTD_HTD_VERTEXSPAN_HPP
+
+#include <htd/Globals.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace htd
+{
+    /**
+     *  Immutable view on a contiguous sequence of vertices owned by another object.
+     *
+     *  A span does not own the vertices it refers to. It is invalidated by every modification of its owner,
+     *  just like the iterators of a std::vector. Use toVector() to obtain a copy of the vertices which
+     *  outlives the owner.
+     */
+    class VertexSpan
+    {
+        public:
+            /**
+             *  The value type of the span.
+             */
+            typedef htd::vertex_t value_type;
+
+            /**
+             *  The size type of the span.
+             */
+            typedef std::size_t size_type;
+
+            /**
+             *  The reference type of the span.
+             */
+            typedef const htd::vertex_t & const_reference;
+
+            /**
+             *  The reference type of the span.
+             */
+            typedef const_reference reference;
+
+            /**
+             *  The iterator type of the span.
+             */
+            typedef const htd::vertex_t * const_iterator;
+
+            /**
+             *  The iterator type of the span.
+             */
+            typedef const_iterator iterator;
+
+            /**
+             *  Constructor for an empty span.
+             */
+            VertexSpan(void) HTD_NOEXCEPT : data_(nullptr), size_(0)
+            {
+
+            }
+
+            /**
+             *  Constructor for a span.
+             *
+             *  @param[in] data The first vertex of the span.
+             *  @param[in] size The number of vertices in the span.
+             */
+            VertexSpan(const htd::vertex_t * data, std::size_t size) HTD_NOEXCEPT : data_(data), size_(size)
+            {
+
+            }
+
+            /**
+             *  Constructor for a span referring to the content of a vector.
+             *
+             *  @param[in] content  The vector holding the vertices of the span.
+             */
+            explicit VertexSpan(const std::vector<htd::vertex_t> & content) HTD_NOEXCEPT : data_(content.data()), size_(content.size())
+            {
+
+            }
+
+            /**
+             *  Getter for the iterator to the first vertex of the span.
+             *
+             *  @return An iterator to the first vertex of the span.
+             */
+            const_iterator begin(void) const HTD_NOEXCEPT
+            {
+                return data_;
+            }
+
+            /**
+             *  Getter for the iterator to the end of the span.
+             *
+             *  @return An iterator to the end of the span.
+             */
+            const_iterator end(void) const HTD_NOEXCEPT
+            {
+                return data_ + size_;
+            }
+
+            /**
+             *  Getter for the iterator to the first vertex of the span.
+             *
+             *  @return An iterator to the first vertex of the span.
+             */
+            const_iterator cbegin(void) const HTD_NOEXCEPT
+            {
+                return begin();
+            }
+
+            /**
+             *  Getter for the iterator to the end of the span.
+             *
+             *  @return An iterator to the end of the span.
+             */
+            const_iterator cend(void) const HTD_NOEXCEPT
+            {
+                return end();
+            }
+
+            /**
+             *  Getter for a pointer to the first vertex of the span.
+             *
+             *  @return A pointer to the first vertex of the span.
+             */
+            const htd::vertex_t * data(void) const HTD_NOEXCEPT
+            {
+                return data_;
+            }
+
+            /**
+             *  Getter for the size of the span.
+             *
+             *  @return The size of the span.
+             */
+            std::size_t size(void) const HTD_NOEXCEPT
+            {
+                return size_;
+            }
+
+            /**
+             *  Check whether the span is empty.
+             *
+             *  @return True if the span is empty, false otherwise.
+             */
+            bool empty(void) const HTD_NOEXCEPT
+            {
+                return size_ == 0;
+            }
+
+            /**
+             *  Access the vertex at the specific position within the span.
+             *
+             *  @param[in] index    The position of the vertex.
+             *
+             *  @return The vertex at the specific position.
+             */
+            const htd::vertex_t & operator[](htd::index_t index) const
+            {
+                HTD_ASSERT(index < size_)
+
+                return data_[index];
+            }
+
+            /**
+             *  Access the vertex at the specific position within the span.
+             *
+             *  @param[in] index    The position of the vertex.
+             *
+             *  @return The vertex at the specific position.
+             *
+             *  @throws std::out_of_range If the position is not less than the size of the span.
+             */
+            const htd::vertex_t & at(htd::index_t index) const
+            {
+                if (index >= size_)
+                {
+                    throw std::out_of_range("const htd::vertex_t & htd::VertexSpan::at(htd::index_t) const");
+                }
+
+                return data_[index];
+            }
+
+            /**
+             *  Access the first vertex of the span.
+             *
+             *  @return The first vertex of the span.
+             */
+            const htd::vertex_t & front(void) const
+            {
+                HTD_ASSERT(!empty())
+
+                return data_[0];
+            }
+
+            /**
+             *  Access the last vertex of the span.
+             *
+             *  @return The last vertex of the span.
+             */
+            const htd::vertex_t & back(void) const
+            {
+                HTD_ASSERT(!empty())
+
+                return data_[size_ - 1];
+            }
+
+            /**
+             *  Copy the vertices of the span into a new vector.
+             *
+             *  @return A vector containing the vertices of the span in the same order.
+             */
+            std::vector<htd::vertex_t> toVector(void) const
+            {
+                return std::vector<htd::vertex_t>(begin(), end());
+            }
+
+            /**
+             *  Equality operator for a span.
+             *
+             *  @param[in] rhs  The span at the right-hand side of the operator.
+             *
+             *  @return True if both spans contain the same vertices in the same order, false otherwise.
+             */
+            bool operator==(const VertexSpan & rhs) const
+            {
+                return size_ == rhs.size_ && std::equal(begin(), end(), rhs.begin());
+            }
+
+            /**
+             *  Inequality operator for a span.
+             *
+             *  @param[in] rhs  The span at the right-hand side of the operator.
+             *
+             *  @return True if the spans do not contain the same vertices in the same order, false otherwise.
+             */
+            bool operator!=(const VertexSpan & rhs) const
+            {
+                return !(*this == rhs);
+            }
+
+            /**
+             *  Less-than operator for a span.
+             *
+             *  @param[in] rhs  The span at the right-hand side of the operator.
+             *
+             *  @return True if the span is lexicographically smaller than the span at the right-hand side of the operator, false otherwise.
+             */
+            bool operator<(const VertexSpan & rhs) const
+            {
+                return std::lexicographical_compare(begin(), end(), rhs.begin(), rhs.end());
+            }
+
+        private:
+            /**
+             *  A pointer to the first vertex of the span.
+             */
+            const htd::vertex_t * data_;
+
+            /**
+             *  The number of vertices in the span.
+             */
+            std::size_t size_;
+    };
+
+    /**
+     *  Equality operator for a span.
+     *
+     *  @param[in] lhs  The span at the left-hand side of the operator.
+     *  @param[in] rhs  The vector at the right-hand side of the operator.
+     *
+     *  @return True if the span contains the same vertices in the same order as the vector, false otherwise.
+     */
+    inline bool operator==(const htd::VertexSpan & lhs, const std::vector<htd::vertex_t> & rhs)
+    {
+        return lhs == htd::VertexSpan(rhs);
+    }
+
+    /**
+     *  Equality operator for a span.
+     *
+     *  @param[in] lhs  The vector at the left-hand side of the operator.
+     *  @param[in] rhs  The span at the right-hand side of the operator.
+     *
+     *  @return True if the vector contains the same vertices in the same order as the span, false otherwise.
+     */
+    inline bool operator==(const std::vector<htd::vertex_t> & lhs, const htd::VertexSpan & rhs)
+    {
+        return htd::VertexSpan(lhs) == rhs;
+    }
+
+    /**
+     *  Inequality operator for a span.
+     *
+     *  @param[in] lhs  The span at the left-hand side of the operator.
+     *  @param[in] rhs  The vector at the right-hand side of the operator.
+     *
+     *  @return True if the span does not contain the same vertices in the same order as the vector, false otherwise.
+     */
+    inline bool operator!=(const htd::VertexSpan & lhs, const std::vector<htd::vertex_t> & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    /**
+     *  Inequality operator for a span.
+     *
+     *  @param[in] lhs  The vector at the left-hand side of the operator.
+     *  @param[in] rhs  The span at the right-hand side of the operator.
+     *
+     *  @return True if the vector does not contain the same vertices in the same order as the span, false otherwise.
+     */
+    inline bool operator!=(const std::vector<htd::vertex_t> & lhs, const htd::VertexSpan & rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
+
+#endif /* HTD_HTD_VERTEXSPAN_HPP */
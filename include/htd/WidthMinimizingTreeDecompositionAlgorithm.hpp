@@ -229,6 +229,10 @@ namespace htd
             /**
              *  Set the number of iterations which shall be performed (0=infinite).
              *
+             *  @note The algorithm stops early as soon as the width of the best decomposition found so far matches a lower bound
+             *  for the treewidth, i.e., the one provided by the preprocessed input graph (see htd::IPreprocessedGraph::minTreeWidth())
+             *  or the one computed by htd::TreeWidthLowerBoundAlgorithm once the first decomposition is found.
+             *
              *  @param[in] iterationCount   The number of iterations which shall be performed.
              */
             HTD_API void setIterationCount(std::size_t iterationCount);
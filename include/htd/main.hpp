@@ -30,22 +30,30 @@
 #include <htd/AddEmptyRootOperation.hpp>
 #include <htd/AddIdenticalJoinNodeParentOperation.hpp>
 #include <htd/Algorithm.hpp>
+#include <htd/ApproximateMinimumDegreeOrderingAlgorithm.hpp>
 #include <htd/AssemblyInfo.hpp>
+#include <htd/Bag.hpp>
+#include <htd/BagArena.hpp>
 #include <htd/BiconnectedComponentAlgorithm.hpp>
 #include <htd/BidirectionalGraphNaming.hpp>
 #include <htd/BreadthFirstGraphTraversal.hpp>
 #include <htd/BucketEliminationGraphDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 #include <htd/CliqueMinimalSeparatorAlgorithm.hpp>
 #include <htd/Collection.hpp>
 #include <htd/CombinedWidthMinimizingTreeDecompositionAlgorithm.hpp>
+#include <htd/CompactHypergraph.hpp>
 #include <htd/CompressionOperation.hpp>
 #include <htd/ConnectedComponentAlgorithmFactory.hpp>
+#include <htd/ConnectedComponentGraph.hpp>
 #include <htd/ConstCollection.hpp>
+#include <htd/ConstIndexedIteratorWrapper.hpp>
 #include <htd/ConstIteratorBase.hpp>
 #include <htd/ConstIterator.hpp>
 #include <htd/ConstIteratorWrapper.hpp>
 #include <htd/ConstPointerIteratorWrapper.hpp>
+#include <htd/DenseVertexMap.hpp>
 #include <htd/DepthFirstConnectedComponentAlgorithm.hpp>
 #include <htd/DepthFirstGraphTraversal.hpp>
 #include <htd/DinitzMaxFlowAlgorithm.hpp>
@@ -54,6 +62,8 @@
 #include <htd/DirectedMultiGraphFactory.hpp>
 #include <htd/DirectedMultiGraph.hpp>
 #include <htd/EnhancedMaximumCardinalitySearchOrderingAlgorithm.hpp>
+#include <htd/ExactOrderingAlgorithm.hpp>
+#include <htd/ExactTreeDecompositionAlgorithm.hpp>
 #include <htd/ExchangeNodeReplacementOperation.hpp>
 #include <htd/ExhaustiveVertexSelectionStrategy.hpp>
 #include <htd/FilteredHyperedgeCollection.hpp>
@@ -197,6 +207,7 @@
 #include <htd/MinimumSeparatorAlgorithm.hpp>
 #include <htd/MultiGraphFactory.hpp>
 #include <htd/MultiGraph.hpp>
+#include <htd/MultiHypergraphBuilder.hpp>
 #include <htd/MultiHypergraphFactory.hpp>
 #include <htd/MultiHypergraph.hpp>
 #include <htd/NamedDirectedGraph.hpp>
@@ -222,12 +233,15 @@
 #include <htd/PreprocessorDefinitions.hpp>
 #include <htd/PriorityQueue.hpp>
 #include <htd/ProvideStaticOrderingAlgorithm.hpp>
+#include <htd/RandomNumberGenerator.hpp>
 #include <htd/RandomOrderingAlgorithm.hpp>
 #include <htd/RandomVertexSelectionStrategy.hpp>
+#include <htd/SafeSeparatorOrderingAlgorithm.hpp>
 #include <htd/SemiNormalizationOperation.hpp>
 #include <htd/SeparatorBasedTreeDecompositionAlgorithm.hpp>
 #include <htd/SetCoverAlgorithmFactory.hpp>
 #include <htd/SetCoverAlgorithm.hpp>
+#include <htd/SetKernels.hpp>
 #include <htd/SingleNeighborVertexSelectionStrategy.hpp>
 #include <htd/State.hpp>
 #include <htd/StronglyConnectedComponentAlgorithmFactory.hpp>
@@ -238,6 +252,7 @@
 #include <htd/TreeDecompositionOptimizationOperation.hpp>
 #include <htd/TreeDecompositionVerifier.hpp>
 #include <htd/Tree.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 #include <htd/TriangulationMinimizationOrderingAlgorithm.hpp>
 #include <htd/TrivialTreeDecompositionAlgorithm.hpp>
 #include <htd/VectorAdapterConstIteratorWrapper.hpp>
@@ -245,6 +260,7 @@
 #include <htd/VectorAdapterIteratorWrapper.hpp>
 #include <htd/Vertex.hpp>
 #include <htd/VertexOrdering.hpp>
+#include <htd/VertexSpan.hpp>
 #include <htd/WeakNormalizationOperation.hpp>
 #include <htd/WidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/WidthReductionOperation.hpp>
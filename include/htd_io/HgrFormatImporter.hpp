@@ -28,6 +28,7 @@
 #include <htd_io/PreprocessorDefinitions.hpp>
 
 #include <htd/IMultiHypergraph.hpp>
+#include <htd/CompactHypergraph.hpp>
 
 #include <string>
 #include <iostream>
@@ -70,6 +71,28 @@ namespace htd_io
              */
             HTD_IO_API htd::IMultiHypergraph * import(std::istream & stream) const;
 
+            /**
+             *  Create a new immutable CompactHypergraph instance based on the information stored in a given file.
+             *
+             *  The edges are loaded directly into the compact representation, i.e., no mutable graph is built in between.
+             *
+             *  @param[in] path The path to the file from which the information can be read.
+             *
+             *  @return A new CompactHypergraph instance based on the information stored in the given file.
+             */
+            HTD_IO_API htd::CompactHypergraph * importCompact(const std::string & path) const;
+
+            /**
+             *  Create a new immutable CompactHypergraph instance based on the information from a given stream.
+             *
+             *  The edges are loaded directly into the compact representation, i.e., no mutable graph is built in between.
+             *
+             *  @param[in] stream   The input stream from which the information can be read.
+             *
+             *  @return A new CompactHypergraph instance based on the information from the given stream.
+             */
+            HTD_IO_API htd::CompactHypergraph * importCompact(std::istream & stream) const;
+
         private:
             struct Implementation;
 
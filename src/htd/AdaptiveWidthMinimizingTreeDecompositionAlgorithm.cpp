@@ -27,10 +27,13 @@
 
 #include <htd/AdaptiveWidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/ExactTreeDecompositionAlgorithm.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
+#include <algorithm>
 #include <cstdarg>
 
 /**
@@ -114,6 +117,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
      *  @param[in] progressCallback         A callback function which is invoked for each new decomposition.
      *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in] minimumMaxBagSize        The lower bound for the maximum bag size of each decomposition of the graph. The algorithm stops as soon as it is reached.
      *
      *  @note The maximum bag size of the computed decomposition must be less than or equal to the provided upper bound.
      *
@@ -129,7 +133,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
                                                            const htd::IMultiHypergraph & graph,
                                                            const htd::IPreprocessedGraph & preprocessedGraph,
                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const;
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t minimumMaxBagSize) const;
 
     /**
      *  Compute a decomposition of the given graph and apply the given manipulation operations to it.
@@ -140,6 +144,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  @param[in] manipulationOperations   The manipulation operations which shall be applied.
      *  @param[in] progressCallback         A callback function which is invoked for each new decomposition.
      *  @param[in] maxBagSize               The upper bound for the maximum bag size of the computed decomposition.
+     *  @param[in] minimumMaxBagSize        The lower bound for the maximum bag size of each decomposition of the graph. The algorithm stops as soon as it is reached.
      *
      *  @note The maximum bag size of the computed decomposition must be less than or equal to the provided upper bound.
      *
@@ -155,7 +160,7 @@ struct htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::Implementation
                                                            const htd::IMultiHypergraph & graph,
                                                            const htd::IPreprocessedGraph & preprocessedGraph,
                                                            const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const;
+                                                           const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t minimumMaxBagSize) const;
 };
 
 htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm::AdaptiveWidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -321,6 +326,11 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     htd::ITreeDecomposition * ret = nullptr;
 
+    /* A decomposition whose width matches the lower bound for the treewidth cannot be improved any further. */
+    std::size_t minimumMaxBagSize = preprocessedGraph.minTreeWidth() + 1;
+
+    bool lowerBoundComputed = false;
+
     std::vector<std::size_t> minimalWidths(implementation_->algorithms_.size(), (std::size_t)-1);
     std::vector<std::size_t> accumulatedWidths(implementation_->algorithms_.size());
 
@@ -334,11 +344,13 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         }
     }
 
-    for (htd::index_t round = 0; round < implementation_->decisionRounds_ && !managementInstance.isTerminated(); ++round)
+    bool optimal = false;
+
+    for (htd::index_t round = 0; round < implementation_->decisionRounds_ && !managementInstance.isTerminated() && !optimal; ++round)
     {
         htd::index_t algorithmIndex = 0;
 
-        for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated(); ++it)
+        for (auto it = implementation_->algorithms_.begin(); it != implementation_->algorithms_.end() && !managementInstance.isTerminated() && !optimal; ++it)
         {
             if (disqualifiedAlgorithms.count(algorithmIndex) == 0)
             {
@@ -361,6 +373,9 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                     {
                         std::size_t currentMaxBagSize = currentDecomposition->maximumBagSize();
 
+                        /* The exact algorithm only returns decompositions whose width is proven to be optimal. */
+                        bool exact = dynamic_cast<const htd::ExactTreeDecompositionAlgorithm *>(*it) != nullptr;
+
                         accumulatedWidths[algorithmIndex] += currentMaxBagSize;
 
                         if (currentMaxBagSize < minimalWidths[algorithmIndex])
@@ -377,11 +392,25 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                             ret = currentDecomposition;
 
                             bestMaxBagSize = currentMaxBagSize;
+
+                            /* The lower bound only pays off once a decomposition exists whose optimality is not proven yet. */
+                            if (!lowerBoundComputed && !exact && bestMaxBagSize > minimumMaxBagSize)
+                            {
+                                htd::TreeWidthLowerBoundAlgorithm lowerBoundAlgorithm(implementation_->managementInstance_);
+
+                                minimumMaxBagSize = std::max(minimumMaxBagSize, lowerBoundAlgorithm.computeLowerBound(preprocessedGraph, bestMaxBagSize - 1) + 1);
+
+                                lowerBoundComputed = true;
+                            }
+
+                            optimal = bestMaxBagSize <= minimumMaxBagSize;
                         }
                         else
                         {
                             delete currentDecomposition;
                         }
+
+                        optimal = optimal || exact;
                     }
                     else
                     {
@@ -422,6 +451,16 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         }
     }
 
+    if (optimal)
+    {
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return ret;
+    }
+
     std::size_t optimum = (std::size_t)-1;
 
     std::vector<htd::index_t> pool;
@@ -446,13 +485,13 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
         }
     }
 
-    htd::ITreeDecompositionAlgorithm * selectedAlgorithm = implementation_->algorithms_[htd::selectRandomElement<htd::index_t>(pool)];
+    htd::ITreeDecompositionAlgorithm * selectedAlgorithm = implementation_->algorithms_[htd::selectRandomElement<htd::index_t>(pool, implementation_->managementInstance_->randomNumberGenerator())];
 
     htd::BucketEliminationTreeDecompositionAlgorithm * bucketEliminationTreeDecompositionAlgorithm = dynamic_cast<htd::BucketEliminationTreeDecompositionAlgorithm *>(selectedAlgorithm);
 
     if (bucketEliminationTreeDecompositionAlgorithm != nullptr)
     {
-        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*bucketEliminationTreeDecompositionAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1);
+        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*bucketEliminationTreeDecompositionAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1, minimumMaxBagSize);
 
         if (currentDecomposition != nullptr)
         {
@@ -467,7 +506,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
     }
     else
     {
-        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*selectedAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1);
+        htd::ITreeDecomposition * currentDecomposition = implementation_->computeImprovedDecomposition(*selectedAlgorithm, graph, preprocessedGraph, manipulationOperations, progressCallback, bestMaxBagSize - 1, minimumMaxBagSize);
 
         if (currentDecomposition != nullptr)
         {
@@ -659,7 +698,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                                const htd::IMultiHypergraph & graph,
                                                                                                                                const htd::IPreprocessedGraph & preprocessedGraph,
                                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
+                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t minimumMaxBagSize) const
 {
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
@@ -669,7 +708,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t nonImprovementCount = 0;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    while (remainingIterations > 0 && !managementInstance_->isTerminated() && (ret == nullptr || bestMaxBagSize > minimumMaxBagSize))
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -751,7 +790,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
                                                                                                                                const htd::IMultiHypergraph & graph,
                                                                                                                                const htd::IPreprocessedGraph & preprocessedGraph,
                                                                                                                                const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
-                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
+                                                                                                                               const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize, std::size_t minimumMaxBagSize) const
 {
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
@@ -759,7 +798,7 @@ htd::ITreeDecomposition * htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm
 
     std::size_t remainingIterations = iterationCount_;
 
-    while (remainingIterations > 0 && !managementInstance_->isTerminated())
+    while (remainingIterations > 0 && !managementInstance_->isTerminated() && (ret == nullptr || bestMaxBagSize > minimumMaxBagSize))
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
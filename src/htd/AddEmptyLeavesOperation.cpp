@@ -99,7 +99,7 @@ void htd::AddEmptyLeavesOperation::apply(const htd::IMultiHypergraph & graph, ht
             {
                 htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newLeaf);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(newLeaf), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(newLeaf)), *labelCollection);
 
                 delete labelCollection;
 
@@ -128,7 +128,7 @@ void htd::AddEmptyLeavesOperation::apply(const htd::IMultiHypergraph & graph, ht
             {
                 htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newLeaf);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(newLeaf), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(newLeaf)), *labelCollection);
 
                 delete labelCollection;
 
@@ -172,7 +172,7 @@ void htd::AddEmptyLeavesOperation::apply(const htd::IMultiHypergraph & graph, ht
             {
                 htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newLeaf);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(newLeaf), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(newLeaf)), *labelCollection);
 
                 delete labelCollection;
 
@@ -201,7 +201,7 @@ void htd::AddEmptyLeavesOperation::apply(const htd::IMultiHypergraph & graph, ht
             {
                 htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newLeaf);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(newLeaf), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(newLeaf)), *labelCollection);
 
                 delete labelCollection;
 
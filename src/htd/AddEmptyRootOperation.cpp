@@ -88,9 +88,9 @@ void htd::AddEmptyRootOperation::apply(const htd::IMultiHypergraph & graph, htd:
         {
             htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newRoot);
 
-            const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(newRoot);
+            const htd::Bag & bagContent = decomposition.bagContent(newRoot);
 
-            htd::ILabel * newLabel = labelingFunction->computeLabel(bagContent, *labelCollection);
+            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bagContent), *labelCollection);
 
             delete labelCollection;
 
@@ -118,9 +118,9 @@ void htd::AddEmptyRootOperation::apply(const htd::IMultiHypergraph & graph, htd:
             {
                 htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newRoot);
 
-                const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(newRoot);
+                const htd::Bag & bagContent = decomposition.bagContent(newRoot);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(bagContent, *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bagContent), *labelCollection);
 
                 delete labelCollection;
 
@@ -158,9 +158,9 @@ void htd::AddEmptyRootOperation::apply(const htd::IMultiHypergraph & graph, htd:
         {
             htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newRoot);
 
-            const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(newRoot);
+            const htd::Bag & bagContent = decomposition.bagContent(newRoot);
 
-            htd::ILabel * newLabel = labelingFunction->computeLabel(bagContent, *labelCollection);
+            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bagContent), *labelCollection);
 
             delete labelCollection;
 
@@ -188,9 +188,9 @@ void htd::AddEmptyRootOperation::apply(const htd::IMultiHypergraph & graph, htd:
             {
                 htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newRoot);
 
-                const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(newRoot);
+                const htd::Bag & bagContent = decomposition.bagContent(newRoot);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(bagContent, *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bagContent), *labelCollection);
 
                 delete labelCollection;
 
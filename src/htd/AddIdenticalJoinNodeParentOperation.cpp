@@ -94,7 +94,7 @@ void htd::AddIdenticalJoinNodeParentOperation::apply(const htd::IMultiHypergraph
 
     for (htd::vertex_t node : joinNodeCollection)
     {
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+        const htd::Bag & bag = decomposition.bagContent(node);
 
         DEBUGGING_CODE(
         std::cout << "JOIN NODE: " << node << std::endl;
@@ -107,7 +107,7 @@ void htd::AddIdenticalJoinNodeParentOperation::apply(const htd::IMultiHypergraph
         {
             htd::vertex_t newParent = decomposition.addParent(node);
 
-            decomposition.mutableBagContent(newParent) = bag;
+            decomposition.setBagContent(newParent, bag);
 
             decomposition.mutableInducedHyperedges(newParent) = decomposition.inducedHyperedges(node);
 
@@ -115,7 +115,7 @@ void htd::AddIdenticalJoinNodeParentOperation::apply(const htd::IMultiHypergraph
             {
                 htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newParent);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(bag, *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bag), *labelCollection);
 
                 delete labelCollection;
 
@@ -134,7 +134,7 @@ void htd::AddIdenticalJoinNodeParentOperation::apply(const htd::IMultiHypergraph
     {
         if (decomposition.isJoinNode(vertex))
         {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const htd::Bag & bag = decomposition.bagContent(vertex);
 
             DEBUGGING_CODE(
             std::cout << "JOIN NODE: " << vertex << std::endl;
@@ -147,7 +147,7 @@ void htd::AddIdenticalJoinNodeParentOperation::apply(const htd::IMultiHypergraph
             {
                 htd::vertex_t newParent = decomposition.addParent(vertex);
 
-                decomposition.mutableBagContent(newParent) = bag;
+                decomposition.setBagContent(newParent, bag);
 
                 decomposition.mutableInducedHyperedges(newParent) = decomposition.inducedHyperedges(vertex);
 
@@ -155,7 +155,7 @@ void htd::AddIdenticalJoinNodeParentOperation::apply(const htd::IMultiHypergraph
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newParent);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(bag, *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bag), *labelCollection);
 
                     delete labelCollection;
 
@@ -0,0 +1,572 @@
+/* 
+ * File:   ApproximateMinimumDegreeOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_APPROXIMATEMINIMUMDEGREEORDERINGALGORITHM_CPP
+#define HTD_HTD_APPROXIMATEMINIMUMDEGREEORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/ApproximateMinimumDegreeOrderingAlgorithm.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/VertexOrdering.hpp>
+#include <htd/BucketPriorityQueue.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::ApproximateMinimumDegreeOrderingAlgorithm.
+ */
+struct htd::ApproximateMinimumDegreeOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The role of a vertex within the quotient graph.
+     */
+    enum class State : unsigned char
+    {
+        /**
+         *  The vertex is not part of the quotient graph (anymore).
+         */
+        INACTIVE,
+
+        /**
+         *  The vertex is not eliminated yet and it represents its supervariable.
+         */
+        VARIABLE,
+
+        /**
+         *  The vertex is eliminated and represents the element holding its neighborhood at the time of elimination.
+         */
+        ELEMENT,
+
+        /**
+         *  The vertex is not eliminated yet and it was merged into the supervariable of another vertex.
+         */
+        MERGED
+    };
+
+    /**
+     *  Marker for the end of the member list of a supervariable.
+     */
+    static const htd::vertex_t NO_MEMBER = std::numeric_limits<htd::vertex_t>::max();
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Remove all vertices from the content of an element which do not represent a supervariable anymore.
+     *
+     *  @param[in,out] content  The content of the element.
+     *  @param[in] states       The roles of the vertices within the quotient graph.
+     *  @param[in] weights      The weights of the supervariables.
+     *
+     *  @return The total weight of the supervariables remaining in the content of the element.
+     */
+    static std::size_t compactElement(std::vector<htd::vertex_t> & content, const std::vector<State> & states, const std::vector<std::size_t> & weights)
+    {
+        std::size_t ret = 0;
+
+        std::size_t remainingCount = 0;
+
+        for (htd::vertex_t vertex : content)
+        {
+            if (states[vertex] == State::VARIABLE)
+            {
+                content[remainingCount] = vertex;
+
+                ++remainingCount;
+
+                ret += weights[vertex];
+            }
+        }
+
+        content.resize(remainingCount);
+
+        return ret;
+    }
+
+    /**
+     *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] target              The target vector to which the computed ordering shall be appended.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of a decomposition based on the resulting ordering.
+     *
+     *  @return The maximum bag size of the decomposition which is obtained via bucket elimination using the input graph and the resulting ordering.
+     */
+    std::size_t writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT;
+};
+
+const htd::vertex_t htd::ApproximateMinimumDegreeOrderingAlgorithm::Implementation::NO_MEMBER;
+
+htd::ApproximateMinimumDegreeOrderingAlgorithm::ApproximateMinimumDegreeOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+    
+}
+            
+htd::ApproximateMinimumDegreeOrderingAlgorithm::~ApproximateMinimumDegreeOrderingAlgorithm()
+{
+    
+}
+
+htd::IVertexOrdering * htd::ApproximateMinimumDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinimumDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IWidthLimitedVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph, maxBagSize, maxIterationCount);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::ApproximateMinimumDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    return computeOrdering(graph, preprocessedGraph, (std::size_t)-1, 1);
+}
+
+htd::IWidthLimitedVertexOrdering * htd::ApproximateMinimumDegreeOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const HTD_NOEXCEPT
+{
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    std::vector<htd::vertex_t> ordering;
+    ordering.reserve(graph.vertexCount());
+
+    std::size_t iterations = 0;
+
+    std::size_t currentMaxBagSize = (std::size_t)-1;
+
+    do
+    {
+        ordering.clear();
+
+        currentMaxBagSize = implementation_->writeOrderingTo(preprocessedGraph, ordering, maxBagSize);
+
+        ++iterations;
+    }
+    while (currentMaxBagSize > maxBagSize && iterations < maxIterationCount && !managementInstance.isTerminated());
+
+    if (maxIterationCount == 0 && currentMaxBagSize > maxBagSize)
+    {
+        ordering.clear();
+
+        currentMaxBagSize = 0;
+    }
+
+    return new htd::VertexOrdering(std::move(ordering), iterations, currentMaxBagSize);
+}
+
+std::size_t htd::ApproximateMinimumDegreeOrderingAlgorithm::Implementation::writeOrderingTo(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<htd::vertex_t> & target, std::size_t maxBagSize) const HTD_NOEXCEPT
+{
+    std::size_t ret = 0;
+
+    const std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
+
+    std::size_t vertexCount = neighborhood.size();
+
+    std::vector<std::vector<htd::vertex_t>> variableNeighbors(vertexCount);
+
+    std::vector<std::vector<htd::vertex_t>> elementNeighbors(vertexCount);
+
+    std::vector<std::vector<htd::vertex_t>> elementContent(vertexCount);
+
+    std::vector<State> states(vertexCount, State::INACTIVE);
+
+    std::vector<std::size_t> weights(vertexCount, 1);
+
+    std::vector<std::size_t> degrees(vertexCount, 0);
+
+    std::vector<std::size_t> newDegrees(vertexCount, 0);
+
+    std::vector<htd::vertex_t> nextMember(vertexCount, NO_MEMBER);
+
+    std::vector<htd::vertex_t> lastMember(vertexCount);
+
+    std::vector<std::size_t> marks(vertexCount, 0);
+
+    std::vector<std::size_t> externalWeights(vertexCount, 0);
+
+    std::vector<std::size_t> externalWeightMarks(vertexCount, 0);
+
+    std::vector<std::size_t> comparisonMarks(vertexCount, 0);
+
+    std::vector<std::pair<std::size_t, htd::vertex_t>> signatures;
+
+    std::size_t currentMark = 0;
+
+    std::size_t currentComparisonMark = 0;
+
+    std::size_t remainingWeight = 0;
+
+    htd::BucketPriorityQueue<htd::vertex_t, std::greater<std::size_t>> priorityQueue;
+
+    target.insert(target.end(),
+                  preprocessedGraph.eliminationSequence().begin(),
+                  preprocessedGraph.eliminationSequence().end());
+
+    ret = preprocessedGraph.minTreeWidth() + 1;
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        states[vertex] = State::VARIABLE;
+
+        lastMember[vertex] = vertex;
+
+        ++remainingWeight;
+    }
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        std::vector<htd::vertex_t> & currentNeighbors = variableNeighbors[vertex];
+
+        for (htd::vertex_t neighbor : neighborhood[vertex])
+        {
+            if (neighbor != vertex && states[neighbor] == State::VARIABLE)
+            {
+                currentNeighbors.push_back(neighbor);
+            }
+        }
+
+        degrees[vertex] = currentNeighbors.size();
+
+        priorityQueue.push(vertex, degrees[vertex]);
+    }
+
+    htd::RandomNumberGenerator & randomNumberGenerator = managementInstance_->randomNumberGenerator();
+
+    while (remainingWeight > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
+    {
+        htd::vertex_t pivot = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), randomNumberGenerator);
+
+        priorityQueue.eraseFromTopCollection(pivot);
+
+        remainingWeight -= weights[pivot];
+
+        ++currentMark;
+
+        marks[pivot] = currentMark;
+
+        /* Collect the neighborhood of the pivot in the elimination graph, i.e., its variable neighbors and the content of its adjacent elements. */
+        std::vector<htd::vertex_t> & pivotContent = elementContent[pivot];
+
+        std::size_t pivotContentWeight = 0;
+
+        for (htd::vertex_t neighbor : variableNeighbors[pivot])
+        {
+            if (states[neighbor] == State::VARIABLE && marks[neighbor] != currentMark)
+            {
+                marks[neighbor] = currentMark;
+
+                pivotContent.push_back(neighbor);
+
+                pivotContentWeight += weights[neighbor];
+            }
+        }
+
+        for (htd::vertex_t element : elementNeighbors[pivot])
+        {
+            if (states[element] == State::ELEMENT)
+            {
+                for (htd::vertex_t neighbor : elementContent[element])
+                {
+                    if (states[neighbor] == State::VARIABLE && marks[neighbor] != currentMark)
+                    {
+                        marks[neighbor] = currentMark;
+
+                        pivotContent.push_back(neighbor);
+
+                        pivotContentWeight += weights[neighbor];
+                    }
+                }
+
+                states[element] = State::INACTIVE;
+
+                std::vector<htd::vertex_t>().swap(elementContent[element]);
+            }
+        }
+
+        std::vector<htd::vertex_t>().swap(variableNeighbors[pivot]);
+
+        std::vector<htd::vertex_t>().swap(elementNeighbors[pivot]);
+
+        states[pivot] = State::ELEMENT;
+
+        if (pivotContentWeight + weights[pivot] > ret)
+        {
+            ret = pivotContentWeight + weights[pivot];
+        }
+
+        for (htd::vertex_t member = pivot; member != NO_MEMBER; member = nextMember[member])
+        {
+            target.push_back(preprocessedGraph.vertexName(member));
+        }
+
+        /* Compute the weight of the part of each element adjacent to the new element which is not covered by the new element. */
+        for (htd::vertex_t vertex : pivotContent)
+        {
+            for (htd::vertex_t element : elementNeighbors[vertex])
+            {
+                if (states[element] == State::ELEMENT)
+                {
+                    if (externalWeightMarks[element] != currentMark)
+                    {
+                        externalWeightMarks[element] = currentMark;
+
+                        externalWeights[element] = compactElement(elementContent[element], states, weights);
+                    }
+
+                    externalWeights[element] -= weights[vertex];
+                }
+            }
+        }
+
+        /* Update the adjacency lists and compute the approximate external degree of each vertex adjacent to the new element. */
+        signatures.clear();
+
+        for (htd::vertex_t vertex : pivotContent)
+        {
+            std::size_t signature = pivot;
+
+            std::size_t externalDegree = pivotContentWeight - weights[vertex];
+
+            std::vector<htd::vertex_t> & currentElementNeighbors = elementNeighbors[vertex];
+
+            std::size_t remainingElementCount = 0;
+
+            for (htd::vertex_t element : currentElementNeighbors)
+            {
+                if (states[element] == State::ELEMENT)
+                {
+                    if (externalWeights[element] == 0)
+                    {
+                        states[element] = State::INACTIVE;
+
+                        std::vector<htd::vertex_t>().swap(elementContent[element]);
+                    }
+                    else
+                    {
+                        currentElementNeighbors[remainingElementCount] = element;
+
+                        ++remainingElementCount;
+
+                        externalDegree += externalWeights[element];
+
+                        signature += element;
+                    }
+                }
+            }
+
+            currentElementNeighbors.resize(remainingElementCount);
+
+            currentElementNeighbors.push_back(pivot);
+
+            std::vector<htd::vertex_t> & currentVariableNeighbors = variableNeighbors[vertex];
+
+            std::size_t remainingVariableCount = 0;
+
+            for (htd::vertex_t neighbor : currentVariableNeighbors)
+            {
+                if (states[neighbor] == State::VARIABLE && marks[neighbor] != currentMark)
+                {
+                    currentVariableNeighbors[remainingVariableCount] = neighbor;
+
+                    ++remainingVariableCount;
+
+                    externalDegree += weights[neighbor];
+
+                    signature += neighbor;
+                }
+            }
+
+            currentVariableNeighbors.resize(remainingVariableCount);
+
+            newDegrees[vertex] = std::min(std::min(externalDegree, degrees[vertex] + pivotContentWeight - weights[vertex]), remainingWeight - weights[vertex]);
+
+            signatures.emplace_back(signature, vertex);
+        }
+
+        /* Merge vertices with identical adjacency lists into supervariables. */
+        std::sort(signatures.begin(), signatures.end());
+
+        for (auto it = signatures.begin(); it != signatures.end(); ++it)
+        {
+            htd::vertex_t vertex = it->second;
+
+            if (states[vertex] == State::VARIABLE)
+            {
+                bool marked = false;
+
+                for (auto it2 = it + 1; it2 != signatures.end() && it2->first == it->first; ++it2)
+                {
+                    htd::vertex_t candidate = it2->second;
+
+                    if (states[candidate] == State::VARIABLE &&
+                        elementNeighbors[candidate].size() == elementNeighbors[vertex].size() &&
+                        variableNeighbors[candidate].size() == variableNeighbors[vertex].size())
+                    {
+                        if (!marked)
+                        {
+                            ++currentComparisonMark;
+
+                            for (htd::vertex_t element : elementNeighbors[vertex])
+                            {
+                                comparisonMarks[element] = currentComparisonMark;
+                            }
+
+                            for (htd::vertex_t neighbor : variableNeighbors[vertex])
+                            {
+                                comparisonMarks[neighbor] = currentComparisonMark;
+                            }
+
+                            marked = true;
+                        }
+
+                        bool identical = true;
+
+                        for (auto element = elementNeighbors[candidate].begin(); identical && element != elementNeighbors[candidate].end(); ++element)
+                        {
+                            identical = comparisonMarks[*element] == currentComparisonMark;
+                        }
+
+                        for (auto neighbor = variableNeighbors[candidate].begin(); identical && neighbor != variableNeighbors[candidate].end(); ++neighbor)
+                        {
+                            identical = comparisonMarks[*neighbor] == currentComparisonMark;
+                        }
+
+                        if (identical)
+                        {
+                            priorityQueue.erase(candidate, degrees[candidate]);
+
+                            newDegrees[vertex] -= std::min(newDegrees[vertex], weights[candidate]);
+
+                            weights[vertex] += weights[candidate];
+
+                            nextMember[lastMember[vertex]] = candidate;
+
+                            lastMember[vertex] = lastMember[candidate];
+
+                            states[candidate] = State::MERGED;
+
+                            std::vector<htd::vertex_t>().swap(variableNeighbors[candidate]);
+
+                            std::vector<htd::vertex_t>().swap(elementNeighbors[candidate]);
+                        }
+                    }
+                }
+            }
+        }
+
+        std::size_t remainingContentCount = 0;
+
+        for (htd::vertex_t vertex : pivotContent)
+        {
+            if (states[vertex] == State::VARIABLE)
+            {
+                priorityQueue.updatePriority(vertex, degrees[vertex], newDegrees[vertex]);
+
+                degrees[vertex] = newDegrees[vertex];
+
+                pivotContent[remainingContentCount] = vertex;
+
+                ++remainingContentCount;
+            }
+        }
+
+        pivotContent.resize(remainingContentCount);
+
+        if (pivotContent.empty())
+        {
+            states[pivot] = State::INACTIVE;
+
+            std::vector<htd::vertex_t>().swap(pivotContent);
+        }
+    }
+
+    return ret;
+}
+
+bool htd::ApproximateMinimumDegreeOrderingAlgorithm::supportsComponentOrdering(void) const HTD_NOEXCEPT
+{
+    return true;
+}
+
+const htd::LibraryInstance * htd::ApproximateMinimumDegreeOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ApproximateMinimumDegreeOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::ApproximateMinimumDegreeOrderingAlgorithm * htd::ApproximateMinimumDegreeOrderingAlgorithm::clone(void) const
+{
+    return new htd::ApproximateMinimumDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::ApproximateMinimumDegreeOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinimumDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+
+htd::IWidthLimitableOrderingAlgorithm * htd::ApproximateMinimumDegreeOrderingAlgorithm::cloneWidthLimitableOrderingAlgorithm(void) const
+{
+    return new htd::ApproximateMinimumDegreeOrderingAlgorithm(implementation_->managementInstance_);
+}
+#endif
+
+#endif /* HTD_HTD_APPROXIMATEMINIMUMDEGREEORDERINGALGORITHM_CPP */
@@ -0,0 +1,411 @@
+/*
+ * File:   BagArena.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_BAGARENA_CPP
+#define HTD_HTD_BAGARENA_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/BagArena.hpp>
+#include <htd/DenseVertexMap.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::BagArena.
+ */
+struct htd::BagArena::Implementation
+{
+    /**
+     *  The minimum number of vertices which fit into a newly allocated block.
+     */
+    static const std::size_t MINIMUM_BLOCK_CAPACITY = 1024;
+
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void) : bags_(), materializedBags_(), blocks_(), blockCapacity_(0), blockSize_(0), storageSize_(0), bound_(htd::Vertex::FIRST)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original  The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : Implementation()
+    {
+        layout(original);
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The views on the bags, indexed by the vertex IDs.
+     */
+    htd::DenseVertexMap<htd::Bag> bags_;
+
+    /**
+     *  The vectors backing the bags which were handed out for modification.
+     */
+    std::unordered_map<htd::vertex_t, std::vector<htd::vertex_t>> materializedBags_;
+
+    /**
+     *  The blocks holding the contents of the bags.
+     */
+    std::vector<std::unique_ptr<htd::vertex_t[]>> blocks_;
+
+    /**
+     *  The number of vertices which fit into the last block.
+     */
+    std::size_t blockCapacity_;
+
+    /**
+     *  The number of vertices already placed in the last block.
+     */
+    std::size_t blockSize_;
+
+    /**
+     *  The number of vertices which fit into all blocks.
+     */
+    std::size_t storageSize_;
+
+    /**
+     *  The exclusive upper bound of the vertices for which a bag was stored so far.
+     */
+    htd::vertex_t bound_;
+
+    /**
+     *  Reserve space for the given number of vertices at the end of the last block.
+     *
+     *  @param[in] size The number of vertices.
+     *
+     *  @return A pointer to the reserved space.
+     */
+    htd::vertex_t * allocate(std::size_t size)
+    {
+        if (size == 0)
+        {
+            return nullptr;
+        }
+
+        if (blockSize_ + size > blockCapacity_)
+        {
+            std::size_t capacity = std::max(size, std::max(static_cast<std::size_t>(MINIMUM_BLOCK_CAPACITY), storageSize_));
+
+            blocks_.emplace_back(new htd::vertex_t[capacity]);
+
+            blockCapacity_ = capacity;
+
+            blockSize_ = 0;
+
+            storageSize_ += capacity;
+        }
+
+        htd::vertex_t * ret = blocks_.back().get() + blockSize_;
+
+        blockSize_ += size;
+
+        return ret;
+    }
+
+    /**
+     *  Check whether the storage reserved for the given bag ends where the unused space of the last block begins.
+     *
+     *  @param[in] bag  The bag.
+     *
+     *  @return True if the storage reserved for the given bag ends where the unused space of the last block begins, false otherwise.
+     */
+    bool isAtEnd(const htd::Bag & bag) const
+    {
+        return bag.capacity_ > 0 && bag.content_ + bag.capacity_ == blocks_.back().get() + blockSize_;
+    }
+
+    /**
+     *  Give the slot reserved for the given bag back to the arena. The bag is left without storage.
+     *
+     *  @param[in] bag  The bag.
+     */
+    void release(htd::Bag & bag)
+    {
+        if (isAtEnd(bag))
+        {
+            blockSize_ -= bag.capacity_;
+        }
+
+        bag.content_ = nullptr;
+        bag.size_ = 0;
+        bag.capacity_ = 0;
+    }
+
+    /**
+     *  Set the content of the bag of the given vertex.
+     *
+     *  @param[in] vertex   The vertex.
+     *  @param[in] content  A pointer to the first vertex of the new content.
+     *  @param[in] size     The size of the new content.
+     */
+    void assign(htd::vertex_t vertex, const htd::vertex_t * content, std::size_t size)
+    {
+        HTD_ASSERT(vertex != htd::Vertex::UNKNOWN)
+
+        htd::Bag & bag = bags_[vertex];
+
+        if (vertex >= bound_)
+        {
+            bound_ = vertex + 1;
+        }
+
+        /* A materialized bag is folded back into the arena. Its slot was released when it was materialized,
+         * so it gets a new one. The vector is kept alive until the new content is copied because the new
+         * content may be taken from the vector itself. */
+        std::vector<htd::vertex_t> materializedContent;
+
+        if (bag.materializedContent_ != nullptr)
+        {
+            materializedContent.swap(*(bag.materializedContent_));
+
+            materializedBags_.erase(vertex);
+
+            bag.materializedContent_ = nullptr;
+        }
+
+        if (size > bag.capacity_)
+        {
+            if (isAtEnd(bag) && blockSize_ - bag.capacity_ + size <= blockCapacity_)
+            {
+                blockSize_ += size - bag.capacity_;
+
+                bag.capacity_ = size;
+            }
+            else
+            {
+                /* A bag which already had content is likely to grow again, so reserve some headroom. */
+                std::size_t capacity = std::max(size, 2 * bag.capacity_);
+
+                /* The old slot cannot be reused because the new content does not fit into it, it is only
+                 * reclaimed by the next layout. */
+                bag.content_ = allocate(capacity);
+
+                bag.capacity_ = capacity;
+            }
+        }
+
+        if (bag.content_ != content)
+        {
+            std::copy(content, content + size, bag.content_);
+        }
+
+        bag.size_ = size;
+    }
+
+    /**
+     *  Lay out the bags of the given implementation details structure back to back in a single new block.
+     *
+     *  @param[in] source   The implementation details structure providing the bags. It may be the current one.
+     */
+    void layout(const Implementation & source)
+    {
+        std::size_t totalSize = source.contentSize();
+
+        std::unique_ptr<htd::vertex_t[]> block(totalSize > 0 ? new htd::vertex_t[totalSize] : nullptr);
+
+        htd::vertex_t * position = block.get();
+
+        for (htd::vertex_t vertex = htd::Vertex::FIRST; vertex < source.bound_; ++vertex)
+        {
+            if (source.bags_.contains(vertex))
+            {
+                const htd::Bag & bag = source.bags_.at(vertex);
+
+                std::size_t size = bag.size();
+
+                std::copy(bag.begin(), bag.end(), position);
+
+                htd::Bag & target = bags_[vertex];
+
+                target.content_ = size > 0 ? position : nullptr;
+                target.size_ = size;
+                target.capacity_ = size;
+                target.materializedContent_ = nullptr;
+
+                position += size;
+            }
+        }
+
+        materializedBags_.clear();
+
+        blocks_.clear();
+
+        if (totalSize > 0)
+        {
+            blocks_.push_back(std::move(block));
+        }
+
+        blockCapacity_ = totalSize;
+        blockSize_ = totalSize;
+        storageSize_ = totalSize;
+
+        bound_ = source.bound_;
+    }
+
+    /**
+     *  Getter for the total number of vertices stored in all bags.
+     *
+     *  @return The total number of vertices stored in all bags.
+     */
+    std::size_t contentSize(void) const
+    {
+        std::size_t ret = 0;
+
+        for (htd::vertex_t vertex = htd::Vertex::FIRST; vertex < bound_; ++vertex)
+        {
+            if (bags_.contains(vertex))
+            {
+                ret += bags_.at(vertex).size();
+            }
+        }
+
+        return ret;
+    }
+};
+
+htd::BagArena::BagArena(void) : implementation_(new Implementation())
+{
+
+}
+
+htd::BagArena::BagArena(const htd::BagArena & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::BagArena::~BagArena()
+{
+
+}
+
+std::size_t htd::BagArena::bagCount(void) const
+{
+    return implementation_->bags_.size();
+}
+
+bool htd::BagArena::isBag(htd::vertex_t vertex) const
+{
+    return implementation_->bags_.contains(vertex);
+}
+
+const htd::Bag & htd::BagArena::bagContent(htd::vertex_t vertex) const
+{
+    return implementation_->bags_.at(vertex);
+}
+
+std::vector<htd::vertex_t> & htd::BagArena::mutableBagContent(htd::vertex_t vertex)
+{
+    htd::Bag & bag = implementation_->bags_.at(vertex);
+
+    if (bag.materializedContent_ == nullptr)
+    {
+        std::vector<htd::vertex_t> & content = implementation_->materializedBags_[vertex];
+
+        content.assign(bag.content_, bag.content_ + bag.size_);
+
+        implementation_->release(bag);
+
+        bag.materializedContent_ = &content;
+    }
+
+    return *(bag.materializedContent_);
+}
+
+void htd::BagArena::setBagContent(htd::vertex_t vertex, const std::vector<htd::vertex_t> & content)
+{
+    implementation_->assign(vertex, content.data(), content.size());
+}
+
+void htd::BagArena::setBagContent(htd::vertex_t vertex, const htd::Bag & content)
+{
+    implementation_->assign(vertex, content.data(), content.size());
+}
+
+void htd::BagArena::removeBag(htd::vertex_t vertex)
+{
+    if (implementation_->bags_.contains(vertex))
+    {
+        htd::Bag & bag = implementation_->bags_.at(vertex);
+
+        if (bag.materializedContent_ != nullptr)
+        {
+            implementation_->materializedBags_.erase(vertex);
+        }
+
+        implementation_->release(bag);
+
+        implementation_->bags_.erase(vertex);
+
+        /* Without any bag left, no view can point into the blocks anymore, so they can be released right away. */
+        if (implementation_->bags_.size() == 0)
+        {
+            implementation_->layout(*implementation_);
+        }
+    }
+}
+
+void htd::BagArena::clear(void)
+{
+    implementation_.reset(new Implementation());
+}
+
+std::size_t htd::BagArena::contentSize(void) const
+{
+    return implementation_->contentSize();
+}
+
+std::size_t htd::BagArena::storageSize(void) const
+{
+    return implementation_->storageSize_;
+}
+
+void htd::BagArena::compact(void)
+{
+    implementation_->layout(*implementation_);
+}
+
+htd::BagArena & htd::BagArena::operator=(const htd::BagArena & original)
+{
+    if (this != &original)
+    {
+        implementation_.reset(new Implementation(*(original.implementation_)));
+    }
+
+    return *this;
+}
+
+#endif /* HTD_HTD_BAGARENA_CPP */
@@ -34,11 +34,16 @@
 #include <htd/IWidthLimitableOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
+#include <htd/PreprocessedGraph.hpp>
+#include <htd/ConnectedComponentGraph.hpp>
+#include <htd/VertexOrdering.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdarg>
 #include <functional>
 #include <memory>
+#include <numeric>
 #include <stack>
 #include <tuple>
 #include <unordered_map>
@@ -56,7 +61,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance()), labelingFunctions_(), postProcessingOperations_(), compressionEnabled_(true), computeInducedEdges_(true)
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance()), labelingFunctions_(), postProcessingOperations_(), compressionEnabled_(true), componentOrderingEnabled_(false), computeInducedEdges_(true)
     {
 
     }
@@ -101,6 +106,11 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      */
     bool compressionEnabled_;
 
+    /**
+     *  A boolean flag indicating whether the connected components of the input graph shall be ordered separately even if only a single thread may be used.
+     */
+    bool componentOrderingEnabled_;
+
     /**
      *  A boolean flag indicating whether the hyperedges induced by a respective bag shall be computed.
      */
@@ -128,6 +138,30 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      */
     std::pair<htd::IMutableGraphDecomposition *, std::size_t> computeMutableDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t maxBagSize, std::size_t maxIterationCount) const;
 
+    /**
+     *  Compute a vertex elimination ordering of the given graph by ordering each connected component of the preprocessed graph independently.
+     *
+     *  Each component is turned into a graph of its own, together with a matching preprocessed graph, so that the ordering
+     *  algorithm never sees vertices outside the component, neither in the graph nor in the preprocessed graph. The graph
+     *  of a component is built by the worker which orders the component and it is discarded right afterwards, hence at
+     *  most one component graph per worker is kept in memory at the same time.
+     *
+     *  The components are handed out to up to as many worker threads as the management instance allows, largest
+     *  components first, and each worker uses its own copy of the ordering algorithm. The ordering of each component
+     *  is computed with a random number generator derived from the index of the component, so that the result depends
+     *  neither on the number nor on the scheduling of the threads. The resulting ordering consists of the partial
+     *  ordering of the preprocessing phase followed by the orderings of the components.
+     *
+     *  @param[in] graph                The graph which shall be decomposed.
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[in] components           The vertices of the connected components of the preprocessed graph. There must be at least two components.
+     *  @param[in] maxBagSize           The upper bound for the maximum bag size of the decomposition. The value is only used for width-limitable ordering algorithms.
+     *  @param[in] maxIterationCount    The maximum number of iterations per component. The value is only used for width-limitable ordering algorithms.
+     *
+     *  @return The combined vertex elimination ordering. The returned ordering is incomplete if the ordering of at least one component is.
+     */
+    htd::IVertexOrdering * computeOrderingOfComponents(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<std::vector<htd::vertex_t>> & components, std::size_t maxBagSize, std::size_t maxIterationCount) const;
+
     /**
      *  Get the vertex which is ranked first in the vertex elimination ordering.
      *
@@ -137,7 +171,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *
      *  @return The vertex which is ranked first in the vertex elimination ordering.
      */
-    htd::vertex_t getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices) const;
+    htd::vertex_t getMinimumVertex(const htd::VertexSpan & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices) const;
 
     /**
      *  Get the vertex which is ranked first in the vertex elimination ordering.
@@ -240,7 +274,7 @@ struct htd::BucketEliminationGraphDecompositionAlgorithm::Implementation
      *  @param[in] originStack      The stack instance used for backtracking.
      */
     void distributeEdge(htd::index_t edgeIndex,
-                        const std::vector<htd::vertex_t> & edge,
+                        const htd::VertexSpan & edge,
                         htd::vertex_t startBucket,
                         const std::vector<std::vector<htd::vertex_t>> & buckets,
                         const std::vector<std::vector<htd::vertex_t>> & neighbors,
@@ -429,7 +463,7 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
             {
                 htd::ILabelCollection * labelCollection = decomposition->labelings().exportVertexLabelCollection(vertex);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition->bagContent(vertex), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition->bagContent(vertex)), *labelCollection);
 
                 delete labelCollection;
 
@@ -443,7 +477,7 @@ std::pair<htd::IGraphDecomposition *, std::size_t> htd::BucketEliminationGraphDe
             {
                 htd::ILabelCollection * labelCollection = decomposition->labelings().exportVertexLabelCollection(vertex);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition->bagContent(vertex), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition->bagContent(vertex)), *labelCollection);
 
                 delete labelCollection;
 
@@ -599,6 +633,16 @@ void htd::BucketEliminationGraphDecompositionAlgorithm::setCompressionEnabled(bo
     implementation_->compressionEnabled_ = compressionEnabled;
 }
 
+bool htd::BucketEliminationGraphDecompositionAlgorithm::isComponentOrderingEnabled(void) const
+{
+    return implementation_->componentOrderingEnabled_;
+}
+
+void htd::BucketEliminationGraphDecompositionAlgorithm::setComponentOrderingEnabled(bool componentOrderingEnabled)
+{
+    implementation_->componentOrderingEnabled_ = componentOrderingEnabled;
+}
+
 bool htd::BucketEliminationGraphDecompositionAlgorithm::isComputeInducedEdgesEnabled(void) const
 {
     return implementation_->computeInducedEdges_;
@@ -614,6 +658,7 @@ htd::BucketEliminationGraphDecompositionAlgorithm * htd::BucketEliminationGraphD
     htd::BucketEliminationGraphDecompositionAlgorithm * ret = new htd::BucketEliminationGraphDecompositionAlgorithm(implementation_->managementInstance_);
 
     ret->setCompressionEnabled(implementation_->compressionEnabled_);
+    ret->setComponentOrderingEnabled(implementation_->componentOrderingEnabled_);
     ret->setComputeInducedEdgesEnabled(implementation_->computeInducedEdges_);
 
     for (const auto & labelingFunction : implementation_->labelingFunctions_)
@@ -651,13 +696,34 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
 
     std::size_t iterations = 0;
 
+    std::shared_ptr<const std::vector<std::vector<htd::vertex_t>>> components;
+
+    const htd::PreprocessedGraph * componentSource = dynamic_cast<const htd::PreprocessedGraph *>(&preprocessedGraph);
+
+    /* The components are only ordered separately if they can be ordered in parallel or if this was requested explicitly, hence the
+     * single-threaded default remains the ordering of the whole graph. The result with more than one thread equals the result with
+     * component ordering enabled explicitly. */
+    if (componentSource != nullptr && orderingAlgorithm_->supportsComponentOrdering() && (componentOrderingEnabled_ || managementInstance_->threadCount() > 1))
+    {
+        components = componentSource->components();
+    }
+
+    bool orderComponents = components != nullptr && components->size() > 1;
+
     if (widthLimitableAlgorithm == nullptr)
     {
         htd::IVertexOrdering * ordering = nullptr;
 
         do
         {
-            ordering = orderingAlgorithm_->computeOrdering(graph, preprocessedGraph);
+            if (orderComponents)
+            {
+                ordering = computeOrderingOfComponents(graph, preprocessedGraph, *components, maxBagSize, maxIterationCount);
+            }
+            else
+            {
+                ordering = orderingAlgorithm_->computeOrdering(graph, preprocessedGraph);
+            }
 
             if (ordering != nullptr)
             {
@@ -684,7 +750,16 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
     }
     else
     {
-        htd::IWidthLimitedVertexOrdering * ordering = widthLimitableAlgorithm->computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount);
+        htd::IVertexOrdering * ordering = nullptr;
+
+        if (orderComponents)
+        {
+            ordering = computeOrderingOfComponents(graph, preprocessedGraph, *components, maxBagSize, maxIterationCount);
+        }
+        else
+        {
+            ordering = widthLimitableAlgorithm->computeOrdering(graph, preprocessedGraph, maxBagSize, maxIterationCount);
+        }
 
         if (ordering != nullptr)
         {
@@ -702,6 +777,152 @@ std::pair<htd::IMutableGraphDecomposition *, std::size_t> htd::BucketElimination
     return std::make_pair(ret, iterations);
 }
 
+htd::IVertexOrdering * htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeOrderingOfComponents(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<std::vector<htd::vertex_t>> & components, std::size_t maxBagSize, std::size_t maxIterationCount) const
+{
+    const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+    std::size_t componentCount = components.size();
+
+    HTD_ASSERT(componentCount > 1)
+
+    std::vector<htd::index_t> schedule(componentCount);
+
+    std::iota(schedule.begin(), schedule.end(), 0);
+
+    std::stable_sort(schedule.begin(), schedule.end(), [&](htd::index_t index1, htd::index_t index2)
+    {
+        return components[index1].size() > components[index2].size();
+    });
+
+    std::vector<htd::IVertexOrdering *> orderings(componentCount, nullptr);
+
+    std::atomic<std::size_t> nextComponent(0);
+
+    std::atomic<bool> incomplete(false);
+
+    htd::RandomNumberGenerator randomNumberGenerator = managementInstance.randomNumberGenerator().fork();
+
+    auto worker = [&](const htd::IOrderingAlgorithm & algorithm)
+    {
+        const htd::IWidthLimitableOrderingAlgorithm * widthLimitableAlgorithm = dynamic_cast<const htd::IWidthLimitableOrderingAlgorithm *>(&algorithm);
+
+        for (std::size_t position = nextComponent++; position < componentCount && !incomplete && !managementInstance.isTerminated(); position = nextComponent++)
+        {
+            htd::index_t componentIndex = schedule[position];
+
+            htd::ConnectedComponentGraph component(managementInstance_, preprocessedGraph, components[componentIndex]);
+
+            htd::RandomNumberGenerator componentRandomNumberGenerator = randomNumberGenerator.substream(componentIndex);
+
+            htd::IVertexOrdering * ordering = nullptr;
+
+            {
+                htd::RandomNumberGeneratorBinding randomNumberGeneratorBinding(managementInstance, componentRandomNumberGenerator);
+
+                if (widthLimitableAlgorithm != nullptr)
+                {
+                    ordering = widthLimitableAlgorithm->computeOrdering(component.graph(), component.preprocessedGraph(), maxBagSize, maxIterationCount);
+                }
+                else
+                {
+                    ordering = algorithm.computeOrdering(component.graph(), component.preprocessedGraph());
+                }
+            }
+
+            if (ordering == nullptr || ordering->sequence().size() != component.vertices().size())
+            {
+                incomplete = true;
+            }
+
+            orderings[componentIndex] = ordering;
+        }
+    };
+
+    std::size_t workerCount = std::min(managementInstance.threadCount(), componentCount);
+
+    std::vector<htd::IOrderingAlgorithm *> algorithms;
+
+    for (std::size_t index = 1; index < workerCount; ++index)
+    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        algorithms.push_back(orderingAlgorithm_->clone());
+#else
+        algorithms.push_back(orderingAlgorithm_->cloneOrderingAlgorithm());
+#endif
+    }
+
+    htd::parallelInvoke(workerCount, [&](std::size_t threadIndex)
+    {
+        worker(threadIndex == 0 ? *orderingAlgorithm_ : *(algorithms[threadIndex - 1]));
+    });
+
+    for (htd::IOrderingAlgorithm * algorithm : algorithms)
+    {
+        delete algorithm;
+    }
+
+    htd::IVertexOrdering * ret = nullptr;
+
+    std::vector<htd::vertex_t> sequence;
+    sequence.reserve(graph.vertexCount());
+
+    sequence.insert(sequence.end(), preprocessedGraph.eliminationSequence().begin(), preprocessedGraph.eliminationSequence().end());
+
+    std::size_t iterations = 0;
+
+    std::size_t maximumBagSize = 0;
+
+    bool widthKnown = true;
+
+    for (htd::index_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+    {
+        htd::IVertexOrdering * ordering = orderings[componentIndex];
+
+        const std::vector<htd::vertex_t> & component = components[componentIndex];
+
+        if (ordering != nullptr)
+        {
+            /* The ordering is given by the vertices of the component graph, hence it is translated to the identifiers of the vertices within the input graph. */
+            if (ordering->sequence().size() == component.size())
+            {
+                for (htd::vertex_t vertex : ordering->sequence())
+                {
+                    sequence.push_back(preprocessedGraph.vertexName(component[vertex - htd::Vertex::FIRST]));
+                }
+            }
+
+            iterations = std::max(iterations, ordering->requiredIterations());
+
+            const htd::IWidthLimitedVertexOrdering * widthLimitedOrdering = dynamic_cast<const htd::IWidthLimitedVertexOrdering *>(ordering);
+
+            if (widthLimitedOrdering != nullptr)
+            {
+                maximumBagSize = std::max(maximumBagSize, widthLimitedOrdering->maximumBagSize());
+            }
+            else
+            {
+                widthKnown = false;
+            }
+        }
+    }
+
+    if (widthKnown)
+    {
+        ret = new htd::VertexOrdering(std::move(sequence), iterations, maximumBagSize);
+    }
+    else
+    {
+        ret = new htd::VertexOrdering(std::move(sequence), iterations);
+    }
+
+    for (htd::IVertexOrdering * ordering : orderings)
+    {
+        delete ordering;
+    }
+
+    return ret;
+}
+
 htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::computeMutableDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering) const
 {
     const htd::LibraryInstance & managementInstance = *managementInstance_;
@@ -747,7 +968,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
             for (htd::index_t index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
             {
-                const std::vector<htd::vertex_t> & elements = hyperedgePosition->sortedElements();
+                const htd::VertexSpan & elements = hyperedgePosition->sortedElements();
 
                 switch (elements.size())
                 {
@@ -889,7 +1110,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
 
                 for (index = 0; index < edgeCount && !managementInstance.isTerminated(); ++index)
                 {
-                    const std::vector<htd::vertex_t> & edgeElements = hyperedgePosition->sortedElements();
+                    const htd::VertexSpan & edgeElements = hyperedgePosition->sortedElements();
 
                     if (edgeElements.size() == 2)
                     {
@@ -931,8 +1152,8 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
         {
             if (vertex1 < vertex2)
             {
-                const std::vector<htd::vertex_t> & bagContent1 = ret->bagContent(vertex1);
-                const std::vector<htd::vertex_t> & bagContent2 = ret->bagContent(vertex2);
+                const htd::Bag & bagContent1 = ret->bagContent(vertex1);
+                const htd::Bag & bagContent2 = ret->bagContent(vertex2);
 
                 if (std::includes(bagContent2.begin(), bagContent2.end(), bagContent1.begin(), bagContent1.end()))
                 {
@@ -951,7 +1172,7 @@ htd::IMutableGraphDecomposition * htd::BucketEliminationGraphDecompositionAlgori
     return ret;
 }
 
-htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const std::vector<htd::vertex_t> & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices) const
+htd::vertex_t htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::getMinimumVertex(const htd::VertexSpan & vertices, const std::vector<htd::vertex_t> & ordering, const std::vector<htd::index_t> & vertexIndices) const
 {
     std::size_t minimum = (std::size_t)-1;
 
@@ -1202,7 +1423,7 @@ int htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::is_maxima
     return ret;
 }
 
-void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, const std::vector<htd::vertex_t> & edge, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
+void htd::BucketEliminationGraphDecompositionAlgorithm::Implementation::distributeEdge(htd::index_t edgeIndex, const htd::VertexSpan & edge, htd::vertex_t startBucket, const std::vector<std::vector<htd::vertex_t>> & buckets, const std::vector<std::vector<htd::vertex_t>> & neighbors, std::vector<std::vector<htd::index_t>> & inducedEdges, std::vector<htd::id_t> & lastAssignedEdge, std::stack<htd::vertex_t> & originStack) const
 {
     long size = static_cast<long>(edge.size());
 
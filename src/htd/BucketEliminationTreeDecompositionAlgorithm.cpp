@@ -247,7 +247,7 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
             {
                 htd::ILabelCollection * labelCollection = decomposition->labelings().exportVertexLabelCollection(vertex);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition->bagContent(vertex), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition->bagContent(vertex)), *labelCollection);
 
                 delete labelCollection;
 
@@ -261,7 +261,7 @@ std::pair<htd::ITreeDecomposition *, std::size_t> htd::BucketEliminationTreeDeco
             {
                 htd::ILabelCollection * labelCollection = decomposition->labelings().exportVertexLabelCollection(vertex);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition->bagContent(vertex), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition->bagContent(vertex)), *labelCollection);
 
                 delete labelCollection;
 
@@ -401,6 +401,16 @@ void htd::BucketEliminationTreeDecompositionAlgorithm::setCompressionEnabled(boo
     implementation_->baseAlgorithm_->setCompressionEnabled(compressionEnabled);
 }
 
+bool htd::BucketEliminationTreeDecompositionAlgorithm::isComponentOrderingEnabled(void) const
+{
+    return implementation_->baseAlgorithm_->isComponentOrderingEnabled();
+}
+
+void htd::BucketEliminationTreeDecompositionAlgorithm::setComponentOrderingEnabled(bool componentOrderingEnabled)
+{
+    implementation_->baseAlgorithm_->setComponentOrderingEnabled(componentOrderingEnabled);
+}
+
 bool htd::BucketEliminationTreeDecompositionAlgorithm::isComputeInducedEdgesEnabled(void) const
 {
     return implementation_->baseAlgorithm_->isComputeInducedEdgesEnabled();
@@ -448,18 +458,16 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
                     if (componentCount > 1)
                     {
+                        htd::RandomNumberGenerator & randomNumberGenerator = managementInstance_->randomNumberGenerator();
+
                         for (htd::index_t index = 0; index < componentCount - 1; ++index)
                         {
                             const std::vector<htd::vertex_t> & component1 = components[index];
                             const std::vector<htd::vertex_t> & component2 = components[index + 1];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex1 = component1[std::rand() % component1.size()];
+                            htd::vertex_t vertex1 = component1[randomNumberGenerator.nextIndex(component1.size())];
 
-                            /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                            // coverity[dont_call]
-                            htd::vertex_t vertex2 = component2[std::rand() % component2.size()];
+                            htd::vertex_t vertex2 = component2[randomNumberGenerator.nextIndex(component2.size())];
 
                             mutableGraphDecomposition.addEdge(vertex1, vertex2);
                         }
@@ -472,24 +480,23 @@ std::pair<htd::IMutableTreeDecomposition *, std::size_t> htd::BucketEliminationT
 
                 htd::BreadthFirstGraphTraversal graphTraversal(managementInstance_);
 
-                /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-                // coverity[dont_call]
-                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(std::rand() % graphDecomposition.first->vertexCount()), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
+                graphTraversal.traverse(*(graphDecomposition.first), graphDecomposition.first->vertexAtPosition(managementInstance_->randomNumberGenerator().nextIndex(graphDecomposition.first->vertexCount())), [&](htd::vertex_t vertex, htd::vertex_t predecessor, std::size_t distanceFromStartingVertex)
                 {
                     HTD_UNUSED(distanceFromStartingVertex)
 
                     if (predecessor == htd::Vertex::UNKNOWN)
                     {
-                        node = ret->insertRoot(std::move(mutableGraphDecomposition.mutableBagContent(vertex)),
-                                               std::move(mutableGraphDecomposition.mutableInducedHyperedges(vertex)));
+                        node = ret->insertRoot();
                     }
                     else
                     {
-                        node = ret->addChild(vertexMapping.at(predecessor),
-                                             std::move(mutableGraphDecomposition.mutableBagContent(vertex)),
-                                             std::move(mutableGraphDecomposition.mutableInducedHyperedges(vertex)));
+                        node = ret->addChild(vertexMapping.at(predecessor));
                     }
 
+                    ret->setBagContent(node, mutableGraphDecomposition.bagContent(vertex));
+
+                    ret->mutableInducedHyperedges(node) = std::move(mutableGraphDecomposition.mutableInducedHyperedges(vertex));
+
                     vertexMapping.emplace(vertex, node);
                 });
             }
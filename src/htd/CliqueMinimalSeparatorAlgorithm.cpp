@@ -823,11 +823,13 @@ std::vector<htd::vertex_t> * htd::CliqueMinimalSeparatorAlgorithm::computeSepara
             labels[index] = 0;
         }
 
+        htd::RandomNumberGenerator & randomNumberGenerator = managementInstance.randomNumberGenerator();
+
         while (size > 0 && !managementInstance.isTerminated())
         {
             implementation_->fillMaxCardinalityPool(vertices, labels, pool);
 
-            htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool);
+            htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool, randomNumberGenerator);
 
             const std::vector<htd::vertex_t> & selectedNeighborhood = eliminationGraph.neighborhood(selectedVertex);
 
@@ -868,7 +870,7 @@ std::vector<htd::vertex_t> * htd::CliqueMinimalSeparatorAlgorithm::computeSepara
 
                 while (!currentlyReachableVertices.empty())
                 {
-                    htd::vertex_t reachableVertex = htd::selectRandomElement<htd::vertex_t>(currentlyReachableVertices);
+                    htd::vertex_t reachableVertex = htd::selectRandomElement<htd::vertex_t>(currentlyReachableVertices, randomNumberGenerator);
 
                     currentlyReachableVertices.erase(std::lower_bound(currentlyReachableVertices.begin(),
                                                                       currentlyReachableVertices.end(),
@@ -946,7 +948,7 @@ std::vector<htd::vertex_t> * htd::CliqueMinimalSeparatorAlgorithm::computeSepara
 
         if (!cliqueSeparators.empty())
         {
-            const std::vector<htd::vertex_t> & separator = htd::selectRandomElement<std::vector<htd::vertex_t>>(cliqueSeparators);
+            const std::vector<htd::vertex_t> & separator = htd::selectRandomElement<std::vector<htd::vertex_t>>(cliqueSeparators, randomNumberGenerator);
 
             for (htd::vertex_t vertex : separator)
             {
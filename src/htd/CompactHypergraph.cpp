@@ -0,0 +1,772 @@
+/* 
+ * File:   CompactHypergraph.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_COMPACTHYPERGRAPH_CPP
+#define HTD_HTD_COMPACTHYPERGRAPH_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/CompactHypergraph.hpp>
+#include <htd/ConstIndexedIteratorWrapper.hpp>
+#include <htd/VectorAdapter.hpp>
+#include <htd/HyperedgeVector.hpp>
+#include <htd/IMutableMultiHypergraph.hpp>
+
+#include <htd/Algorithm.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stack>
+#include <stdexcept>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::CompactHypergraph.
+ */
+struct htd::CompactHypergraph::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] original  The multi-hypergraph which shall be represented by the compact multi-hypergraph.
+     */
+    Implementation(const htd::IMultiHypergraph & original)
+        : next_vertex_(htd::Vertex::FIRST),
+          next_edge_(htd::Id::FIRST),
+          vertices_(),
+          existing_(),
+          neighborOffsets_(),
+          neighbors_(),
+          incidenceOffsets_(),
+          incidences_(),
+          isolatedVertices_(),
+          edges_(std::make_shared<std::vector<htd::Hyperedge>>())
+    {
+        vertices_.reserve(original.vertexCount());
+
+        original.copyVerticesTo(vertices_);
+
+        const htd::IMutableMultiHypergraph * mutableOriginal = dynamic_cast<const htd::IMutableMultiHypergraph *>(&original);
+
+        if (mutableOriginal != nullptr)
+        {
+            next_vertex_ = mutableOriginal->nextVertex();
+        }
+        else if (!vertices_.empty())
+        {
+            next_vertex_ = vertices_.back() + 1;
+        }
+
+        std::size_t slotCount = next_vertex_ - htd::Vertex::FIRST;
+
+        existing_.resize(slotCount, false);
+
+        neighborOffsets_.resize(slotCount + 1, 0);
+
+        incidenceOffsets_.resize(slotCount + 1, 0);
+
+        for (htd::vertex_t vertex : vertices_)
+        {
+            existing_[vertex - htd::Vertex::FIRST] = true;
+
+            neighborOffsets_[vertex - htd::Vertex::FIRST + 1] = original.neighborCount(vertex);
+        }
+
+        for (htd::index_t index = 1; index <= slotCount; ++index)
+        {
+            neighborOffsets_[index] += neighborOffsets_[index - 1];
+        }
+
+        neighbors_.reserve(neighborOffsets_[slotCount]);
+
+        for (htd::vertex_t vertex : vertices_)
+        {
+            original.copyNeighborsTo(vertex, neighbors_);
+
+            if (neighborCount(vertex) == 0)
+            {
+                isolatedVertices_.push_back(vertex);
+            }
+        }
+
+        const htd::ConstCollection<htd::Hyperedge> & hyperedgeCollection = original.hyperedges();
+
+        edges_->reserve(hyperedgeCollection.size());
+
+        for (const htd::Hyperedge & hyperedge : hyperedgeCollection)
+        {
+            HTD_ASSERT(edges_->empty() || edges_->back().id() < hyperedge.id())
+
+            edges_->push_back(hyperedge);
+        }
+
+        if (mutableOriginal != nullptr)
+        {
+            next_edge_ = mutableOriginal->nextEdgeId();
+        }
+        else if (!edges_->empty())
+        {
+            next_edge_ = edges_->back().id() + 1;
+        }
+
+        indexIncidences();
+    }
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] vertexCount  The number of vertices of the compact multi-hypergraph.
+     *  @param[in] hyperedges   The hyperedges of the compact multi-hypergraph sorted by ID in ascending order.
+     */
+    Implementation(std::size_t vertexCount, std::vector<htd::Hyperedge> && hyperedges)
+        : next_vertex_(htd::Vertex::FIRST + vertexCount),
+          next_edge_(htd::Id::FIRST),
+          vertices_(vertexCount),
+          existing_(vertexCount, true),
+          neighborOffsets_(vertexCount + 1, 0),
+          neighbors_(),
+          incidenceOffsets_(vertexCount + 1, 0),
+          incidences_(),
+          isolatedVertices_(),
+          edges_(std::make_shared<std::vector<htd::Hyperedge>>(std::move(hyperedges)))
+    {
+        std::iota(vertices_.begin(), vertices_.end(), htd::Vertex::FIRST);
+
+        if (!edges_->empty())
+        {
+            next_edge_ = edges_->back().id() + 1;
+        }
+
+        indexIncidences();
+
+        /* The neighborhood of each vertex is the union of the endpoints of its incident hyperedges. A vertex is its own neighbor only if a hyperedge contains it more than once. */
+        std::vector<htd::vertex_t> lastVisitor(vertexCount, htd::Vertex::UNKNOWN);
+
+        for (htd::vertex_t vertex : vertices_)
+        {
+            std::size_t begin = neighbors_.size();
+
+            for (auto it = incidencesBegin(vertex); it != incidencesEnd(vertex); ++it)
+            {
+                const htd::Hyperedge & hyperedge = (*edges_)[*it];
+
+                bool duplicates = hyperedge.elements().size() > hyperedge.sortedElements().size();
+
+                for (htd::vertex_t neighbor : hyperedge.sortedElements())
+                {
+                    if (lastVisitor[neighbor - htd::Vertex::FIRST] != vertex && (neighbor != vertex || (duplicates && std::count(hyperedge.elements().begin(), hyperedge.elements().end(), vertex) > 1)))
+                    {
+                        lastVisitor[neighbor - htd::Vertex::FIRST] = vertex;
+
+                        neighbors_.push_back(neighbor);
+                    }
+                }
+            }
+
+            std::sort(neighbors_.begin() + begin, neighbors_.end());
+
+            neighborOffsets_[vertex - htd::Vertex::FIRST + 1] = neighbors_.size();
+
+            if (neighbors_.size() == begin)
+            {
+                isolatedVertices_.push_back(vertex);
+            }
+        }
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  Build the incidence relation between the vertices and the hyperedges.
+     */
+    void indexIncidences(void)
+    {
+        std::size_t slotCount = next_vertex_ - htd::Vertex::FIRST;
+
+        for (const htd::Hyperedge & hyperedge : *edges_)
+        {
+            for (htd::vertex_t vertex : hyperedge.sortedElements())
+            {
+                HTD_ASSERT(vertex >= htd::Vertex::FIRST && vertex < next_vertex_)
+
+                ++(incidenceOffsets_[vertex - htd::Vertex::FIRST + 1]);
+            }
+        }
+
+        for (htd::index_t index = 1; index <= slotCount; ++index)
+        {
+            incidenceOffsets_[index] += incidenceOffsets_[index - 1];
+        }
+
+        incidences_.resize(incidenceOffsets_[slotCount]);
+
+        std::vector<std::size_t> insertionPositions(incidenceOffsets_.begin(), incidenceOffsets_.end() - 1);
+
+        htd::index_t position = 0;
+
+        for (const htd::Hyperedge & hyperedge : *edges_)
+        {
+            for (htd::vertex_t vertex : hyperedge.sortedElements())
+            {
+                incidences_[insertionPositions[vertex - htd::Vertex::FIRST]++] = position;
+            }
+
+            ++position;
+        }
+    }
+
+    /**
+     *  Get the number of neighbors of a vertex.
+     *
+     *  @param[in] vertex   The vertex for which the number of neighbors shall be returned.
+     *
+     *  @return The number of neighbors of the given vertex.
+     */
+    inline std::size_t neighborCount(htd::vertex_t vertex) const
+    {
+        return neighborOffsets_[vertex - htd::Vertex::FIRST + 1] - neighborOffsets_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Get an iterator to the first neighbor of a vertex.
+     *
+     *  @param[in] vertex   The vertex for which the iterator shall be returned.
+     *
+     *  @return An iterator to the first neighbor of the given vertex.
+     */
+    inline std::vector<htd::vertex_t>::const_iterator neighborsBegin(htd::vertex_t vertex) const
+    {
+        return neighbors_.begin() + neighborOffsets_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Get an iterator past the last neighbor of a vertex.
+     *
+     *  @param[in] vertex   The vertex for which the iterator shall be returned.
+     *
+     *  @return An iterator past the last neighbor of the given vertex.
+     */
+    inline std::vector<htd::vertex_t>::const_iterator neighborsEnd(htd::vertex_t vertex) const
+    {
+        return neighbors_.begin() + neighborOffsets_[vertex - htd::Vertex::FIRST + 1];
+    }
+
+    /**
+     *  Get an iterator to the position of the first hyperedge containing a vertex.
+     *
+     *  @param[in] vertex   The vertex for which the iterator shall be returned.
+     *
+     *  @return An iterator to the position of the first hyperedge containing the given vertex.
+     */
+    inline std::vector<htd::index_t>::const_iterator incidencesBegin(htd::vertex_t vertex) const
+    {
+        return incidences_.begin() + incidenceOffsets_[vertex - htd::Vertex::FIRST];
+    }
+
+    /**
+     *  Get an iterator past the position of the last hyperedge containing a vertex.
+     *
+     *  @param[in] vertex   The vertex for which the iterator shall be returned.
+     *
+     *  @return An iterator past the position of the last hyperedge containing the given vertex.
+     */
+    inline std::vector<htd::index_t>::const_iterator incidencesEnd(htd::vertex_t vertex) const
+    {
+        return incidences_.begin() + incidenceOffsets_[vertex - htd::Vertex::FIRST + 1];
+    }
+
+    /**
+     *  Collect the IDs of all hyperedges with the given endpoints.
+     *
+     *  @param[in] begin    An iterator to the first endpoint.
+     *  @param[in] end      An iterator past the last endpoint.
+     *  @param[in] size     The number of endpoints.
+     *  @param[out] target  The target vector to which the matching edge IDs shall be appended.
+     *  @param[in] firstOnly    A boolean flag whether the search shall stop after the first match.
+     */
+    template <typename Iter>
+    void collectEdgeIds(Iter begin, Iter end, std::size_t size, std::vector<htd::id_t> & target, bool firstOnly) const
+    {
+        if (size > 0)
+        {
+            htd::vertex_t firstVertex = *begin;
+
+            if (firstVertex >= htd::Vertex::FIRST && firstVertex < next_vertex_ && existing_[firstVertex - htd::Vertex::FIRST])
+            {
+                for (auto it = incidencesBegin(firstVertex); it != incidencesEnd(firstVertex) && (!firstOnly || target.empty()); ++it)
+                {
+                    const htd::Hyperedge & hyperedge = (*edges_)[*it];
+
+                    if (hyperedge.size() == size && htd::equal(hyperedge.begin(), hyperedge.end(), begin, end))
+                    {
+                        target.push_back(hyperedge.id());
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     *  The ID the next vertex added to the original graph would have got.
+     */
+    htd::vertex_t next_vertex_;
+
+    /**
+     *  The ID the next edge added to the original graph would have got.
+     */
+    htd::id_t next_edge_;
+
+    /**
+     *  The vector of all vertices in the graph sorted in ascending order.
+     */
+    std::vector<htd::vertex_t> vertices_;
+
+    /**
+     *  Boolean flags indicating for each vertex identifier below next_vertex_ whether the vertex exists in the graph.
+     */
+    std::vector<bool> existing_;
+
+    /**
+     *  The offsets of the neighborhood of each vertex within neighbors_. The last entry holds the total number of entries.
+     */
+    std::vector<std::size_t> neighborOffsets_;
+
+    /**
+     *  The concatenation of the neighborhoods of all vertices. The neighborhood of each vertex is sorted in ascending order.
+     */
+    std::vector<htd::vertex_t> neighbors_;
+
+    /**
+     *  The offsets of the incident hyperedges of each vertex within incidences_. The last entry holds the total number of entries.
+     */
+    std::vector<std::size_t> incidenceOffsets_;
+
+    /**
+     *  The concatenation of the positions of the incident hyperedges of all vertices. The positions of each vertex are sorted in ascending order.
+     */
+    std::vector<htd::index_t> incidences_;
+
+    /**
+     *  The vector of all isolated vertices in the graph sorted in ascending order.
+     */
+    std::vector<htd::vertex_t> isolatedVertices_;
+
+    /**
+     *  The collection of hyperedges sorted by ID in ascending order.
+     */
+    std::shared_ptr<std::vector<htd::Hyperedge>> edges_;
+};
+
+htd::CompactHypergraph::CompactHypergraph(const htd::CompactHypergraph & original) : managementInstance_(original.managementInstance_), implementation_(original.implementation_)
+{
+
+}
+
+htd::CompactHypergraph::CompactHypergraph(const htd::IMultiHypergraph & original) : managementInstance_(original.managementInstance()), implementation_(std::make_shared<const Implementation>(original))
+{
+
+}
+
+htd::CompactHypergraph::CompactHypergraph(const htd::LibraryInstance * const manager, std::size_t vertexCount, std::vector<htd::Hyperedge> && hyperedges) : managementInstance_(manager), implementation_(std::make_shared<const Implementation>(vertexCount, std::move(hyperedges)))
+{
+    HTD_ASSERT(manager != nullptr)
+}
+
+htd::CompactHypergraph::~CompactHypergraph()
+{
+
+}
+
+std::size_t htd::CompactHypergraph::vertexCount(void) const
+{
+    return implementation_->vertices_.size();
+}
+
+std::size_t htd::CompactHypergraph::edgeCount(void) const
+{
+    return implementation_->edges_->size();
+}
+
+std::size_t htd::CompactHypergraph::edgeCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return std::distance(implementation_->incidencesBegin(vertex), implementation_->incidencesEnd(vertex));
+}
+
+bool htd::CompactHypergraph::isVertex(htd::vertex_t vertex) const
+{
+    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->existing_[vertex - htd::Vertex::FIRST];
+}
+
+bool htd::CompactHypergraph::isEdge(htd::id_t edgeId) const
+{
+    const std::vector<htd::Hyperedge> & edges = *(implementation_->edges_);
+
+    auto position = std::lower_bound(edges.begin(), edges.end(), edgeId, [](const htd::Hyperedge & hyperedge, htd::id_t id) { return hyperedge.id() < id; });
+
+    return position != edges.end() && position->id() == edgeId;
+}
+
+bool htd::CompactHypergraph::isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    return isNeighbor(vertex1, vertex2) && isEdge(std::vector<htd::vertex_t> { vertex1, vertex2 });
+}
+
+bool htd::CompactHypergraph::isEdge(const std::vector<htd::vertex_t> & elements) const
+{
+    std::vector<htd::id_t> result;
+
+    implementation_->collectEdgeIds(elements.begin(), elements.end(), elements.size(), result, true);
+
+    return !result.empty();
+}
+
+bool htd::CompactHypergraph::isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    std::vector<htd::id_t> result;
+
+    implementation_->collectEdgeIds(elements.begin(), elements.end(), elements.size(), result, true);
+
+    return !result.empty();
+}
+
+htd::ConstCollection<htd::id_t> htd::CompactHypergraph::associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    if (isNeighbor(vertex1, vertex2))
+    {
+        std::vector<htd::vertex_t> elements { vertex1, vertex2 };
+
+        implementation_->collectEdgeIds(elements.begin(), elements.end(), elements.size(), ret.container(), false);
+    }
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::id_t> htd::CompactHypergraph::associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    implementation_->collectEdgeIds(elements.begin(), elements.end(), elements.size(), ret.container(), false);
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+htd::ConstCollection<htd::id_t> htd::CompactHypergraph::associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const
+{
+    htd::VectorAdapter<htd::id_t> ret;
+
+    implementation_->collectEdgeIds(elements.begin(), elements.end(), elements.size(), ret.container(), false);
+
+    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+}
+
+bool htd::CompactHypergraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
+{
+    HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
+
+    return std::binary_search(implementation_->neighborsBegin(vertex), implementation_->neighborsEnd(vertex), neighbor);
+}
+
+std::size_t htd::CompactHypergraph::neighborCount(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->neighborCount(vertex);
+}
+
+bool htd::CompactHypergraph::isConnected(void) const
+{
+    bool ret = true;
+
+    const std::vector<htd::vertex_t> & vertices = implementation_->vertices_;
+
+    if (!vertices.empty())
+    {
+        std::size_t visitedVertexCount = 0;
+
+        std::vector<bool> visitedVertices(implementation_->next_vertex_ - htd::Vertex::FIRST, false);
+
+        std::stack<htd::vertex_t> originStack;
+
+        originStack.push(vertices[0]);
+
+        visitedVertices[vertices[0] - htd::Vertex::FIRST] = true;
+
+        while (!originStack.empty())
+        {
+            htd::vertex_t currentVertex = originStack.top();
+
+            originStack.pop();
+
+            ++visitedVertexCount;
+
+            for (auto it = implementation_->neighborsBegin(currentVertex); it != implementation_->neighborsEnd(currentVertex); ++it)
+            {
+                if (!visitedVertices[*it - htd::Vertex::FIRST])
+                {
+                    visitedVertices[*it - htd::Vertex::FIRST] = true;
+
+                    originStack.push(*it);
+                }
+            }
+        }
+
+        ret = visitedVertexCount == vertices.size();
+    }
+
+    return ret;
+}
+
+bool htd::CompactHypergraph::isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+{
+    HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
+
+    bool ret = vertex1 == vertex2;
+
+    if (!ret)
+    {
+        std::vector<htd::vertex_t> newVertices;
+        std::vector<htd::vertex_t> tmpVertices;
+
+        std::vector<bool> reachableVertices(implementation_->next_vertex_ - htd::Vertex::FIRST, false);
+
+        reachableVertices[vertex1 - htd::Vertex::FIRST] = true;
+
+        newVertices.push_back(vertex1);
+
+        while (!ret && !newVertices.empty())
+        {
+            std::swap(tmpVertices, newVertices);
+
+            newVertices.resize(0);
+
+            for (auto it = tmpVertices.begin(); !ret && it != tmpVertices.end(); ++it)
+            {
+                for (auto it2 = implementation_->neighborsBegin(*it); !ret && it2 != implementation_->neighborsEnd(*it); ++it2)
+                {
+                    htd::vertex_t neighbor = *it2;
+
+                    if (!reachableVertices[neighbor - htd::Vertex::FIRST])
+                    {
+                        reachableVertices[neighbor - htd::Vertex::FIRST] = true;
+
+                        newVertices.push_back(neighbor);
+
+                        ret = neighbor == vertex2;
+                    }
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompactHypergraph::neighbors(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->neighborsBegin(vertex), implementation_->neighborsEnd(vertex), implementation_->neighborCount(vertex));
+}
+
+void htd::CompactHypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    target.insert(target.end(), implementation_->neighborsBegin(vertex), implementation_->neighborsEnd(vertex));
+}
+
+htd::vertex_t htd::CompactHypergraph::neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    HTD_ASSERT(index < implementation_->neighborCount(vertex))
+
+    return *(implementation_->neighborsBegin(vertex) + index);
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompactHypergraph::vertices(void) const
+{
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertices_);
+}
+
+void htd::CompactHypergraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
+{
+    target.insert(target.end(), implementation_->vertices_.begin(), implementation_->vertices_.end());
+}
+
+htd::vertex_t htd::CompactHypergraph::vertexAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->vertices_.size())
+
+    return implementation_->vertices_[index];
+}
+
+const std::vector<htd::vertex_t> & htd::CompactHypergraph::vertexVector(void) const
+{
+    return implementation_->vertices_;
+}
+
+std::size_t htd::CompactHypergraph::isolatedVertexCount(void) const
+{
+    return implementation_->isolatedVertices_.size();
+}
+
+htd::ConstCollection<htd::vertex_t> htd::CompactHypergraph::isolatedVertices(void) const
+{
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->isolatedVertices_);
+}
+
+htd::vertex_t htd::CompactHypergraph::isolatedVertexAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->isolatedVertices_.size())
+
+    return implementation_->isolatedVertices_[index];
+}
+
+bool htd::CompactHypergraph::isIsolatedVertex(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return implementation_->neighborCount(vertex) == 0;
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::CompactHypergraph::hyperedges(void) const
+{
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->edges_));
+}
+
+htd::ConstCollection<htd::Hyperedge> htd::CompactHypergraph::hyperedges(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    typedef htd::ConstIndexedIteratorWrapper<std::vector<htd::index_t>::const_iterator, std::vector<htd::Hyperedge>> IteratorType;
+
+    const std::vector<htd::Hyperedge> & edges = *(implementation_->edges_);
+
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new IteratorType(implementation_->incidencesBegin(vertex), edges)),
+                                                             static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new IteratorType(implementation_->incidencesEnd(vertex), edges)),
+                                                             edgeCount(vertex));
+}
+
+const htd::Hyperedge & htd::CompactHypergraph::hyperedge(htd::id_t edgeId) const
+{
+    const std::vector<htd::Hyperedge> & edges = *(implementation_->edges_);
+
+    auto position = std::lower_bound(edges.begin(), edges.end(), edgeId, [](const htd::Hyperedge & hyperedge, htd::id_t id) { return hyperedge.id() < id; });
+
+    HTD_ASSERT(position != edges.end() && position->id() == edgeId)
+
+    return *position;
+}
+
+const htd::Hyperedge & htd::CompactHypergraph::hyperedgeAtPosition(htd::index_t index) const
+{
+    HTD_ASSERT(index < implementation_->edges_->size())
+
+    return (*(implementation_->edges_))[index];
+}
+
+const htd::Hyperedge & htd::CompactHypergraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    if (index >= edgeCount(vertex))
+    {
+        throw std::out_of_range("const htd::Hyperedge & htd::CompactHypergraph::hyperedgeAtPosition(htd::index_t, htd::vertex_t) const");
+    }
+
+    return (*(implementation_->edges_))[*(implementation_->incidencesBegin(vertex) + index)];
+}
+
+htd::FilteredHyperedgeCollection htd::CompactHypergraph::hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const
+{
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeVector(implementation_->edges_), indices);
+}
+
+htd::FilteredHyperedgeCollection htd::CompactHypergraph::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
+{
+    return htd::FilteredHyperedgeCollection(new htd::HyperedgeVector(implementation_->edges_), std::move(indices));
+}
+
+htd::vertex_t htd::CompactHypergraph::nextVertex(void) const
+{
+    return implementation_->next_vertex_;
+}
+
+htd::id_t htd::CompactHypergraph::nextEdgeId(void) const
+{
+    return implementation_->next_edge_;
+}
+
+const htd::LibraryInstance * htd::CompactHypergraph::managementInstance(void) const HTD_NOEXCEPT
+{
+    return managementInstance_;
+}
+
+void htd::CompactHypergraph::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    managementInstance_ = manager;
+}
+
+htd::CompactHypergraph * htd::CompactHypergraph::clone(void) const
+{
+    return new htd::CompactHypergraph(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IGraphStructure * htd::CompactHypergraph::cloneGraphStructure(void) const
+{
+    return clone();
+}
+
+htd::IMultiHypergraph * htd::CompactHypergraph::cloneMultiHypergraph(void) const
+{
+    return clone();
+}
+#endif
+
+htd::CompactHypergraph & htd::CompactHypergraph::operator=(const htd::CompactHypergraph & original)
+{
+    if (this != &original)
+    {
+        managementInstance_ = original.managementInstance_;
+
+        implementation_ = original.implementation_;
+    }
+
+    return *this;
+}
+
+#endif /* HTD_HTD_COMPACTHYPERGRAPH_CPP */
@@ -124,8 +124,8 @@ void htd::CompressionOperation::apply(const htd::IMultiHypergraph & graph, htd::
         {
             htd::vertex_t parent = decomposition.parent(vertex);
 
-            const std::vector<htd::vertex_t> & currentBag = decomposition.bagContent(vertex);
-            const std::vector<htd::vertex_t> & parentBag = decomposition.bagContent(parent);
+            const htd::Bag & currentBag = decomposition.bagContent(vertex);
+            const htd::Bag & parentBag = decomposition.bagContent(parent);
 
             const std::pair<std::size_t, std::size_t> & result = htd::symmetric_difference_sizes(currentBag, parentBag);
 
@@ -0,0 +1,171 @@
+/*
+ * File:   ConnectedComponentGraph.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_CONNECTEDCOMPONENTGRAPH_CPP
+#define HTD_HTD_CONNECTEDCOMPONENTGRAPH_CPP
+
+#include <htd/ConnectedComponentGraph.hpp>
+
+#include <htd/MultiHypergraph.hpp>
+#include <htd/PreprocessedGraph.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::ConnectedComponentGraph.
+ */
+struct htd::ConnectedComponentGraph::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager              The management instance to which the graph of the component shall belong.
+     *  @param[in] preprocessedGraph    The preprocessed graph containing the component.
+     *  @param[in] vertices             The vertices (with 0-based IDs) of the component, sorted in ascending order.
+     */
+    Implementation(const htd::LibraryInstance * const manager, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::vertex_t> & vertices)
+        : vertices_(vertices), names_(), graph_(manager, vertices_.size()), preprocessedGraph_(nullptr)
+    {
+        const std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
+
+        std::size_t size = vertices_.size();
+
+        names_.reserve(size);
+
+        std::vector<std::vector<htd::vertex_t>> componentNeighborhood(size);
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> componentEdges;
+
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            htd::vertex_t vertex = vertices_[index];
+
+            names_.push_back(preprocessedGraph.vertexName(vertex));
+
+            std::vector<htd::vertex_t> & currentNeighborhood = componentNeighborhood[index];
+
+            currentNeighborhood.reserve(neighborhood[vertex].size());
+
+            /* The local identifiers preserve the order of the vertices, hence the neighborhoods stay sorted. */
+            for (htd::vertex_t neighbor : neighborhood[vertex])
+            {
+                htd::vertex_t localNeighbor = static_cast<htd::vertex_t>(std::lower_bound(vertices_.begin(), vertices_.end(), neighbor) - vertices_.begin());
+
+                HTD_ASSERT(localNeighbor < size && vertices_[localNeighbor] == neighbor)
+
+                currentNeighborhood.push_back(localNeighbor);
+
+                if (localNeighbor > index)
+                {
+                    componentEdges.emplace_back(static_cast<htd::vertex_t>(index + htd::Vertex::FIRST), localNeighbor + htd::Vertex::FIRST);
+                }
+            }
+        }
+
+        graph_.addEdges(componentEdges);
+
+        std::vector<htd::vertex_t> localVertexNames(size);
+
+        std::iota(localVertexNames.begin(), localVertexNames.end(), htd::Vertex::FIRST);
+
+        std::vector<htd::vertex_t> localVertices(size);
+
+        std::iota(localVertices.begin(), localVertices.end(), 0);
+
+        preprocessedGraph_.reset(new htd::PreprocessedGraph(std::move(localVertexNames),
+                                                            std::move(componentNeighborhood),
+                                                            std::vector<htd::vertex_t>(),
+                                                            std::move(localVertices),
+                                                            graph_.edgeCount(),
+                                                            preprocessedGraph.minTreeWidth()));
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The vertices (with 0-based IDs) of the component within the original preprocessed graph.
+     */
+    std::vector<htd::vertex_t> vertices_;
+
+    /**
+     *  The identifiers of the vertices of the component in the original input graph.
+     */
+    std::vector<htd::vertex_t> names_;
+
+    /**
+     *  The component in the form of an input graph.
+     */
+    htd::MultiHypergraph graph_;
+
+    /**
+     *  The component in the form of a preprocessed graph.
+     */
+    std::unique_ptr<htd::PreprocessedGraph> preprocessedGraph_;
+};
+
+htd::ConnectedComponentGraph::ConnectedComponentGraph(const htd::LibraryInstance * const manager, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::vertex_t> & vertices)
+    : implementation_(new Implementation(manager, preprocessedGraph, vertices))
+{
+
+}
+
+htd::ConnectedComponentGraph::ConnectedComponentGraph(htd::ConnectedComponentGraph && original) : implementation_(std::move(original.implementation_))
+{
+
+}
+
+htd::ConnectedComponentGraph::~ConnectedComponentGraph()
+{
+
+}
+
+const std::vector<htd::vertex_t> & htd::ConnectedComponentGraph::vertices(void) const HTD_NOEXCEPT
+{
+    return implementation_->vertices_;
+}
+
+htd::vertex_t htd::ConnectedComponentGraph::vertexName(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(vertex >= htd::Vertex::FIRST && vertex - htd::Vertex::FIRST < implementation_->names_.size())
+
+    return implementation_->names_[vertex - htd::Vertex::FIRST];
+}
+
+const htd::IMultiHypergraph & htd::ConnectedComponentGraph::graph(void) const HTD_NOEXCEPT
+{
+    return implementation_->graph_;
+}
+
+const htd::IPreprocessedGraph & htd::ConnectedComponentGraph::preprocessedGraph(void) const HTD_NOEXCEPT
+{
+    return *(implementation_->preprocessedGraph_);
+}
+
+#endif /* HTD_HTD_CONNECTEDCOMPONENTGRAPH_CPP */
@@ -33,8 +33,56 @@
 #include <htd/VertexOrdering.hpp>
 
 #include <algorithm>
-#include <deque>
-#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Buffers used by the MCS-M algorithm which are kept alive between subsequent invocations.
+     */
+    struct ScratchBuffers
+    {
+        /**
+         *  The vertices which are not yet part of the ordering, sorted by ascending weight.
+         */
+        std::vector<htd::vertex_t> vertices;
+
+        /**
+         *  The positions of the vertices within the vector of remaining vertices.
+         */
+        std::vector<std::size_t> positions;
+
+        /**
+         *  The weight of each vertex.
+         */
+        std::vector<std::size_t> weights;
+
+        /**
+         *  The first position of each weight bucket within the vector of remaining vertices.
+         */
+        std::vector<std::size_t> bucketStart;
+
+        /**
+         *  The number of the search in which each vertex was visited most recently.
+         */
+        std::vector<std::size_t> stamps;
+
+        /**
+         *  The vertices which were reached by the current search, grouped by the maximum weight along the path via which they were reached.
+         */
+        std::vector<std::vector<htd::vertex_t>> reachedVertices;
+
+        /**
+         *  The vertices whose weight shall be increased after the current search.
+         */
+        std::vector<htd::vertex_t> updatedVertices;
+    };
+
+    /**
+     *  The scratch buffers of the current thread.
+     */
+    thread_local ScratchBuffers threadLocalScratchBuffers;
+}
 
 /**
  *  Private implementation details of class htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm.
@@ -60,97 +108,6 @@ struct htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::Implementation
      *  The management instance to which the current object instance belongs.
      */
     const htd::LibraryInstance * managementInstance_;
-
-    /**
-     *  Fill the pool of vertices having maximum weight.
-     *
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[out] pool    The vertex pool which shall be filled with all vertices of maximum weight.
-     */
-    void fillMaxCardinalityPool(const std::unordered_set<htd::vertex_t> & vertices, const std::vector<std::size_t> & weights, std::vector<htd::vertex_t> & pool) const HTD_NOEXCEPT
-    {
-        std::size_t max = 0;
-
-        pool.clear();
-
-        for (htd::vertex_t vertex : vertices)
-        {
-            std::size_t tmp = weights[vertex];
-
-            if (tmp >= max)
-            {
-                if (tmp > max)
-                {
-                    max = tmp;
-
-                    pool.clear();
-                }
-
-                pool.push_back(vertex);
-            }
-        }
-    }
-
-    /**
-     *  Check whether there exists a path between two vertices consisting of only
-     *  unnumbered vertices in the graph whose weight is strictly less than the
-     *  weight of the source vertex.
-     *
-     *  @param[in] graph    The graph.
-     *  @param[in] weights  A vector containing the weights associated with each of the vertices.
-     *  @param[in] vertices The set of vertices which shall be considered.
-     *  @param[in] source   The source vertex.
-     *  @param[in] target   The target vertex.
-     *
-     *  @return True if a valid path between the two vertices exists, false otherwise.
-     */
-    bool hasValidPath(const htd::IPreprocessedGraph & graph, const std::vector<std::size_t> & weights, const std::unordered_set<htd::vertex_t> & vertices, htd::vertex_t source, htd::vertex_t target)
-    {
-        bool ret = false;
-
-        std::size_t currentWeight = weights[source];
-
-        std::deque<htd::vertex_t> originDeque;
-
-        std::unordered_set<htd::vertex_t> visitedVertices;
-
-        htd::vertex_t currentVertex = source;
-
-        originDeque.push_back(currentVertex);
-
-        while (!ret && !originDeque.empty() && !managementInstance_->isTerminated())
-        {
-            currentVertex = originDeque.front();
-
-            visitedVertices.insert(currentVertex);
-
-            ret = currentVertex == target;
-
-            if (!ret)
-            {
-                const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(currentVertex);
-
-                auto it = neighborCollection.begin();
-
-                for (std::size_t remainder = neighborCollection.size(); remainder > 0; --remainder)
-                {
-                    htd::vertex_t neighbor = *it;
-
-                    if (visitedVertices.count(neighbor) == 0 && ((vertices.count(neighbor) == 1 && weights[neighbor] < currentWeight) || neighbor == target))
-                    {
-                        originDeque.push_back(neighbor);
-                    }
-
-                    ++it;
-                }
-            }
-
-            originDeque.pop_front();
-        }
-
-        return ret;
-    }
 };
 
 htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::EnhancedMaximumCardinalitySearchOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -178,18 +135,50 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
 }
 
 htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+
+    return computeOrdering(graph, preprocessedGraph, fillEdges);
+}
+
+htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges) const HTD_NOEXCEPT
 {
     HTD_UNUSED(graph)
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
+    std::size_t vertexCount = preprocessedGraph.inputGraphVertexCount();
+
+    ScratchBuffers & scratchBuffers = threadLocalScratchBuffers;
 
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
+    std::vector<htd::vertex_t> & vertices = scratchBuffers.vertices;
+    std::vector<std::size_t> & positions = scratchBuffers.positions;
+    std::vector<std::size_t> & weights = scratchBuffers.weights;
+    std::vector<std::size_t> & bucketStart = scratchBuffers.bucketStart;
+    std::vector<std::size_t> & stamps = scratchBuffers.stamps;
+    std::vector<std::vector<htd::vertex_t>> & reachedVertices = scratchBuffers.reachedVertices;
+    std::vector<htd::vertex_t> & updatedVertices = scratchBuffers.updatedVertices;
 
-    std::vector<htd::vertex_t> pool;
+    vertices.assign(preprocessedGraph.remainingVertices().begin(), preprocessedGraph.remainingVertices().end());
 
-    std::vector<std::size_t> weights(preprocessedGraph.inputGraphVertexCount());
+    /* Vertices which are not (or no longer) contained in the range [0, size) of 'vertices' are located at positions greater or equal to 'size'. */
+    positions.assign(vertexCount, vertexCount);
+
+    weights.assign(vertexCount, 0);
+
+    bucketStart.assign(size + 1, 0);
+
+    stamps.assign(vertexCount, 0);
+
+    if (reachedVertices.size() < size)
+    {
+        reachedVertices.resize(size);
+    }
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        positions[vertices[index]] = index;
+    }
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
@@ -200,25 +189,124 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
                     preprocessedGraph.eliminationSequence().begin(),
                     preprocessedGraph.eliminationSequence().end());
 
+    htd::RandomNumberGenerator & randomNumberGenerator = managementInstance.randomNumberGenerator();
+
+    /* The vertices are sorted by ascending weight, the vertices with weight i are located in the range [bucketStart[i], bucketStart[i + 1]) and the vertices with maximum weight fill the range [bucketStart[maximumWeight], size). */
+    std::size_t maximumWeight = 0;
+
+    std::size_t stamp = 0;
+
     while (size > 0 && !managementInstance.isTerminated())
     {
-        implementation_->fillMaxCardinalityPool(vertices, weights, pool);
+        std::size_t selectedPosition = bucketStart[maximumWeight] + randomNumberGenerator.nextIndex(size - bucketStart[maximumWeight]);
+
+        htd::vertex_t selectedVertex = vertices[selectedPosition];
+
+        --size;
 
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(pool);
+        htd::vertex_t lastVertex = vertices[size];
 
-        vertices.erase(selectedVertex);
+        vertices[selectedPosition] = lastVertex;
+        positions[lastVertex] = selectedPosition;
 
-        for (htd::vertex_t vertex : vertices)
+        vertices[size] = selectedVertex;
+        positions[selectedVertex] = size;
+
+        ++stamp;
+
+        stamps[selectedVertex] = stamp;
+
+        updatedVertices.clear();
+
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(selectedVertex))
         {
-            if (implementation_->hasValidPath(preprocessedGraph, weights, vertices, vertex, selectedVertex))
+            if (positions[neighbor] < size)
             {
-                weights[vertex]++;
+                stamps[neighbor] = stamp;
+
+                updatedVertices.push_back(neighbor);
+
+                reachedVertices[weights[neighbor]].push_back(neighbor);
             }
         }
 
-        pool.clear();
+        std::size_t neighborCount = updatedVertices.size();
 
-        --size;
+        /* Explore the unnumbered vertices in order of increasing maximum weight along the path from the selected vertex. A vertex whose weight exceeds this maximum is reachable via a path of strictly lighter vertices and hence its weight must be increased. */
+        for (std::size_t currentWeight = 0; currentWeight <= maximumWeight; ++currentWeight)
+        {
+            std::vector<htd::vertex_t> & currentBucket = reachedVertices[currentWeight];
+
+            while (!currentBucket.empty())
+            {
+                htd::vertex_t vertex = currentBucket.back();
+
+                currentBucket.pop_back();
+
+                for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(vertex))
+                {
+                    if (positions[neighbor] < size && stamps[neighbor] != stamp)
+                    {
+                        stamps[neighbor] = stamp;
+
+                        std::size_t neighborWeight = weights[neighbor];
+
+                        if (neighborWeight > currentWeight)
+                        {
+                            updatedVertices.push_back(neighbor);
+
+                            reachedVertices[neighborWeight].push_back(neighbor);
+                        }
+                        else
+                        {
+                            currentBucket.push_back(neighbor);
+                        }
+                    }
+                }
+            }
+        }
+
+        for (std::size_t index = 0; index < updatedVertices.size(); ++index)
+        {
+            htd::vertex_t vertex = updatedVertices[index];
+
+            std::size_t position = positions[vertex];
+
+            std::size_t & currentWeight = weights[vertex];
+
+            if (currentWeight == maximumWeight)
+            {
+                ++maximumWeight;
+
+                bucketStart[maximumWeight] = size;
+            }
+
+            /* Move the vertex to the end of its bucket and shift the start of the next bucket in front of it. */
+            std::size_t targetPosition = --bucketStart[currentWeight + 1];
+
+            htd::vertex_t displacedVertex = vertices[targetPosition];
+
+            vertices[position] = displacedVertex;
+            positions[displacedVertex] = position;
+
+            vertices[targetPosition] = vertex;
+            positions[vertex] = targetPosition;
+
+            ++currentWeight;
+
+            if (index >= neighborCount)
+            {
+                htd::vertex_t vertexName1 = preprocessedGraph.vertexName(selectedVertex);
+                htd::vertex_t vertexName2 = preprocessedGraph.vertexName(vertex);
+
+                fillEdges.emplace_back(std::min(vertexName1, vertexName2), std::max(vertexName1, vertexName2));
+            }
+        }
+
+        while (maximumWeight > 0 && bucketStart[maximumWeight] == size)
+        {
+            --maximumWeight;
+        }
 
         ordering.push_back(preprocessedGraph.vertexName(selectedVertex));
     }
@@ -228,6 +316,11 @@ htd::IVertexOrdering * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::c
     return new htd::VertexOrdering(std::move(ordering), 1);
 }
 
+bool htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::supportsComponentOrdering(void) const HTD_NOEXCEPT
+{
+    return true;
+}
+
 const htd::LibraryInstance * htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -0,0 +1,1011 @@
+/*
+ * File:   ExactOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_EXACTORDERINGALGORITHM_CPP
+#define HTD_HTD_EXACTORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/ExactOrderingAlgorithm.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/MinFillOrderingAlgorithm.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
+#include <htd/VertexOrdering.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::ExactOrderingAlgorithm.
+ */
+struct htd::ExactOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), maximumComponentSize_(DEFAULT_MAXIMUM_COMPONENT_SIZE), searchLimit_(DEFAULT_SEARCH_LIMIT), memoryLimit_(DEFAULT_MEMORY_LIMIT)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), maximumComponentSize_(original.maximumComponentSize_), searchLimit_(original.searchLimit_), memoryLimit_(original.memoryLimit_)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The maximum number of vertices of a connected component for which an optimal ordering is computed.
+     */
+    std::size_t maximumComponentSize_;
+
+    /**
+     *  The maximum number of combinations of feasible sets which are tested per connected component.
+     */
+    std::size_t searchLimit_;
+
+    /**
+     *  The maximum number of bytes which are used for the feasible sets and partial blocks of a connected component.
+     */
+    std::size_t memoryLimit_;
+
+    /**
+     *  The default value for the maximum number of vertices of a connected component for which an optimal ordering is computed.
+     */
+    static const std::size_t DEFAULT_MAXIMUM_COMPONENT_SIZE = 150;
+
+    /**
+     *  The default value for the maximum number of combinations of feasible sets which are tested per connected component.
+     */
+    static const std::size_t DEFAULT_SEARCH_LIMIT = static_cast<std::size_t>(1) << 26;
+
+    /**
+     *  The default value for the maximum number of bytes which are used for the feasible sets and partial blocks of a connected component.
+     */
+    static const std::size_t DEFAULT_MEMORY_LIMIT = static_cast<std::size_t>(1) << 30;
+
+    /**
+     *  Set a bit within a bitset.
+     *
+     *  @param[in] bitset   A pointer to the first word of the bitset.
+     *  @param[in] position The position of the bit.
+     */
+    static void setBit(std::uint64_t * bitset, std::size_t position) HTD_NOEXCEPT
+    {
+        bitset[position >> 6] |= static_cast<std::uint64_t>(1) << (position & 63);
+    }
+
+    /**
+     *  Clear a bit within a bitset.
+     *
+     *  @param[in] bitset   A pointer to the first word of the bitset.
+     *  @param[in] position The position of the bit.
+     */
+    static void clearBit(std::uint64_t * bitset, std::size_t position) HTD_NOEXCEPT
+    {
+        bitset[position >> 6] &= ~(static_cast<std::uint64_t>(1) << (position & 63));
+    }
+
+    /**
+     *  Check whether a bit within a bitset is set.
+     *
+     *  @param[in] bitset   A pointer to the first word of the bitset.
+     *  @param[in] position The position of the bit.
+     *
+     *  @return True if the bit is set, false otherwise.
+     */
+    static bool isBitSet(const std::uint64_t * bitset, std::size_t position) HTD_NOEXCEPT
+    {
+        return (bitset[position >> 6] & (static_cast<std::uint64_t>(1) << (position & 63))) != 0;
+    }
+
+    /**
+     *  Internal data structure for the search for an optimal elimination ordering of a connected component.
+     *
+     *  For a bound k, a connected vertex set C is called feasible if |N(C)| <= k and if there is a vertex v in C such
+     *  that each connected component of C \ {v} is feasible. The vertices of a feasible set can be eliminated with
+     *  width at most k by eliminating the components of C \ {v} recursively and the vertex v afterwards.
+     *
+     *  Instead of refuting the feasibility of sets top-down, the search enumerates the feasible sets bottom-up. Each
+     *  new feasible set D is combined with the partial blocks of each vertex v in N(D). A partial block of v is a set
+     *  {v} + D1 + ... + Dm of feasible sets which are adjacent to v but not to each other. It turns into a feasible
+     *  set as soon as its neighborhood contains at most k vertices. Because the neighborhoods of D1, ..., Dm are part
+     *  of the neighborhood of the final feasible set, partial blocks whose feasible sets have more than k neighbors
+     *  besides v are discarded. The component has an elimination ordering of width at most k if and only if there is
+     *  a set Y which is the union of feasible sets that are pairwise non-adjacent such that the remaining vertices
+     *  form a bag of size at most k + 1.
+     */
+    class ComponentSearch
+    {
+        public:
+            /**
+             *  Constructor for a new search.
+             *
+             *  @param[in] managementInstance   The management instance which is used to check for termination.
+             *  @param[in] vertexCount          The number of vertices of the component.
+             *  @param[in] searchLimit          The maximum number of combinations of feasible sets and partial blocks which shall be tested.
+             *  @param[in] memoryLimit          The maximum number of bytes which shall be used for the feasible sets and partial blocks.
+             */
+            ComponentSearch(const htd::LibraryInstance & managementInstance, std::size_t vertexCount, std::size_t searchLimit, std::size_t memoryLimit)
+                : managementInstance_(managementInstance), vertexCount_(vertexCount), wordCount_((vertexCount + 63) >> 6), searchLimit_(searchLimit), effort_(0), memoryLimit_(memoryLimit), memoryUsage_(0), aborted_(false),
+                  adjacencyMatrix_(vertexCount * wordCount_, 0), feasibleSets_(), feasibleSetVertices_(), pendingFeasibleSets_(), partialBlocks_(), knownPartialBlocks_(), rootSet_(), sequence_()
+            {
+
+            }
+
+            /**
+             *  Add an edge to the component.
+             *
+             *  @param[in] vertex1  The first end point of the edge.
+             *  @param[in] vertex2  The second end point of the edge.
+             */
+            void addEdge(std::size_t vertex1, std::size_t vertex2)
+            {
+                setBit(adjacencyMatrix_.data() + vertex1 * wordCount_, vertex2);
+                setBit(adjacencyMatrix_.data() + vertex2 * wordCount_, vertex1);
+            }
+
+            /**
+             *  Compute the width of an elimination ordering of the component.
+             *
+             *  @param[in] ordering The elimination ordering.
+             *
+             *  @return The width of the elimination ordering.
+             */
+            std::size_t computeWidth(const std::vector<htd::index_t> & ordering) const
+            {
+                std::size_t ret = 0;
+
+                std::vector<std::uint64_t> eliminationMatrix(adjacencyMatrix_);
+
+                for (htd::index_t vertex : ordering)
+                {
+                    ret = std::max(ret, count(eliminationMatrix.data() + vertex * wordCount_));
+
+                    eliminate(eliminationMatrix.data(), vertex);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Decide whether the component admits an elimination ordering of width at most the given bound.
+             *
+             *  @param[in] maximumWidth The maximum width of the ordering.
+             *
+             *  @return True if an ordering of the requested width was found, false if no such ordering exists or if the search was aborted.
+             */
+            bool decide(std::size_t maximumWidth)
+            {
+                feasibleSets_.clear();
+                feasibleSetVertices_.clear();
+                pendingFeasibleSets_ = std::priority_queue<std::pair<std::size_t, htd::index_t>>();
+                partialBlocks_.assign(vertexCount_, std::vector<std::uint64_t>());
+                knownPartialBlocks_.clear();
+                rootSet_.clear();
+                sequence_.clear();
+
+                memoryUsage_ = 0;
+
+                std::vector<std::uint64_t> initialBlock(wordCount_, 0);
+
+                std::vector<std::uint64_t> emptySet(wordCount_, 0);
+
+                for (std::size_t vertex = 0; vertex < vertexCount_ && rootSet_.empty() && !aborted_; ++vertex)
+                {
+                    setBit(initialBlock.data(), vertex);
+
+                    addPartialBlock(vertex, initialBlock, emptySet, maximumWidth);
+
+                    clearBit(initialBlock.data(), vertex);
+                }
+
+                std::vector<std::uint64_t> feasibleSet(wordCount_);
+                std::vector<std::uint64_t> neighborhood(wordCount_);
+                std::vector<std::uint64_t> forbidden(wordCount_);
+                std::vector<std::uint64_t> block(wordCount_);
+                std::vector<std::uint64_t> blockNeighborhood(wordCount_);
+
+                while (!pendingFeasibleSets_.empty() && rootSet_.empty() && !aborted_)
+                {
+                    feasibleSet = feasibleSets_[pendingFeasibleSets_.top().second];
+
+                    pendingFeasibleSets_.pop();
+
+                    computeNeighborhood(feasibleSet.data(), neighborhood.data());
+
+                    forEachBit(neighborhood.data(), [&](std::size_t vertex)
+                    {
+                        if (!rootSet_.empty() || aborted_)
+                        {
+                            return;
+                        }
+
+                        /* A partial block of the vertex may only be extended by sets which are neither part of nor adjacent to its feasible sets. */
+                        for (std::size_t word = 0; word < wordCount_; ++word)
+                        {
+                            forbidden[word] = feasibleSet[word] | neighborhood[word];
+                        }
+
+                        clearBit(forbidden.data(), vertex);
+
+                        if (count(forbidden.data()) - count(feasibleSet.data()) > maximumWidth)
+                        {
+                            return;
+                        }
+
+                        std::size_t blockCount = partialBlocks_[vertex].size() / (2 * wordCount_);
+
+                        for (htd::index_t blockIndex = 0; blockIndex < blockCount && rootSet_.empty() && !aborted_; ++blockIndex)
+                        {
+                            ++effort_;
+
+                            if (effort_ > searchLimit_ || ((effort_ & 1023) == 0 && managementInstance_.isTerminated()))
+                            {
+                                aborted_ = true;
+
+                                return;
+                            }
+
+                            const std::uint64_t * partialBlock = partialBlocks_[vertex].data() + 2 * blockIndex * wordCount_;
+
+                            const std::uint64_t * partialBlockNeighborhood = partialBlock + wordCount_;
+
+                            bool compatible = true;
+
+                            std::size_t neighborCount = 0;
+
+                            for (std::size_t word = 0; word < wordCount_ && compatible; ++word)
+                            {
+                                compatible = (partialBlock[word] & forbidden[word]) == 0;
+
+                                block[word] = partialBlock[word] | feasibleSet[word];
+
+                                blockNeighborhood[word] = partialBlockNeighborhood[word] | neighborhood[word];
+
+                                neighborCount += htd::popcount(blockNeighborhood[word]);
+                            }
+
+                            if (compatible)
+                            {
+                                clearBit(blockNeighborhood.data(), vertex);
+
+                                if (neighborCount - (isBitSet(neighborhood.data(), vertex) ? 1 : 0) <= maximumWidth)
+                                {
+                                    addPartialBlock(vertex, block, blockNeighborhood, maximumWidth);
+                                }
+                            }
+                        }
+                    });
+                }
+
+                if (rootSet_.empty())
+                {
+                    return false;
+                }
+
+                std::vector<std::vector<std::uint64_t>> components;
+
+                computeComponents(rootSet_.data(), components);
+
+                for (const std::vector<std::uint64_t> & component : components)
+                {
+                    writeOrdering(component);
+                }
+
+                std::vector<std::uint64_t> & bag = rootSet_;
+
+                for (std::size_t word = 0; word < wordCount_; ++word)
+                {
+                    bag[word] = ~bag[word];
+                }
+
+                forEachBit(bag.data(), [&](std::size_t vertex)
+                {
+                    if (vertex < vertexCount_)
+                    {
+                        sequence_.push_back(vertex);
+                    }
+                });
+
+                return true;
+            }
+
+            /**
+             *  Check whether the search was aborted because the search limit or the memory limit was exceeded or the management instance was terminated.
+             *
+             *  @return True if the search was aborted, false otherwise.
+             */
+            bool aborted(void) const
+            {
+                return aborted_;
+            }
+
+            /**
+             *  Getter for the elimination ordering found by the last successful call of decide().
+             *
+             *  @return The elimination ordering found by the last successful call of decide().
+             */
+            const std::vector<htd::index_t> & sequence(void) const
+            {
+                return sequence_;
+            }
+
+        private:
+            /**
+             *  The estimated number of bytes used by the containers for each partial block besides the bitsets themselves.
+             */
+            static const std::size_t PARTIAL_BLOCK_OVERHEAD = 64;
+
+            /**
+             *  The estimated number of bytes used by the containers for each feasible set besides the bitset itself.
+             */
+            static const std::size_t FEASIBLE_SET_OVERHEAD = 128;
+
+            /**
+             *  Hash function for vertex sets given as bitsets.
+             */
+            struct BitsetHash
+            {
+                std::size_t operator()(const std::vector<std::uint64_t> & bitset) const
+                {
+                    std::size_t ret = 0;
+
+                    for (std::uint64_t word : bitset)
+                    {
+                        std::hash_combine(ret, word);
+                    }
+
+                    return ret;
+                }
+            };
+
+            /**
+             *  The management instance which is used to check for termination.
+             */
+            const htd::LibraryInstance & managementInstance_;
+
+            /**
+             *  The number of vertices of the component.
+             */
+            std::size_t vertexCount_;
+
+            /**
+             *  The number of words of a bitset.
+             */
+            std::size_t wordCount_;
+
+            /**
+             *  The maximum number of combinations of feasible sets and partial blocks which shall be tested.
+             */
+            std::size_t searchLimit_;
+
+            /**
+             *  The number of combinations of feasible sets and partial blocks which were tested so far.
+             */
+            std::size_t effort_;
+
+            /**
+             *  The maximum number of bytes which shall be used for the feasible sets and partial blocks.
+             */
+            std::size_t memoryLimit_;
+
+            /**
+             *  The estimated number of bytes which are used for the feasible sets and partial blocks of the current call of decide().
+             */
+            std::size_t memoryUsage_;
+
+            /**
+             *  A boolean flag indicating whether the search was aborted.
+             */
+            bool aborted_;
+
+            /**
+             *  The adjacency matrix of the component.
+             */
+            std::vector<std::uint64_t> adjacencyMatrix_;
+
+            /**
+             *  The feasible sets in the order in which they were found.
+             */
+            std::vector<std::vector<std::uint64_t>> feasibleSets_;
+
+            /**
+             *  The vertex v of each feasible set C such that each connected component of C \ {v} is feasible.
+             */
+            std::unordered_map<std::vector<std::uint64_t>, htd::vertex_t, BitsetHash> feasibleSetVertices_;
+
+            /**
+             *  The size and the index of each feasible set which was not yet combined with the partial blocks.
+             *
+             *  Larger feasible sets are combined first, which leads to the root set much faster than processing the feasible sets in the order in which they were found.
+             */
+            std::priority_queue<std::pair<std::size_t, htd::index_t>> pendingFeasibleSets_;
+
+            /**
+             *  The partial blocks of each vertex, each of them given by its vertex set followed by the neighborhood of its feasible sets.
+             */
+            std::vector<std::vector<std::uint64_t>> partialBlocks_;
+
+            /**
+             *  The vertex sets of the partial blocks found so far, each of them followed by the vertex the partial block belongs to.
+             */
+            std::unordered_set<std::vector<std::uint64_t>, BitsetHash> knownPartialBlocks_;
+
+            /**
+             *  The union of the feasible sets which are eliminated before the remaining vertices.
+             */
+            std::vector<std::uint64_t> rootSet_;
+
+            /**
+             *  The elimination ordering found by the last successful call of decide().
+             */
+            std::vector<htd::index_t> sequence_;
+
+            /**
+             *  Call a function for each bit which is set within a bitset.
+             *
+             *  @param[in] bitset   A pointer to the first word of the bitset.
+             *  @param[in] function The function which shall be called with the position of each bit.
+             */
+            template <typename Function>
+            void forEachBit(const std::uint64_t * bitset, const Function & function) const
+            {
+                for (std::size_t index = 0; index < wordCount_; ++index)
+                {
+                    for (std::uint64_t word = bitset[index]; word != 0; word &= word - 1)
+                    {
+                        function((index << 6) + htd::countTrailingZeros(word));
+                    }
+                }
+            }
+
+            /**
+             *  Compute the number of bits which are set within a bitset.
+             *
+             *  @param[in] bitset   A pointer to the first word of the bitset.
+             *
+             *  @return The number of bits which are set within the bitset.
+             */
+            std::size_t count(const std::uint64_t * bitset) const
+            {
+                std::size_t ret = 0;
+
+                for (std::size_t index = 0; index < wordCount_; ++index)
+                {
+                    ret += htd::popcount(bitset[index]);
+                }
+
+                return ret;
+            }
+
+            /**
+             *  Eliminate a vertex, i.e., turn its neighborhood into a clique and remove it from the graph.
+             *
+             *  @param[in] eliminationMatrix    The adjacency matrix of the elimination graph.
+             *  @param[in] vertex               The vertex which shall be eliminated.
+             */
+            void eliminate(std::uint64_t * eliminationMatrix, std::size_t vertex) const
+            {
+                const std::uint64_t * neighborhood = eliminationMatrix + vertex * wordCount_;
+
+                forEachBit(neighborhood, [&](std::size_t neighbor)
+                {
+                    std::uint64_t * otherNeighborhood = eliminationMatrix + neighbor * wordCount_;
+
+                    for (std::size_t index = 0; index < wordCount_; ++index)
+                    {
+                        otherNeighborhood[index] |= neighborhood[index];
+                    }
+
+                    clearBit(otherNeighborhood, neighbor);
+                    clearBit(otherNeighborhood, vertex);
+                });
+            }
+
+            /**
+             *  Compute the open neighborhood of a vertex set.
+             *
+             *  @param[in] vertices The vertex set.
+             *  @param[out] target  The bitset to which the neighborhood shall be written.
+             */
+            void computeNeighborhood(const std::uint64_t * vertices, std::uint64_t * target) const
+            {
+                std::fill(target, target + wordCount_, 0);
+
+                forEachBit(vertices, [&](std::size_t vertex)
+                {
+                    const std::uint64_t * neighborhood = adjacencyMatrix_.data() + vertex * wordCount_;
+
+                    for (std::size_t index = 0; index < wordCount_; ++index)
+                    {
+                        target[index] |= neighborhood[index];
+                    }
+                });
+
+                for (std::size_t index = 0; index < wordCount_; ++index)
+                {
+                    target[index] &= ~vertices[index];
+                }
+            }
+
+            /**
+             *  Compute the connected components of the subgraph induced by a vertex set.
+             *
+             *  @param[in] vertices The vertex set.
+             *  @param[out] target  The vector to which the vertex sets of the connected components shall be written.
+             */
+            void computeComponents(const std::uint64_t * vertices, std::vector<std::vector<std::uint64_t>> & target) const
+            {
+                std::vector<std::uint64_t> remaining(vertices, vertices + wordCount_);
+
+                std::vector<std::uint64_t> frontier(wordCount_);
+
+                std::vector<std::uint64_t> nextFrontier(wordCount_);
+
+                target.clear();
+
+                for (std::size_t index = 0; index < wordCount_; ++index)
+                {
+                    while (remaining[index] != 0)
+                    {
+                        std::size_t vertex = (index << 6) + htd::countTrailingZeros(remaining[index]);
+
+                        target.emplace_back(wordCount_, 0);
+
+                        std::vector<std::uint64_t> & component = target.back();
+
+                        std::fill(frontier.begin(), frontier.end(), 0);
+
+                        setBit(frontier.data(), vertex);
+                        setBit(component.data(), vertex);
+
+                        clearBit(remaining.data(), vertex);
+
+                        for (bool extended = true; extended;)
+                        {
+                            std::fill(nextFrontier.begin(), nextFrontier.end(), 0);
+
+                            forEachBit(frontier.data(), [&](std::size_t member)
+                            {
+                                const std::uint64_t * neighborhood = adjacencyMatrix_.data() + member * wordCount_;
+
+                                for (std::size_t index2 = 0; index2 < wordCount_; ++index2)
+                                {
+                                    nextFrontier[index2] |= neighborhood[index2] & remaining[index2];
+                                }
+                            });
+
+                            extended = false;
+
+                            for (std::size_t index2 = 0; index2 < wordCount_; ++index2)
+                            {
+                                remaining[index2] &= ~nextFrontier[index2];
+
+                                component[index2] |= nextFrontier[index2];
+
+                                extended = extended || nextFrontier[index2] != 0;
+                            }
+
+                            std::swap(frontier, nextFrontier);
+                        }
+                    }
+                }
+            }
+
+            /**
+             *  Register a partial block of a vertex.
+             *
+             *  If the partial block or one of its combinations with the remaining vertices leads to an elimination ordering of the
+             *  whole component, the union of the feasible sets which are eliminated first is stored as root set of the search.
+             *
+             *  @param[in] vertex               The vertex the partial block belongs to.
+             *  @param[in] block                The vertex set of the partial block.
+             *  @param[in] blockNeighborhood    The neighborhood of the feasible sets of the partial block without the vertex itself.
+             *  @param[in] maximumWidth         The maximum width of the ordering.
+             */
+            void addPartialBlock(std::size_t vertex, const std::vector<std::uint64_t> & block, const std::vector<std::uint64_t> & blockNeighborhood, std::size_t maximumWidth)
+            {
+                std::vector<std::uint64_t> key(block);
+
+                key.push_back(vertex);
+
+                if (!knownPartialBlocks_.insert(std::move(key)).second)
+                {
+                    return;
+                }
+
+                /* Each partial block is stored as key of the known partial blocks and as vertex set and neighborhood of its vertex. */
+                memoryUsage_ += (3 * wordCount_ + 1) * sizeof(std::uint64_t) + PARTIAL_BLOCK_OVERHEAD;
+
+                if (memoryUsage_ > memoryLimit_)
+                {
+                    aborted_ = true;
+
+                    return;
+                }
+
+                std::size_t blockSize = count(block.data());
+
+                /* The vertex and the vertices outside the partial block form the root bag. */
+                if (vertexCount_ - blockSize + 1 <= maximumWidth + 1)
+                {
+                    rootSet_ = block;
+
+                    clearBit(rootSet_.data(), vertex);
+
+                    return;
+                }
+
+                std::vector<std::uint64_t> neighborhood(wordCount_);
+
+                computeNeighborhood(block.data(), neighborhood.data());
+
+                if (count(neighborhood.data()) <= maximumWidth && feasibleSetVertices_.emplace(block, static_cast<htd::vertex_t>(vertex)).second)
+                {
+                    memoryUsage_ += wordCount_ * sizeof(std::uint64_t) + FEASIBLE_SET_OVERHEAD;
+
+                    pendingFeasibleSets_.emplace(blockSize, feasibleSets_.size());
+
+                    feasibleSets_.push_back(block);
+
+                    /* The vertices outside the new feasible set form the root bag. */
+                    if (vertexCount_ - blockSize <= maximumWidth + 1)
+                    {
+                        rootSet_ = block;
+
+                        return;
+                    }
+                }
+
+                std::vector<std::uint64_t> & partialBlocks = partialBlocks_[vertex];
+
+                partialBlocks.insert(partialBlocks.end(), block.begin(), block.end());
+                partialBlocks.insert(partialBlocks.end(), blockNeighborhood.begin(), blockNeighborhood.end());
+            }
+
+            /**
+             *  Append an elimination ordering of a feasible set to the sequence of the search.
+             *
+             *  @param[in] feasibleSet  The feasible set.
+             */
+            void writeOrdering(const std::vector<std::uint64_t> & feasibleSet)
+            {
+                auto position = feasibleSetVertices_.find(feasibleSet);
+
+                HTD_ASSERT(position != feasibleSetVertices_.end())
+
+                htd::vertex_t vertex = position->second;
+
+                std::vector<std::uint64_t> remainder(feasibleSet);
+
+                clearBit(remainder.data(), vertex);
+
+                std::vector<std::vector<std::uint64_t>> components;
+
+                computeComponents(remainder.data(), components);
+
+                for (const std::vector<std::uint64_t> & component : components)
+                {
+                    writeOrdering(component);
+                }
+
+                sequence_.push_back(vertex);
+            }
+    };
+};
+
+const std::size_t htd::ExactOrderingAlgorithm::Implementation::DEFAULT_MAXIMUM_COMPONENT_SIZE;
+
+const std::size_t htd::ExactOrderingAlgorithm::Implementation::DEFAULT_SEARCH_LIMIT;
+
+const std::size_t htd::ExactOrderingAlgorithm::Implementation::DEFAULT_MEMORY_LIMIT;
+
+const std::size_t htd::ExactOrderingAlgorithm::Implementation::ComponentSearch::PARTIAL_BLOCK_OVERHEAD;
+
+const std::size_t htd::ExactOrderingAlgorithm::Implementation::ComponentSearch::FEASIBLE_SET_OVERHEAD;
+
+htd::ExactOrderingAlgorithm::ExactOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::ExactOrderingAlgorithm::ExactOrderingAlgorithm(const htd::ExactOrderingAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::ExactOrderingAlgorithm::~ExactOrderingAlgorithm()
+{
+
+}
+
+htd::IVertexOrdering * htd::ExactOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::ExactOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    bool optimal = false;
+
+    return computeOrdering(graph, preprocessedGraph, optimal);
+}
+
+htd::IVertexOrdering * htd::ExactOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, bool & optimal) const HTD_NOEXCEPT
+{
+    typedef htd::ExactOrderingAlgorithm::Implementation::ComponentSearch ComponentSearch;
+
+    static const htd::index_t UNDEFINED = (htd::index_t)-1;
+
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    const std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
+
+    optimal = false;
+
+    /* The min-fill ordering provides the initial upper bound for each component and the fallback for components which are too large. */
+    htd::MinFillOrderingAlgorithm heuristicAlgorithm(implementation_->managementInstance_);
+
+    htd::IVertexOrdering * heuristicOrdering = heuristicAlgorithm.computeOrdering(graph, preprocessedGraph);
+
+    std::vector<htd::index_t> localIndices(neighborhood.size(), UNDEFINED);
+
+    std::vector<std::vector<htd::vertex_t>> components;
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        if (localIndices[vertex] == UNDEFINED)
+        {
+            components.emplace_back(1, vertex);
+
+            std::vector<htd::vertex_t> & component = components.back();
+
+            localIndices[vertex] = 0;
+
+            for (htd::index_t index = 0; index < component.size(); ++index)
+            {
+                for (htd::vertex_t neighbor : neighborhood[component[index]])
+                {
+                    if (localIndices[neighbor] == UNDEFINED)
+                    {
+                        localIndices[neighbor] = component.size();
+
+                        component.push_back(neighbor);
+                    }
+                }
+            }
+
+            if (component.size() > implementation_->maximumComponentSize_)
+            {
+                return heuristicOrdering;
+            }
+        }
+    }
+
+    std::unordered_map<htd::vertex_t, htd::vertex_t> remainingVertices;
+
+    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+    {
+        remainingVertices.emplace(preprocessedGraph.vertexName(vertex), vertex);
+    }
+
+    std::vector<htd::index_t> heuristicPositions(neighborhood.size(), 0);
+
+    htd::index_t position = 0;
+
+    for (htd::vertex_t vertexName : heuristicOrdering->sequence())
+    {
+        auto match = remainingVertices.find(vertexName);
+
+        if (match != remainingVertices.end())
+        {
+            heuristicPositions[match->second] = position;
+        }
+
+        ++position;
+    }
+
+    delete heuristicOrdering;
+
+    /* Larger components tend to have larger width, which allows to skip the search for smaller components. */
+    std::stable_sort(components.begin(), components.end(), [](const std::vector<htd::vertex_t> & component1, const std::vector<htd::vertex_t> & component2)
+    {
+        return component1.size() > component2.size();
+    });
+
+    std::vector<htd::vertex_t> sequence(preprocessedGraph.eliminationSequence().begin(), preprocessedGraph.eliminationSequence().end());
+
+    sequence.reserve(neighborhood.size());
+
+    /* The search starts at the best known lower bound for the treewidth, hence each width below it is skipped right away. */
+    htd::TreeWidthLowerBoundAlgorithm lowerBoundAlgorithm(implementation_->managementInstance_);
+
+    std::size_t width = std::max(preprocessedGraph.minTreeWidth(), lowerBoundAlgorithm.computeLowerBound(preprocessedGraph));
+
+    optimal = true;
+
+    std::vector<htd::index_t> componentOrdering;
+
+    for (const std::vector<htd::vertex_t> & component : components)
+    {
+        /* Each ordering of a component which is not larger than a bag of the current width is good enough. */
+        if (component.size() <= width + 1)
+        {
+            sequence.insert(sequence.end(), component.begin(), component.end());
+
+            continue;
+        }
+
+        ComponentSearch search(managementInstance, component.size(), implementation_->searchLimit_, implementation_->memoryLimit_);
+
+        for (htd::index_t index = 0; index < component.size(); ++index)
+        {
+            for (htd::vertex_t neighbor : neighborhood[component[index]])
+            {
+                if (localIndices[neighbor] > index)
+                {
+                    search.addEdge(index, localIndices[neighbor]);
+                }
+            }
+        }
+
+        componentOrdering.resize(component.size());
+
+        std::iota(componentOrdering.begin(), componentOrdering.end(), 0);
+
+        std::sort(componentOrdering.begin(), componentOrdering.end(), [&](htd::index_t index1, htd::index_t index2)
+        {
+            return heuristicPositions[component[index1]] < heuristicPositions[component[index2]];
+        });
+
+        std::size_t componentWidth = search.computeWidth(componentOrdering);
+
+        /* Refuting the bound directly below the width of the best known ordering proves the optimality of the ordering. */
+        while (componentWidth > width)
+        {
+            if (search.decide(componentWidth - 1))
+            {
+                componentOrdering = search.sequence();
+
+                componentWidth = search.computeWidth(componentOrdering);
+            }
+            else
+            {
+                if (search.aborted())
+                {
+                    optimal = false;
+                }
+
+                width = componentWidth;
+            }
+        }
+
+        for (htd::index_t index : componentOrdering)
+        {
+            sequence.push_back(component[index]);
+        }
+    }
+
+    for (htd::index_t index = preprocessedGraph.eliminationSequence().size(); index < sequence.size(); ++index)
+    {
+        sequence[index] = preprocessedGraph.vertexName(sequence[index]);
+    }
+
+    return new htd::VertexOrdering(std::move(sequence), 1);
+}
+
+std::size_t htd::ExactOrderingAlgorithm::maximumComponentSize(void) const
+{
+    return implementation_->maximumComponentSize_;
+}
+
+void htd::ExactOrderingAlgorithm::setMaximumComponentSize(std::size_t maximumComponentSize)
+{
+    implementation_->maximumComponentSize_ = maximumComponentSize;
+}
+
+std::size_t htd::ExactOrderingAlgorithm::searchLimit(void) const
+{
+    return implementation_->searchLimit_;
+}
+
+void htd::ExactOrderingAlgorithm::setSearchLimit(std::size_t searchLimit)
+{
+    implementation_->searchLimit_ = searchLimit;
+}
+
+std::size_t htd::ExactOrderingAlgorithm::memoryLimit(void) const
+{
+    return implementation_->memoryLimit_;
+}
+
+void htd::ExactOrderingAlgorithm::setMemoryLimit(std::size_t memoryLimit)
+{
+    implementation_->memoryLimit_ = memoryLimit;
+}
+
+bool htd::ExactOrderingAlgorithm::supportsComponentOrdering(void) const HTD_NOEXCEPT
+{
+    return true;
+}
+
+const htd::LibraryInstance * htd::ExactOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ExactOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::ExactOrderingAlgorithm * htd::ExactOrderingAlgorithm::clone(void) const
+{
+    return new htd::ExactOrderingAlgorithm(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::ExactOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return new htd::ExactOrderingAlgorithm(*this);
+}
+#endif
+
+#endif /* HTD_HTD_EXACTORDERINGALGORITHM_CPP */
@@ -0,0 +1,382 @@
+/* 
+ * File:   ExactTreeDecompositionAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_EXACTTREEDECOMPOSITIONALGORITHM_CPP
+#define HTD_HTD_EXACTTREEDECOMPOSITIONALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+
+#include <htd/ExactTreeDecompositionAlgorithm.hpp>
+#include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/ExactOrderingAlgorithm.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/VertexOrdering.hpp>
+
+#include <cstdarg>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::ExactTreeDecompositionAlgorithm.
+ */
+struct htd::ExactTreeDecompositionAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager  The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager)), orderingAlgorithm_(manager)
+    {
+
+    }
+
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager                  The management instance to which the current object instance belongs.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be applied globally to each decomposition generated by the algorithm.
+     */
+    Implementation(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+        : managementInstance_(manager), algorithm_(new htd::BucketEliminationTreeDecompositionAlgorithm(manager, manipulationOperations)), orderingAlgorithm_(manager)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), algorithm_(original.algorithm_->clone()), orderingAlgorithm_(original.orderingAlgorithm_)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+        delete algorithm_;
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The decomposition algorithm which turns the optimal ordering into a tree decomposition.
+     */
+    htd::BucketEliminationTreeDecompositionAlgorithm * algorithm_;
+
+    /**
+     *  The ordering algorithm which computes the optimal ordering.
+     */
+    htd::ExactOrderingAlgorithm orderingAlgorithm_;
+
+    /**
+     *  Ordering algorithm which returns a copy of a vertex elimination ordering computed in advance.
+     */
+    class PrecomputedOrderingAlgorithm : public virtual htd::IOrderingAlgorithm
+    {
+        public:
+            /**
+             *  Constructor for a new ordering algorithm of type PrecomputedOrderingAlgorithm.
+             *
+             *  @param[in] manager      The management instance to which the new algorithm belongs.
+             *  @param[in] sequence     The vertex elimination ordering which shall be returned.
+             */
+            PrecomputedOrderingAlgorithm(const htd::LibraryInstance * const manager, std::vector<htd::vertex_t> && sequence) : managementInstance_(manager), sequence_(std::move(sequence))
+            {
+
+            }
+
+            virtual ~PrecomputedOrderingAlgorithm()
+            {
+
+            }
+
+            htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                HTD_UNUSED(graph)
+
+                return new htd::VertexOrdering(sequence_, 1);
+            }
+
+            htd::IVertexOrdering * computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                HTD_UNUSED(graph)
+                HTD_UNUSED(preprocessedGraph)
+
+                return new htd::VertexOrdering(sequence_, 1);
+            }
+
+            const htd::LibraryInstance * managementInstance(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return managementInstance_;
+            }
+
+            void setManagementInstance(const htd::LibraryInstance * const manager) HTD_OVERRIDE
+            {
+                HTD_ASSERT(manager != nullptr)
+
+                managementInstance_ = manager;
+            }
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+            PrecomputedOrderingAlgorithm * clone(void) const HTD_OVERRIDE
+            {
+                return new PrecomputedOrderingAlgorithm(*this);
+            }
+#else
+            PrecomputedOrderingAlgorithm * clone(void) const
+            {
+                return new PrecomputedOrderingAlgorithm(*this);
+            }
+
+            htd::IOrderingAlgorithm * cloneOrderingAlgorithm(void) const HTD_OVERRIDE
+            {
+                return new PrecomputedOrderingAlgorithm(*this);
+            }
+#endif
+
+        private:
+            /**
+             *  The management instance to which the current object instance belongs.
+             */
+            const htd::LibraryInstance * managementInstance_;
+
+            /**
+             *  The vertex elimination ordering which is returned.
+             */
+            std::vector<htd::vertex_t> sequence_;
+    };
+};
+
+htd::ExactTreeDecompositionAlgorithm::ExactTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::ExactTreeDecompositionAlgorithm::ExactTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) : implementation_(new Implementation(manager, manipulationOperations))
+{
+
+}
+
+htd::ExactTreeDecompositionAlgorithm::ExactTreeDecompositionAlgorithm(const htd::ExactTreeDecompositionAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::ExactTreeDecompositionAlgorithm::~ExactTreeDecompositionAlgorithm()
+{
+
+}
+
+htd::ITreeDecomposition * htd::ExactTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph) const
+{
+    return computeDecomposition(graph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::ExactTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::ITreeDecomposition * ret = computeDecomposition(graph, *preprocessedGraph, manipulationOperations);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::ExactTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return computeDecomposition(graph, preprocessedGraph, std::vector<htd::IDecompositionManipulationOperation *>());
+}
+
+htd::ITreeDecomposition * htd::ExactTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations) const
+{
+    bool optimal = false;
+
+    htd::IVertexOrdering * ordering = implementation_->orderingAlgorithm_.computeOrdering(graph, preprocessedGraph, optimal);
+
+    if (!optimal || implementation_->managementInstance_->isTerminated())
+    {
+        delete ordering;
+
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return nullptr;
+    }
+
+    std::vector<htd::vertex_t> sequence(ordering->sequence().begin(), ordering->sequence().end());
+
+    delete ordering;
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * algorithm = implementation_->algorithm_->clone();
+
+    algorithm->setOrderingAlgorithm(new Implementation::PrecomputedOrderingAlgorithm(implementation_->managementInstance_, std::move(sequence)));
+
+    htd::ITreeDecomposition * ret = algorithm->computeDecomposition(graph, preprocessedGraph, manipulationOperations);
+
+    delete algorithm;
+
+    return ret;
+}
+
+htd::ITreeDecomposition * htd::ExactTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, manipulationOperations);
+}
+
+htd::ITreeDecomposition * htd::ExactTreeDecompositionAlgorithm::computeDecomposition(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, int manipulationOperationCount, ...) const
+{
+    va_list arguments;
+
+    va_start(arguments, manipulationOperationCount);
+
+    std::vector<htd::IDecompositionManipulationOperation *> manipulationOperations;
+
+    for (int manipulationOperationIndex = 0; manipulationOperationIndex < manipulationOperationCount; manipulationOperationIndex++)
+    {
+        manipulationOperations.push_back(va_arg(arguments, htd::IDecompositionManipulationOperation *));
+    }
+
+    va_end(arguments);
+
+    return computeDecomposition(graph, preprocessedGraph, manipulationOperations);
+}
+
+void htd::ExactTreeDecompositionAlgorithm::setManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    implementation_->algorithm_->setManipulationOperations(manipulationOperations);
+}
+
+void htd::ExactTreeDecompositionAlgorithm::addManipulationOperation(htd::IDecompositionManipulationOperation * manipulationOperation)
+{
+    implementation_->algorithm_->addManipulationOperation(manipulationOperation);
+}
+
+void htd::ExactTreeDecompositionAlgorithm::addManipulationOperations(const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations)
+{
+    implementation_->algorithm_->addManipulationOperations(manipulationOperations);
+}
+
+bool htd::ExactTreeDecompositionAlgorithm::isSafelyInterruptible(void) const
+{
+    return false;
+}
+
+bool htd::ExactTreeDecompositionAlgorithm::isComputeInducedEdgesEnabled(void) const
+{
+    return implementation_->algorithm_->isComputeInducedEdgesEnabled();
+}
+
+void htd::ExactTreeDecompositionAlgorithm::setComputeInducedEdgesEnabled(bool computeInducedEdgesEnabled)
+{
+    implementation_->algorithm_->setComputeInducedEdgesEnabled(computeInducedEdgesEnabled);
+}
+
+bool htd::ExactTreeDecompositionAlgorithm::isCompressionEnabled(void) const
+{
+    return implementation_->algorithm_->isCompressionEnabled();
+}
+
+void htd::ExactTreeDecompositionAlgorithm::setCompressionEnabled(bool compressionEnabled)
+{
+    implementation_->algorithm_->setCompressionEnabled(compressionEnabled);
+}
+
+std::size_t htd::ExactTreeDecompositionAlgorithm::maximumComponentSize(void) const
+{
+    return implementation_->orderingAlgorithm_.maximumComponentSize();
+}
+
+void htd::ExactTreeDecompositionAlgorithm::setMaximumComponentSize(std::size_t maximumComponentSize)
+{
+    implementation_->orderingAlgorithm_.setMaximumComponentSize(maximumComponentSize);
+}
+
+std::size_t htd::ExactTreeDecompositionAlgorithm::searchLimit(void) const
+{
+    return implementation_->orderingAlgorithm_.searchLimit();
+}
+
+void htd::ExactTreeDecompositionAlgorithm::setSearchLimit(std::size_t searchLimit)
+{
+    implementation_->orderingAlgorithm_.setSearchLimit(searchLimit);
+}
+
+std::size_t htd::ExactTreeDecompositionAlgorithm::memoryLimit(void) const
+{
+    return implementation_->orderingAlgorithm_.memoryLimit();
+}
+
+void htd::ExactTreeDecompositionAlgorithm::setMemoryLimit(std::size_t memoryLimit)
+{
+    implementation_->orderingAlgorithm_.setMemoryLimit(memoryLimit);
+}
+
+const htd::LibraryInstance * htd::ExactTreeDecompositionAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::ExactTreeDecompositionAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+
+    implementation_->algorithm_->setManagementInstance(manager);
+
+    implementation_->orderingAlgorithm_.setManagementInstance(manager);
+}
+
+htd::ExactTreeDecompositionAlgorithm * htd::ExactTreeDecompositionAlgorithm::clone(void) const
+{
+    return new htd::ExactTreeDecompositionAlgorithm(*this);
+}
+
+#endif /* HTD_HTD_EXACTTREEDECOMPOSITIONALGORITHM_CPP */
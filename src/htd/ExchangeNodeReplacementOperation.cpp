@@ -94,7 +94,7 @@ void htd::ExchangeNodeReplacementOperation::apply(const htd::IMultiHypergraph &
     {
         htd::vertex_t node = *it;
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+        const htd::Bag & bag = decomposition.bagContent(node);
 
         std::vector<htd::vertex_t> children;
 
@@ -108,7 +108,7 @@ void htd::ExchangeNodeReplacementOperation::apply(const htd::IMultiHypergraph &
             {
                 htd::vertex_t newVertex = decomposition.addParent(child);
 
-                decomposition.mutableBagContent(newVertex) = rememberedVertices;
+                decomposition.setBagContent(newVertex, rememberedVertices);
 
                 htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(node);
 
@@ -148,7 +148,7 @@ void htd::ExchangeNodeReplacementOperation::apply(const htd::IMultiHypergraph &
 
         if (decomposition.isExchangeNode(vertex))
         {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const htd::Bag & bag = decomposition.bagContent(vertex);
 
             std::vector<htd::vertex_t> children;
 
@@ -162,7 +162,7 @@ void htd::ExchangeNodeReplacementOperation::apply(const htd::IMultiHypergraph &
                 {
                     htd::vertex_t newVertex = decomposition.addParent(child);
 
-                    decomposition.mutableBagContent(newVertex) = rememberedVertices;
+                    decomposition.setBagContent(newVertex, rememberedVertices);
 
                     htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(vertex);
 
@@ -216,7 +216,7 @@ void htd::ExchangeNodeReplacementOperation::apply(const htd::IMultiHypergraph &
     {
         htd::vertex_t node = *it;
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+        const htd::Bag & bag = decomposition.bagContent(node);
 
         std::vector<htd::vertex_t> children;
 
@@ -230,7 +230,7 @@ void htd::ExchangeNodeReplacementOperation::apply(const htd::IMultiHypergraph &
             {
                 htd::vertex_t newVertex = decomposition.addParent(child);
 
-                decomposition.mutableBagContent(newVertex) = rememberedVertices;
+                decomposition.setBagContent(newVertex, rememberedVertices);
 
                 htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(node);
 
@@ -270,7 +270,7 @@ void htd::ExchangeNodeReplacementOperation::apply(const htd::IMultiHypergraph &
 
         if (decomposition.isExchangeNode(vertex))
         {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const htd::Bag & bag = decomposition.bagContent(vertex);
 
             std::vector<htd::vertex_t> children;
 
@@ -284,7 +284,7 @@ void htd::ExchangeNodeReplacementOperation::apply(const htd::IMultiHypergraph &
                 {
                     htd::vertex_t newVertex = decomposition.addParent(child);
 
-                    decomposition.mutableBagContent(newVertex) = rememberedVertices;
+                    decomposition.setBagContent(newVertex, rememberedVertices);
 
                     htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(vertex);
 
@@ -119,7 +119,7 @@ void htd::FilteredHyperedgeCollection::restrictTo(const std::vector<htd::vertex_
     sortedVertices.erase(std::unique(sortedVertices.begin(), sortedVertices.end()), sortedVertices.end());
 
     relevantIndices_->erase(std::remove_if(relevantIndices_->begin(), relevantIndices_->end(), [&](htd::index_t index) {
-        const std::vector<htd::vertex_t> & sortedElements = baseCollection_->at(index).sortedElements();
+        const htd::VertexSpan & sortedElements = baseCollection_->at(index).sortedElements();
 
         return htd::has_non_empty_set_difference(sortedElements.begin(), sortedElements.end(), sortedVertices.begin(), sortedVertices.end());
     }), relevantIndices_->end());
@@ -136,7 +136,7 @@ htd::FilteredHyperedgeCollection * htd::FilteredHyperedgeCollection::clone(const
 
     for (htd::index_t index : *relevantIndices_)
     {
-        const std::vector<htd::vertex_t> & sortedElements = baseCollection_->at(index).sortedElements();
+        const htd::VertexSpan & sortedElements = baseCollection_->at(index).sortedElements();
 
         if (std::includes(relevantVertices.begin(), relevantVertices.end(), sortedElements.begin(), sortedElements.end()))
         {
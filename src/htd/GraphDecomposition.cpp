@@ -47,7 +47,7 @@ htd::GraphDecomposition::GraphDecomposition(const htd::IMultiHypergraph & origin
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
+        bagContent_.setBagContent(vertex, std::vector<htd::vertex_t>());
 
         inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
     }
@@ -57,7 +57,7 @@ htd::GraphDecomposition::GraphDecomposition(const htd::ILabeledMultiHypergraph &
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
+        bagContent_.setBagContent(vertex, std::vector<htd::vertex_t>());
 
         inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
     }
@@ -67,7 +67,7 @@ htd::GraphDecomposition::GraphDecomposition(const htd::IGraphDecomposition & ori
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_[vertex] = original.bagContent(vertex);
+        bagContent_.setBagContent(vertex, original.bagContent(vertex));
 
         inducedEdges_[vertex] = original.inducedHyperedges(vertex);
     }
@@ -82,7 +82,7 @@ htd::vertex_t htd::GraphDecomposition::addVertex(void)
 {
     htd::vertex_t ret = htd::LabeledMultiHypergraph::addVertex();
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
+    bagContent_.setBagContent(ret, std::vector<htd::vertex_t>());
 
     inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
 
@@ -93,7 +93,7 @@ htd::vertex_t htd::GraphDecomposition::addVertex(const std::vector<htd::vertex_t
 {
     htd::vertex_t ret = htd::LabeledMultiHypergraph::addVertex();
 
-    bagContent_[ret] = bagContent;
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_[ret] = inducedEdges;
 
@@ -104,7 +104,7 @@ htd::vertex_t htd::GraphDecomposition::addVertex(std::vector<htd::vertex_t> && b
 {
     htd::vertex_t ret = htd::LabeledMultiHypergraph::addVertex();
 
-    bagContent_.emplace(ret, std::move(bagContent));
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_.emplace(ret, std::move(inducedEdges));
 
@@ -117,7 +117,7 @@ htd::vertex_t htd::GraphDecomposition::addVertices(std::size_t count)
 
     for (htd::index_t index = 0; index < count; ++index)
     {
-        bagContent_.emplace(static_cast<htd::vertex_t>(ret + index), std::vector<htd::vertex_t>());
+        bagContent_.setBagContent(static_cast<htd::vertex_t>(ret + index), std::vector<htd::vertex_t>());
 
         inducedEdges_.emplace(static_cast<htd::vertex_t>(ret + index), htd::FilteredHyperedgeCollection());
     }
@@ -129,7 +129,7 @@ void htd::GraphDecomposition::removeVertex(htd::vertex_t vertex)
 {
     htd::LabeledMultiHypergraph::removeVertex(vertex);
 
-    bagContent_.erase(vertex);
+    bagContent_.removeBag(vertex);
 
     inducedEdges_.erase(vertex);
 }
@@ -138,21 +138,35 @@ std::size_t htd::GraphDecomposition::bagSize(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex).size();
+    return bagContent_.bagContent(vertex).size();
 }
 
 std::vector<htd::vertex_t> & htd::GraphDecomposition::mutableBagContent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return bagContent_.mutableBagContent(vertex);
 }
 
-const std::vector<htd::vertex_t> & htd::GraphDecomposition::bagContent(htd::vertex_t vertex) const
+void htd::GraphDecomposition::setBagContent(htd::vertex_t vertex, const std::vector<htd::vertex_t> & content)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    bagContent_.setBagContent(vertex, content);
+}
+
+void htd::GraphDecomposition::setBagContent(htd::vertex_t vertex, const htd::Bag & content)
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    bagContent_.setBagContent(vertex, content);
+}
+
+const htd::Bag & htd::GraphDecomposition::bagContent(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return bagContent_.bagContent(vertex);
 }
 
 htd::FilteredHyperedgeCollection & htd::GraphDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)
@@ -261,7 +275,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::GraphDec
 
         for (htd::index_t index = 0; index < count; ++index)
         {
-            bagContent_[*it] = original.bagContent_.at(*it);
+            bagContent_.setBagContent(*it, original.bagContent_.bagContent(*it));
 
             inducedEdges_[*it] = original.inducedEdges_.at(*it);
 
@@ -289,7 +303,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::IMultiHy
 
         for (htd::index_t index = 0; index < count; ++index)
         {
-            bagContent_[*it] = std::vector<htd::vertex_t>();
+            bagContent_.setBagContent(*it, std::vector<htd::vertex_t>());
 
             inducedEdges_[*it] = htd::FilteredHyperedgeCollection();
 
@@ -317,7 +331,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::ILabeled
 
         for (htd::index_t index = 0; index < count; ++index)
         {
-            bagContent_[*it] = std::vector<htd::vertex_t>();
+            bagContent_.setBagContent(*it, std::vector<htd::vertex_t>());
 
             inducedEdges_[*it] = htd::FilteredHyperedgeCollection();
 
@@ -345,7 +359,7 @@ htd::GraphDecomposition & htd::GraphDecomposition::operator=(const htd::IGraphDe
 
         for (htd::index_t index = 0; index < count; ++index)
         {
-            bagContent_[*it] = original.bagContent(*it);
+            bagContent_.setBagContent(*it, original.bagContent(*it));
 
             inducedEdges_[*it] = original.inducedHyperedges(*it);
 
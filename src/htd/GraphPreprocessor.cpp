@@ -40,8 +40,8 @@
 
 #include <algorithm>
 #include <numeric>
+#include <array>
 #include <unordered_map>
-#include <unordered_set>
 
 namespace htd
 {
@@ -572,33 +572,281 @@ struct htd::GraphPreprocessor::Implementation
         std::vector<std::vector<htd::vertex_t>> neighborhood;
     };
 
+    /**
+     *  Structure representing the set of vertices which were not yet eliminated.
+     *
+     *  The vertices are stored in a dense array so that membership tests, removals and iterations
+     *  take constant time per vertex. Vertices of degree less than 4 are additionally linked into
+     *  intrusive, doubly-linked lists, one per degree, so that a change of the degree of a vertex
+     *  only requires updating a few array entries.
+     */
+    struct RemainingVertices
+    {
+        /**
+         *  The number of degree buckets maintained by the data structure.
+         */
+        static const std::size_t BUCKET_COUNT = 4;
+
+        /**
+         *  The value marking the absence of a vertex or a position.
+         */
+        static const htd::vertex_t UNDEFINED = static_cast<htd::vertex_t>(-1);
+
+        /**
+         *  Constructor for the RemainingVertices data structure.
+         *
+         *  @param[in] vertexCount  The number of vertex indices which may be stored in the data structure.
+         */
+        explicit RemainingVertices(std::size_t vertexCount) : vertices(), positions(vertexCount, UNDEFINED), buckets(vertexCount, BUCKET_COUNT), next(vertexCount, UNDEFINED), previous(vertexCount, UNDEFINED), heads(), sizes()
+        {
+            heads.fill(UNDEFINED);
+
+            sizes.fill(0);
+        }
+
+        ~RemainingVertices()
+        {
+
+        }
+
+        /**
+         *  Check whether the data structure does not contain any vertex.
+         *
+         *  @return True if the data structure does not contain any vertex, false otherwise.
+         */
+        bool empty(void) const
+        {
+            return vertices.empty();
+        }
+
+        /**
+         *  Check whether the given vertex is contained in the data structure.
+         *
+         *  @param[in] vertex   The vertex which shall be checked.
+         *
+         *  @return True if the given vertex is contained in the data structure, false otherwise.
+         */
+        bool contains(htd::vertex_t vertex) const
+        {
+            return positions[vertex] != UNDEFINED;
+        }
+
+        /**
+         *  Insert a new vertex into the data structure.
+         *
+         *  @param[in] vertex   The vertex which shall be inserted.
+         *  @param[in] degree   The current degree of the vertex.
+         */
+        void insert(htd::vertex_t vertex, std::size_t degree)
+        {
+            HTD_ASSERT(!contains(vertex))
+
+            positions[vertex] = static_cast<htd::vertex_t>(vertices.size());
+
+            vertices.push_back(vertex);
+
+            link(vertex, degree);
+        }
+
+        /**
+         *  Remove a vertex from the data structure.
+         *
+         *  The last vertex of the dense array takes the place of the removed vertex.
+         *  Removing vertices while iterating over the data structure is therefore
+         *  not allowed.
+         *
+         *  @param[in] vertex   The vertex which shall be removed. If the vertex is not contained in the data structure, the function has no effect.
+         */
+        void erase(htd::vertex_t vertex)
+        {
+            htd::vertex_t position = positions[vertex];
+
+            if (position != UNDEFINED)
+            {
+                unlink(vertex);
+
+                htd::vertex_t lastVertex = vertices.back();
+
+                vertices[position] = lastVertex;
+
+                positions[lastVertex] = position;
+
+                vertices.pop_back();
+
+                positions[vertex] = UNDEFINED;
+            }
+        }
+
+        /**
+         *  Update the degree bucket to which the given vertex belongs.
+         *
+         *  @param[in] vertex   The vertex whose degree changed.
+         *  @param[in] degree   The new degree of the vertex.
+         */
+        void updateDegree(htd::vertex_t vertex, std::size_t degree)
+        {
+            if (contains(vertex) && buckets[vertex] != std::min(degree, BUCKET_COUNT))
+            {
+                unlink(vertex);
+
+                link(vertex, degree);
+            }
+        }
+
+        /**
+         *  Get the number of vertices having the given degree.
+         *
+         *  @param[in] degree   The degree of the vertices. The value must be less than BUCKET_COUNT.
+         *
+         *  @return The number of vertices having the given degree.
+         */
+        std::size_t bucketSize(std::size_t degree) const
+        {
+            return sizes[degree];
+        }
+
+        /**
+         *  Copy all vertices having the given degree to a target vector.
+         *
+         *  @param[in] degree   The degree of the vertices. The value must be less than BUCKET_COUNT.
+         *  @param[out] target  The target vector to which the vertices shall be appended.
+         */
+        void copyBucketTo(std::size_t degree, std::vector<htd::vertex_t> & target) const
+        {
+            target.reserve(target.size() + sizes[degree]);
+
+            for (htd::vertex_t vertex = heads[degree]; vertex != UNDEFINED; vertex = next[vertex])
+            {
+                target.push_back(vertex);
+            }
+        }
+
+        /**
+         *  Link the given vertex into the bucket corresponding to its degree.
+         *
+         *  @param[in] vertex   The vertex which shall be linked.
+         *  @param[in] degree   The current degree of the vertex.
+         */
+        void link(htd::vertex_t vertex, std::size_t degree)
+        {
+            if (degree < BUCKET_COUNT)
+            {
+                htd::vertex_t head = heads[degree];
+
+                next[vertex] = head;
+
+                previous[vertex] = UNDEFINED;
+
+                if (head != UNDEFINED)
+                {
+                    previous[head] = vertex;
+                }
+
+                heads[degree] = vertex;
+
+                buckets[vertex] = degree;
+
+                ++(sizes[degree]);
+            }
+            else
+            {
+                buckets[vertex] = BUCKET_COUNT;
+            }
+        }
+
+        /**
+         *  Unlink the given vertex from the bucket in which it is currently stored.
+         *
+         *  @param[in] vertex   The vertex which shall be unlinked.
+         */
+        void unlink(htd::vertex_t vertex)
+        {
+            std::size_t bucket = buckets[vertex];
+
+            if (bucket < BUCKET_COUNT)
+            {
+                htd::vertex_t predecessor = previous[vertex];
+                htd::vertex_t successor = next[vertex];
+
+                if (predecessor != UNDEFINED)
+                {
+                    next[predecessor] = successor;
+                }
+                else
+                {
+                    heads[bucket] = successor;
+                }
+
+                if (successor != UNDEFINED)
+                {
+                    previous[successor] = predecessor;
+                }
+
+                --(sizes[bucket]);
+
+                buckets[vertex] = BUCKET_COUNT;
+            }
+        }
+
+        /**
+         *  The remaining vertices, stored in a dense array.
+         */
+        std::vector<htd::vertex_t> vertices;
+
+        /**
+         *  The position of each vertex within the dense array or UNDEFINED if the vertex was removed.
+         */
+        std::vector<htd::vertex_t> positions;
+
+        /**
+         *  The degree bucket to which each vertex belongs. Vertices of degree BUCKET_COUNT or higher are not linked into any bucket.
+         */
+        std::vector<std::size_t> buckets;
+
+        /**
+         *  The successor of each vertex within its degree bucket.
+         */
+        std::vector<htd::vertex_t> next;
+
+        /**
+         *  The predecessor of each vertex within its degree bucket.
+         */
+        std::vector<htd::vertex_t> previous;
+
+        /**
+         *  The first vertex of each degree bucket.
+         */
+        std::array<htd::vertex_t, BUCKET_COUNT> heads;
+
+        /**
+         *  The number of vertices within each degree bucket.
+         */
+        std::array<std::size_t, BUCKET_COUNT> sizes;
+    };
+
     /**
      *  Eliminate all vertices of degree less than 2 from the graph.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The set of all available vertices, grouped by their degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
-                                                     std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool eliminateVerticesOfDegreeLessThanTwo(RemainingVertices & vertices,
                                                      std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                      std::vector<htd::vertex_t> & ordering);
 
     /**
      *  Eliminate all vertices of degree 2 from the graph.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The set of all available vertices, grouped by their degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool contractPaths(std::unordered_set<htd::vertex_t> & vertices,
-                              std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool contractPaths(RemainingVertices & vertices,
                               std::vector<std::vector<htd::vertex_t>> & neighborhood,
                               std::vector<htd::vertex_t> & ordering);
 
@@ -606,15 +854,13 @@ struct htd::GraphPreprocessor::Implementation
      *  Eliminate all vertices of degree 3 from the graph in
      *  case that at least two of its neighbors are adjacent.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The set of all available vertices, grouped by their degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
-                                std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool shrinkTriangles(RemainingVertices & vertices,
                                 std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                 std::vector<htd::vertex_t> & ordering);
 
@@ -623,15 +869,13 @@ struct htd::GraphPreprocessor::Implementation
      *  eliminate both of them and connect the three neighbors so
      *  that they form a triangle.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The set of all available vertices, grouped by their degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
-                              std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool handleBuddies(RemainingVertices & vertices,
                               std::vector<std::vector<htd::vertex_t>> & neighborhood,
                               std::vector<htd::vertex_t> & ordering);
 
@@ -639,8 +883,7 @@ struct htd::GraphPreprocessor::Implementation
      *  Eliminate all vertices from the graph for which
      *  it holds that all its neighbors form a clique.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The set of all available vertices, grouped by their degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *  @param[in] maxDegree        The degree up to which a vertex shall be considered for this preprocessing.
@@ -648,8 +891,7 @@ struct htd::GraphPreprocessor::Implementation
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool eliminateSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                            std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool eliminateSimplicialVertices(RemainingVertices & vertices,
                                             std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                             std::vector<htd::vertex_t> & ordering,
                                             std::size_t maxDegree,
@@ -660,44 +902,18 @@ struct htd::GraphPreprocessor::Implementation
      *  holds that at least all but one of its neighbors
      *  form a clique.
      *
-     *  @param[in] vertices         The set of all available vertices.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
+     *  @param[in] vertices         The set of all available vertices, grouped by their degree.
      *  @param[in] neighborhood     The neighborhood relation of the remaining graph.
      *  @param[in] ordering         The resulting, partial vertex elimination ordering.
      *  @param[in,out] minTreeWidth The lower bound for the treewidth of the given graph.
      *
      *  @return True if at least one vertex was removed due to this preprocessing step, false otherwise.
      */
-    static bool eliminateAlmostSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                  std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+    static bool eliminateAlmostSimplicialVertices(RemainingVertices & vertices,
                                                   std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                   std::vector<htd::vertex_t> & ordering,
                                                   std::size_t & minTreeWidth);
 
-    /**
-     *  Update the group to which the given vertex belongs.
-     *
-     *  @param[in] vertex           The vertex which shall be assigned to a group.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] newDegree        The new degree of the vertex.
-     *  @param[in] oldDegree        The old degree of the vertex.
-     */
-    static void assignVertexToGroup(htd::vertex_t vertex,
-                                    std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                    std::size_t newDegree,
-                                    std::size_t oldDegree);
-
-    /**
-     *  Update the group to which the given vertex belongs.
-     *
-     *  @param[in] vertex           The vertex which shall be assigned to a group.
-     *  @param[in] verticesByDegree A vector of vertex sets. The degree of each vertex in a given set is equal to the index of the set within the vector.
-     *  @param[in] newDegree        The new degree of the vertex.
-     */
-    static void assignVertexToGroup(htd::vertex_t vertex,
-                                    std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                    std::size_t newDegree);
-
     /**
      *  Decompose two sets of vertices into vertices only in the first set and vertices in both sets.
      *
@@ -720,7 +936,7 @@ struct htd::GraphPreprocessor::Implementation
      */
     void applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
                                                 htd::PreprocessedGraph & preprocessedGraph,
-                                                std::unordered_set<htd::vertex_t> & vertices) const;
+                                                RemainingVertices & vertices) const;
 
     /**
      *  Eliminate a connected component from the given preprocessed graph and update the preprocessed graph's elimination sequence.
@@ -731,7 +947,7 @@ struct htd::GraphPreprocessor::Implementation
      *  @param[in,out] minTreeWidth     The lower bound for the treewidth of the given graph component.
      */
     void eliminateVertices(const htd::IMultiHypergraph & graph,
-                           const std::unordered_set<htd::vertex_t> & vertices,
+                           const std::vector<htd::vertex_t> & vertices,
                            htd::PreprocessedGraph & preprocessedGraph,
                            std::size_t & minTreeWidth) const;
 
@@ -742,9 +958,13 @@ struct htd::GraphPreprocessor::Implementation
      *  @param[in] vertices             The set of all available vertices.
      */
     void applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                           std::unordered_set<htd::vertex_t> & vertices) const;
+                                           RemainingVertices & vertices) const;
 };
 
+const std::size_t htd::GraphPreprocessor::Implementation::RemainingVertices::BUCKET_COUNT;
+
+const htd::vertex_t htd::GraphPreprocessor::Implementation::RemainingVertices::UNDEFINED;
+
 htd::GraphPreprocessor::GraphPreprocessor(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
 {
 
@@ -765,15 +985,13 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
     std::size_t size = input.vertexNames.size();
 
-    std::vector<htd::vertex_t> vertexNames(input.vertexNames.begin(), input.vertexNames.end());
+    std::vector<htd::vertex_t> vertexNames(std::move(input.vertexNames));
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(input.neighborhood.begin(), input.neighborhood.end());
+    std::vector<std::vector<htd::vertex_t>> neighborhood(std::move(input.neighborhood));
 
     if (implementation_->applyPreprocessing1_ || implementation_->applyPreprocessing2_ || implementation_->applyPreprocessing3_ || implementation_->applyPreprocessing4_)
     {
-        std::unordered_set<htd::vertex_t> vertices(size);
-
-        std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
+        htd::GraphPreprocessor::Implementation::RemainingVertices vertices(size);
 
         std::vector<htd::vertex_t> ordering;
         ordering.reserve(size);
@@ -782,12 +1000,10 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
         for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
         {
-            vertices.insert(vertex);
-
-            implementation_->assignVertexToGroup(vertex, verticesByDegree, neighborhood[vertex].size());
+            vertices.insert(vertex, neighborhood[vertex].size());
         }
 
-        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
         {
 
         }
@@ -798,14 +1014,14 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
         {
             minTreeWidth = 2;
 
-            while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+            while (implementation_->contractPaths(vertices, neighborhood, ordering))
             {
                 ok = true;
             }
 
             if (ok)
             {
-                while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
                 {
 
                 }
@@ -816,18 +1032,18 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
         {
             minTreeWidth = 3;
 
-            while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+            while (implementation_->shrinkTriangles(vertices, neighborhood, ordering))
             {
                 ok = false;
 
-                while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                while (implementation_->contractPaths(vertices, neighborhood, ordering))
                 {
                     ok = true;
                 }
 
                 if (ok)
                 {
-                    while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                    while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
                     {
 
                     }
@@ -837,40 +1053,40 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
 
         if (!vertices.empty() && implementation_->applyPreprocessing4_)
         {
-            if (implementation_->eliminateSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, 64, minTreeWidth))
+            if (implementation_->eliminateSimplicialVertices(vertices, neighborhood, ordering, 64, minTreeWidth))
             {
-                while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+                while (implementation_->shrinkTriangles(vertices, neighborhood, ordering))
                 {
                     ok = false;
 
-                    while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                    while (implementation_->contractPaths(vertices, neighborhood, ordering))
                     {
                         ok = true;
                     }
 
                     if (ok)
                     {
-                        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                        while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
                         {
 
                         }
                     }
                 }
 
-                while (implementation_->eliminateAlmostSimplicialVertices(vertices, verticesByDegree, neighborhood, ordering, minTreeWidth))
+                while (implementation_->eliminateAlmostSimplicialVertices(vertices, neighborhood, ordering, minTreeWidth))
                 {
-                    while (implementation_->shrinkTriangles(vertices, verticesByDegree, neighborhood, ordering))
+                    while (implementation_->shrinkTriangles(vertices, neighborhood, ordering))
                     {
                         ok = false;
 
-                        while (implementation_->contractPaths(vertices, verticesByDegree, neighborhood, ordering))
+                        while (implementation_->contractPaths(vertices, neighborhood, ordering))
                         {
                             ok = true;
                         }
 
                         if (ok)
                         {
-                            while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, verticesByDegree, neighborhood, ordering))
+                            while (implementation_->eliminateVerticesOfDegreeLessThanTwo(vertices, neighborhood, ordering))
                             {
 
                             }
@@ -885,7 +1101,7 @@ htd::IPreprocessedGraph * htd::GraphPreprocessor::prepare(const htd::IMultiHyper
             ordering[index] = vertexNames[ordering[index]];
         }
 
-        std::vector<htd::vertex_t> remainingVertices(vertices.begin(), vertices.end());
+        std::vector<htd::vertex_t> remainingVertices(vertices.vertices.begin(), vertices.vertices.end());
 
         std::sort(remainingVertices.begin(), remainingVertices.end());
 
@@ -990,48 +1206,22 @@ htd::GraphPreprocessor * htd::GraphPreprocessor::clone(void) const
     return new htd::GraphPreprocessor(implementation_->managementInstance_);
 }
 
-void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t vertex,
-                                                                 std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                 std::size_t newDegree)
-{
-    if (newDegree < verticesByDegree.size())
-    {
-        verticesByDegree[newDegree].insert(vertex);
-    }
-}
-
-void htd::GraphPreprocessor::Implementation::assignVertexToGroup(htd::vertex_t vertex,
-                                                                 std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
-                                                                 std::size_t newDegree,
-                                                                 std::size_t oldDegree)
-{
-    if (oldDegree < verticesByDegree.size())
-    {
-        verticesByDegree[oldDegree].erase(vertex);
-    }
-
-    assignVertexToGroup(vertex, verticesByDegree, newDegree);
-}
-
-bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTwo(std::unordered_set<htd::vertex_t> & vertices,
-                                                                                  std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTwo(RemainingVertices & vertices,
                                                                                   std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                                   std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
+    vertices.copyBucketTo(0, ordering);
 
-    for (htd::vertex_t vertex : verticesDegree0)
+    for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
     {
-        ordering.push_back(vertex);
+        vertices.erase(*it);
     }
 
-    verticesDegree0.clear();
-
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
+    std::vector<htd::vertex_t> relevantVertices;
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree1.begin(), verticesDegree1.end());
+    vertices.copyBucketTo(1, relevantVertices);
 
     for (htd::vertex_t vertex : relevantVertices)
     {
@@ -1047,38 +1237,28 @@ bool htd::GraphPreprocessor::Implementation::eliminateVerticesOfDegreeLessThanTw
             // coverity[use_iterator]
             otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-            assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+            vertices.updateDegree(neighbor, otherNeighborhood.size());
 
             std::vector<htd::vertex_t>().swap(currentNeighborhood);
-
-            verticesDegree1.erase(vertex);
-        }
-        else
-        {
-            verticesDegree0.erase(vertex);
         }
 
-        ordering.push_back(vertex);
-    }
+        vertices.erase(vertex);
 
-    for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
-    {
-        vertices.erase(*it);
+        ordering.push_back(vertex);
     }
 
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<htd::vertex_t> & vertices,
-                                                           std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::contractPaths(RemainingVertices & vertices,
                                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                            std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
+    std::vector<htd::vertex_t> relevantVertices;
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree2.begin(), verticesDegree2.end());
+    vertices.copyBucketTo(2, relevantVertices);
 
     for (htd::vertex_t vertex : relevantVertices)
     {
@@ -1104,8 +1284,8 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
 
             if (position != otherNeighborhood1.end() && *position == neighbor2)
             {
-                assignVertexToGroup(neighbor1, verticesByDegree, otherNeighborhood1.size(), otherNeighborhood1.size() + 1);
-                assignVertexToGroup(neighbor2, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
+                vertices.updateDegree(neighbor1, otherNeighborhood1.size());
+                vertices.updateDegree(neighbor2, otherNeighborhood2.size());
             }
             else
             {
@@ -1115,8 +1295,6 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
 
             std::vector<htd::vertex_t>().swap(currentNeighborhood);
 
-            verticesDegree2.erase(vertex);
-
             ordering.push_back(vertex);
 
             vertices.erase(vertex);
@@ -1126,16 +1304,15 @@ bool htd::GraphPreprocessor::Implementation::contractPaths(std::unordered_set<ht
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<htd::vertex_t> & vertices,
-                                                             std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::shrinkTriangles(RemainingVertices & vertices,
                                                              std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                              std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
+    std::vector<htd::vertex_t> relevantVertices;
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree3.begin(), verticesDegree3.end());
+    vertices.copyBucketTo(3, relevantVertices);
 
     for (htd::vertex_t vertex : relevantVertices)
     {
@@ -1234,23 +1411,21 @@ bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<
 
                 if (neighborDegree1 != otherNeighborhood1.size())
                 {
-                    assignVertexToGroup(neighbor1, verticesByDegree, otherNeighborhood1.size(), neighborDegree1);
+                    vertices.updateDegree(neighbor1, otherNeighborhood1.size());
                 }
 
                 if (neighborDegree2 != otherNeighborhood2.size())
                 {
-                    assignVertexToGroup(neighbor2, verticesByDegree, otherNeighborhood2.size(), neighborDegree2);
+                    vertices.updateDegree(neighbor2, otherNeighborhood2.size());
                 }
 
                 if (neighborDegree3 != otherNeighborhood3.size())
                 {
-                    assignVertexToGroup(neighbor3, verticesByDegree, otherNeighborhood3.size(), neighborDegree3);
+                    vertices.updateDegree(neighbor3, otherNeighborhood3.size());
                 }
 
                 std::vector<htd::vertex_t>().swap(currentNeighborhood);
 
-                verticesDegree3.erase(vertex);
-
                 ordering.push_back(vertex);
 
                 vertices.erase(vertex);
@@ -1261,16 +1436,15 @@ bool htd::GraphPreprocessor::Implementation::shrinkTriangles(std::unordered_set<
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<htd::vertex_t> & vertices,
-                                                           std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::handleBuddies(RemainingVertices & vertices,
                                                            std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                            std::vector<htd::vertex_t> & ordering)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
+    std::vector<htd::vertex_t> relevantVertices;
 
-    std::vector<htd::vertex_t> relevantVertices(verticesDegree3.begin(), verticesDegree3.end());
+    vertices.copyBucketTo(3, relevantVertices);
 
     if (relevantVertices.size() > 1)
     {
@@ -1302,14 +1476,6 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
                             htd::vertex_t neighbor2 = currentNeighborhood1[1];
                             htd::vertex_t neighbor3 = currentNeighborhood1[2];
 
-                            std::vector<htd::vertex_t> & otherNeighborhood1 = neighborhood[neighbor1];
-                            std::vector<htd::vertex_t> & otherNeighborhood2 = neighborhood[neighbor2];
-                            std::vector<htd::vertex_t> & otherNeighborhood3 = neighborhood[neighbor3];
-
-                            std::size_t neighborDegree1 = otherNeighborhood1.size();
-                            std::size_t neighborDegree2 = otherNeighborhood2.size();
-                            std::size_t neighborDegree3 = otherNeighborhood3.size();
-
                             for (htd::vertex_t vertex : currentNeighborhood1)
                             {
                                 std::vector<htd::vertex_t> & currentNeighborhood3 = neighborhood[vertex];
@@ -1348,9 +1514,9 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
                                 }
                             }
 
-                            assignVertexToGroup(neighbor1, verticesByDegree, neighborhood[neighbor1].size(), neighborDegree1);
-                            assignVertexToGroup(neighbor2, verticesByDegree, neighborhood[neighbor2].size(), neighborDegree2);
-                            assignVertexToGroup(neighbor3, verticesByDegree, neighborhood[neighbor3].size(), neighborDegree3);
+                            vertices.updateDegree(neighbor1, neighborhood[neighbor1].size());
+                            vertices.updateDegree(neighbor2, neighborhood[neighbor2].size());
+                            vertices.updateDegree(neighbor3, neighborhood[neighbor3].size());
 
                             std::vector<htd::vertex_t>().swap(currentNeighborhood1);
                             std::vector<htd::vertex_t>().swap(currentNeighborhood2);
@@ -1368,16 +1534,13 @@ bool htd::GraphPreprocessor::Implementation::handleBuddies(std::unordered_set<ht
         for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
         {
             vertices.erase(*it);
-
-            verticesDegree3.erase(*it);
         }
     }
 
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                                         std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(RemainingVertices & vertices,
                                                                          std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                          std::vector<htd::vertex_t> & ordering,
                                                                          std::size_t maxDegree,
@@ -1385,7 +1548,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    for (htd::vertex_t vertex : vertices)
+    for (htd::vertex_t vertex : vertices.vertices)
     {
         std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
@@ -1410,7 +1573,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
                     // coverity[use_iterator]
                     otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+                    vertices.updateDegree(neighbor, otherNeighborhood.size());
                 }
 
                 minTreewidth = std::max(minTreewidth, currentNeighborhood.size());
@@ -1422,33 +1585,22 @@ bool htd::GraphPreprocessor::Implementation::eliminateSimplicialVertices(std::un
         }
     }
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
-
     for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
     {
         vertices.erase(*it);
-
-        verticesDegree0.erase(*it);
-        verticesDegree1.erase(*it);
-        verticesDegree2.erase(*it);
-        verticesDegree3.erase(*it);
     }
 
     return ordering.size() > oldOrderingSize;
 }
 
-bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(std::unordered_set<htd::vertex_t> & vertices,
-                                                                               std::vector<std::unordered_set<htd::vertex_t>> & verticesByDegree,
+bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(RemainingVertices & vertices,
                                                                                std::vector<std::vector<htd::vertex_t>> & neighborhood,
                                                                                std::vector<htd::vertex_t> & ordering,
                                                                                std::size_t & minTreeWidth)
 {
     std::size_t oldOrderingSize = ordering.size();
 
-    for (htd::vertex_t vertex : vertices)
+    for (htd::vertex_t vertex : vertices.vertices)
     {
         std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
 
@@ -1483,7 +1635,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
                     // coverity[use_iterator]
                     otherNeighborhood.erase(std::lower_bound(otherNeighborhood.begin(), otherNeighborhood.end(), vertex));
 
-                    assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood.size(), otherNeighborhood.size() + 1);
+                    vertices.updateDegree(neighbor, otherNeighborhood.size());
                 }
 
                 minTreeWidth = std::max(minTreeWidth, currentNeighborhood.size());
@@ -1530,7 +1682,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
 
                                 otherNeighborhood2.insert(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), culprit), culprit);
 
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() - 1);
+                                vertices.updateDegree(neighbor, otherNeighborhood2.size());
                             }
 
                             std::size_t middle = otherNeighborhood.size();
@@ -1539,7 +1691,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
 
                             std::inplace_merge(otherNeighborhood.begin(), otherNeighborhood.begin() + middle, otherNeighborhood.end());
 
-                            assignVertexToGroup(culprit, verticesByDegree, otherNeighborhood.size(), middle);
+                            vertices.updateDegree(culprit, otherNeighborhood.size());
 
                             for (htd::vertex_t neighbor : currentNeighborhood)
                             {
@@ -1549,7 +1701,7 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
                                 // coverity[use_iterator]
                                 otherNeighborhood2.erase(std::lower_bound(otherNeighborhood2.begin(), otherNeighborhood2.end(), vertex));
 
-                                assignVertexToGroup(neighbor, verticesByDegree, otherNeighborhood2.size(), otherNeighborhood2.size() + 1);
+                                vertices.updateDegree(neighbor, otherNeighborhood2.size());
                             }
 
                             std::vector<htd::vertex_t>().swap(currentNeighborhood);
@@ -1562,19 +1714,9 @@ bool htd::GraphPreprocessor::Implementation::eliminateAlmostSimplicialVertices(s
         }
     }
 
-    std::unordered_set<htd::vertex_t> & verticesDegree0 = verticesByDegree[0];
-    std::unordered_set<htd::vertex_t> & verticesDegree1 = verticesByDegree[1];
-    std::unordered_set<htd::vertex_t> & verticesDegree2 = verticesByDegree[2];
-    std::unordered_set<htd::vertex_t> & verticesDegree3 = verticesByDegree[3];
-
     for (auto it = ordering.begin() + oldOrderingSize; it != ordering.end(); ++it)
     {
         vertices.erase(*it);
-
-        verticesDegree0.erase(*it);
-        verticesDegree1.erase(*it);
-        verticesDegree2.erase(*it);
-        verticesDegree3.erase(*it);
     }
 
     return ordering.size() > oldOrderingSize;
@@ -1622,7 +1764,7 @@ void htd::GraphPreprocessor::Implementation::splitSets(const std::vector<htd::ve
 
 void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocessing(const htd::IMultiHypergraph & graph,
                                                                                     htd::PreprocessedGraph & preprocessedGraph,
-                                                                                    std::unordered_set<htd::vertex_t> & vertices) const
+                                                                                    RemainingVertices & vertices) const
 {
     htd::BiconnectedComponentAlgorithm biconnectedComponentAlgorithm(managementInstance_);
 
@@ -1656,7 +1798,7 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
             ++index;
         }
 
-        const std::vector<htd::vertex_t> & selectedComponent = components[htd::selectRandomElement<htd::index_t>(pool)];
+        const std::vector<htd::vertex_t> & selectedComponent = components[htd::selectRandomElement<htd::index_t>(pool, managementInstance_->randomNumberGenerator())];
 
         std::vector<htd::vertex_t> relevantArticulationPoints;
 
@@ -1717,22 +1859,20 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
            return component1.size() < component2.size();
         });
 
+        RemainingVertices componentVertices(preprocessedGraph.neighborhood().size());
+
         for (const std::vector<htd::vertex_t> & component : connectedComponents)
         {
-            std::vector<std::unordered_set<htd::vertex_t>> verticesByDegree(4);
-
             std::size_t oldOrderingSize = preprocessedGraph.eliminationSequence().size();
 
-            std::unordered_set<htd::vertex_t> componentVertices(component.begin(), component.end());
-
             std::size_t minTreeWidth = 0;
 
             for (htd::vertex_t vertex : component)
             {
-                assignVertexToGroup(vertex, verticesByDegree, preprocessedGraph.neighborhood(vertex).size());
+                componentVertices.insert(vertex, preprocessedGraph.neighborhood(vertex).size());
             }
 
-            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
             {
 
             }
@@ -1743,14 +1883,14 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
             {
                 minTreeWidth = 2;
 
-                while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                while (contractPaths(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                 {
                     ok = true;
                 }
 
                 if (ok)
                 {
-                    while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                    while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                     {
 
                     }
@@ -1761,18 +1901,18 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
             {
                 minTreeWidth = 3;
 
-                while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                while (shrinkTriangles(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                 {
                     ok = false;
 
-                    while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                    while (contractPaths(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                     {
                         ok = true;
                     }
 
                     if (ok)
                     {
-                        while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                        while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                         {
 
                         }
@@ -1782,40 +1922,40 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
 
             if (!componentVertices.empty())
             {
-                if (eliminateSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), 64, minTreeWidth))
+                if (eliminateSimplicialVertices(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), 64, minTreeWidth))
                 {
-                    while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                    while (shrinkTriangles(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                     {
                         ok = false;
 
-                        while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                        while (contractPaths(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                         {
                             ok = true;
                         }
 
                         if (ok)
                         {
-                            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                            while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                             {
 
                             }
                         }
                     }
 
-                    while (eliminateAlmostSimplicialVertices(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), minTreeWidth))
+                    while (eliminateAlmostSimplicialVertices(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence(), minTreeWidth))
                     {
-                        while (shrinkTriangles(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                        while (shrinkTriangles(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                         {
                             ok = false;
 
-                            while (contractPaths(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                            while (contractPaths(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                             {
                                 ok = true;
                             }
 
                             if (ok)
                             {
-                                while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, verticesByDegree, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
+                                while (eliminateVerticesOfDegreeLessThanTwo(componentVertices, preprocessedGraph.neighborhood(), preprocessedGraph.eliminationSequence()))
                                 {
 
                                 }
@@ -1836,29 +1976,34 @@ void htd::GraphPreprocessor::Implementation::applyBiconnectedComponentPreprocess
             {
                 oldOrderingSize = preprocessedGraph.eliminationSequence().size();
 
-                eliminateVertices(graph, componentVertices, preprocessedGraph, minTreeWidth);
+                eliminateVertices(graph, componentVertices.vertices, preprocessedGraph, minTreeWidth);
 
-                for (auto it = componentVertices.begin(); it != componentVertices.end(); ++it)
+                for (htd::vertex_t vertex : componentVertices.vertices)
                 {
-                    vertices.erase(*it);
+                    vertices.erase(vertex);
                 }
             }
             else
             {
-                std::vector<htd::vertex_t> remainingVertices(componentVertices.begin(), componentVertices.end());
+                std::vector<htd::vertex_t> remainingVertices(componentVertices.vertices.begin(), componentVertices.vertices.end());
 
                 std::sort(remainingVertices.begin(), remainingVertices.end());
 
                 preprocessedGraph.setRemainingVertices(std::move(remainingVertices));
             }
 
+            while (!componentVertices.empty())
+            {
+                componentVertices.erase(componentVertices.vertices.back());
+            }
+
             preprocessedGraph.minTreeWidth() = std::max(preprocessedGraph.minTreeWidth(), minTreeWidth);
         }
     }
 }
 
 void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMultiHypergraph & graph,
-                                                               const std::unordered_set<htd::vertex_t> & vertices,
+                                                               const std::vector<htd::vertex_t> & vertices,
                                                                htd::PreprocessedGraph & preprocessedGraph,
                                                                std::size_t & minTreeWidth) const
 {
@@ -1931,7 +2076,7 @@ void htd::GraphPreprocessor::Implementation::eliminateVertices(const htd::IMulti
 }
 
 void htd::GraphPreprocessor::Implementation::applyCliqueSeparatorPreprocessing(htd::PreprocessedGraph & preprocessedGraph,
-                                                                               std::unordered_set<htd::vertex_t> & vertices) const
+                                                                               RemainingVertices & vertices) const
 {
     htd::CliqueMinimalSeparatorAlgorithm algorithm(managementInstance_);
 
@@ -27,6 +27,176 @@
 
 #include <htd/Helpers.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     *  A boolean flag indicating whether the current thread executes a parallel region started by htd::parallelFor() or htd::parallelInvoke().
+     */
+    thread_local bool threadLocalParallelRegion = false;
+
+    /**
+     *  Mark the current thread as part of a parallel region for the lifetime of the object.
+     */
+    class ParallelRegionGuard
+    {
+        public:
+            ParallelRegionGuard(void) : previous_(threadLocalParallelRegion)
+            {
+                threadLocalParallelRegion = true;
+            }
+
+            ~ParallelRegionGuard()
+            {
+                threadLocalParallelRegion = previous_;
+            }
+
+            /**
+             *  Check whether the current thread was already part of a parallel region when the guard was created.
+             *
+             *  @return True if the current thread was already part of a parallel region when the guard was created, false otherwise.
+             */
+            bool nested(void) const
+            {
+                return previous_;
+            }
+
+        private:
+            /**
+             *  The state of the flag before the guard was created.
+             */
+            bool previous_;
+    };
+
+    /**
+     *  Collection of worker threads which are joined at the latest when the collection is destroyed.
+     *
+     *  The first exception thrown by one of the workers is stored, so that it can be rethrown on the calling thread
+     *  after all workers have finished, instead of terminating the program.
+     */
+    class WorkerThreadGroup
+    {
+        public:
+            WorkerThreadGroup(void) : failed_(false), threads_(), exception_(), mutex_()
+            {
+
+            }
+
+            ~WorkerThreadGroup()
+            {
+                join();
+            }
+
+            WorkerThreadGroup(const WorkerThreadGroup & original) = delete;
+
+            WorkerThreadGroup & operator=(const WorkerThreadGroup & original) = delete;
+
+            /**
+             *  Start a new worker thread.
+             *
+             *  @param[in] function The function which shall be executed by the worker thread.
+             */
+            template <typename Function>
+            void start(Function function)
+            {
+                threads_.emplace_back([this, function]()
+                {
+                    execute(function);
+                });
+            }
+
+            /**
+             *  Execute the given function and store the exception it throws, if any.
+             *
+             *  @param[in] function The function which shall be executed.
+             */
+            template <typename Function>
+            void execute(const Function & function)
+            {
+                try
+                {
+                    function();
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+
+                    if (!exception_)
+                    {
+                        exception_ = std::current_exception();
+                    }
+
+                    failed_ = true;
+                }
+            }
+
+            /**
+             *  Check whether one of the workers has thrown an exception.
+             *
+             *  @return True if one of the workers has thrown an exception, false otherwise.
+             */
+            bool failed(void) const
+            {
+                return failed_;
+            }
+
+            /**
+             *  Wait for all worker threads and rethrow the first exception thrown by one of the workers, if any.
+             */
+            void finish(void)
+            {
+                join();
+
+                if (exception_)
+                {
+                    std::rethrow_exception(exception_);
+                }
+            }
+
+        private:
+            /**
+             *  Wait for all worker threads which were not joined yet.
+             */
+            void join(void)
+            {
+                for (std::thread & thread : threads_)
+                {
+                    if (thread.joinable())
+                    {
+                        thread.join();
+                    }
+                }
+            }
+
+            /**
+             *  A boolean flag indicating whether one of the workers has thrown an exception.
+             */
+            std::atomic<bool> failed_;
+
+            /**
+             *  The worker threads.
+             */
+            std::vector<std::thread> threads_;
+
+            /**
+             *  The first exception thrown by one of the workers.
+             */
+            std::exception_ptr exception_;
+
+            /**
+             *  The mutex protecting the stored exception.
+             */
+            std::mutex mutex_;
+    };
+}
+
 htd::LibraryInstance * htd::createManagementInstance(htd::id_t id)
 {
     htd::LibraryInstance * ret = new htd::LibraryInstance(id);
@@ -214,45 +384,12 @@ void htd::set_intersection(const std::vector<htd::vertex_t> & set1,
 
 std::tuple<std::size_t, std::size_t, std::size_t> htd::analyze_sets(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
+    HTD_ASSERT(htd::is_sorted_and_duplicate_free(set1.begin(), set1.end()))
+    HTD_ASSERT(htd::is_sorted_and_duplicate_free(set2.begin(), set2.end()))
 
-    auto last1 = set1.end();
-    auto last2 = set2.end();
+    std::size_t overlap = htd::set_intersection_size(set1.begin(), set1.end(), set2.begin(), set2.end());
 
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
-    std::size_t overlap = 0;
-
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            onlySet1++;
-
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            onlySet2++;
-
-            ++first2;
-        }
-        else
-        {
-            overlap++;
-
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
-        }
-    }
-
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
-
-    return std::tuple<std::size_t, std::size_t, std::size_t>(onlySet1, overlap, onlySet2);
+    return std::tuple<std::size_t, std::size_t, std::size_t>(set1.size() - overlap, overlap, set2.size() - overlap);
 }
 
 void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
@@ -304,42 +441,12 @@ void htd::decompose_sets(const std::vector<htd::vertex_t> & set1,
 
 std::pair<std::size_t, std::size_t> htd::symmetric_difference_sizes(const std::vector<htd::vertex_t> & set1, const std::vector<htd::vertex_t> & set2)
 {
-    auto first1 = set1.begin();
-    auto first2 = set2.begin();
-
-    auto last1 = set1.end();
-    auto last2 = set2.end();
-
-    std::size_t onlySet1 = 0;
-    std::size_t onlySet2 = 0;
+    HTD_ASSERT(htd::is_sorted_and_duplicate_free(set1.begin(), set1.end()))
+    HTD_ASSERT(htd::is_sorted_and_duplicate_free(set2.begin(), set2.end()))
 
-    while (first1 != last1 && first2 != last2)
-    {
-        if (*first1 < *first2)
-        {
-            onlySet1++;
-
-            ++first1;
-        }
-        else if (*first2 < *first1)
-        {
-            onlySet2++;
+    std::size_t overlap = htd::set_intersection_size(set1.begin(), set1.end(), set2.begin(), set2.end());
 
-            ++first2;
-        }
-        else
-        {
-            ++first1;
-
-            //Skip common value in set 2.
-            ++first2;
-        }
-    }
-
-    onlySet1 += std::distance(first1, last1);
-    onlySet2 += std::distance(first2, last2);
-
-    return std::pair<std::size_t, std::size_t>(onlySet1, onlySet2);
+    return std::pair<std::size_t, std::size_t>(set1.size() - overlap, set2.size() - overlap);
 }
 
 std::vector<htd::vertex_t> * htd::computeJoinVertices(const htd::ITreeDecomposition & decomposition, htd::vertex_t vertex)
@@ -381,4 +488,81 @@ std::vector<htd::vertex_t> * htd::computeJoinVertices(const htd::ITreeDecomposit
     return ret;
 }
 
+void htd::parallelFor(std::size_t count, std::size_t threadCount, const std::function<void(std::size_t, std::size_t)> & function)
+{
+    /* Each thread receives several chunks on average, so that threads finishing early can take over remaining work. */
+    std::size_t chunkSize = std::max(count / (std::max(threadCount, static_cast<std::size_t>(1)) * 16), static_cast<std::size_t>(64));
+
+    threadCount = std::min(threadCount, (count + chunkSize - 1) / chunkSize);
+
+    if (threadCount <= 1 || threadLocalParallelRegion)
+    {
+        if (count > 0)
+        {
+            function(0, count);
+        }
+    }
+    else
+    {
+        std::atomic<std::size_t> nextIndex(0);
+
+        WorkerThreadGroup workers;
+
+        auto worker = [&]()
+        {
+            ParallelRegionGuard guard;
+
+            std::size_t first = nextIndex.fetch_add(chunkSize);
+
+            /* After an exception, the remaining chunks are skipped as the result is discarded anyway. */
+            while (first < count && !workers.failed())
+            {
+                function(first, std::min(first + chunkSize, count));
+
+                first = nextIndex.fetch_add(chunkSize);
+            }
+        };
+
+        for (std::size_t index = 1; index < threadCount; ++index)
+        {
+            workers.start(worker);
+        }
+
+        workers.execute(worker);
+
+        workers.finish();
+    }
+}
+
+void htd::parallelInvoke(std::size_t threadCount, const std::function<void(std::size_t)> & function)
+{
+    ParallelRegionGuard guard;
+
+    if (threadCount <= 1 || guard.nested())
+    {
+        function(0);
+    }
+    else
+    {
+        WorkerThreadGroup workers;
+
+        for (std::size_t index = 1; index < threadCount; ++index)
+        {
+            workers.start([&function, index]()
+            {
+                ParallelRegionGuard threadGuard;
+
+                function(index);
+            });
+        }
+
+        workers.execute([&function]()
+        {
+            function(0);
+        });
+
+        workers.finish();
+    }
+}
+
 #endif /* HTD_HTD_HELPERS_CPP */
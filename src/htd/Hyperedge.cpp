@@ -30,733 +30,106 @@
 #include <htd/Helpers.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <iterator>
+#include <stdexcept>
 
-/**
- *  Interface for the element information of a hyperedge.
- */
-class htd::Hyperedge::IElementInformation
-{
-    public:
-        virtual ~IElementInformation() = 0;
-
-        /**
-         *  Set the endpoints of the hyperedge.
-         *
-         *  @param[in] vertex1  The first endpoint of the updated hyperedge.
-         *  @param[in] vertex2  The second endpoint of the updated hyperedge.
-         */
-        virtual void setElements(htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_NOEXCEPT = 0;
-
-        /**
-         *  Set the endpoints of the hyperedge.
-         *
-         *  @param[in] elements The new endpoints of the updated hyperedge.
-         */
-        virtual void setElements(const std::vector<htd::vertex_t> & elements) HTD_NOEXCEPT = 0;
-
-        /**
-         *  Set the endpoints of the hyperedge.
-         *
-         *  @param[in] elements The new endpoints of the updated hyperedge.
-         */
-        virtual void setElements(std::vector<htd::vertex_t> && elements) HTD_NOEXCEPT = 0;
-
-        /**
-         *  Set the endpoints of the hyperedge.
-         *
-         *  @param[in] elements The new endpoints of the updated hyperedge.
-         */
-        virtual void setElements(const htd::ConstCollection<htd::vertex_t> & elements) HTD_NOEXCEPT = 0;
-
-        /**
-         *  Getter for the elements of the hyperedge.
-         *
-         *  @return The elements of the hyperedge.
-         */
-        virtual const std::vector<htd::vertex_t> & elements(void) const = 0;
-
-        /**
-         *  Getter for the elements of the hyperedge in ascending order without duplicates.
-         *
-         *  @return The elements of the hyperedge in ascending order without duplicates.
-         */
-        virtual const std::vector<htd::vertex_t> & sortedElements(void) const = 0;
-
-        /**
-         *  Check whether the hyperedge contains no elements.
-         *
-         *  @return True if the hyperedge contains no elements, false otherwise.
-         */
-        virtual bool empty(void) const = 0;
-
-        /**
-         *  Getter for the number of elements of the hyperedge.
-         *
-         *  @return The number of elements of the hyperedge.
-         */
-        virtual std::size_t size(void) const = 0;
-
-        /**
-         *  Check whether the hyperedge contains a specific vertex.
-         *
-         *  @param[in] vertex   The specific vertex to test for existence.
-         *
-         *  @return True if the hyperedge contains the specific vertex, false otherwise.
-         */
-        virtual bool contains(htd::vertex_t vertex) const = 0;
-
-        /**
-         *  Erase a specific vertex from the hyperedge in case the vertex is contained in the hyperedge.
-         *
-         *  @param[in] vertex   The specific vertex which shall be removed.
-         */
-        virtual void erase(htd::vertex_t vertex) = 0;
-
-        /**
-         *  Getter for a const_iterator pointing to the first element in the hyperedge.
-         *
-         *  @return A const_iterator pointing to the first element in the hyperedge.
-         */
-        virtual std::vector<htd::vertex_t>::const_iterator begin(void) const = 0;
-
-        /**
-         *  Getter for a const_iterator pointing to the end of the elements in the hyperedge.
-         *
-         *  @return A const_iterator pointing to the end of the elements in the hyperedge.
-         */
-        virtual std::vector<htd::vertex_t>::const_iterator end(void) const = 0;
-
-        /**
-         *  Access the element at the specific position within the hyperedge.
-         *
-         *  @param[in] index    The position of the element.
-         *
-         *  @return The element at the specific position.
-         */
-        virtual const htd::vertex_t & at(htd::index_t index) const = 0;
-
-        /**
-         *  Access the element at the specific position within the hyperedge.
-         *
-         *  @param[in] index    The position of the element.
-         *
-         *  @return The element at the specific position.
-         */
-        virtual const htd::vertex_t & operator[](htd::index_t index) const = 0;
-
-        /**
-         *  Create a deep copy of the current hyperedge element information.
-         *
-         *  @return A new IElementInformation object identical to the current hyperedge element information.
-         */
-        virtual IElementInformation * clone(void) const = 0;
-
-        /**
-         *  Check whether the element information is of type SortedElementInformation.
-         *
-         *  @return True if the element information is of type SortedElementInformation, false otherwise.
-         */
-        virtual bool isSortedElementInformation(void) const = 0;
-};
-
-inline htd::Hyperedge::IElementInformation::~IElementInformation() { }
-
-/**
- *  Internal class for storing the element information of a hyperedge.
- *
- *  This internal class is only used when the elements are not sorted in ascending order.
- */
-class ElementInformation : public htd::Hyperedge::IElementInformation
-{
-    public:
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] vertex1  The first endpoint of the constructed hyperedge.
-         *  @param[in] vertex2  The second endpoint of the constructed hyperedge.
-         */
-        ElementInformation(htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_NOEXCEPT : elements_(std::initializer_list<htd::vertex_t> { vertex1, vertex2 }), sortedElements_()
-        {
-            sortedElements_.push_back(vertex2);
-
-            if (vertex1 > vertex2)
-            {
-                sortedElements_.push_back(vertex1);
-            }
-        }
-
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] elements The endpoints of the constructed hyperedge.
-         */
-        ElementInformation(const std::vector<htd::vertex_t> & elements) HTD_NOEXCEPT : elements_(elements.begin(), elements.end()), sortedElements_()
-        {
-            elements_.shrink_to_fit();
-
-            sortedElements_.reserve(elements_.size());
-
-            if (elements_.size() == 2)
-            {
-                htd::vertex_t vertex1 = elements_[0];
-                htd::vertex_t vertex2 = elements_[1];
-
-                if (vertex1 > vertex2)
-                {
-                    sortedElements_.push_back(vertex2);
-                    sortedElements_.push_back(vertex1);
-                }
-                else
-                {
-                    sortedElements_.push_back(vertex1);
-                }
-            }
-            else
-            {
-                sortedElements_.insert(sortedElements_.end(), elements_.begin(), elements_.end());
-
-                std::sort(sortedElements_.begin(), sortedElements_.end());
-
-                sortedElements_.erase(std::unique(sortedElements_.begin(), sortedElements_.end()), sortedElements_.end());
-            }
-        }
-
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] elements         The endpoints of the constructed hyperedge.
-         *  @param[in] sortedElements   The endpoints of the constructed hyperedge sorted in ascending order without duplicates.
-         */
-        ElementInformation(const std::vector<htd::vertex_t> & elements, const std::vector<htd::vertex_t> & sortedElements) HTD_NOEXCEPT : elements_(elements), sortedElements_(sortedElements)
-        {
-            #ifndef NDEBUG
-            std::vector<htd::vertex_t> tmp(elements_.begin(), elements_.end());
-
-            std::sort(tmp.begin(), tmp.end());
-
-            tmp.erase(std::unique(tmp.begin(), tmp.end()), tmp.end());
-
-            HTD_ASSERT(sortedElements_ == tmp)
-            #endif
-
-            elements_.shrink_to_fit();
-
-            sortedElements_.shrink_to_fit();
-        }
-
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] elements The endpoints of the constructed hyperedge.
-         */
-        ElementInformation(std::vector<htd::vertex_t> && elements) HTD_NOEXCEPT : elements_(std::move(elements)), sortedElements_()
-        {
-            elements_.shrink_to_fit();
-
-            sortedElements_.reserve(elements_.size());
-
-            if (elements_.size() == 2)
-            {
-                htd::vertex_t vertex1 = elements_[0];
-                htd::vertex_t vertex2 = elements_[1];
-
-                if (vertex1 > vertex2)
-                {
-                    sortedElements_.push_back(vertex2);
-                    sortedElements_.push_back(vertex1);
-                }
-                else
-                {
-                    sortedElements_.push_back(vertex1);
-                }
-            }
-            else
-            {
-                sortedElements_.insert(sortedElements_.end(), elements_.begin(), elements_.end());
-
-                std::sort(sortedElements_.begin(), sortedElements_.end());
-
-                sortedElements_.erase(std::unique(sortedElements_.begin(), sortedElements_.end()), sortedElements_.end());
-            }
-        }
-
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] elements         The endpoints of the constructed hyperedge.
-         *  @param[in] sortedElements   The endpoints of the constructed hyperedge sorted in ascending order without duplicates.
-         */
-        ElementInformation(std::vector<htd::vertex_t> && elements, std::vector<htd::vertex_t> && sortedElements) HTD_NOEXCEPT : elements_(std::move(elements)), sortedElements_(std::move(sortedElements))
-        {
-            #ifndef NDEBUG
-            std::vector<htd::vertex_t> tmp(elements_.begin(), elements_.end());
-
-            std::sort(tmp.begin(), tmp.end());
-
-            tmp.erase(std::unique(tmp.begin(), tmp.end()), tmp.end());
-
-            HTD_ASSERT(sortedElements_ == tmp)
-            #endif
-
-            elements_.shrink_to_fit();
-
-            sortedElements_.shrink_to_fit();
-        }
-
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] elements The endpoints of the constructed hyperedge.
-         */
-        ElementInformation(const htd::ConstCollection<htd::vertex_t> & elements) HTD_NOEXCEPT : elements_(elements.begin(), elements.end()), sortedElements_()
-        {
-            elements_.shrink_to_fit();
-
-            sortedElements_.reserve(elements_.size());
-
-            if (elements.size() == 2)
-            {
-                htd::vertex_t vertex1 = elements_[0];
-                htd::vertex_t vertex2 = elements_[1];
-
-                if (vertex1 > vertex2)
-                {
-                    sortedElements_.push_back(vertex2);
-                    sortedElements_.push_back(vertex1);
-                }
-                else
-                {
-                    sortedElements_.push_back(vertex1);
-                }
-            }
-            else
-            {
-                sortedElements_.insert(sortedElements_.end(), elements_.begin(), elements_.end());
-
-                std::sort(sortedElements_.begin(), sortedElements_.end());
-
-                sortedElements_.erase(std::unique(sortedElements_.begin(), sortedElements_.end()), sortedElements_.end());
-            }
-        }
-
-        void setElements(htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_NOEXCEPT HTD_OVERRIDE
-        {
-            elements_.clear();
-
-            elements_.push_back(vertex1);
-            elements_.push_back(vertex2);
-
-            sortedElements_.clear();
-
-            sortedElements_.push_back(vertex2);
-
-            if (vertex1 > vertex2)
-            {
-                sortedElements_.push_back(vertex1);
-            }
-        }
-
-        /**
-         *  Set the endpoints of the hyperedge.
-         *
-         *  @param[in] elements The new endpoints of the updated hyperedge.
-         */
-        void setElements(const std::vector<htd::vertex_t> & elements) HTD_NOEXCEPT HTD_OVERRIDE
-        {
-            elements_.reserve(elements.size());
-
-            elements_ = elements;
-
-            sortedElements_.reserve(elements_.size());
-
-            if (elements_.size() == 2)
-            {
-                htd::vertex_t vertex1 = elements_[0];
-                htd::vertex_t vertex2 = elements_[1];
-
-                if (vertex1 > vertex2)
-                {
-                    sortedElements_.push_back(vertex2);
-                    sortedElements_.push_back(vertex1);
-                }
-                else
-                {
-                    sortedElements_.push_back(vertex1);
-                }
-            }
-            else
-            {
-                sortedElements_.insert(sortedElements_.end(), elements_.begin(), elements_.end());
-
-                std::sort(sortedElements_.begin(), sortedElements_.end());
-
-                sortedElements_.erase(std::unique(sortedElements_.begin(), sortedElements_.end()), sortedElements_.end());
-            }
-        }
-
-        /**
-         *  Set the endpoints of the hyperedge.
-         *
-         *  @param[in] elements The new endpoints of the updated hyperedge.
-         */
-        void setElements(std::vector<htd::vertex_t> && elements) HTD_NOEXCEPT HTD_OVERRIDE
-        {
-            elements_.swap(elements);
-
-            elements_.shrink_to_fit();
-
-            sortedElements_.reserve(elements_.size());
-
-            if (elements_.size() == 2)
-            {
-                htd::vertex_t vertex1 = elements_[0];
-                htd::vertex_t vertex2 = elements_[1];
-
-                if (vertex1 > vertex2)
-                {
-                    sortedElements_.push_back(vertex2);
-                    sortedElements_.push_back(vertex1);
-                }
-                else
-                {
-                    sortedElements_.push_back(vertex1);
-                }
-            }
-            else
-            {
-                sortedElements_.insert(sortedElements_.end(), elements_.begin(), elements_.end());
-
-                std::sort(sortedElements_.begin(), sortedElements_.end());
-
-                sortedElements_.erase(std::unique(sortedElements_.begin(), sortedElements_.end()), sortedElements_.end());
-            }
-        }
-
-        void setElements(const htd::ConstCollection<htd::vertex_t> & elements) HTD_NOEXCEPT HTD_OVERRIDE
-        {
-            setElements(std::vector<htd::vertex_t>(elements.begin(), elements.end()));
-        }
-
-        const std::vector<htd::vertex_t> & elements(void) const HTD_OVERRIDE
-        {
-            return elements_;
-        }
-
-        const std::vector<htd::vertex_t> & sortedElements(void) const HTD_OVERRIDE
-        {
-            return sortedElements_;
-        }
-
-        bool empty(void) const HTD_OVERRIDE
-        {
-            return elements_.empty();
-        }
-
-        std::size_t size(void) const HTD_OVERRIDE
-        {
-            return elements_.size();
-        }
+constexpr std::size_t htd::Hyperedge::INLINE_CAPACITY;
 
-        bool contains(htd::vertex_t vertex) const HTD_OVERRIDE
-        {
-            return std::binary_search(sortedElements_.begin(), sortedElements_.end(), vertex);
-        }
-
-        void erase(htd::vertex_t vertex) HTD_OVERRIDE
-        {
-            elements_.erase(std::remove(elements_.begin(), elements_.end(), vertex), elements_.end());
-
-            auto position = std::lower_bound(sortedElements_.begin(), sortedElements_.end(), vertex);
-
-            if (position != sortedElements_.end() && *position == vertex)
-            {
-                sortedElements_.erase(position);
-            }
-        }
-
-        std::vector<htd::vertex_t>::const_iterator begin(void) const HTD_OVERRIDE
-        {
-            return elements_.begin();
-        }
-
-        std::vector<htd::vertex_t>::const_iterator end(void) const HTD_OVERRIDE
-        {
-            return elements_.end();
-        }
-
-        const htd::vertex_t & at(htd::index_t index) const HTD_OVERRIDE
-        {
-            return elements_.at(index);
-        }
-
-        const htd::vertex_t & operator[](htd::index_t index) const HTD_OVERRIDE
-        {
-            return elements_[index];
-        }
-
-        ElementInformation * clone(void) const HTD_OVERRIDE
-        {
-            return new ElementInformation(*this);
-        }
-
-        bool isSortedElementInformation(void) const HTD_OVERRIDE
-        {
-            return false;
-        }
-
-    private:
-        std::vector<htd::vertex_t> elements_;
-
-        std::vector<htd::vertex_t> sortedElements_;
-};
-
-/**
- *  Internal class for storing the element information of a hyperedge which's elements are already sorted and free of duplicates.
- */
-class SortedElementInformation : public htd::Hyperedge::IElementInformation
-{
-    public:
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] vertex   The single endpoint of the constructed hyperedge.
-         */
-        SortedElementInformation(htd::vertex_t vertex) HTD_NOEXCEPT : elements_(std::initializer_list<htd::vertex_t> { vertex })
-        {
-
-        }
-
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] vertex1  The first endpoint of the constructed hyperedge.
-         *  @param[in] vertex2  The second endpoint of the constructed hyperedge.
-         */
-        SortedElementInformation(htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_NOEXCEPT : elements_(std::initializer_list<htd::vertex_t> { vertex1, vertex2 })
-        {
-
-        }
-
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] elements The endpoints of the constructed hyperedge.
-         */
-        SortedElementInformation(const std::vector<htd::vertex_t> & elements) HTD_NOEXCEPT : elements_(elements.begin(), elements.end())
-        {
-            elements_.shrink_to_fit();
-        }
-
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] elements The endpoints of the constructed hyperedge.
-         */
-        SortedElementInformation(std::vector<htd::vertex_t> && elements) HTD_NOEXCEPT : elements_(std::move(elements))
-        {
-            elements_.shrink_to_fit();
-        }
-
-        /**
-         *  Constructor for a hyperedge element information.
-         *
-         *  @param[in] elements The endpoints of the constructed hyperedge.
-         */
-        SortedElementInformation(const htd::ConstCollection<htd::vertex_t> & elements) HTD_NOEXCEPT : elements_(elements.begin(), elements.end())
-        {
-            elements_.shrink_to_fit();
-        }
-
-        void setElements(htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_NOEXCEPT HTD_OVERRIDE
-        {
-            elements_.clear();
-
-            elements_.push_back(vertex1);
-            elements_.push_back(vertex2);
-        }
-
-        /**
-         *  Set the endpoints of the hyperedge.
-         *
-         *  @param[in] elements The new endpoints of the updated hyperedge.
-         */
-        void setElements(const std::vector<htd::vertex_t> & elements) HTD_NOEXCEPT HTD_OVERRIDE
-        {
-            elements_.reserve(elements.size());
-
-            elements_ = elements;
-        }
-
-        /**
-         *  Set the endpoints of the hyperedge.
-         *
-         *  @param[in] elements The new endpoints of the updated hyperedge.
-         */
-        void setElements(std::vector<htd::vertex_t> && elements) HTD_NOEXCEPT HTD_OVERRIDE
-        {
-            elements_.swap(elements);
-
-            elements_.shrink_to_fit();
-        }
-
-        void setElements(const htd::ConstCollection<htd::vertex_t> & elements) HTD_NOEXCEPT HTD_OVERRIDE
-        {
-            setElements(std::vector<htd::vertex_t>(elements.begin(), elements.end()));
-        }
-
-        const std::vector<htd::vertex_t> & elements(void) const HTD_OVERRIDE
-        {
-            return elements_;
-        }
-
-        const std::vector<htd::vertex_t> & sortedElements(void) const HTD_OVERRIDE
-        {
-            return elements_;
-        }
-
-        bool empty(void) const HTD_OVERRIDE
-        {
-            return elements_.empty();
-        }
-
-        std::size_t size(void) const HTD_OVERRIDE
-        {
-            return elements_.size();
-        }
-
-        bool contains(htd::vertex_t vertex) const HTD_OVERRIDE
-        {
-            return std::binary_search(elements_.begin(), elements_.end(), vertex);
-        }
-
-        void erase(htd::vertex_t vertex) HTD_OVERRIDE
-        {
-            auto position = std::lower_bound(elements_.begin(), elements_.end(), vertex);
-
-            if (position != elements_.end() && *position == vertex)
-            {
-                elements_.erase(position);
-            }
-        }
-
-        std::vector<htd::vertex_t>::const_iterator begin(void) const HTD_OVERRIDE
-        {
-            return elements_.begin();
-        }
-
-        std::vector<htd::vertex_t>::const_iterator end(void) const HTD_OVERRIDE
-        {
-            return elements_.end();
-        }
-
-        const htd::vertex_t & at(htd::index_t index) const HTD_OVERRIDE
-        {
-            return elements_.at(index);
-        }
-
-        const htd::vertex_t & operator[](htd::index_t index) const HTD_OVERRIDE
-        {
-            return elements_[index];
-        }
-
-        SortedElementInformation * clone(void) const HTD_OVERRIDE
-        {
-            return new SortedElementInformation(*this);
-        }
-
-        bool isSortedElementInformation(void) const HTD_OVERRIDE
-        {
-            return true;
-        }
-
-    private:
-        std::vector<htd::vertex_t> elements_;
-};
+htd::Hyperedge::Hyperedge(htd::id_t id, htd::vertex_t vertex) HTD_NOEXCEPT : id_(id), size_(1), sortedSize_(1), sorted_(true)
+{
+    inlineContent_[0] = vertex;
+}
 
-htd::Hyperedge::Hyperedge(htd::id_t id, htd::vertex_t vertex) HTD_NOEXCEPT : id_(id)
+htd::Hyperedge::Hyperedge(htd::id_t id, htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_NOEXCEPT : id_(id), size_(0), sortedSize_(0), sorted_(true)
 {
-    content_.reset(new SortedElementInformation(vertex));
+    setElements(vertex1, vertex2);
 }
 
-htd::Hyperedge::Hyperedge(htd::id_t id, htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_NOEXCEPT : id_(id)
+htd::Hyperedge::Hyperedge(htd::id_t id, const std::vector<htd::vertex_t> & elements) HTD_NOEXCEPT : id_(id), size_(0), sortedSize_(0), sorted_(true)
 {
-    if (vertex1 < vertex2)
-    {
-        content_.reset(new SortedElementInformation(vertex1, vertex2));
-    }
-    else
-    {
-        content_.reset(new ElementInformation(vertex1, vertex2));
-    }
+    assign(elements.data(), elements.size());
 }
 
-htd::Hyperedge::Hyperedge(htd::id_t id, const std::vector<htd::vertex_t> & elements) HTD_NOEXCEPT : id_(id)
+htd::Hyperedge::Hyperedge(htd::id_t id, const std::vector<htd::vertex_t> & elements, const std::vector<htd::vertex_t> & sortedElements) HTD_NOEXCEPT : id_(id), size_(0), sortedSize_(0), sorted_(true)
 {
     if (htd::is_sorted_and_duplicate_free(elements.begin(), elements.end()))
     {
-        content_.reset(new SortedElementInformation(elements));
+        assign(elements.data(), elements.size(), nullptr, elements.size());
     }
     else
     {
-        content_.reset(new ElementInformation(elements));
+        #ifndef NDEBUG
+        std::vector<htd::vertex_t> tmp(elements.begin(), elements.end());
+
+        std::sort(tmp.begin(), tmp.end());
+
+        tmp.erase(std::unique(tmp.begin(), tmp.end()), tmp.end());
+
+        HTD_ASSERT(sortedElements == tmp)
+        #endif
+
+        assign(elements.data(), elements.size(), sortedElements.data(), sortedElements.size());
     }
 }
 
-htd::Hyperedge::Hyperedge(htd::id_t id, const std::vector<htd::vertex_t> & elements, const std::vector<htd::vertex_t> & sortedElements) HTD_NOEXCEPT : id_(id)
+htd::Hyperedge::Hyperedge(htd::id_t id, std::vector<htd::vertex_t> && elements) HTD_NOEXCEPT : htd::Hyperedge::Hyperedge(id, static_cast<const std::vector<htd::vertex_t> &>(elements))
 {
-    if (htd::is_sorted_and_duplicate_free(elements.begin(), elements.end()))
-    {
-        content_.reset(new SortedElementInformation(elements));
-    }
-    else
-    {
-        content_.reset(new ElementInformation(elements, sortedElements));
-    }
+
 }
 
-htd::Hyperedge::Hyperedge(htd::id_t id, std::vector<htd::vertex_t> && elements) HTD_NOEXCEPT : id_(id)
+htd::Hyperedge::Hyperedge(htd::id_t id, std::vector<htd::vertex_t> && elements, std::vector<htd::vertex_t> && sortedElements) HTD_NOEXCEPT : htd::Hyperedge::Hyperedge(id, static_cast<const std::vector<htd::vertex_t> &>(elements), static_cast<const std::vector<htd::vertex_t> &>(sortedElements))
 {
-    if (htd::is_sorted_and_duplicate_free(elements.begin(), elements.end()))
+
+}
+
+htd::Hyperedge::Hyperedge(htd::id_t id, const htd::ConstCollection<htd::vertex_t> & elements) HTD_NOEXCEPT : htd::Hyperedge::Hyperedge(id, std::vector<htd::vertex_t>(elements.begin(), elements.end()))
+{
+
+}
+
+htd::Hyperedge::Hyperedge(const htd::Hyperedge & original) HTD_NOEXCEPT : id_(original.id_), size_(original.size_), sortedSize_(original.sortedSize_), sorted_(original.sorted_)
+{
+    const htd::vertex_t * source = original.buffer();
+
+    std::size_t count = original.bufferSize();
+
+    if (count > INLINE_CAPACITY)
     {
-        content_.reset(new SortedElementInformation(std::move(elements)));
+        content_ = new htd::vertex_t[count];
+
+        std::copy(source, source + count, content_);
     }
     else
     {
-        content_.reset(new ElementInformation(std::move(elements)));
+        std::copy(source, source + count, inlineContent_);
     }
 }
 
-htd::Hyperedge::Hyperedge(htd::id_t id, std::vector<htd::vertex_t> && elements, std::vector<htd::vertex_t> && sortedElements) HTD_NOEXCEPT : id_(id)
+htd::Hyperedge::Hyperedge(htd::Hyperedge && original) HTD_NOEXCEPT : id_(original.id_), size_(original.size_), sortedSize_(original.sortedSize_), sorted_(original.sorted_)
 {
-    if (htd::is_sorted_and_duplicate_free(elements.begin(), elements.end()))
+    std::size_t count = original.bufferSize();
+
+    if (count > INLINE_CAPACITY)
     {
-        content_.reset(new SortedElementInformation(std::move(elements)));
+        content_ = original.content_;
     }
     else
     {
-        content_.reset(new ElementInformation(std::move(elements), std::move(sortedElements)));
+        std::copy(original.inlineContent_, original.inlineContent_ + count, inlineContent_);
     }
-}
 
-htd::Hyperedge::Hyperedge(htd::id_t id, const htd::ConstCollection<htd::vertex_t> & elements) HTD_NOEXCEPT : htd::Hyperedge::Hyperedge(id, std::vector<htd::vertex_t>(elements.begin(), elements.end()))
-{
-
-}
+    original.size_ = 0;
 
-htd::Hyperedge::Hyperedge(const htd::Hyperedge & original) HTD_NOEXCEPT : id_(original.id_), content_(original.content_->clone())
-{
-
-}
-
-htd::Hyperedge::Hyperedge(htd::Hyperedge && original) HTD_NOEXCEPT : id_(original.id_), content_(std::move(original.content_))
-{
+    original.sortedSize_ = 0;
 
+    original.sorted_ = true;
 }
 
 htd::Hyperedge::~Hyperedge() HTD_NOEXCEPT
 {
-
+    release();
 }
 
 htd::id_t htd::Hyperedge::id(void) const HTD_NOEXCEPT
@@ -771,84 +144,42 @@ void htd::Hyperedge::setId(htd::id_t newId) HTD_NOEXCEPT
 
 void htd::Hyperedge::setElements(htd::vertex_t vertex1, htd::vertex_t vertex2) HTD_NOEXCEPT
 {
-    if (content_->isSortedElementInformation())
+    release();
+
+    inlineContent_[0] = vertex1;
+    inlineContent_[1] = vertex2;
+
+    size_ = 2;
+
+    sorted_ = vertex1 < vertex2;
+
+    if (sorted_)
     {
-        if (vertex1 < vertex2)
-        {
-            content_->setElements(vertex1, vertex2);
-        }
-        else
-        {
-            content_.reset(new ElementInformation(vertex1, vertex2));
-        }
+        sortedSize_ = 2;
+    }
+    else if (vertex1 > vertex2)
+    {
+        inlineContent_[2] = vertex2;
+        inlineContent_[3] = vertex1;
+
+        sortedSize_ = 2;
     }
     else
     {
-        if (vertex1 < vertex2)
-        {
-            content_.reset(new SortedElementInformation(vertex1, vertex2));
-        }
-        else
-        {
-            content_->setElements(vertex1, vertex2);
-        }
+        inlineContent_[2] = vertex1;
+
+        sortedSize_ = 1;
     }
 }
 
 void htd::Hyperedge::setElements(const std::vector<htd::vertex_t> & elements) HTD_NOEXCEPT
 {
-    bool sorted = htd::is_sorted_and_duplicate_free(elements.begin(), elements.end());
-
-    if (content_->isSortedElementInformation())
-    {
-        if (sorted)
-        {
-            content_->setElements(elements);
-        }
-        else
-        {
-            content_.reset(new ElementInformation(elements));
-        }
-    }
-    else
-    {
-        if (sorted)
-        {
-            content_.reset(new SortedElementInformation(elements));
-        }
-        else
-        {
-            content_->setElements(elements);
-        }
-    }
+    assign(elements.data(), elements.size());
 }
 
 void htd::Hyperedge::setElements(std::vector<htd::vertex_t> && elements) HTD_NOEXCEPT
 {
-    bool sorted = htd::is_sorted_and_duplicate_free(elements.begin(), elements.end());
-
-    if (content_->isSortedElementInformation())
-    {
-        if (sorted)
-        {
-            content_->setElements(std::move(elements));
-        }
-        else
-        {
-            content_.reset(new ElementInformation(std::move(elements)));
-        }
-    }
-    else
-    {
-        if (sorted)
-        {
-            content_.reset(new SortedElementInformation(std::move(elements)));
-        }
-        else
-        {
-            content_->setElements(std::move(elements));
-        }
-    }
+    assign(elements.data(), elements.size());
 }
 
 void htd::Hyperedge::setElements(const htd::ConstCollection<htd::vertex_t> & elements) HTD_NOEXCEPT
@@ -856,102 +187,293 @@ void htd::Hyperedge::setElements(const htd::ConstCollection<htd::vertex_t> & ele
     setElements(std::vector<htd::vertex_t>(elements.begin(), elements.end()));
 }
 
-const std::vector<htd::vertex_t> & htd::Hyperedge::elements(void) const HTD_NOEXCEPT
+htd::VertexSpan htd::Hyperedge::elements(void) const HTD_NOEXCEPT
 {
-    return content_->elements();
+    return htd::VertexSpan(buffer(), size_);
 }
 
-const std::vector<htd::vertex_t> & htd::Hyperedge::sortedElements(void) const HTD_NOEXCEPT
+htd::VertexSpan htd::Hyperedge::sortedElements(void) const HTD_NOEXCEPT
 {
-    return content_->sortedElements();
+    return sorted_ ? htd::VertexSpan(buffer(), size_) : htd::VertexSpan(buffer() + size_, sortedSize_);
 }
 
 bool htd::Hyperedge::empty(void) const HTD_NOEXCEPT
 {
-    return content_->empty();
+    return size_ == 0;
 }
 
 std::size_t htd::Hyperedge::size(void) const HTD_NOEXCEPT
 {
-    return content_->size();
+    return size_;
 }
 
 bool htd::Hyperedge::contains(htd::vertex_t vertex) const HTD_NOEXCEPT
 {
-    return content_->contains(vertex);
+    const htd::VertexSpan & sortedElements = this->sortedElements();
+
+    return std::binary_search(sortedElements.begin(), sortedElements.end(), vertex);
 }
 
 void htd::Hyperedge::erase(htd::vertex_t vertex) HTD_NOEXCEPT
 {
-    content_->erase(vertex);
+    if (contains(vertex))
+    {
+        const htd::VertexSpan & elements = this->elements();
+
+        const htd::VertexSpan & sortedElements = this->sortedElements();
+
+        std::vector<htd::vertex_t> remainingElements;
+
+        remainingElements.reserve(elements.size());
+
+        std::remove_copy(elements.begin(), elements.end(), std::back_inserter(remainingElements), vertex);
+
+        if (htd::is_sorted_and_duplicate_free(remainingElements.begin(), remainingElements.end()))
+        {
+            assign(remainingElements.data(), remainingElements.size(), nullptr, remainingElements.size());
+        }
+        else
+        {
+            std::vector<htd::vertex_t> remainingSortedElements;
+
+            remainingSortedElements.reserve(sortedElements.size());
+
+            std::remove_copy(sortedElements.begin(), sortedElements.end(), std::back_inserter(remainingSortedElements), vertex);
+
+            assign(remainingElements.data(), remainingElements.size(), remainingSortedElements.data(), remainingSortedElements.size());
+        }
+    }
 }
 
-std::vector<htd::vertex_t>::const_iterator htd::Hyperedge::begin(void) const HTD_NOEXCEPT
+htd::VertexSpan::const_iterator htd::Hyperedge::begin(void) const HTD_NOEXCEPT
 {
-    return content_->begin();
+    return buffer();
 }
 
-std::vector<htd::vertex_t>::const_iterator htd::Hyperedge::end(void) const HTD_NOEXCEPT
+htd::VertexSpan::const_iterator htd::Hyperedge::end(void) const HTD_NOEXCEPT
 {
-    return content_->end();
+    return buffer() + size_;
 }
 
 const htd::vertex_t & htd::Hyperedge::at(htd::index_t index) const
 {
-    return content_->at(index);
+    if (index >= size_)
+    {
+        throw std::out_of_range("const htd::vertex_t & htd::Hyperedge::at(htd::index_t) const");
+    }
+
+    return buffer()[index];
 }
 
 const htd::vertex_t & htd::Hyperedge::operator[](htd::index_t index) const
 {
-    return (*content_)[index];
+    HTD_ASSERT(index < size_)
+
+    return buffer()[index];
 }
 
 htd::Hyperedge & htd::Hyperedge::operator=(const htd::Hyperedge & original)
 {
-    id_ = original.id_;
+    if (this != &original)
+    {
+        id_ = original.id_;
 
-    content_.reset(original.content_->clone());
+        const htd::vertex_t * source = original.buffer();
+
+        assign(source, original.size_, original.sorted_ ? nullptr : source + original.size_, original.sortedSize_);
+    }
 
     return *this;
 }
 
 htd::Hyperedge & htd::Hyperedge::operator=(htd::Hyperedge && original) HTD_NOEXCEPT
 {
-    id_ = original.id_;
+    if (this != &original)
+    {
+        release();
+
+        id_ = original.id_;
+
+        size_ = original.size_;
+
+        sortedSize_ = original.sortedSize_;
+
+        sorted_ = original.sorted_;
 
-    content_ = std::move(original.content_);
+        std::size_t count = original.bufferSize();
+
+        if (count > INLINE_CAPACITY)
+        {
+            content_ = original.content_;
+        }
+        else
+        {
+            std::copy(original.inlineContent_, original.inlineContent_ + count, inlineContent_);
+        }
+
+        original.size_ = 0;
+
+        original.sortedSize_ = 0;
+
+        original.sorted_ = true;
+    }
 
     return *this;
 }
 
 bool htd::Hyperedge::operator<(const htd::Hyperedge & rhs) const
 {
-    return std::tie(content_->elements(), id_) < std::tie(rhs.content_->elements(), rhs.id_);
+    const htd::VertexSpan & elements = this->elements();
+
+    const htd::VertexSpan & otherElements = rhs.elements();
+
+    if (elements < otherElements)
+    {
+        return true;
+    }
+
+    if (otherElements < elements)
+    {
+        return false;
+    }
+
+    return id_ < rhs.id_;
 }
 
 bool htd::Hyperedge::operator>(const htd::Hyperedge & rhs) const
 {
-    return std::tie(content_->elements(), id_) > std::tie(rhs.content_->elements(), rhs.id_);
+    return rhs < *this;
 }
 
 bool htd::Hyperedge::operator==(const htd::Hyperedge & rhs) const
 {
-    return rhs.content_->elements() == content_->elements();
+    return rhs.elements() == elements();
 }
 
 bool htd::Hyperedge::operator==(const std::vector<htd::vertex_t> & rhs) const
 {
-    return rhs == content_->elements();
+    return rhs == elements();
 }
 
 bool htd::Hyperedge::operator!=(const htd::Hyperedge & rhs) const
 {
-    return rhs.content_->elements() != content_->elements();
+    return rhs.elements() != elements();
 }
 
 bool htd::Hyperedge::operator!=(const std::vector<htd::vertex_t> & rhs) const
 {
-    return rhs != content_->elements();
+    return rhs != elements();
+}
+
+std::size_t htd::Hyperedge::bufferSize(void) const HTD_NOEXCEPT
+{
+    return sorted_ ? size_ : static_cast<std::size_t>(size_) + sortedSize_;
+}
+
+const htd::vertex_t * htd::Hyperedge::buffer(void) const HTD_NOEXCEPT
+{
+    return bufferSize() > INLINE_CAPACITY ? content_ : inlineContent_;
+}
+
+void htd::Hyperedge::assign(const htd::vertex_t * elements, std::size_t size, const htd::vertex_t * sortedElements, std::size_t sortedSize)
+{
+    HTD_ASSERT(size <= UINT32_MAX)
+
+    std::size_t count = sortedElements == nullptr ? size : size + sortedSize;
+
+    /* The new endpoints may refer to the current buffer, hence they are copied before the buffer is released. */
+    htd::vertex_t inlineBuffer[INLINE_CAPACITY];
+
+    htd::vertex_t * target = count > INLINE_CAPACITY ? new htd::vertex_t[count] : inlineBuffer;
+
+    std::copy(elements, elements + size, target);
+
+    if (sortedElements != nullptr)
+    {
+        std::copy(sortedElements, sortedElements + sortedSize, target + size);
+    }
+
+    release();
+
+    size_ = static_cast<std::uint32_t>(size);
+
+    sorted_ = sortedElements == nullptr;
+
+    sortedSize_ = static_cast<std::uint32_t>(sorted_ ? size : sortedSize);
+
+    if (count > INLINE_CAPACITY)
+    {
+        content_ = target;
+    }
+    else
+    {
+        std::copy(inlineBuffer, inlineBuffer + count, inlineContent_);
+    }
+}
+
+void htd::Hyperedge::assign(const htd::vertex_t * elements, std::size_t size)
+{
+    if (htd::is_sorted_and_duplicate_free(elements, elements + size))
+    {
+        assign(elements, size, nullptr, size);
+    }
+    else if (size <= INLINE_CAPACITY)
+    {
+        /* The number of endpoints is tiny, hence an insertion sort which drops duplicates is sufficient. */
+        htd::vertex_t sortedElements[INLINE_CAPACITY];
+
+        std::size_t sortedSize = 0;
+
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            htd::vertex_t vertex = elements[index];
+
+            std::size_t position = sortedSize;
+
+            while (position > 0 && sortedElements[position - 1] > vertex)
+            {
+                --position;
+            }
+
+            if (position == 0 || sortedElements[position - 1] != vertex)
+            {
+                for (std::size_t current = sortedSize; current > position; --current)
+                {
+                    sortedElements[current] = sortedElements[current - 1];
+                }
+
+                sortedElements[position] = vertex;
+
+                ++sortedSize;
+            }
+        }
+
+        assign(elements, size, sortedElements, sortedSize);
+    }
+    else
+    {
+        std::vector<htd::vertex_t> sortedElements(elements, elements + size);
+
+        std::sort(sortedElements.begin(), sortedElements.end());
+
+        sortedElements.erase(std::unique(sortedElements.begin(), sortedElements.end()), sortedElements.end());
+
+        assign(elements, size, sortedElements.data(), sortedElements.size());
+    }
+}
+
+void htd::Hyperedge::release(void) HTD_NOEXCEPT
+{
+    if (bufferSize() > INLINE_CAPACITY)
+    {
+        delete[] content_;
+    }
+
+    size_ = 0;
+
+    sortedSize_ = 0;
+
+    sorted_ = true;
 }
 
 #endif /* HTD_HTD_HYPEREDGE_CPP */
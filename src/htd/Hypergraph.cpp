@@ -315,7 +315,7 @@ htd::id_t htd::Hypergraph::addEdge(const htd::ConstCollection<htd::vertex_t> & e
 
 htd::id_t htd::Hypergraph::addEdge(const htd::Hyperedge & hyperedge)
 {
-    const htd::ConstCollection<htd::id_t> & associatedIds = associatedEdgeIds(hyperedge.elements());
+    const htd::ConstCollection<htd::id_t> & associatedIds = associatedEdgeIds(hyperedge.elements().toVector());
 
     if (associatedIds.size() > 0)
     {
@@ -327,7 +327,7 @@ htd::id_t htd::Hypergraph::addEdge(const htd::Hyperedge & hyperedge)
 
 htd::id_t htd::Hypergraph::addEdge(htd::Hyperedge && hyperedge)
 {
-    const htd::ConstCollection<htd::id_t> & associatedIds = associatedEdgeIds(hyperedge.elements());
+    const htd::ConstCollection<htd::id_t> & associatedIds = associatedEdgeIds(hyperedge.elements().toVector());
 
     if (associatedIds.size() > 0)
     {
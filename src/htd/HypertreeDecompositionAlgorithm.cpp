@@ -194,7 +194,7 @@ htd::IHypertreeDecomposition * htd::HypertreeDecompositionAlgorithm::computeDeco
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
-            htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(ret->bagContent(vertex)), *labelCollection);
 
             delete labelCollection;
 
@@ -208,7 +208,7 @@ htd::IHypertreeDecomposition * htd::HypertreeDecompositionAlgorithm::computeDeco
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
-            htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(ret->bagContent(vertex)), *labelCollection);
 
             delete labelCollection;
 
@@ -394,7 +394,7 @@ void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(cons
 
     for (htd::index_t index1 = 0; index1 < edgeCount; ++index1)
     {
-        const std::vector<htd::vertex_t> & elements1 = it1->sortedElements();
+        const htd::VertexSpan & elements1 = it1->sortedElements();
 
         bool maximal = true;
 
@@ -404,7 +404,7 @@ void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(cons
 
         for (htd::index_t index2 = index1 + 1; index2 < edgeCount; ++index2)
         {
-            const std::vector<htd::vertex_t> & elements2 = it2->sortedElements();
+            const htd::VertexSpan & elements2 = it2->sortedElements();
 
             if (std::includes(elements2.begin(), elements2.end(), elements1.begin(), elements1.end()))
             {
@@ -418,7 +418,7 @@ void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(cons
         {
             relevantHyperedges.push_back(*it1);
 
-            relevantContainers.push_back(elements1);
+            relevantContainers.push_back(elements1.toVector());
         }
 
         ++it1;
@@ -436,7 +436,9 @@ void htd::HypertreeDecompositionAlgorithm::Implementation::setCoveringEdges(cons
 
         std::vector<htd::index_t> selectedIndices;
 
-        setCoverAlgorithm->computeSetCover(decomposition.bagContent(vertex), relevantContainers, selectedIndices);
+        const htd::Bag & bag = decomposition.bagContent(vertex);
+
+        setCoverAlgorithm->computeSetCover(std::vector<htd::vertex_t>(bag.begin(), bag.end()), relevantContainers, selectedIndices);
 
         std::vector<htd::Hyperedge> selectedHyperedges;
 
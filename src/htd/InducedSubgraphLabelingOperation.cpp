@@ -111,7 +111,7 @@ void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph &
 
         std::vector<htd::Hyperedge> label;
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+        const htd::Bag & bag = decomposition.bagContent(vertex);
 
         bool edgeIntroductionCheckNeeded = false;
 
@@ -257,7 +257,7 @@ void htd::InducedSubgraphLabelingOperation::apply(const htd::IMultiHypergraph &
 
         std::vector<htd::Hyperedge> label;
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+        const htd::Bag & bag = decomposition.bagContent(vertex);
 
         bool edgeIntroductionCheckNeeded = false;
 
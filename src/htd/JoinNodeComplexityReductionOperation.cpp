@@ -94,7 +94,7 @@ void htd::JoinNodeComplexityReductionOperation::apply(const htd::IMultiHypergrap
     {
         htd::vertex_t node = *it;
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+        const htd::Bag & bag = decomposition.bagContent(node);
 
         std::vector<htd::vertex_t> children;
 
@@ -102,7 +102,7 @@ void htd::JoinNodeComplexityReductionOperation::apply(const htd::IMultiHypergrap
 
         for (htd::vertex_t child : children)
         {
-            const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(child);
+            const htd::Bag & childBag = decomposition.bagContent(child);
 
             decomposition.copyRememberedVerticesTo(node, rememberedVertices, child);
 
@@ -110,7 +110,7 @@ void htd::JoinNodeComplexityReductionOperation::apply(const htd::IMultiHypergrap
             {
                 htd::vertex_t newVertex = decomposition.addParent(child);
 
-                decomposition.mutableBagContent(newVertex) = rememberedVertices;
+                decomposition.setBagContent(newVertex, rememberedVertices);
 
                 htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(node);
 
@@ -150,7 +150,7 @@ void htd::JoinNodeComplexityReductionOperation::apply(const htd::IMultiHypergrap
 
         if (decomposition.isJoinNode(vertex))
         {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const htd::Bag & bag = decomposition.bagContent(vertex);
 
             std::vector<htd::vertex_t> children;
 
@@ -158,7 +158,7 @@ void htd::JoinNodeComplexityReductionOperation::apply(const htd::IMultiHypergrap
 
             for (htd::vertex_t child : children)
             {
-                const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(child);
+                const htd::Bag & childBag = decomposition.bagContent(child);
 
                 decomposition.copyRememberedVerticesTo(vertex, rememberedVertices, child);
 
@@ -166,7 +166,7 @@ void htd::JoinNodeComplexityReductionOperation::apply(const htd::IMultiHypergrap
                 {
                     htd::vertex_t newVertex = decomposition.addParent(child);
 
-                    decomposition.mutableBagContent(newVertex) = rememberedVertices;
+                    decomposition.setBagContent(newVertex, rememberedVertices);
 
                     htd::FilteredHyperedgeCollection newInducedHyperedges = decomposition.inducedHyperedges(vertex);
 
@@ -95,7 +95,7 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
 
     for (htd::vertex_t node : joinNodes)
     {
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+        const htd::Bag & bag = decomposition.bagContent(node);
 
         const htd::FilteredHyperedgeCollection & inducedHyperedges = decomposition.inducedHyperedges(node);
 
@@ -112,7 +112,7 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
             {
                 htd::vertex_t newParent = decomposition.addParent(node);
 
-                decomposition.mutableBagContent(newParent) = bag;
+                decomposition.setBagContent(newParent, bag);
 
                 decomposition.mutableInducedHyperedges(newParent) = inducedHyperedges;
 
@@ -120,7 +120,7 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newParent);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(bag, *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bag), *labelCollection);
 
                     delete labelCollection;
 
@@ -144,13 +144,13 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
                 std::cout << std::endl << std::endl;
                 )
 
-                htd::vertex_t intermediateVertex = decomposition.addParent(child, bag, inducedHyperedges);
+                htd::vertex_t intermediateVertex = decomposition.addParent(child, std::vector<htd::vertex_t>(bag.begin(), bag.end()), inducedHyperedges);
 
                 for (auto & labelingFunction : labelingFunctions)
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(intermediateVertex);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(bag, *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bag), *labelCollection);
 
                     delete labelCollection;
 
@@ -170,7 +170,7 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
     {
         if (decomposition.isJoinNode(vertex))
         {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const htd::Bag & bag = decomposition.bagContent(vertex);
 
             const htd::FilteredHyperedgeCollection & inducedHyperedges = decomposition.inducedHyperedges(vertex);
 
@@ -187,7 +187,7 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
                 {
                     htd::vertex_t newParent = decomposition.addParent(vertex);
 
-                    decomposition.mutableBagContent(newParent) = bag;
+                    decomposition.setBagContent(newParent, bag);
 
                     decomposition.mutableInducedHyperedges(newParent) = inducedHyperedges;
 
@@ -195,7 +195,7 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
                     {
                         htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newParent);
 
-                        htd::ILabel * newLabel = labelingFunction->computeLabel(bag, *labelCollection);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bag), *labelCollection);
 
                         delete labelCollection;
 
@@ -221,13 +221,13 @@ void htd::JoinNodeNormalizationOperation::apply(const htd::IMultiHypergraph & gr
                     std::cout << std::endl << std::endl;
                     )
 
-                    htd::vertex_t intermediateVertex = decomposition.addParent(child, bag, inducedHyperedges);
+                    htd::vertex_t intermediateVertex = decomposition.addParent(child, std::vector<htd::vertex_t>(bag.begin(), bag.end()), inducedHyperedges);
 
                     for (auto & labelingFunction : labelingFunctions)
                     {
                         htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(intermediateVertex);
 
-                        htd::ILabel * newLabel = labelingFunction->computeLabel(bag, *labelCollection);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(bag), *labelCollection);
 
                         delete labelCollection;
 
@@ -236,7 +236,7 @@ void htd::JoinNodeReplacementOperation::apply(const htd::IMultiHypergraph & grap
 
                     if (requiredVertices.size() > 0)
                     {
-                        const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(currentNode);
+                        const htd::Bag & bagContent = decomposition.bagContent(currentNode);
 
                         std::vector<htd::vertex_t> newBagContent;
 
@@ -254,7 +254,7 @@ void htd::JoinNodeReplacementOperation::apply(const htd::IMultiHypergraph & grap
                         std::cout << std::endl << std::endl;
                         )
 
-                        decomposition.mutableBagContent(currentNode) = newBagContent;
+                        decomposition.setBagContent(currentNode, newBagContent);
 
                         for (auto & labelingFunction : labelingFunctions)
                         {
@@ -317,7 +317,7 @@ void htd::JoinNodeReplacementOperation::apply(const htd::IMultiHypergraph & grap
 
                     for (htd::vertex_t child : availableChildren)
                     {
-                        const std::vector<htd::vertex_t> & childBagContent = decomposition.bagContent(child);
+                        const htd::Bag & childBagContent = decomposition.bagContent(child);
 
                         DEBUGGING_CODE(
                         std::cout << "   SIBLING: " << child << std::endl;
@@ -437,7 +437,7 @@ void htd::JoinNodeReplacementOperation::Implementation::getChildrenVertexLabelSe
 
     for (htd::vertex_t child : decomposition.children(vertex))
     {
-        const std::vector<htd::vertex_t> & childLabel = decomposition.bagContent(child);
+        const htd::Bag & childLabel = decomposition.bagContent(child);
 
         result.insert(childLabel.begin(), childLabel.end());
     }
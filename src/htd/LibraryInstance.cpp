@@ -56,7 +56,38 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/GraphSeparatorAlgorithmFactory.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <csignal>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Random number generator bound to a thread for a specific management instance.
+     */
+    struct ThreadLocalRandomNumberGenerator
+    {
+        /**
+         *  The management instance for which the generator was bound.
+         */
+        const htd::LibraryInstance * managementInstance;
+
+        /**
+         *  The random number generator.
+         */
+        htd::RandomNumberGenerator * generator;
+    };
+
+    /**
+     *  The random number generators bound in the current thread, the most recent binding last.
+     *
+     *  Bindings are rare and short-lived, hence a linear search from the end of the vector is sufficient.
+     */
+    thread_local std::vector<ThreadLocalRandomNumberGenerator> threadLocalRandomNumberGenerators;
+}
 
 /**
  *  Private implementation details of class htd::LibraryInstance.
@@ -68,7 +99,7 @@ struct htd::LibraryInstance::Implementation
      *
      *  @param[in] id   The identifier of the management instance.
      */
-    Implementation(htd::id_t id) : id_(id), nextHandlerId_(htd::Id::FIRST), terminated_(false)
+    Implementation(htd::id_t id) : id_(id), nextHandlerId_(htd::Id::FIRST), terminated_(false), threadCount_(1), randomNumberGenerator_()
     {
 
     }
@@ -131,7 +162,17 @@ struct htd::LibraryInstance::Implementation
     /**
      *  A boolean flag indicating whether the current management instance was terminated.
      */
-    bool terminated_;
+    std::atomic<bool> terminated_;
+
+    /**
+     *  The maximum number of threads which may be used by the algorithms of the library.
+     */
+    std::size_t threadCount_;
+
+    /**
+     *  The random number generator owned by the management instance.
+     */
+    htd::RandomNumberGenerator randomNumberGenerator_;
 
     /**
      *  The factory class for the default implementation of the htd::IConnectedComponentAlgorithm interface.
@@ -309,6 +350,36 @@ void htd::LibraryInstance::reset(void)
     implementation_->terminated_ = false;
 }
 
+std::size_t htd::LibraryInstance::threadCount(void) const
+{
+    return implementation_->threadCount_;
+}
+
+void htd::LibraryInstance::setThreadCount(std::size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(static_cast<std::size_t>(std::thread::hardware_concurrency()), static_cast<std::size_t>(1));
+    }
+
+    implementation_->threadCount_ = threadCount;
+}
+
+htd::RandomNumberGenerator & htd::LibraryInstance::randomNumberGenerator(void) const
+{
+    const std::vector<ThreadLocalRandomNumberGenerator> & bindings = threadLocalRandomNumberGenerators;
+
+    for (auto it = bindings.rbegin(); it != bindings.rend(); ++it)
+    {
+        if (it->managementInstance == this)
+        {
+            return *(it->generator);
+        }
+    }
+
+    return implementation_->randomNumberGenerator_;
+}
+
 htd::ConnectedComponentAlgorithmFactory & htd::LibraryInstance::connectedComponentAlgorithmFactory(void)
 {
     return *(implementation_->connectedComponentAlgorithmFactory_);
@@ -589,4 +660,25 @@ const htd::GraphSeparatorAlgorithmFactory & htd::LibraryInstance::graphSeparator
     return *(implementation_->graphSeparatorAlgorithmFactory_);
 }
 
+htd::RandomNumberGeneratorBinding::RandomNumberGeneratorBinding(const htd::LibraryInstance & managementInstance, htd::RandomNumberGenerator & generator) : managementInstance_(managementInstance), generator_(generator)
+{
+    threadLocalRandomNumberGenerators.push_back({ &managementInstance, &generator });
+}
+
+htd::RandomNumberGeneratorBinding::~RandomNumberGeneratorBinding()
+{
+    std::vector<ThreadLocalRandomNumberGenerator> & bindings = threadLocalRandomNumberGenerators;
+
+    /* Bindings are usually undone in reverse order, hence the binding to remove is found at the end of the vector. */
+    for (auto it = bindings.rbegin(); it != bindings.rend(); ++it)
+    {
+        if (it->managementInstance == &managementInstance_ && it->generator == &generator_)
+        {
+            bindings.erase(std::next(it).base());
+
+            break;
+        }
+    }
+}
+
 #endif /* HTD_HTD_LIBRARYINSTANCE_CPP */
@@ -103,7 +103,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
 
         if (childCount > implementation_->limit_)
         {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+            const htd::Bag & bag = decomposition.bagContent(node);
 
             const htd::FilteredHyperedgeCollection & inducedHyperedges = decomposition.inducedHyperedges(node);
 
@@ -119,7 +119,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
             {
                 htd::vertex_t newNode = decomposition.addChild(attachmentPoint);
 
-                decomposition.mutableBagContent(newNode) = bag;
+                decomposition.setBagContent(newNode, bag);
 
                 decomposition.mutableInducedHyperedges(newNode) = inducedHyperedges;
 
@@ -127,7 +127,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newNode);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(newNode), *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(newNode)), *labelCollection);
 
                     delete labelCollection;
 
@@ -148,7 +148,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
             {
                 htd::vertex_t newNode = decomposition.addChild(attachmentPoint);
 
-                decomposition.mutableBagContent(newNode) = bag;
+                decomposition.setBagContent(newNode, bag);
 
                 decomposition.mutableInducedHyperedges(newNode) = inducedHyperedges;
 
@@ -156,7 +156,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newNode);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(newNode), *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(newNode)), *labelCollection);
 
                     delete labelCollection;
 
@@ -189,7 +189,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
 
         if (childCount > implementation_->limit_)
         {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const htd::Bag & bag = decomposition.bagContent(vertex);
 
             const htd::FilteredHyperedgeCollection & inducedHyperedges = decomposition.inducedHyperedges(vertex);
 
@@ -205,7 +205,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
             {
                 htd::vertex_t newNode = decomposition.addChild(attachmentPoint);
 
-                decomposition.mutableBagContent(newNode) = bag;
+                decomposition.setBagContent(newNode, bag);
 
                 decomposition.mutableInducedHyperedges(newNode) = inducedHyperedges;
 
@@ -213,7 +213,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newNode);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(newNode), *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(newNode)), *labelCollection);
 
                     delete labelCollection;
 
@@ -236,7 +236,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
             {
                 htd::vertex_t newNode = decomposition.addChild(attachmentPoint);
 
-                decomposition.mutableBagContent(newNode) = bag;
+                decomposition.setBagContent(newNode, bag);
 
                 decomposition.mutableInducedHyperedges(newNode) = inducedHyperedges;
 
@@ -244,7 +244,7 @@ void htd::LimitChildCountOperation::apply(const htd::IMultiHypergraph & graph, h
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(newNode);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(newNode), *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(newNode)), *labelCollection);
 
                     delete labelCollection;
 
@@ -99,7 +99,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
 
         std::vector<htd::vertex_t> bagContent;
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+        const htd::Bag & bag = decomposition.bagContent(node);
 
         std::copy(std::begin(bag), std::end(bag), std::back_inserter(bagContent));
 
@@ -121,7 +121,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
             {
                 std::vector<htd::vertex_t> newBagContent;
 
-                const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(attachmentPoint);
+                const htd::Bag & childBag = decomposition.bagContent(attachmentPoint);
 
                 std::set_difference(childBag.begin(), childBag.end(), forgottenVertices.begin(), forgottenVertices.begin() + index, std::back_inserter(newBagContent));
 
@@ -135,7 +135,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                     delete labelCollection;
 
@@ -168,7 +168,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
         {
             std::vector<htd::vertex_t> bagContent;
 
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const htd::Bag & bag = decomposition.bagContent(vertex);
 
             std::copy(std::begin(bag), std::end(bag), std::back_inserter(bagContent));
 
@@ -188,7 +188,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
                 {
                     std::vector<htd::vertex_t> newBagContent;
 
-                    const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(attachmentPoint);
+                    const htd::Bag & childBag = decomposition.bagContent(attachmentPoint);
 
                     std::set_difference(childBag.begin(), childBag.end(), forgottenVertices.begin(), forgottenVertices.begin() + index, std::back_inserter(newBagContent));
 
@@ -204,7 +204,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
                     {
                         htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                        htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                         delete labelCollection;
 
@@ -249,7 +249,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
 
         std::vector<htd::vertex_t> bagContent;
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+        const htd::Bag & bag = decomposition.bagContent(node);
 
         std::copy(std::begin(bag), std::end(bag), std::back_inserter(bagContent));
 
@@ -271,7 +271,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
             {
                 std::vector<htd::vertex_t> newBagContent;
 
-                const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(attachmentPoint);
+                const htd::Bag & childBag = decomposition.bagContent(attachmentPoint);
 
                 std::set_difference(childBag.begin(), childBag.end(), forgottenVertices.begin(), forgottenVertices.begin() + index, std::back_inserter(newBagContent));
 
@@ -285,7 +285,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                     delete labelCollection;
 
@@ -318,7 +318,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
         {
             std::vector<htd::vertex_t> bagContent;
 
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const htd::Bag & bag = decomposition.bagContent(vertex);
 
             std::copy(std::begin(bag), std::end(bag), std::back_inserter(bagContent));
 
@@ -340,7 +340,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
                 {
                     std::vector<htd::vertex_t> newBagContent;
 
-                    const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(attachmentPoint);
+                    const htd::Bag & childBag = decomposition.bagContent(attachmentPoint);
 
                     std::set_difference(childBag.begin(), childBag.end(), forgottenVertices.begin(), forgottenVertices.begin() + index, std::back_inserter(newBagContent));
 
@@ -356,7 +356,7 @@ void htd::LimitMaximumForgottenVertexCountOperation::apply(const htd::IMultiHype
                     {
                         htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                        htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                         delete labelCollection;
 
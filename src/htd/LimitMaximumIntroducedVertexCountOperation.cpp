@@ -109,7 +109,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
         {
             std::vector<htd::vertex_t> bagContent;
 
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+            const htd::Bag & bag = decomposition.bagContent(node);
 
             std::copy(std::begin(bag), std::end(bag), std::back_inserter(bagContent));
 
@@ -141,7 +141,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                 {
                     htd::vertex_t child = decomposition.childAtPosition(node, 0);
 
-                    const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(child);
+                    const htd::Bag & childBag = decomposition.bagContent(child);
 
                     std::vector<htd::vertex_t> newBagContent;
 
@@ -158,7 +158,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                     delete labelCollection;
 
@@ -171,7 +171,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                 {
                     std::vector<htd::vertex_t> newBagContent;
 
-                    const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(attachmentPoint);
+                    const htd::Bag & childBag = decomposition.bagContent(attachmentPoint);
 
                     std::set_union(childBag.begin(), childBag.end(), introducedVertices.begin(), introducedVertices.begin() + index, std::back_inserter(newBagContent));
 
@@ -185,7 +185,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                     {
                         htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                        htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                         delete labelCollection;
 
@@ -226,7 +226,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
             {
                 std::vector<htd::vertex_t> bagContent;
 
-                const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+                const htd::Bag & bag = decomposition.bagContent(node);
 
                 std::copy(std::begin(bag), std::end(bag), std::back_inserter(bagContent));
 
@@ -258,7 +258,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                     {
                         htd::vertex_t child = decomposition.childAtPosition(node, 0);
 
-                        const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(child);
+                        const htd::Bag & childBag = decomposition.bagContent(child);
 
                         std::vector<htd::vertex_t> newBagContent;
 
@@ -277,7 +277,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                     {
                         htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                        htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                         delete labelCollection;
 
@@ -290,7 +290,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                     {
                         std::vector<htd::vertex_t> newBagContent;
 
-                        const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(attachmentPoint);
+                        const htd::Bag & childBag = decomposition.bagContent(attachmentPoint);
 
                         std::set_union(childBag.begin(), childBag.end(), introducedVertices.begin(), introducedVertices.begin() + index, std::back_inserter(newBagContent));
 
@@ -306,7 +306,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                         {
                             htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                             delete labelCollection;
 
@@ -354,7 +354,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
         {
             std::vector<htd::vertex_t> bagContent;
 
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+            const htd::Bag & bag = decomposition.bagContent(node);
 
             std::copy(std::begin(bag), std::end(bag), std::back_inserter(bagContent));
 
@@ -386,7 +386,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                 {
                     htd::vertex_t child = decomposition.childAtPosition(node, 0);
 
-                    const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(child);
+                    const htd::Bag & childBag = decomposition.bagContent(child);
 
                     std::vector<htd::vertex_t> newBagContent;
 
@@ -403,7 +403,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                 {
                     htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                    htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                    htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                     delete labelCollection;
 
@@ -416,7 +416,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                 {
                     std::vector<htd::vertex_t> newBagContent;
 
-                    const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(attachmentPoint);
+                    const htd::Bag & childBag = decomposition.bagContent(attachmentPoint);
 
                     std::set_union(childBag.begin(), childBag.end(), introducedVertices.begin(), introducedVertices.begin() + index, std::back_inserter(newBagContent));
 
@@ -430,7 +430,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                     {
                         htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                        htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                         delete labelCollection;
 
@@ -470,7 +470,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
             {
                 std::vector<htd::vertex_t> bagContent;
 
-                const std::vector<htd::vertex_t> & bag = decomposition.bagContent(node);
+                const htd::Bag & bag = decomposition.bagContent(node);
 
                 std::copy(std::begin(bag), std::end(bag), std::back_inserter(bagContent));
 
@@ -502,7 +502,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                     {
                         htd::vertex_t child = decomposition.childAtPosition(node, 0);
 
-                        const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(child);
+                        const htd::Bag & childBag = decomposition.bagContent(child);
 
                         std::vector<htd::vertex_t> newBagContent;
 
@@ -521,7 +521,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                     {
                         htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                        htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                         delete labelCollection;
 
@@ -534,7 +534,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                     {
                         std::vector<htd::vertex_t> newBagContent;
 
-                        const std::vector<htd::vertex_t> & childBag = decomposition.bagContent(attachmentPoint);
+                        const htd::Bag & childBag = decomposition.bagContent(attachmentPoint);
 
                         std::set_union(childBag.begin(), childBag.end(), introducedVertices.begin(), introducedVertices.begin() + index, std::back_inserter(newBagContent));
 
@@ -550,7 +550,7 @@ void htd::LimitMaximumIntroducedVertexCountOperation::apply(const htd::IMultiHyp
                         {
                             htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(attachmentPoint);
 
-                            htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(attachmentPoint), *labelCollection);
+                            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(attachmentPoint)), *labelCollection);
 
                             delete labelCollection;
 
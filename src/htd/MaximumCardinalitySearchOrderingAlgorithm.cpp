@@ -31,10 +31,43 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
 
 #include <algorithm>
-#include <unordered_set>
+#include <vector>
+
+namespace
+{
+    /**
+     *  Buffers used by the maximum-cardinality search which are kept alive between subsequent invocations.
+     */
+    struct ScratchBuffers
+    {
+        /**
+         *  The vertices which are not yet part of the ordering, sorted by ascending weight.
+         */
+        std::vector<htd::vertex_t> vertices;
+
+        /**
+         *  The positions of the vertices within the vector of remaining vertices.
+         */
+        std::vector<std::size_t> positions;
+
+        /**
+         *  The number of neighbors of each vertex which are already part of the ordering.
+         */
+        std::vector<std::size_t> weights;
+
+        /**
+         *  The first position of each weight bucket within the vector of remaining vertices.
+         */
+        std::vector<std::size_t> bucketStart;
+    };
+
+    /**
+     *  The scratch buffers of the current thread.
+     */
+    thread_local ScratchBuffers threadLocalScratchBuffers;
+}
 
 /**
  *  Private implementation details of class htd::MaximumCardinalitySearchOrderingAlgorithm.
@@ -92,15 +125,28 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
 
     std::size_t size = preprocessedGraph.remainingVertices().size();
 
-    std::unordered_set<htd::vertex_t> vertices(size);
+    std::size_t vertexCount = preprocessedGraph.inputGraphVertexCount();
+
+    ScratchBuffers & scratchBuffers = threadLocalScratchBuffers;
+
+    std::vector<htd::vertex_t> & vertices = scratchBuffers.vertices;
+    std::vector<std::size_t> & positions = scratchBuffers.positions;
+    std::vector<std::size_t> & weights = scratchBuffers.weights;
+    std::vector<std::size_t> & bucketStart = scratchBuffers.bucketStart;
+
+    vertices.assign(preprocessedGraph.remainingVertices().begin(), preprocessedGraph.remainingVertices().end());
 
-    htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
+    /* Vertices which are not (or no longer) contained in the range [0, size) of 'vertices' are located at positions greater or equal to 'size'. */
+    positions.assign(vertexCount, vertexCount);
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    weights.assign(vertexCount, 0);
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> priorityQueue;
+    bucketStart.assign(size + 1, 0);
 
-    std::vector<std::size_t> weights(preprocessedGraph.inputGraphVertexCount());
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        positions[vertices[index]] = index;
+    }
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
@@ -111,39 +157,61 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
                     preprocessedGraph.eliminationSequence().begin(),
                     preprocessedGraph.eliminationSequence().end());
 
-    for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
-    {
-        priorityQueue.push(vertex, 0);
-    }
+    htd::RandomNumberGenerator & randomNumberGenerator = managementInstance.randomNumberGenerator();
+
+    /* The vertices are sorted by ascending weight, the vertices with weight i are located in the range [bucketStart[i], bucketStart[i + 1]) and the vertices with maximum weight fill the range [bucketStart[maximumWeight], size). */
+    std::size_t maximumWeight = 0;
 
     while (size > 0 && !managementInstance.isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        std::size_t selectedPosition = bucketStart[maximumWeight] + randomNumberGenerator.nextIndex(size - bucketStart[maximumWeight]);
+
+        htd::vertex_t selectedVertex = vertices[selectedPosition];
+
+        --size;
 
-        priorityQueue.eraseFromTopCollection(selectedVertex);
+        htd::vertex_t lastVertex = vertices[size];
 
-        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedVertex];
+        vertices[selectedPosition] = lastVertex;
+        positions[lastVertex] = selectedPosition;
 
-        for (htd::vertex_t neighbor : selectedNeighborhood)
+        vertices[size] = selectedVertex;
+        positions[selectedVertex] = size;
+
+        for (htd::vertex_t neighbor : preprocessedGraph.neighborhood(selectedVertex))
         {
-            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[neighbor];
+            std::size_t position = positions[neighbor];
 
-            /* Because 'vertex' is a neighbor of 'selectedVertex', std::lower_bound will always find 'selectedVertex' in 'currentNeighborhood'. */
-            // coverity[use_iterator]
-            currentNeighborhood.erase(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), selectedVertex));
+            if (position < size)
+            {
+                std::size_t & currentWeight = weights[neighbor];
 
-            std::size_t & currentWeight = weights[neighbor];
+                if (currentWeight == maximumWeight)
+                {
+                    ++maximumWeight;
 
-            priorityQueue.updatePriority(neighbor, currentWeight, currentWeight + 1);
+                    bucketStart[maximumWeight] = size;
+                }
 
-            ++currentWeight;
-        }
+                /* Move the neighbor to the end of its bucket and shift the start of the next bucket in front of it. */
+                std::size_t targetPosition = --bucketStart[currentWeight + 1];
 
-        std::vector<htd::vertex_t>().swap(selectedNeighborhood);
+                htd::vertex_t displacedVertex = vertices[targetPosition];
 
-        vertices.erase(selectedVertex);
+                vertices[position] = displacedVertex;
+                positions[displacedVertex] = position;
 
-        --size;
+                vertices[targetPosition] = neighbor;
+                positions[neighbor] = targetPosition;
+
+                ++currentWeight;
+            }
+        }
+
+        while (maximumWeight > 0 && bucketStart[maximumWeight] == size)
+        {
+            --maximumWeight;
+        }
 
         ordering.push_back(preprocessedGraph.vertexName(selectedVertex));
     }
@@ -153,6 +221,11 @@ htd::IVertexOrdering * htd::MaximumCardinalitySearchOrderingAlgorithm::computeOr
     return new htd::VertexOrdering(std::move(ordering), 1);
 }
 
+bool htd::MaximumCardinalitySearchOrderingAlgorithm::supportsComponentOrdering(void) const HTD_NOEXCEPT
+{
+    return true;
+}
+
 const htd::LibraryInstance * htd::MaximumCardinalitySearchOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -31,7 +31,7 @@
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/PriorityQueue.hpp>
+#include <htd/BucketPriorityQueue.hpp>
 
 #include <algorithm>
 #include <unordered_set>
@@ -148,11 +148,36 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     htd::fillSet(preprocessedGraph.remainingVertices(), vertices);
 
-    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().begin(), preprocessedGraph.neighborhood().end());
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood(preprocessedGraph.neighborhood().size());
+
+    /* The closed neighborhoods of the vertices are independent of each other, hence they can be built concurrently. */
+    htd::parallelFor(remainingVertices.size(), managementInstance_->threadCount(), [&](std::size_t first, std::size_t last)
+    {
+        for (std::size_t index = first; index < last; ++index)
+        {
+            htd::vertex_t vertex = remainingVertices[index];
+
+            const std::vector<htd::vertex_t> & originalNeighborhood = preprocessedGraph.neighborhood(vertex);
+
+            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+            currentNeighborhood.reserve(originalNeighborhood.size() + 1);
+
+            auto position = std::lower_bound(originalNeighborhood.begin(), originalNeighborhood.end(), vertex);
+
+            currentNeighborhood.insert(currentNeighborhood.end(), originalNeighborhood.begin(), position);
+
+            currentNeighborhood.push_back(vertex);
+
+            currentNeighborhood.insert(currentNeighborhood.end(), position, originalNeighborhood.end());
+        }
+    });
 
     std::vector<htd::vertex_t> difference;
 
-    htd::PriorityQueue<htd::vertex_t, std::size_t, std::greater<std::size_t>> priorityQueue;
+    htd::BucketPriorityQueue<htd::vertex_t, std::greater<std::size_t>> priorityQueue;
 
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
@@ -162,16 +187,14 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
 
     for (htd::vertex_t vertex : vertices)
     {
-        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
-
-        currentNeighborhood.insert(std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex), vertex);
-
-        priorityQueue.push(vertex, currentNeighborhood.size());
+        priorityQueue.push(vertex, neighborhood[vertex].size());
     }
 
+    htd::RandomNumberGenerator & randomNumberGenerator = managementInstance_->randomNumberGenerator();
+
     while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), randomNumberGenerator);
 
         priorityQueue.eraseFromTopCollection(selectedVertex);
 
@@ -220,6 +243,11 @@ std::size_t htd::MinDegreeOrderingAlgorithm::Implementation::writeOrderingTo(con
     return ret;
 }
 
+bool htd::MinDegreeOrderingAlgorithm::supportsComponentOrdering(void) const HTD_NOEXCEPT
+{
+    return true;
+}
+
 const htd::LibraryInstance * htd::MinDegreeOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -34,6 +34,7 @@
 #include <htd/PriorityQueue.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <unordered_set>
 
 /**
@@ -78,7 +79,7 @@ struct htd::MinFillOrderingAlgorithm::Implementation
          *
          *  @return The number of edges between the provided vertices.
          */
-        std::size_t computeEdgeCount(const std::vector<std::vector<htd::vertex_t>> & availableNeighborhoods, const std::vector<htd::vertex_t> & vertices)
+        std::size_t computeEdgeCount(const std::vector<std::vector<htd::vertex_t>> & availableNeighborhoods, const std::vector<htd::vertex_t> & vertices) const
         {
             std::size_t ret = 0;
 
@@ -106,21 +107,28 @@ struct htd::MinFillOrderingAlgorithm::Implementation
          */
         PreparedInput(const htd::LibraryInstance & managementInstance, const htd::IPreprocessedGraph & preprocessedGraph) : minFill((std::size_t)-1), totalFill(0), fillValue()
         {
-            HTD_UNUSED(managementInstance)
-
             std::size_t size = preprocessedGraph.inputGraphVertexCount();
 
             fillValue.resize(size, 0);
 
-            for (htd::vertex_t vertex : preprocessedGraph.remainingVertices())
+            const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+            /* The fill values of the vertices are independent of each other, hence they can be computed concurrently. */
+            htd::parallelFor(remainingVertices.size(), managementInstance.threadCount(), [&](std::size_t first, std::size_t last)
             {
-                const std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
+                for (std::size_t index = first; index < last; ++index)
+                {
+                    htd::vertex_t vertex = remainingVertices[index];
 
-                std::size_t currentFillValue = ((currentNeighborhood.size() * (currentNeighborhood.size() - 1)) / 2) - computeEdgeCount(preprocessedGraph.neighborhood(), currentNeighborhood);
+                    const std::vector<htd::vertex_t> & currentNeighborhood = preprocessedGraph.neighborhood(vertex);
 
-                fillValue[vertex] = currentFillValue;
+                    fillValue[vertex] = ((currentNeighborhood.size() * (currentNeighborhood.size() - 1)) / 2) - computeEdgeCount(preprocessedGraph.neighborhood(), currentNeighborhood);
+                }
+            });
 
-                totalFill += currentFillValue;
+            for (htd::vertex_t vertex : remainingVertices)
+            {
+                totalFill += fillValue[vertex];
             }
         }
 
@@ -145,6 +153,123 @@ struct htd::MinFillOrderingAlgorithm::Implementation
         std::vector<std::size_t> fillValue;
     };
 
+    /**
+     *  Bitset representation of the missing edges within the neighborhood of an eliminated vertex.
+     *
+     *  Each neighbor of the eliminated vertex is assigned a position within the neighborhood. For each neighbor, the
+     *  neighbors it is not adjacent to are stored as a bitset over these positions, so that the number of missing
+     *  edges within an arbitrary subset of the neighborhood can be counted via word-parallel AND and popcount.
+     */
+    struct DenseNeighborhood
+    {
+        /**
+         *  The minimum size of a neighborhood for which the bitset representation is used.
+         */
+        static const std::size_t MINIMUM_SIZE = 64;
+
+        /**
+         *  The maximum size of a neighborhood for which the bitset representation is used.
+         *
+         *  The memory consumption of the representation is quadratic in the size of the neighborhood.
+         */
+        static const std::size_t MAXIMUM_SIZE = 16384;
+
+        /**
+         *  Constructor for the DenseNeighborhood data structure.
+         *
+         *  @param[in] vertexCount  The number of vertices of the input graph.
+         */
+        DenseNeighborhood(std::size_t vertexCount) : wordCount(0), positions(vertexCount, 0), missingEdges(), selection()
+        {
+
+        }
+
+        /**
+         *  Initialize the bitsets for the given neighborhood.
+         *
+         *  @param[in] neighborhood         The neighborhood of the eliminated vertex, sorted in ascending order.
+         *  @param[in] additionalNeighbors  The vertices of the neighborhood a vertex of the neighborhood is not adjacent to.
+         */
+        void initialize(const std::vector<htd::vertex_t> & neighborhood, const std::vector<std::vector<htd::vertex_t>> & additionalNeighbors)
+        {
+            wordCount = (neighborhood.size() + 63) / 64;
+
+            for (htd::index_t index = 0; index < neighborhood.size(); ++index)
+            {
+                positions[neighborhood[index]] = index;
+            }
+
+            missingEdges.assign(neighborhood.size() * wordCount, 0);
+
+            selection.resize(wordCount);
+
+            for (htd::index_t index = 0; index < neighborhood.size(); ++index)
+            {
+                std::uint64_t * row = missingEdges.data() + index * wordCount;
+
+                for (htd::vertex_t vertex : additionalNeighbors[neighborhood[index]])
+                {
+                    htd::index_t position = positions[vertex];
+
+                    row[position >> 6] |= static_cast<std::uint64_t>(1) << (position & 63);
+                }
+            }
+        }
+
+        /**
+         *  Count the missing edges between the given vertices.
+         *
+         *  @param[in] vertices The vertices. All of them must be part of the neighborhood the data structure was initialized with.
+         *
+         *  @return The number of missing edges between the given vertices.
+         */
+        std::size_t missingEdgeCount(const std::vector<htd::vertex_t> & vertices)
+        {
+            std::size_t ret = 0;
+
+            std::fill(selection.begin(), selection.end(), 0);
+
+            for (htd::vertex_t vertex : vertices)
+            {
+                htd::index_t position = positions[vertex];
+
+                selection[position >> 6] |= static_cast<std::uint64_t>(1) << (position & 63);
+            }
+
+            for (htd::vertex_t vertex : vertices)
+            {
+                const std::uint64_t * row = missingEdges.data() + positions[vertex] * wordCount;
+
+                for (htd::index_t index = 0; index < wordCount; ++index)
+                {
+                    ret += htd::popcount(selection[index] & row[index]);
+                }
+            }
+
+            return ret / 2;
+        }
+
+        /**
+         *  The number of words of each bitset.
+         */
+        std::size_t wordCount;
+
+        /**
+         *  The position of each vertex of the current neighborhood within the bitsets.
+         */
+        std::vector<htd::index_t> positions;
+
+        /**
+         *  The bitsets of the missing edges, stored consecutively for the vertices of the current neighborhood.
+         */
+        std::vector<std::uint64_t> missingEdges;
+
+        /**
+         *  Temporary bitset of the vertices for which the missing edges are counted.
+         */
+        std::vector<std::uint64_t> selection;
+    };
+
     /**
      *  Compute the vertex ordering of a given graph and write it to the end of a given vector.
      *
@@ -252,6 +377,8 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
     std::vector<htd::vertex_t> affectedVertices;
     affectedVertices.reserve(size);
 
+    DenseNeighborhood denseNeighborhood(size);
+
     target.insert(target.end(),
                   preprocessedGraph.eliminationSequence().begin(),
                   preprocessedGraph.eliminationSequence().end());
@@ -269,9 +396,11 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
         priorityQueue.push(vertex, fillValue[vertex]);
     }
 
+    htd::RandomNumberGenerator & randomNumberGenerator = managementInstance_->randomNumberGenerator();
+
     while (totalFill > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
     {
-        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection());
+        htd::vertex_t selectedVertex = htd::selectRandomElement<htd::vertex_t>(priorityQueue.topCollection(), randomNumberGenerator);
 
         priorityQueue.eraseFromTopCollection(selectedVertex);
 
@@ -376,6 +505,13 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                 }
             }
 
+            bool dense = selectedNeighborhood.size() >= DenseNeighborhood::MINIMUM_SIZE && selectedNeighborhood.size() <= DenseNeighborhood::MAXIMUM_SIZE;
+
+            if (dense)
+            {
+                denseNeighborhood.initialize(selectedNeighborhood, additionalNeighbors);
+            }
+
             for (htd::vertex_t vertex : selectedNeighborhood)
             {
                 std::vector<htd::vertex_t> & currentExistingNeighborhood = existingNeighbors[vertex];
@@ -415,35 +551,42 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
                         }
                     }
 
-                    auto neighborhoodEnd = currentExistingNeighborhood.end();
-
-                    for (auto it = currentExistingNeighborhood.begin(); it != neighborhoodEnd && tmp + fillUpdate > 0;)
+                    if (dense)
                     {
-                        const std::vector<htd::vertex_t> & currentAdditionalNeighborhood2 = additionalNeighbors[*it];
-
-                        ++it;
+                        fillUpdate -= static_cast<long>(denseNeighborhood.missingEdgeCount(currentExistingNeighborhood));
+                    }
+                    else
+                    {
+                        auto neighborhoodEnd = currentExistingNeighborhood.end();
 
-                        if (!currentAdditionalNeighborhood2.empty() && it != neighborhoodEnd)
+                        for (auto it = currentExistingNeighborhood.begin(); it != neighborhoodEnd && tmp + fillUpdate > 0;)
                         {
-                            if (currentAdditionalNeighborhood2.size() == 1)
+                            const std::vector<htd::vertex_t> & currentAdditionalNeighborhood2 = additionalNeighbors[*it];
+
+                            ++it;
+
+                            if (!currentAdditionalNeighborhood2.empty() && it != neighborhoodEnd)
                             {
-                                if (std::binary_search(it, neighborhoodEnd, currentAdditionalNeighborhood2[0]))
+                                if (currentAdditionalNeighborhood2.size() == 1)
                                 {
-                                    --fillUpdate;
+                                    if (std::binary_search(it, neighborhoodEnd, currentAdditionalNeighborhood2[0]))
+                                    {
+                                        --fillUpdate;
+                                    }
+                                }
+                                else
+                                {
+                                    std::size_t fillReduction = htd::set_intersection_size(std::lower_bound(it,
+                                                                                                            neighborhoodEnd,
+                                                                                                            currentAdditionalNeighborhood2[0]),
+                                                                                           neighborhoodEnd,
+                                                                                           std::lower_bound(currentAdditionalNeighborhood2.begin(),
+                                                                                                            currentAdditionalNeighborhood2.end(),
+                                                                                                            *it),
+                                                                                           currentAdditionalNeighborhood2.end());
+
+                                    fillUpdate -= static_cast<long>(fillReduction);
                                 }
-                            }
-                            else
-                            {
-                                std::size_t fillReduction = htd::set_intersection_size(std::lower_bound(it,
-                                                                                                        neighborhoodEnd,
-                                                                                                        currentAdditionalNeighborhood2[0]),
-                                                                                       neighborhoodEnd,
-                                                                                       std::lower_bound(currentAdditionalNeighborhood2.begin(),
-                                                                                                        currentAdditionalNeighborhood2.end(),
-                                                                                                        *it),
-                                                                                       currentAdditionalNeighborhood2.end());
-
-                                fillUpdate -= static_cast<long>(fillReduction);
                             }
                         }
                     }
@@ -481,33 +624,40 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
                     std::size_t fillReduction = 0;
 
-                    auto neighborhoodEnd = relevantNeighborhood.end();
-
-                    for (auto it = relevantNeighborhood.begin(); it != neighborhoodEnd - 1 && tmp - fillReduction > 0;)
+                    if (dense)
                     {
-                        const std::vector<htd::vertex_t> & currentAdditionalNeighborhood2 = additionalNeighbors[*it];
-
-                        ++it;
+                        fillReduction = denseNeighborhood.missingEdgeCount(relevantNeighborhood);
+                    }
+                    else
+                    {
+                        auto neighborhoodEnd = relevantNeighborhood.end();
 
-                        if (!currentAdditionalNeighborhood2.empty())
+                        for (auto it = relevantNeighborhood.begin(); it != neighborhoodEnd - 1 && tmp - fillReduction > 0;)
                         {
-                            if (currentAdditionalNeighborhood2.size() == 1)
+                            const std::vector<htd::vertex_t> & currentAdditionalNeighborhood2 = additionalNeighbors[*it];
+
+                            ++it;
+
+                            if (!currentAdditionalNeighborhood2.empty())
                             {
-                                if (std::binary_search(it, neighborhoodEnd, currentAdditionalNeighborhood2[0]))
+                                if (currentAdditionalNeighborhood2.size() == 1)
                                 {
-                                    ++fillReduction;
+                                    if (std::binary_search(it, neighborhoodEnd, currentAdditionalNeighborhood2[0]))
+                                    {
+                                        ++fillReduction;
+                                    }
+                                }
+                                else
+                                {
+                                    fillReduction += htd::set_intersection_size(std::lower_bound(it,
+                                                                                                 neighborhoodEnd,
+                                                                                                 currentAdditionalNeighborhood2[0]),
+                                                                                neighborhoodEnd,
+                                                                                std::lower_bound(currentAdditionalNeighborhood2.begin(),
+                                                                                                 currentAdditionalNeighborhood2.end(),
+                                                                                                 *it),
+                                                                                currentAdditionalNeighborhood2.end());
                                 }
-                            }
-                            else
-                            {
-                                fillReduction += htd::set_intersection_size(std::lower_bound(it,
-                                                                                             neighborhoodEnd,
-                                                                                             currentAdditionalNeighborhood2[0]),
-                                                                            neighborhoodEnd,
-                                                                            std::lower_bound(currentAdditionalNeighborhood2.begin(),
-                                                                                             currentAdditionalNeighborhood2.end(),
-                                                                                             *it),
-                                                                            currentAdditionalNeighborhood2.end());
                             }
                         }
                     }
@@ -641,7 +791,7 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
 
     while (size > 0 && ret <= maxBagSize && !managementInstance_->isTerminated())
     {
-        htd::vertex_t vertex = htd::selectRandomElement<htd::vertex_t>(vertices);
+        htd::vertex_t vertex = htd::selectRandomElement<htd::vertex_t>(vertices, randomNumberGenerator);
 
         std::size_t neighborhoodSize = neighborhood[vertex].size();
 
@@ -662,6 +812,11 @@ std::size_t htd::MinFillOrderingAlgorithm::Implementation::writeOrderingTo(const
     return ret;
 }
 
+bool htd::MinFillOrderingAlgorithm::supportsComponentOrdering(void) const HTD_NOEXCEPT
+{
+    return true;
+}
+
 const htd::LibraryInstance * htd::MinFillOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
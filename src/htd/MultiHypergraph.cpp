@@ -28,17 +28,23 @@
 #include <htd/Globals.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/MultiHypergraph.hpp>
+#include <htd/ConstIndexedIteratorWrapper.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/HyperedgeDeque.hpp>
+#include <htd/VectorAdapterConstIteratorWrapper.hpp>
 
 #include <htd/Algorithm.hpp>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <deque>
 #include <iterator>
+#include <limits>
+#include <memory>
 #include <stack>
-#include <unordered_set>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 /**
@@ -60,7 +66,14 @@ struct htd::MultiHypergraph::Implementation
           selfLoops_(),
           deletions_(),
           edges_(std::make_shared<std::deque<htd::Hyperedge>>()),
-          neighborhood_()
+          removedEdges_(),
+          removedEdgeCount_(0),
+          remainingEdgeCounts_(),
+          neighborhood_(),
+          edgePositions_(),
+          edgeIndex_(),
+          incidentEdges_(),
+          owners_(1)
     {
 
     }
@@ -84,7 +97,14 @@ struct htd::MultiHypergraph::Implementation
           selfLoops_(original.selfLoops_),
           deletions_(original.deletions_),
           edges_(std::make_shared<std::deque<htd::Hyperedge>>(*(original.edges_))),
-          neighborhood_(original.neighborhood_)
+          removedEdges_(original.removedEdges_),
+          removedEdgeCount_(original.removedEdgeCount_),
+          remainingEdgeCounts_(original.remainingEdgeCounts_),
+          neighborhood_(original.neighborhood_),
+          edgePositions_(original.edgePositions_),
+          edgeIndex_(original.edgeIndex_),
+          incidentEdges_(original.incidentEdges_),
+          owners_(1)
     {
 
     }
@@ -108,7 +128,672 @@ struct htd::MultiHypergraph::Implementation
 
         edges_->clear();
 
+        removedEdges_.clear();
+
+        removedEdgeCount_ = 0;
+
+        remainingEdgeCounts_.clear();
+
         neighborhood_.clear();
+
+        edgePositions_.clear();
+
+        edgeIndex_.clear();
+
+        incidentEdges_.clear();
+    }
+
+    /**
+     *  Access the hyperedge with the given ID.
+     *
+     *  @param[in] edgeId   The ID of the hyperedge.
+     *
+     *  @return The hyperedge with the given ID.
+     */
+    const htd::Hyperedge & operator[](htd::id_t edgeId) const
+    {
+        return (*edges_)[edgePositions_[edgeId - htd::Id::FIRST]];
+    }
+
+    /**
+     *  Compute the key of a hyperedge within the element index.
+     *
+     *  @param[in] sortedElements   The sorted set of endpoints of the hyperedge.
+     *
+     *  @return The key of a hyperedge with the given set of endpoints within the element index.
+     */
+    static std::size_t elementKey(const htd::VertexSpan & sortedElements)
+    {
+        std::size_t ret = sortedElements.size();
+
+        for (htd::vertex_t vertex : sortedElements)
+        {
+            std::hash_combine(ret, vertex);
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Check whether the given vertex is marked in the given bit vector.
+     *
+     *  @param[in] marks    The bit vector indexed by the vertex IDs.
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return True if the given vertex is marked, false otherwise.
+     */
+    static bool isMarked(const std::vector<bool> & marks, htd::vertex_t vertex)
+    {
+        htd::index_t index = vertex - htd::Vertex::FIRST;
+
+        return index < marks.size() && marks[index];
+    }
+
+    /**
+     *  Set or clear the mark of the given vertex in the given bit vector.
+     *
+     *  @param[in,out] marks    The bit vector indexed by the vertex IDs.
+     *  @param[in] vertex       The vertex.
+     *  @param[in] value        The new value of the mark.
+     */
+    static void setMark(std::vector<bool> & marks, htd::vertex_t vertex, bool value)
+    {
+        htd::index_t index = vertex - htd::Vertex::FIRST;
+
+        if (index >= marks.size())
+        {
+            if (!value)
+            {
+                return;
+            }
+
+            marks.resize(index + 1, false);
+        }
+
+        marks[index] = value;
+    }
+
+    /**
+     *  Check whether the given vertex has a self-loop.
+     *
+     *  @param[in] vertex   The vertex.
+     *
+     *  @return True if the given vertex has a self-loop, false otherwise.
+     */
+    bool hasSelfLoop(htd::vertex_t vertex) const
+    {
+        return isMarked(selfLoops_, vertex);
+    }
+
+    /**
+     *  Sort the given endpoints of a hyperedge, remove duplicates and register the self-loops induced by the duplicates.
+     *
+     *  @param[in,out] elements The endpoints of the hyperedge. After the call, the vector is sorted in ascending order and free of duplicates.
+     *  @param[out] duplicates  The target vector to which each vertex occurring more than once in the given endpoints shall be appended.
+     */
+    void normalizeElements(std::vector<htd::vertex_t> & elements, std::vector<htd::vertex_t> & duplicates)
+    {
+        std::sort(elements.begin(), elements.end());
+
+        for (htd::index_t index = 1; index < elements.size(); ++index)
+        {
+            if (elements[index] == elements[index - 1] && (duplicates.empty() || duplicates.back() != elements[index]))
+            {
+                setMark(selfLoops_, elements[index], true);
+
+                duplicates.push_back(elements[index]);
+            }
+        }
+
+        elements.erase(std::unique(elements.begin(), elements.end()), elements.end());
+    }
+
+    /**
+     *  Get the storage index of the hyperedge with the given ID within the collection of hyperedges.
+     *
+     *  @param[in] edgeId   The ID of the hyperedge.
+     *
+     *  @return The storage index of the hyperedge with the given ID or std::numeric_limits<htd::index_t>::max() if there is no such hyperedge.
+     */
+    htd::index_t edgePosition(htd::id_t edgeId) const
+    {
+        htd::index_t ret = std::numeric_limits<htd::index_t>::max();
+
+        if (edgeId >= htd::Id::FIRST && edgeId - htd::Id::FIRST < edgePositions_.size())
+        {
+            ret = edgePositions_[edgeId - htd::Id::FIRST];
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Append a new hyperedge to the collection of hyperedges and register it in the edge indices.
+     *
+     *  The neighborhoods of the endpoints are not affected by this function.
+     *
+     *  @param[in] args The arguments which shall be forwarded to the constructor of the new hyperedge.
+     */
+    template <typename... Args>
+    void appendEdge(Args && ... args)
+    {
+        edges_->emplace_back(std::forward<Args>(args)...);
+
+        const htd::Hyperedge & hyperedge = edges_->back();
+
+        if (removedEdgeCount_ > 0)
+        {
+            std::size_t node = edges_->size();
+
+            /* The new node of the Fenwick tree covers the storage indices in the range (node - lowbit(node), node]. */
+            remainingEdgeCounts_.push_back(1 + remainingEdgeCount(node - 1) - remainingEdgeCount(node - (node & (~node + 1))));
+
+            removedEdges_.push_back(false);
+        }
+
+        htd::id_t edgeId = hyperedge.id();
+
+        if (edgeId - htd::Id::FIRST >= edgePositions_.size())
+        {
+            edgePositions_.resize(edgeId - htd::Id::FIRST + 1, std::numeric_limits<htd::index_t>::max());
+        }
+
+        edgePositions_[edgeId - htd::Id::FIRST] = edges_->size() - 1;
+
+        edgeIndex_.emplace(elementKey(hyperedge.sortedElements()), edgeId);
+
+        for (htd::vertex_t vertex : hyperedge.sortedElements())
+        {
+            std::vector<htd::id_t> & currentIncidentEdges = incidentEdges_[vertex - htd::Vertex::FIRST];
+
+            if (currentIncidentEdges.empty() || currentIncidentEdges.back() < edgeId)
+            {
+                currentIncidentEdges.push_back(edgeId);
+            }
+            else
+            {
+                currentIncidentEdges.insert(std::lower_bound(currentIncidentEdges.begin(), currentIncidentEdges.end(), edgeId), edgeId);
+            }
+        }
+    }
+
+    /**
+     *  Remove the given hyperedge from the element index.
+     *
+     *  @param[in] hyperedge    The hyperedge which shall be removed from the element index.
+     */
+    void unregisterElements(const htd::Hyperedge & hyperedge)
+    {
+        auto range = edgeIndex_.equal_range(elementKey(hyperedge.sortedElements()));
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == hyperedge.id())
+            {
+                edgeIndex_.erase(it);
+
+                return;
+            }
+        }
+    }
+
+    /**
+     *  Get the number of hyperedges stored before the given storage index which were not removed.
+     *
+     *  This function must only be called while there are removed hyperedges awaiting compaction.
+     *
+     *  @param[in] storageIndex The storage index up to which (exclusive) the remaining hyperedges shall be counted.
+     *
+     *  @return The number of hyperedges stored before the given storage index which were not removed.
+     */
+    std::size_t remainingEdgeCount(htd::index_t storageIndex) const
+    {
+        std::size_t ret = 0;
+
+        for (htd::index_t node = storageIndex; node > 0; node -= node & (~node + 1))
+        {
+            ret += remainingEdgeCounts_[node];
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Get the storage index of the hyperedge located at the given position within the collection of remaining hyperedges.
+     *
+     *  @param[in] position The position of the hyperedge within the collection of remaining hyperedges.
+     *
+     *  @return The storage index of the hyperedge located at the given position or edges_->size() if the position is out of range.
+     */
+    htd::index_t storageIndex(htd::index_t position) const
+    {
+        if (removedEdgeCount_ == 0)
+        {
+            return position < edges_->size() ? position : edges_->size();
+        }
+
+        std::size_t nodeCount = remainingEdgeCounts_.size() - 1;
+
+        std::size_t step = 1;
+
+        while (step * 2 <= nodeCount)
+        {
+            step *= 2;
+        }
+
+        htd::index_t ret = 0;
+
+        std::size_t remaining = position + 1;
+
+        for (; step > 0; step /= 2)
+        {
+            if (ret + step <= nodeCount && remainingEdgeCounts_[ret + step] < remaining)
+            {
+                ret += step;
+
+                remaining -= remainingEdgeCounts_[ret];
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Mark the hyperedge at the given storage index as removed.
+     *
+     *  The hyperedge stays in the collection of hyperedges until the next compaction so that removing a
+     *  hyperedge does not have to shift the storage indices of all subsequent hyperedges.
+     *
+     *  @param[in] storageIndex The storage index of the hyperedge which shall be removed.
+     */
+    void markRemoved(htd::index_t storageIndex)
+    {
+        std::size_t nodeCount = edges_->size();
+
+        if (removedEdgeCount_ == 0)
+        {
+            removedEdges_.assign(nodeCount, false);
+
+            remainingEdgeCounts_.assign(nodeCount + 1, 0);
+
+            for (std::size_t node = 1; node <= nodeCount; ++node)
+            {
+                remainingEdgeCounts_[node] += 1;
+
+                std::size_t parent = node + (node & (~node + 1));
+
+                if (parent <= nodeCount)
+                {
+                    remainingEdgeCounts_[parent] += remainingEdgeCounts_[node];
+                }
+            }
+        }
+
+        removedEdges_[storageIndex] = true;
+
+        ++removedEdgeCount_;
+
+        for (std::size_t node = storageIndex + 1; node <= nodeCount; node += node & (~node + 1))
+        {
+            --remainingEdgeCounts_[node];
+        }
+    }
+
+    /**
+     *  Drop the removed hyperedges from the collection of hyperedges once they make up more than half of it.
+     *
+     *  The compaction costs time linear in the number of stored hyperedges, so the removal of hyperedges
+     *  takes amortized logarithmic time.
+     */
+    void compactEdges(void)
+    {
+        if (removedEdgeCount_ * 2 > edges_->size())
+        {
+            htd::index_t target = 0;
+
+            for (htd::index_t index = 0; index < edges_->size(); ++index)
+            {
+                if (!removedEdges_[index])
+                {
+                    if (target != index)
+                    {
+                        (*edges_)[target] = std::move((*edges_)[index]);
+                    }
+
+                    edgePositions_[(*edges_)[target].id() - htd::Id::FIRST] = target;
+
+                    ++target;
+                }
+            }
+
+            edges_->erase(edges_->begin() + target, edges_->end());
+
+            removedEdges_.clear();
+
+            removedEdgeCount_ = 0;
+
+            remainingEdgeCounts_.clear();
+        }
+    }
+
+    /**
+     *  Create a collection wrapping a vector of vertices within the given implementation details structure.
+     *
+     *  The collection keeps the implementation details alive, hence it remains valid when the multi-hypergraph it was
+     *  obtained from moves to a private copy of its implementation details and all other sharers are destroyed.
+     *
+     *  @param[in] implementation   The implementation details structure containing the vector.
+     *  @param[in] vertices         The vector of vertices which shall be wrapped.
+     *
+     *  @return A collection wrapping the given vector of vertices.
+     */
+    static htd::ConstCollection<htd::vertex_t> anchoredCollection(const std::shared_ptr<Implementation> & implementation, std::vector<htd::vertex_t> & vertices)
+    {
+        typedef htd::VectorAdapterConstIteratorWrapper<std::vector<htd::vertex_t>::const_iterator> IteratorType;
+
+        std::shared_ptr<std::vector<htd::vertex_t>> collection(implementation, &vertices);
+
+        return htd::ConstCollection<htd::vertex_t>::getInstance(static_cast<htd::ConstIteratorBase<htd::vertex_t> *>(new IteratorType(collection, collection->cbegin())),
+                                                                static_cast<htd::ConstIteratorBase<htd::vertex_t> *>(new IteratorType(collection, collection->cend())),
+                                                                collection->size());
+    }
+
+    /**
+     *  Iterator over the collection of hyperedges which skips removed hyperedges.
+     *
+     *  The iterator keeps the implementation details alive.
+     */
+    class RemainingEdgeIterator : public htd::ConstIteratorBase<htd::Hyperedge>
+    {
+        public:
+            /**
+             *  Constructor for an iterator pointing to the first remaining hyperedge at or after the given storage index.
+             *
+             *  @param[in] implementation   The implementation details structure storing the hyperedges.
+             *  @param[in] storageIndex     The storage index at which the iteration shall start.
+             */
+            RemainingEdgeIterator(const std::shared_ptr<const Implementation> & implementation, htd::index_t storageIndex) HTD_NOEXCEPT : implementation_(implementation), storageIndex_(storageIndex)
+            {
+                skipRemovedEdges();
+            }
+
+            /**
+             *  Copy constructor for an iterator.
+             *
+             *  @param[in] original  The original iterator.
+             */
+            RemainingEdgeIterator(const RemainingEdgeIterator & original) HTD_NOEXCEPT : implementation_(original.implementation_), storageIndex_(original.storageIndex_)
+            {
+
+            }
+
+            virtual ~RemainingEdgeIterator()
+            {
+
+            }
+
+            RemainingEdgeIterator & operator++(void) HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                ++storageIndex_;
+
+                skipRemovedEdges();
+
+                return *this;
+            }
+
+            bool operator==(const htd::ConstIteratorBase<htd::Hyperedge> & rhs) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return storageIndex_ == static_cast<const RemainingEdgeIterator *>(&rhs)->storageIndex_;
+            }
+
+            bool operator!=(const htd::ConstIteratorBase<htd::Hyperedge> & rhs) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return storageIndex_ != static_cast<const RemainingEdgeIterator *>(&rhs)->storageIndex_;
+            }
+
+            const htd::Hyperedge * operator->(void) const HTD_OVERRIDE
+            {
+                return &((*(implementation_->edges_))[storageIndex_]);
+            }
+
+            const htd::Hyperedge & operator*(void) const HTD_OVERRIDE
+            {
+                return (*(implementation_->edges_))[storageIndex_];
+            }
+
+            RemainingEdgeIterator * clone(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return new RemainingEdgeIterator(*this);
+            }
+
+        private:
+            /**
+             *  Advance the storage index to the next hyperedge which was not removed.
+             */
+            void skipRemovedEdges(void) HTD_NOEXCEPT
+            {
+                while (storageIndex_ < implementation_->removedEdges_.size() && implementation_->removedEdges_[storageIndex_])
+                {
+                    ++storageIndex_;
+                }
+            }
+
+            /**
+             *  The implementation details structure storing the hyperedges.
+             */
+            std::shared_ptr<const Implementation> implementation_;
+
+            /**
+             *  The storage index of the current hyperedge.
+             */
+            htd::index_t storageIndex_;
+    };
+
+    /**
+     *  The maximum number of endpoints which lookupKey() normalizes in a buffer on the stack.
+     */
+    static constexpr std::size_t LOOKUP_BUFFER_SIZE = 16;
+
+    /**
+     *  Compute the key of a sequence of endpoints within the element index.
+     *
+     *  The endpoints do not need to be sorted or free of duplicates. Sequences of up to LOOKUP_BUFFER_SIZE endpoints
+     *  are normalized in a buffer on the stack, hence looking them up does not allocate memory.
+     *
+     *  @param[in] elements The endpoints.
+     *
+     *  @return The key of a hyperedge with the given endpoints within the element index.
+     */
+    static std::size_t lookupKey(const htd::VertexSpan & elements)
+    {
+        if (elements.size() == 2)
+        {
+            std::array<htd::vertex_t, 2> sortedElements { { elements[0], elements[1] } };
+
+            if (sortedElements[0] > sortedElements[1])
+            {
+                std::swap(sortedElements[0], sortedElements[1]);
+            }
+
+            return elementKey(htd::VertexSpan(sortedElements.data(), sortedElements[0] == sortedElements[1] ? 1 : 2));
+        }
+
+        if (htd::is_sorted_and_duplicate_free(elements.begin(), elements.end()))
+        {
+            return elementKey(elements);
+        }
+
+        if (elements.size() <= LOOKUP_BUFFER_SIZE)
+        {
+            std::array<htd::vertex_t, LOOKUP_BUFFER_SIZE> sortedElements;
+
+            auto last = std::copy(elements.begin(), elements.end(), sortedElements.begin());
+
+            std::sort(sortedElements.begin(), last);
+
+            last = std::unique(sortedElements.begin(), last);
+
+            return elementKey(htd::VertexSpan(sortedElements.data(), static_cast<std::size_t>(last - sortedElements.begin())));
+        }
+
+        std::vector<htd::vertex_t> sortedElements(elements.begin(), elements.end());
+
+        std::sort(sortedElements.begin(), sortedElements.end());
+
+        sortedElements.erase(std::unique(sortedElements.begin(), sortedElements.end()), sortedElements.end());
+
+        return elementKey(htd::VertexSpan(sortedElements));
+    }
+
+    /**
+     *  Collect the IDs of all hyperedges whose endpoints are exactly the given vertices in the given order.
+     *
+     *  @param[in] elements     The sequence of endpoints.
+     *  @param[out] target      The target vector to which the IDs of the matching hyperedges, sorted in ascending order, shall be appended.
+     */
+    void findEdges(const htd::VertexSpan & elements, std::vector<htd::id_t> & target) const
+    {
+        std::size_t previousSize = target.size();
+
+        auto range = edgeIndex_.equal_range(lookupKey(elements));
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if ((*this)[it->second].elements() == elements)
+            {
+                target.push_back(it->second);
+            }
+        }
+
+        std::sort(target.begin() + previousSize, target.end());
+    }
+
+    /**
+     *  Check whether a hyperedge whose endpoints are exactly the given vertices in the given order exists.
+     *
+     *  @param[in] elements The sequence of endpoints.
+     *
+     *  @return True if such a hyperedge exists, false otherwise.
+     */
+    bool containsEdge(const htd::VertexSpan & elements) const
+    {
+        auto range = edgeIndex_.equal_range(lookupKey(elements));
+
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if ((*this)[it->second].elements() == elements)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     *  Insert a batch of adjacency entries into the neighborhoods of the affected vertices.
+     *
+     *  Each entry (vertex, neighbor) states that 'neighbor' shall be part of the neighborhood of 'vertex'. The entries are
+     *  sorted by vertex and neighbor, so that each affected neighborhood is merged exactly once. The effort depends only on
+     *  the size of the batch: If the affected vertices lie in a range of identifiers which is small compared to the number
+     *  of entries, a two-pass counting sort over this range is used, otherwise the entries are sorted by comparison.
+     *
+     *  @param[in] entries  The adjacency entries which shall be inserted. Entries may be duplicated.
+     */
+    void insertNeighbors(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & entries)
+    {
+        if (entries.empty())
+        {
+            return;
+        }
+
+        htd::vertex_t minimum = entries[0].first;
+        htd::vertex_t maximum = entries[0].first;
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & entry : entries)
+        {
+            minimum = std::min(minimum, std::min(entry.first, entry.second));
+            maximum = std::max(maximum, std::max(entry.first, entry.second));
+        }
+
+        std::size_t range = maximum - minimum + 1;
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> sortedEntries(entries.size());
+
+        if (range <= 2 * entries.size())
+        {
+            std::vector<std::pair<htd::vertex_t, htd::vertex_t>> sortedByNeighbor(entries.size());
+
+            std::vector<std::size_t> offsets(range + 1, 0);
+
+            for (const std::pair<htd::vertex_t, htd::vertex_t> & entry : entries)
+            {
+                ++(offsets[entry.second - minimum + 1]);
+            }
+
+            for (htd::index_t index = 1; index <= range; ++index)
+            {
+                offsets[index] += offsets[index - 1];
+            }
+
+            for (const std::pair<htd::vertex_t, htd::vertex_t> & entry : entries)
+            {
+                sortedByNeighbor[offsets[entry.second - minimum]++] = entry;
+            }
+
+            std::fill(offsets.begin(), offsets.end(), 0);
+
+            for (const std::pair<htd::vertex_t, htd::vertex_t> & entry : sortedByNeighbor)
+            {
+                ++(offsets[entry.first - minimum + 1]);
+            }
+
+            for (htd::index_t index = 1; index <= range; ++index)
+            {
+                offsets[index] += offsets[index - 1];
+            }
+
+            for (const std::pair<htd::vertex_t, htd::vertex_t> & entry : sortedByNeighbor)
+            {
+                sortedEntries[offsets[entry.first - minimum]++] = entry;
+            }
+        }
+        else
+        {
+            std::copy(entries.begin(), entries.end(), sortedEntries.begin());
+
+            std::sort(sortedEntries.begin(), sortedEntries.end());
+        }
+
+        std::vector<htd::vertex_t> newNeighbors;
+
+        auto it = sortedEntries.begin();
+
+        while (it != sortedEntries.end())
+        {
+            htd::vertex_t vertex = it->first;
+
+            newNeighbors.clear();
+
+            for (; it != sortedEntries.end() && it->first == vertex; ++it)
+            {
+                if (newNeighbors.empty() || newNeighbors.back() != it->second)
+                {
+                    newNeighbors.push_back(it->second);
+                }
+            }
+
+            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex - htd::Vertex::FIRST];
+
+            if (currentNeighborhood.empty())
+            {
+                currentNeighborhood.swap(newNeighbors);
+            }
+            else
+            {
+                htd::inplace_set_union(currentNeighborhood, newNeighbors);
+            }
+        }
     }
 
     /**
@@ -137,24 +822,63 @@ struct htd::MultiHypergraph::Implementation
     std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The set of vertices which have self-loops.
+     *  The information whether the vertex corresponding to the respective position has a self-loop.
      */
-    std::unordered_set<htd::vertex_t> selfLoops_;
+    std::vector<bool> selfLoops_;
 
     /**
-     *  The set of vertices which were removed from the graph.
+     *  The information whether the vertex corresponding to the respective position was removed from the graph.
      */
-    std::unordered_set<htd::vertex_t> deletions_;
+    std::vector<bool> deletions_;
 
     /**
-     *  The collection of hyperedges sorted by ID in ascending order.
+     *  The collection of hyperedges sorted by ID in ascending order. Removed hyperedges are kept in the collection until the next compaction.
      */
     std::shared_ptr<std::deque<htd::Hyperedge>> edges_;
 
+    /**
+     *  The information whether the hyperedge at the respective storage index was removed. The vector is empty if there is no removed hyperedge.
+     */
+    std::vector<bool> removedEdges_;
+
+    /**
+     *  The number of removed hyperedges which are still stored in the collection of hyperedges.
+     */
+    std::size_t removedEdgeCount_;
+
+    /**
+     *  The Fenwick tree of the number of remaining hyperedges per storage index, used to translate positions to storage indices. The vector is empty if there is no removed hyperedge.
+     */
+    std::vector<std::size_t> remainingEdgeCounts_;
+
     /**
      *  The vector of neighbors for each vertex in the hypergraph. The neighborhood of each vertex is sorted in ascending order.
      */
     std::vector<std::vector<htd::vertex_t>> neighborhood_;
+
+    /**
+     *  The storage index of each hyperedge within the collection of hyperedges, indexed by the ID of the hyperedge.
+     *  The storage index of hyperedges which do not exist (anymore) is std::numeric_limits<htd::index_t>::max().
+     */
+    std::vector<htd::index_t> edgePositions_;
+
+    /**
+     *  The IDs of all hyperedges, indexed by the hash code of their sorted set of endpoints.
+     */
+    std::unordered_multimap<std::size_t, htd::id_t> edgeIndex_;
+
+    /**
+     *  The IDs of the hyperedges containing each vertex. The IDs of the hyperedges of each vertex are sorted in ascending order.
+     */
+    std::vector<std::vector<htd::id_t>> incidentEdges_;
+
+    /**
+     *  The number of multi-hypergraphs sharing the implementation details.
+     *
+     *  Collections returned by a multi-hypergraph keep the implementation details alive, but they are no owners,
+     *  hence a multi-hypergraph which is modified while such a collection exists is modified in place.
+     */
+    std::atomic<std::size_t> owners_;
 };
 
 htd::MultiHypergraph::MultiHypergraph(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -167,9 +891,9 @@ htd::MultiHypergraph::MultiHypergraph(const htd::LibraryInstance * const manager
     addVertices(initialSize);
 }
 
-htd::MultiHypergraph::MultiHypergraph(const htd::MultiHypergraph & original) : implementation_(new Implementation(*(original.implementation_)))
+htd::MultiHypergraph::MultiHypergraph(const htd::MultiHypergraph & original) : implementation_(original.implementation_)
 {
-
+    ++(implementation_->owners_);
 }
 
 htd::MultiHypergraph::MultiHypergraph(const htd::IMultiHypergraph & original) : implementation_(new Implementation(original.managementInstance()))
@@ -179,7 +903,7 @@ htd::MultiHypergraph::MultiHypergraph(const htd::IMultiHypergraph & original) :
 
 htd::MultiHypergraph::~MultiHypergraph()
 {
-
+    --(implementation_->owners_);
 }
 
 std::size_t htd::MultiHypergraph::vertexCount(void) const
@@ -189,63 +913,41 @@ std::size_t htd::MultiHypergraph::vertexCount(void) const
 
 std::size_t htd::MultiHypergraph::edgeCount(void) const
 {
-    return implementation_->edges_->size();
+    return implementation_->edges_->size() - implementation_->removedEdgeCount_;
 }
 
 std::size_t htd::MultiHypergraph::edgeCount(htd::vertex_t vertex) const
 {
-    std::size_t ret = 0;
-
     HTD_ASSERT(isVertex(vertex))
 
-    for (const htd::Hyperedge & edge : *(implementation_->edges_))
-    {
-        if (edge.contains(vertex))
-        {
-            ret++;
-        }
-    }
-
-    return ret;
+    return implementation_->incidentEdges_[vertex - htd::Vertex::FIRST].size();
 }
 
 bool htd::MultiHypergraph::isVertex(htd::vertex_t vertex) const
 {
-    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->deletions_.count(vertex) == 0;
+    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && !Implementation::isMarked(implementation_->deletions_, vertex);
 }
 
 bool htd::MultiHypergraph::isEdge(htd::id_t edgeId) const
 {
-    bool ret = false;
-
-    for (auto it = implementation_->edges_->begin(); !ret && it != implementation_->edges_->end(); ++it)
-    {
-        ret = (it->id() == edgeId);
-    }
-
-    return ret;
+    return implementation_->edgePosition(edgeId) != std::numeric_limits<htd::index_t>::max();
 }
 
 bool htd::MultiHypergraph::isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const
 {
-    return isNeighbor(vertex1, vertex2) && isEdge(htd::ConstCollection<htd::vertex_t>::getInstance(std::vector<htd::vertex_t> { vertex1, vertex2 }));
+    std::array<htd::vertex_t, 2> elements { { vertex1, vertex2 } };
+
+    return isNeighbor(vertex1, vertex2) && implementation_->containsEdge(htd::VertexSpan(elements.data(), elements.size()));
 }
 
 bool htd::MultiHypergraph::isEdge(const std::vector<htd::vertex_t> & elements) const
 {
-    return isEdge(htd::ConstCollection<htd::vertex_t>::getInstance(elements));
+    return implementation_->containsEdge(htd::VertexSpan(elements));
 }
 
 bool htd::MultiHypergraph::isEdge(const htd::ConstCollection<htd::vertex_t> & elements) const
 {
-    bool ret = false;
-
-    for (auto it = implementation_->edges_->begin(); !ret && it != implementation_->edges_->end(); ++it)
-    {
-        ret = it->size() == elements.size() && htd::equal(it->begin(), it->end(), elements.begin(), elements.end());
-    }
-
-    return ret;
+    return isEdge(std::vector<htd::vertex_t>(elements.begin(), elements.end()));
 }
 
 htd::ConstCollection<htd::id_t> htd::MultiHypergraph::associatedEdgeIds(htd::vertex_t vertex1, htd::vertex_t vertex2) const
@@ -254,15 +956,9 @@ htd::ConstCollection<htd::id_t> htd::MultiHypergraph::associatedEdgeIds(htd::ver
 
     if (isNeighbor(vertex1, vertex2))
     {
-        auto & result = ret.container();
+        std::array<htd::vertex_t, 2> elements { { vertex1, vertex2 } };
 
-        for (const htd::Hyperedge & edge : hyperedges())
-        {
-            if (edge.size() == 2 && edge[0] == vertex1 && edge[1] == vertex2)
-            {
-                result.push_back(edge.id());
-            }
-        }
+        implementation_->findEdges(htd::VertexSpan(elements.data(), elements.size()), ret.container());
     }
 
     return htd::ConstCollection<htd::id_t>::getInstance(ret);
@@ -272,34 +968,14 @@ htd::ConstCollection<htd::id_t> htd::MultiHypergraph::associatedEdgeIds(const st
 {
     htd::VectorAdapter<htd::id_t> ret;
 
-    auto & result = ret.container();
-
-    for (const htd::Hyperedge & edge : hyperedges())
-    {
-        if (edge.size() == elements.size() && htd::equal(edge.begin(), edge.end(), elements.begin(), elements.end()))
-        {
-            result.push_back(edge.id());
-        }
-    }
+    implementation_->findEdges(htd::VertexSpan(elements), ret.container());
 
     return htd::ConstCollection<htd::id_t>::getInstance(ret);
 }
 
 htd::ConstCollection<htd::id_t> htd::MultiHypergraph::associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const
 {
-    htd::VectorAdapter<htd::id_t> ret;
-
-    auto & result = ret.container();
-
-    for (const htd::Hyperedge & edge : hyperedges())
-    {
-        if (edge.size() == elements.size() && htd::equal(edge.begin(), edge.end(), elements.begin(), elements.end()))
-        {
-            result.push_back(edge.id());
-        }
-    }
-
-    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+    return associatedEdgeIds(std::vector<htd::vertex_t>(elements.begin(), elements.end()));
 }
 
 bool htd::MultiHypergraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
@@ -316,15 +992,7 @@ bool htd::MultiHypergraph::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighb
     }
     else
     {
-        for (auto it = implementation_->edges_->begin(); !ret && it != implementation_->edges_->end(); ++it)
-        {
-            const htd::Hyperedge & edge = *it;
-
-            if (std::count_if(edge.begin(), edge.end(), [&](htd::vertex_t element) { return element == vertex; }) >= 2)
-            {
-                ret = true;
-            }
-        }
+        ret = implementation_->hasSelfLoop(vertex);
     }
     
     return ret;
@@ -345,7 +1013,9 @@ bool htd::MultiHypergraph::isConnected(void) const
     {
         std::stack<htd::vertex_t> originStack;
 
-        std::unordered_set<htd::vertex_t> visitedVertices;
+        std::vector<bool> visitedVertices(implementation_->next_vertex_ - htd::Vertex::FIRST, false);
+
+        std::size_t visitedVertexCount = 0;
 
         htd::vertex_t currentVertex = implementation_->vertices_[0];
 
@@ -355,15 +1025,17 @@ bool htd::MultiHypergraph::isConnected(void) const
         {
             currentVertex = originStack.top();
 
-            if (visitedVertices.count(currentVertex) == 0)
+            if (!visitedVertices[currentVertex - htd::Vertex::FIRST])
             {
-                visitedVertices.insert(currentVertex);
+                visitedVertices[currentVertex - htd::Vertex::FIRST] = true;
+
+                ++visitedVertexCount;
 
                 originStack.pop();
 
                 for (htd::vertex_t neighbor : implementation_->neighborhood_[currentVertex - htd::Vertex::FIRST])
                 {
-                    if (visitedVertices.count(neighbor) == 0)
+                    if (!visitedVertices[neighbor - htd::Vertex::FIRST])
                     {
                         originStack.push(neighbor);
                     }
@@ -375,7 +1047,7 @@ bool htd::MultiHypergraph::isConnected(void) const
             }
         }
 
-        ret = visitedVertices.size() == implementation_->vertices_.size();
+        ret = visitedVertexCount == implementation_->vertices_.size();
     }
     else
     {
@@ -445,7 +1117,7 @@ htd::ConstCollection<htd::vertex_t> htd::MultiHypergraph::neighbors(htd::vertex_
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->neighborhood_[vertex - htd::Vertex::FIRST]);
+    return Implementation::anchoredCollection(implementation_, implementation_->neighborhood_[vertex - htd::Vertex::FIRST]);
 }
 
 void htd::MultiHypergraph::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
@@ -470,7 +1142,7 @@ htd::vertex_t htd::MultiHypergraph::neighborAtPosition(htd::vertex_t vertex, htd
 
 htd::ConstCollection<htd::vertex_t> htd::MultiHypergraph::vertices(void) const
 {
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertices_);
+    return Implementation::anchoredCollection(implementation_, implementation_->vertices_);
 }
 
 void htd::MultiHypergraph::copyVerticesTo(std::vector<htd::vertex_t> & target) const
@@ -515,14 +1187,7 @@ htd::ConstCollection<htd::vertex_t> htd::MultiHypergraph::isolatedVertices(void)
 
     for (htd::vertex_t vertex : implementation_->vertices_)
     {
-        bool isolated = true;
-
-        for (auto it = implementation_->edges_->begin(); isolated && it != implementation_->edges_->end(); it++)
-        {
-            isolated = (*it).size() <= 1 || std::find((*it).begin(), (*it).end(), vertex) == (*it).end();
-        }
-
-        if (isolated)
+        if (implementation_->neighborhood_[vertex - htd::Vertex::FIRST].empty())
         {
             result.push_back(vertex);
         }
@@ -548,83 +1213,52 @@ bool htd::MultiHypergraph::isIsolatedVertex(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    bool ret = true;
-
-    for (auto it = implementation_->edges_->begin(); ret && it != implementation_->edges_->end(); it++)
-    {
-        ret = (*it).size() <= 1 || std::find((*it).begin(), (*it).end(), vertex) == (*it).end();
-    }
-
-    return ret;
+    return implementation_->neighborhood_[vertex - htd::Vertex::FIRST].empty();
 }
 
 htd::ConstCollection<htd::Hyperedge> htd::MultiHypergraph::hyperedges(void) const
 {
-    return htd::ConstCollection<htd::Hyperedge>::getInstance(*(implementation_->edges_));
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new Implementation::RemainingEdgeIterator(implementation_, 0)),
+                                                             static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new Implementation::RemainingEdgeIterator(implementation_, implementation_->edges_->size())),
+                                                             edgeCount());
 }
 
 htd::ConstCollection<htd::Hyperedge> htd::MultiHypergraph::hyperedges(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::VectorAdapter<htd::Hyperedge> ret;
+    typedef htd::ConstIndexedIteratorWrapper<std::vector<htd::id_t>::const_iterator, Implementation, htd::Hyperedge> IteratorType;
 
-    auto & result = ret.container();
+    const std::vector<htd::id_t> & incidentEdges = implementation_->incidentEdges_[vertex - htd::Vertex::FIRST];
 
-    for (auto & edge : *(implementation_->edges_))
-    {
-        if (edge.contains(vertex))
-        {
-            result.push_back(edge);
-        }
-    }
+    std::shared_ptr<const Implementation> implementation = implementation_;
 
-    return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new IteratorType(incidentEdges.begin(), implementation)),
+                                                             static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new IteratorType(incidentEdges.end(), implementation)),
+                                                             incidentEdges.size());
 }
 
 const htd::Hyperedge & htd::MultiHypergraph::hyperedge(htd::id_t edgeId) const
 {
-    bool found = false;
-
-    auto position = implementation_->edges_->begin();
-
-    for (auto it = implementation_->edges_->begin(); !found && it != implementation_->edges_->end(); ++it)
-    {
-        if (it->id() == edgeId)
-        {
-            position = it;
-
-            found = true;
-        }
-    }
+    htd::index_t position = implementation_->edgePosition(edgeId);
 
-    HTD_ASSERT(found)
+    HTD_ASSERT(position != std::numeric_limits<htd::index_t>::max())
 
-    return *position;
+    return (*(implementation_->edges_))[position];
 }
 
 const htd::Hyperedge & htd::MultiHypergraph::hyperedgeAtPosition(htd::index_t index) const
 {
-    HTD_ASSERT(index < implementation_->edges_->size())
+    HTD_ASSERT(index < edgeCount())
 
-    return implementation_->edges_->at(index);
+    return implementation_->edges_->at(implementation_->storageIndex(index));
 }
 
 const htd::Hyperedge & htd::MultiHypergraph::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
-    for (auto it = implementation_->edges_->begin(); it != implementation_->edges_->end(); ++it)
+    if (isVertex(vertex) && index < implementation_->incidentEdges_[vertex - htd::Vertex::FIRST].size())
     {
-        const htd::Hyperedge & hyperedge = *it;
-
-        if (hyperedge.contains(vertex))
-        {
-            if (index == 0)
-            {
-                return hyperedge;
-            }
-
-            --index;
-        }
+        return (*implementation_)[implementation_->incidentEdges_[vertex - htd::Vertex::FIRST][index]];
     }
 
     throw std::out_of_range("const htd::Hyperedge & htd::MultiHypergraph::hyperedgeAtPosition(htd::index_t, htd::vertex_t) const");
@@ -632,11 +1266,19 @@ const htd::Hyperedge & htd::MultiHypergraph::hyperedgeAtPosition(htd::index_t in
 
 htd::FilteredHyperedgeCollection htd::MultiHypergraph::hyperedgesAtPositions(const std::vector<htd::index_t> & indices) const
 {
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), indices);
+    return hyperedgesAtPositions(std::vector<htd::index_t>(indices));
 }
 
 htd::FilteredHyperedgeCollection htd::MultiHypergraph::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
 {
+    if (implementation_->removedEdgeCount_ > 0)
+    {
+        for (htd::index_t & index : indices)
+        {
+            index = implementation_->storageIndex(index);
+        }
+    }
+
     return htd::FilteredHyperedgeCollection(new htd::HyperedgeDeque(implementation_->edges_), std::move(indices));
 }
 
@@ -652,6 +1294,8 @@ htd::id_t htd::MultiHypergraph::nextEdgeId(void) const
 
 htd::vertex_t htd::MultiHypergraph::addVertex(void)
 {
+    detach();
+
     htd::vertex_t ret = implementation_->next_vertex_;
     
     implementation_->size_++;
@@ -660,6 +1304,8 @@ htd::vertex_t htd::MultiHypergraph::addVertex(void)
 
     implementation_->neighborhood_.emplace_back(std::vector<htd::vertex_t>());
 
+    implementation_->incidentEdges_.emplace_back(std::vector<htd::id_t>());
+
     implementation_->vertices_.push_back(ret);
 
     return ret;
@@ -667,6 +1313,8 @@ htd::vertex_t htd::MultiHypergraph::addVertex(void)
 
 htd::vertex_t htd::MultiHypergraph::addVertices(std::size_t count)
 {
+    detach();
+
     htd::vertex_t ret = implementation_->next_vertex_;
 
     if (count > 0)
@@ -684,6 +1332,8 @@ htd::vertex_t htd::MultiHypergraph::addVertices(std::size_t count)
 
         implementation_->neighborhood_.resize(implementation_->neighborhood_.size() + count, std::vector<htd::vertex_t>());
 
+        implementation_->incidentEdges_.resize(implementation_->incidentEdges_.size() + count, std::vector<htd::id_t>());
+
         implementation_->size_ += count;
     }
     else
@@ -696,32 +1346,41 @@ htd::vertex_t htd::MultiHypergraph::addVertices(std::size_t count)
 
 void htd::MultiHypergraph::removeVertex(htd::vertex_t vertex)
 {
-    HTD_ASSERT(isVertex(vertex))
+    detach();
 
-    htd::index_t currentIndex = 0;
+    HTD_ASSERT(isVertex(vertex))
 
-    std::vector<htd::index_t> emptyEdges;
+    std::vector<htd::id_t> & incidentEdges = implementation_->incidentEdges_[vertex - htd::Vertex::FIRST];
 
-    for (auto & edge : *(implementation_->edges_))
+    for (htd::id_t edgeId : incidentEdges)
     {
+        htd::index_t position = implementation_->edgePositions_[edgeId - htd::Id::FIRST];
+
+        htd::Hyperedge & edge = (*(implementation_->edges_))[position];
+
+        implementation_->unregisterElements(edge);
+
         edge.erase(vertex);
 
         if (edge.empty())
         {
-            emptyEdges.push_back(currentIndex);
-        }
+            implementation_->markRemoved(position);
 
-        ++currentIndex;
+            implementation_->edgePositions_[edgeId - htd::Id::FIRST] = std::numeric_limits<htd::index_t>::max();
+        }
+        else
+        {
+            implementation_->edgeIndex_.emplace(Implementation::elementKey(edge.sortedElements()), edgeId);
+        }
     }
 
-    for (auto it = emptyEdges.rbegin(); it != emptyEdges.rend(); ++it)
-    {
-        implementation_->edges_->erase(implementation_->edges_->begin() + *it);
-    }
+    incidentEdges.clear();
+
+    implementation_->compactEdges();
 
-    implementation_->selfLoops_.erase(vertex);
+    Implementation::setMark(implementation_->selfLoops_, vertex, false);
 
-    implementation_->deletions_.insert(vertex);
+    Implementation::setMark(implementation_->deletions_, vertex, true);
 
     for (htd::vertex_t neighbor : implementation_->neighborhood_[vertex - htd::Vertex::FIRST])
     {
@@ -744,9 +1403,11 @@ void htd::MultiHypergraph::removeVertex(htd::vertex_t vertex)
 
 htd::id_t htd::MultiHypergraph::addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
 {
+    detach();
+
     HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
 
-    implementation_->edges_->emplace_back(implementation_->next_edge_, vertex1, vertex2);
+    implementation_->appendEdge(implementation_->next_edge_, vertex1, vertex2);
 
     if (vertex1 != vertex2)
     {
@@ -774,7 +1435,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::vertex_t vertex1, htd::vertex_t ver
             currentNeighborhood1.insert(position, vertex1);
         }
 
-        implementation_->selfLoops_.insert(vertex1);
+        Implementation::setMark(implementation_->selfLoops_, vertex1, true);
     }
 
     return implementation_->next_edge_++;
@@ -787,6 +1448,8 @@ htd::id_t htd::MultiHypergraph::addEdge(const std::vector<htd::vertex_t> & eleme
 
 htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
 {
+    detach();
+
     HTD_ASSERT(!elements.empty())
 
     switch (elements.size())
@@ -795,7 +1458,7 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
         {
             HTD_ASSERT(isVertex(elements[0]))
 
-            implementation_->edges_->emplace_back(implementation_->next_edge_, elements[0]);
+            implementation_->appendEdge(implementation_->next_edge_, elements[0]);
 
             return implementation_->next_edge_++;
         }
@@ -818,16 +1481,12 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
 
     std::vector<htd::vertex_t> sortedElements(elements);
 
-    auto elementsBegin = sortedElements.begin();
-    auto elementsEnd = sortedElements.end();
-
-    std::sort(elementsBegin, elementsEnd);
-
-    auto position = std::unique(elementsBegin, elementsEnd);
+    std::vector<htd::vertex_t> duplicates;
 
-    implementation_->selfLoops_.insert(position, elementsEnd);
+    implementation_->normalizeElements(sortedElements, duplicates);
 
-    elementsEnd = sortedElements.erase(position, elementsEnd);
+    auto elementsBegin = sortedElements.begin();
+    auto elementsEnd = sortedElements.end();
 
     for (htd::vertex_t vertex : sortedElements)
     {
@@ -841,7 +1500,7 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
 
         if (!tmp.empty())
         {
-            if (implementation_->selfLoops_.count(vertex) == 0)
+            if (!implementation_->hasSelfLoop(vertex))
             {
                 /* Because 'vertex' does not have any self-loops, the set difference between the
                  * endpoints of the hyperedge and the neighborhood of 'vertex' always contains
@@ -857,7 +1516,7 @@ htd::id_t htd::MultiHypergraph::addEdge(std::vector<htd::vertex_t> && elements)
         }
     }
 
-    implementation_->edges_->emplace_back(implementation_->next_edge_, std::move(elements), std::move(sortedElements));
+    implementation_->appendEdge(implementation_->next_edge_, std::move(elements), std::move(sortedElements));
 
     return implementation_->next_edge_++;
 }
@@ -869,6 +1528,8 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::ConstCollection<htd::vertex_t
 
 htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
 {
+    detach();
+
     HTD_ASSERT(!hyperedge.empty())
 
     switch (hyperedge.size())
@@ -877,7 +1538,7 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
         {
             HTD_ASSERT(isVertex(hyperedge[0]))
 
-            implementation_->edges_->emplace_back(implementation_->next_edge_, hyperedge.elements());
+            implementation_->appendEdge(implementation_->next_edge_, hyperedge[0]);
 
             return implementation_->next_edge_++;
         }
@@ -898,20 +1559,17 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
         HTD_ASSERT(isVertex(vertex));
     }
 
-    implementation_->edges_->emplace_back(implementation_->next_edge_, hyperedge.elements());
+    htd::Hyperedge newHyperedge(hyperedge);
 
-    std::vector<htd::vertex_t> sortedElements(hyperedge.begin(), hyperedge.end());
+    newHyperedge.setId(implementation_->next_edge_);
 
-    std::sort(sortedElements.begin(), sortedElements.end());
+    implementation_->appendEdge(std::move(newHyperedge));
 
-    auto position = std::unique(sortedElements.begin(), sortedElements.end());
+    std::vector<htd::vertex_t> sortedElements(hyperedge.begin(), hyperedge.end());
 
-    for (auto it = position; it != sortedElements.end(); it++)
-    {
-        implementation_->selfLoops_.insert(*it);
-    }
+    std::vector<htd::vertex_t> duplicates;
 
-    sortedElements.erase(position, sortedElements.end());
+    implementation_->normalizeElements(sortedElements, duplicates);
 
     std::vector<htd::vertex_t> newNeighborhood;
 
@@ -919,7 +1577,7 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
     {
         auto & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
 
-        if (implementation_->selfLoops_.count(vertex) > 0)
+        if (implementation_->hasSelfLoop(vertex))
         {
             htd::set_union(currentNeighborhood, sortedElements, newNeighborhood);
         }
@@ -938,6 +1596,8 @@ htd::id_t htd::MultiHypergraph::addEdge(const htd::Hyperedge & hyperedge)
 
 htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
 {
+    detach();
+
     HTD_ASSERT(!hyperedge.empty())
 
     switch (hyperedge.size())
@@ -948,7 +1608,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
 
             hyperedge.setId(implementation_->next_edge_);
 
-            implementation_->edges_->emplace_back(std::move(hyperedge));
+            implementation_->appendEdge(std::move(hyperedge));
 
             return implementation_->next_edge_++;
         }
@@ -973,20 +1633,13 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
 
     newHyperedge.setId(implementation_->next_edge_);
 
-    implementation_->edges_->emplace_back(newHyperedge);
+    implementation_->appendEdge(newHyperedge);
 
     std::vector<htd::vertex_t> sortedElements(newHyperedge.begin(), newHyperedge.end());
 
-    std::sort(sortedElements.begin(), sortedElements.end());
-
-    auto position = std::unique(sortedElements.begin(), sortedElements.end());
+    std::vector<htd::vertex_t> duplicates;
 
-    for (auto it = position; it != sortedElements.end(); it++)
-    {
-        implementation_->selfLoops_.insert(*it);
-    }
-
-    sortedElements.erase(position, sortedElements.end());
+    implementation_->normalizeElements(sortedElements, duplicates);
 
     std::vector<htd::vertex_t> newNeighborhood;
 
@@ -994,7 +1647,7 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
     {
         auto & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
 
-        if (implementation_->selfLoops_.count(vertex) > 0)
+        if (implementation_->hasSelfLoop(vertex))
         {
             htd::set_union(currentNeighborhood, sortedElements, newNeighborhood);
         }
@@ -1011,92 +1664,215 @@ htd::id_t htd::MultiHypergraph::addEdge(htd::Hyperedge && hyperedge)
     return implementation_->next_edge_++;
 }
 
-void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
+htd::id_t htd::MultiHypergraph::addEdges(const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & edges)
 {
-    bool found = false;
+    detach();
 
-    auto position = implementation_->edges_->begin();
+    htd::id_t ret = implementation_->next_edge_;
 
-    for (auto it = implementation_->edges_->begin(); !found && it != implementation_->edges_->end(); ++it)
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> entries;
+
+    entries.reserve(2 * edges.size());
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
     {
-        if (it->id() == edgeId)
-        {
-            position = it;
+        htd::vertex_t vertex1 = edge.first;
+        htd::vertex_t vertex2 = edge.second;
+
+        HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
 
-            found = true;
+        implementation_->appendEdge(implementation_->next_edge_, vertex1, vertex2);
+
+        ++(implementation_->next_edge_);
+
+        entries.emplace_back(vertex1, vertex2);
+
+        if (vertex1 != vertex2)
+        {
+            entries.emplace_back(vertex2, vertex1);
+        }
+        else
+        {
+            Implementation::setMark(implementation_->selfLoops_, vertex1, true);
         }
     }
 
-    if (found)
+    implementation_->insertNeighbors(entries);
+
+    return edges.empty() ? ret - 1 : ret;
+}
+
+htd::id_t htd::MultiHypergraph::addEdges(const std::vector<std::vector<htd::vertex_t>> & edges)
+{
+    return addEdges(std::vector<std::vector<htd::vertex_t>>(edges));
+}
+
+htd::id_t htd::MultiHypergraph::addEdges(std::vector<std::vector<htd::vertex_t>> && edges)
+{
+    detach();
+
+    htd::id_t ret = implementation_->next_edge_;
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> entries;
+
+    std::vector<htd::vertex_t> duplicates;
+
+    for (std::vector<htd::vertex_t> & elements : edges)
     {
-        const htd::Hyperedge & hyperedge = *position;
+        HTD_ASSERT(!elements.empty())
 
-        for (htd::vertex_t vertex : hyperedge)
+        #ifndef NDEBUG
+        for (htd::vertex_t vertex : elements)
         {
-            std::unordered_set<htd::vertex_t> missing(hyperedge.begin(), hyperedge.end());
+            HTD_ASSERT(isVertex(vertex))
+        }
+        #endif
 
-            bool selfLoopExists = false;
+        std::vector<htd::vertex_t> sortedElements(elements);
 
-            for (auto it = implementation_->edges_->begin(); !missing.empty() && it != implementation_->edges_->end(); it++)
-            {
-                htd::Hyperedge & currentEdge = *it;
+        implementation_->normalizeElements(sortedElements, duplicates);
 
-                if (it != position && currentEdge.contains(vertex))
-                {
-                    std::size_t occurrences = 0;
+        for (htd::vertex_t vertex : duplicates)
+        {
+            entries.emplace_back(vertex, vertex);
+        }
 
-                    for (htd::vertex_t vertex2 : currentEdge)
-                    {
-                        missing.erase(vertex2);
+        duplicates.clear();
 
-                        if (vertex2 == vertex)
-                        {
-                            ++occurrences;
-                        }
+        if (elements.size() > 1)
+        {
+            for (htd::vertex_t vertex : sortedElements)
+            {
+                for (htd::vertex_t neighbor : sortedElements)
+                {
+                    if (neighbor != vertex)
+                    {
+                        entries.emplace_back(vertex, neighbor);
                     }
-
-                    selfLoopExists = occurrences > 1;
                 }
             }
+        }
 
-            if (!missing.empty())
-            {
-                std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+        if (elements.size() == 2)
+        {
+            implementation_->appendEdge(implementation_->next_edge_, elements[0], elements[1]);
+        }
+        else
+        {
+            implementation_->appendEdge(implementation_->next_edge_, std::move(elements), std::move(sortedElements));
+        }
+
+        ++(implementation_->next_edge_);
+    }
 
-                for (auto it = missing.begin(); it != missing.end(); it++)
+    implementation_->insertNeighbors(entries);
+
+    return edges.empty() ? ret - 1 : ret;
+}
+
+void htd::MultiHypergraph::removeEdge(htd::id_t edgeId)
+{
+    htd::index_t position = implementation_->edgePosition(edgeId);
+
+    if (position != std::numeric_limits<htd::index_t>::max())
+    {
+        detach();
+
+        const htd::Hyperedge & hyperedge = (*(implementation_->edges_))[position];
+
+        const htd::VertexSpan & endpoints = hyperedge.sortedElements();
+
+        /* For each endpoint of the removed hyperedge, the set of endpoints which are not covered by any other hyperedge containing the endpoint. */
+        std::vector<std::vector<htd::vertex_t>> missing(endpoints.size());
+
+        std::vector<bool> selfLoopExists(endpoints.size(), false);
+
+        std::vector<htd::vertex_t> remainder;
+
+        for (htd::index_t index = 0; index < endpoints.size(); ++index)
+        {
+            htd::vertex_t vertex = endpoints[index];
+
+            std::vector<htd::vertex_t> & currentMissing = missing[index];
+
+            currentMissing.reserve(endpoints.size() - 1);
+
+            std::copy_if(endpoints.begin(), endpoints.end(), std::back_inserter(currentMissing), [&](htd::vertex_t endpoint) { return endpoint != vertex; });
+
+            for (htd::id_t currentEdgeId : implementation_->incidentEdges_[vertex - htd::Vertex::FIRST])
+            {
+                if (currentEdgeId != edgeId)
                 {
-                    auto position2 = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), *it);
+                    const htd::Hyperedge & currentEdge = (*implementation_)[currentEdgeId];
+
+                    const htd::VertexSpan & currentEndpoints = currentEdge.sortedElements();
+
+                    if (!currentMissing.empty())
+                    {
+                        std::set_difference(currentMissing.begin(), currentMissing.end(),
+                                            currentEndpoints.begin(), currentEndpoints.end(), std::back_inserter(remainder));
+
+                        currentMissing.swap(remainder);
+
+                        remainder.clear();
+                    }
 
-                    if (position2 != currentNeighborhood.end())
+                    if (!selfLoopExists[index] && currentEdge.size() > currentEndpoints.size())
                     {
-                        /* Iterator 'position2' is no longer used after erasing the underlying element. Therefore, invalidating the iterator does no harm. */
-                        // coverity[use_iterator]
-                        currentNeighborhood.erase(position2);
+                        selfLoopExists[index] = std::count(currentEdge.begin(), currentEdge.end(), vertex) > 1;
                     }
                 }
             }
+        }
+
+        for (htd::index_t index = 0; index < endpoints.size(); ++index)
+        {
+            htd::vertex_t vertex = endpoints[index];
 
-            if (implementation_->selfLoops_.count(vertex) > 0 && !selfLoopExists)
+            std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+
+            if (implementation_->hasSelfLoop(vertex) && !selfLoopExists[index])
             {
-                std::vector<htd::vertex_t> & currentNeighborhood = implementation_->neighborhood_[vertex - htd::Vertex::FIRST];
+                missing[index].insert(std::lower_bound(missing[index].begin(), missing[index].end(), vertex), vertex);
 
-                auto position2 = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
+                Implementation::setMark(implementation_->selfLoops_, vertex, false);
+            }
 
-                if (position2 != currentNeighborhood.end())
-                {
-                    /* Iterator 'position2' is no longer used after erasing the underlying element. Therefore, invalidating the iterator does no harm. */
-                    // coverity[use_iterator]
-                    currentNeighborhood.erase(position2);
-                }
+            if (!missing[index].empty())
+            {
+                std::vector<htd::vertex_t> newNeighborhood;
+
+                newNeighborhood.reserve(currentNeighborhood.size());
 
-                implementation_->selfLoops_.erase(vertex);
+                std::set_difference(currentNeighborhood.begin(), currentNeighborhood.end(),
+                                    missing[index].begin(), missing[index].end(), std::back_inserter(newNeighborhood));
+
+                currentNeighborhood.swap(newNeighborhood);
             }
         }
 
-        implementation_->edges_->erase(position);
+        for (htd::vertex_t vertex : endpoints)
+        {
+            std::vector<htd::id_t> & currentIncidentEdges = implementation_->incidentEdges_[vertex - htd::Vertex::FIRST];
+
+            currentIncidentEdges.erase(std::lower_bound(currentIncidentEdges.begin(), currentIncidentEdges.end(), edgeId));
+        }
+
+        implementation_->unregisterElements(hyperedge);
+
+        implementation_->edgePositions_[edgeId - htd::Id::FIRST] = std::numeric_limits<htd::index_t>::max();
+
+        implementation_->markRemoved(position);
+
+        implementation_->compactEdges();
     }
 }
 
+htd::CompactHypergraph * htd::MultiHypergraph::freeze(void) const
+{
+    return new htd::CompactHypergraph(*this);
+}
+
 const htd::LibraryInstance * htd::MultiHypergraph::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -1104,6 +1880,8 @@ const htd::LibraryInstance * htd::MultiHypergraph::managementInstance(void) cons
 
 void htd::MultiHypergraph::setManagementInstance(const htd::LibraryInstance * const manager)
 {
+    detach();
+
     HTD_ASSERT(manager != nullptr)
 
     implementation_->managementInstance_ = manager;
@@ -1133,9 +1911,13 @@ htd::IMutableMultiHypergraph * htd::MultiHypergraph::cloneMutableMultiHypergraph
 
 htd::MultiHypergraph & htd::MultiHypergraph::operator=(const htd::MultiHypergraph & original)
 {
-    if (this != &original)
+    if (this != &original && implementation_ != original.implementation_)
     {
-        *implementation_ = *(original.implementation_);
+        --(implementation_->owners_);
+
+        implementation_ = original.implementation_;
+
+        ++(implementation_->owners_);
     }
 
     return *this;
@@ -1145,16 +1927,27 @@ htd::MultiHypergraph & htd::MultiHypergraph::operator=(const htd::IMultiHypergra
 {
     if (this != &original)
     {
-        implementation_->reset();
+        if (implementation_->owners_ > 1)
+        {
+            --(implementation_->owners_);
+
+            implementation_ = std::make_shared<Implementation>(implementation_->managementInstance_);
+        }
+        else
+        {
+            implementation_->reset();
+        }
 
         for (htd::vertex_t vertex : original.vertices())
         {
             while (vertex > implementation_->next_vertex_)
             {
-                implementation_->deletions_.insert(implementation_->next_vertex_);
+                Implementation::setMark(implementation_->deletions_, implementation_->next_vertex_, true);
 
                 implementation_->neighborhood_.emplace_back(std::vector<htd::vertex_t>());
 
+                implementation_->incidentEdges_.emplace_back(std::vector<htd::id_t>());
+
                 ++(implementation_->next_vertex_);
             }
 
@@ -1164,6 +1957,8 @@ htd::MultiHypergraph & htd::MultiHypergraph::operator=(const htd::IMultiHypergra
 
             implementation_->neighborhood_.emplace_back(std::vector<htd::vertex_t>());
 
+            implementation_->incidentEdges_.emplace_back(std::vector<htd::id_t>());
+
             implementation_->vertices_.push_back(vertex);
         }
 
@@ -1178,6 +1973,18 @@ htd::MultiHypergraph & htd::MultiHypergraph::operator=(const htd::IMultiHypergra
     return *this;
 }
 
+void htd::MultiHypergraph::detach(void)
+{
+    if (implementation_->owners_ > 1)
+    {
+        std::shared_ptr<Implementation> implementation = std::make_shared<Implementation>(*implementation_);
+
+        --(implementation_->owners_);
+
+        implementation_ = implementation;
+    }
+}
+
 #ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
 void htd::MultiHypergraph::assign(const htd::IMultiHypergraph & original)
 {
@@ -0,0 +1,273 @@
+/* 
+ * File:   MultiHypergraphBuilder.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ * 
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ * 
+ * This file is part of htd.
+ * 
+ * htd is free software: you can redistribute it and/or modify it under 
+ * the terms of the GNU General Public License as published by the Free 
+ * Software Foundation, either version 3 of the License, or (at your 
+ * option) any later version.
+ * 
+ * htd is distributed in the hope that it will be useful, but WITHOUT 
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY 
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public 
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_MULTIHYPERGRAPHBUILDER_CPP
+#define HTD_HTD_MULTIHYPERGRAPHBUILDER_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/MultiHypergraphBuilder.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::MultiHypergraphBuilder.
+ */
+struct htd::MultiHypergraphBuilder::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     */
+    Implementation(void) : binaryEdges_(), hyperedges_(), runs_()
+    {
+
+    }
+
+    /**
+     *  Copy constructor of the implementation details structure.
+     *
+     *  @param[in] original  The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : binaryEdges_(original.binaryEdges_), hyperedges_(original.hyperedges_), runs_(original.runs_)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  Register a new edge in the run information.
+     *
+     *  @param[in] binary   A boolean flag whether the new edge has exactly two endpoints.
+     */
+    void registerEdge(bool binary)
+    {
+        if (runs_.empty() || runs_.back().first != binary)
+        {
+            runs_.emplace_back(binary, 0);
+        }
+
+        ++(runs_.back().second);
+    }
+
+    /**
+     *  Remove all collected edges.
+     */
+    void clear(void)
+    {
+        binaryEdges_.clear();
+
+        hyperedges_.clear();
+
+        runs_.clear();
+    }
+
+    /**
+     *  The collected edges with exactly two endpoints.
+     */
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> binaryEdges_;
+
+    /**
+     *  The collected edges with a number of endpoints different from two.
+     */
+    std::vector<std::vector<htd::vertex_t>> hyperedges_;
+
+    /**
+     *  The sequence of maximal runs of consecutive binary edges and consecutive hyperedges in insertion order.
+     *  Each entry stores whether the run consists of binary edges and the number of edges within the run.
+     */
+    std::vector<std::pair<bool, std::size_t>> runs_;
+};
+
+htd::MultiHypergraphBuilder::MultiHypergraphBuilder(void) : implementation_(new Implementation())
+{
+
+}
+
+htd::MultiHypergraphBuilder::MultiHypergraphBuilder(const htd::MultiHypergraphBuilder & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::MultiHypergraphBuilder::~MultiHypergraphBuilder()
+{
+
+}
+
+std::size_t htd::MultiHypergraphBuilder::edgeCount(void) const
+{
+    return implementation_->binaryEdges_.size() + implementation_->hyperedges_.size();
+}
+
+void htd::MultiHypergraphBuilder::addEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
+{
+    implementation_->binaryEdges_.emplace_back(vertex1, vertex2);
+
+    implementation_->registerEdge(true);
+}
+
+void htd::MultiHypergraphBuilder::addEdge(const std::vector<htd::vertex_t> & elements)
+{
+    addEdge(std::vector<htd::vertex_t>(elements));
+}
+
+void htd::MultiHypergraphBuilder::addEdge(std::vector<htd::vertex_t> && elements)
+{
+    HTD_ASSERT(!elements.empty())
+
+    if (elements.size() == 2)
+    {
+        addEdge(elements[0], elements[1]);
+    }
+    else
+    {
+        implementation_->hyperedges_.emplace_back(std::move(elements));
+
+        implementation_->registerEdge(false);
+    }
+}
+
+void htd::MultiHypergraphBuilder::clear(void)
+{
+    implementation_->clear();
+}
+
+htd::id_t htd::MultiHypergraphBuilder::populate(htd::IMutableMultiHypergraph & graph)
+{
+    htd::id_t ret = graph.nextEdgeId();
+
+    if (implementation_->runs_.size() == 1 && implementation_->runs_[0].first)
+    {
+        graph.addEdges(implementation_->binaryEdges_);
+    }
+    else if (implementation_->runs_.size() == 1)
+    {
+        graph.addEdges(std::move(implementation_->hyperedges_));
+    }
+    else
+    {
+        /* The cost of each call of addEdges only depends on the size of the batch, hence each run is flushed through the matching overload. */
+        auto binaryEdgePosition = implementation_->binaryEdges_.begin();
+
+        auto hyperedgePosition = implementation_->hyperedges_.begin();
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> binaryEdges;
+
+        std::vector<std::vector<htd::vertex_t>> hyperedges;
+
+        for (const std::pair<bool, std::size_t> & run : implementation_->runs_)
+        {
+            if (run.first)
+            {
+                binaryEdges.assign(binaryEdgePosition, binaryEdgePosition + run.second);
+
+                graph.addEdges(binaryEdges);
+
+                binaryEdgePosition += run.second;
+            }
+            else
+            {
+                hyperedges.clear();
+
+                std::move(hyperedgePosition, hyperedgePosition + run.second, std::back_inserter(hyperedges));
+
+                graph.addEdges(std::move(hyperedges));
+
+                hyperedgePosition += run.second;
+            }
+        }
+    }
+
+    if (implementation_->runs_.empty())
+    {
+        --ret;
+    }
+
+    implementation_->clear();
+
+    return ret;
+}
+
+htd::id_t htd::MultiHypergraphBuilder::populate(htd::IMutableMultiGraph & graph)
+{
+    HTD_ASSERT(implementation_->hyperedges_.empty())
+
+    htd::id_t ret = graph.addEdges(implementation_->binaryEdges_);
+
+    implementation_->clear();
+
+    return ret;
+}
+
+htd::CompactHypergraph * htd::MultiHypergraphBuilder::freeze(const htd::LibraryInstance * const manager, std::size_t vertexCount)
+{
+    std::vector<htd::Hyperedge> hyperedges;
+
+    hyperedges.reserve(edgeCount());
+
+    htd::id_t nextEdgeId = htd::Id::FIRST;
+
+    auto binaryEdgePosition = implementation_->binaryEdges_.begin();
+
+    auto hyperedgePosition = implementation_->hyperedges_.begin();
+
+    for (const std::pair<bool, std::size_t> & run : implementation_->runs_)
+    {
+        if (run.first)
+        {
+            for (auto end = binaryEdgePosition + run.second; binaryEdgePosition != end; ++binaryEdgePosition)
+            {
+                hyperedges.emplace_back(nextEdgeId++, binaryEdgePosition->first, binaryEdgePosition->second);
+            }
+        }
+        else
+        {
+            for (auto end = hyperedgePosition + run.second; hyperedgePosition != end; ++hyperedgePosition)
+            {
+                hyperedges.emplace_back(nextEdgeId++, std::move(*hyperedgePosition));
+            }
+        }
+    }
+
+    implementation_->clear();
+
+    return new htd::CompactHypergraph(manager, vertexCount, std::move(hyperedges));
+}
+
+htd::MultiHypergraphBuilder & htd::MultiHypergraphBuilder::operator=(const htd::MultiHypergraphBuilder & original)
+{
+    if (this != &original)
+    {
+        implementation_.reset(new Implementation(*(original.implementation_)));
+    }
+
+    return *this;
+}
+
+#endif /* HTD_HTD_MULTIHYPERGRAPHBUILDER_CPP */
@@ -59,7 +59,7 @@ htd::PathDecomposition::PathDecomposition(const htd::IPathDecomposition & origin
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_[vertex] = original.bagContent(vertex);
+        bagContent_.setBagContent(vertex, original.bagContent(vertex));
         inducedEdges_[vertex] = original.inducedHyperedges(vertex);
     }
 }
@@ -73,7 +73,7 @@ void htd::PathDecomposition::removeVertex(htd::vertex_t vertex)
 {
     htd::Path::removeVertex(vertex);
 
-    bagContent_.erase(vertex);
+    bagContent_.removeBag(vertex);
 
     inducedEdges_.erase(vertex);
 }
@@ -89,7 +89,7 @@ void htd::PathDecomposition::removeSubpath(htd::vertex_t subpathRoot)
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
 
-        bagContent_.erase(vertex);
+        bagContent_.removeBag(vertex);
 
         inducedEdges_.erase(vertex);
     }, subpathRoot);
@@ -105,7 +105,7 @@ htd::vertex_t htd::PathDecomposition::insertRoot(void)
 
     if (inserted)
     {
-        bagContent_[ret] = std::vector<htd::vertex_t>();
+        bagContent_.setBagContent(ret, std::vector<htd::vertex_t>());
 
         inducedEdges_[ret] = htd::FilteredHyperedgeCollection();
     }
@@ -121,7 +121,7 @@ htd::vertex_t htd::PathDecomposition::insertRoot(const std::vector<htd::vertex_t
 
     if (inserted)
     {
-        bagContent_[ret] = bagContent;
+        bagContent_.setBagContent(ret, bagContent);
 
         inducedEdges_[ret] = inducedEdges;
     }
@@ -137,7 +137,7 @@ htd::vertex_t htd::PathDecomposition::insertRoot(std::vector<htd::vertex_t> && b
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::move(bagContent));
+        bagContent_.setBagContent(ret, bagContent);
 
         inducedEdges_.emplace(ret, std::move(inducedEdges));
     }
@@ -149,7 +149,7 @@ htd::vertex_t htd::PathDecomposition::addChild(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Path::addChild(vertex);
 
-    bagContent_[ret] = std::vector<htd::vertex_t>();
+    bagContent_.setBagContent(ret, std::vector<htd::vertex_t>());
 
     inducedEdges_[ret] = htd::FilteredHyperedgeCollection();
 
@@ -160,7 +160,7 @@ htd::vertex_t htd::PathDecomposition::addChild(htd::vertex_t vertex, const std::
 {
     htd::vertex_t ret = htd::Path::addChild(vertex);
 
-    bagContent_[ret] = bagContent;
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_[ret] = inducedEdges;
 
@@ -171,7 +171,7 @@ htd::vertex_t htd::PathDecomposition::addChild(htd::vertex_t vertex, std::vector
 {
     htd::vertex_t ret = htd::Path::addChild(vertex);
 
-    bagContent_[ret] = std::move(bagContent);
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_[ret] = std::move(inducedEdges);
 
@@ -182,7 +182,7 @@ htd::vertex_t htd::PathDecomposition::addParent(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Path::addParent(vertex);
 
-    bagContent_[ret] = std::vector<htd::vertex_t>();
+    bagContent_.setBagContent(ret, std::vector<htd::vertex_t>());
 
     inducedEdges_[ret] = htd::FilteredHyperedgeCollection();
 
@@ -193,7 +193,7 @@ htd::vertex_t htd::PathDecomposition::addParent(htd::vertex_t vertex, const std:
 {
     htd::vertex_t ret = htd::Path::addParent(vertex);
 
-    bagContent_[ret] = bagContent;
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_[ret] = inducedEdges;
 
@@ -204,7 +204,7 @@ htd::vertex_t htd::PathDecomposition::addParent(htd::vertex_t vertex, std::vecto
 {
     htd::vertex_t ret = htd::Path::addParent(vertex);
 
-    bagContent_[ret] = std::move(bagContent);
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_[ret] = std::move(inducedEdges);
 
@@ -219,7 +219,7 @@ void htd::PathDecomposition::removeChild(htd::vertex_t vertex)
 
         htd::Path::removeChild(vertex, childVertex);
 
-        bagContent_.erase(childVertex);
+        bagContent_.removeBag(childVertex);
 
         inducedEdges_.erase(childVertex);
     }
@@ -229,7 +229,7 @@ void htd::PathDecomposition::removeChild(htd::vertex_t vertex, htd::vertex_t chi
 {
     htd::Path::removeChild(vertex, child);
 
-    bagContent_.erase(child);
+    bagContent_.removeBag(child);
 
     inducedEdges_.erase(child);
 }
@@ -273,8 +273,8 @@ std::size_t htd::PathDecomposition::forgetNodeCount(void) const
     {
         if (childCount(node) > 0)
         {
-            const std::vector<htd::vertex_t> & bag = bagContent(node);
-            const std::vector<htd::vertex_t> & childBag = bagContent(child(node));
+            const htd::Bag & bag = bagContent(node);
+            const htd::Bag & childBag = bagContent(child(node));
 
             if (htd::has_non_empty_set_difference(childBag.begin(), childBag.end(), bag.begin(), bag.end()))
             {
@@ -301,8 +301,8 @@ void htd::PathDecomposition::copyForgetNodesTo(std::vector<htd::vertex_t> & targ
     {
         if (childCount(node) > 0)
         {
-            const std::vector<htd::vertex_t> & bag = bagContent(node);
-            const std::vector<htd::vertex_t> & childBag = bagContent(child(node));
+            const htd::Bag & bag = bagContent(node);
+            const htd::Bag & childBag = bagContent(child(node));
 
             if (htd::has_non_empty_set_difference(childBag.begin(), childBag.end(), bag.begin(), bag.end()))
             {
@@ -333,8 +333,8 @@ bool htd::PathDecomposition::isForgetNode(htd::vertex_t vertex) const
 
     if (childCount(vertex) > 0)
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-        const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+        const htd::Bag & bag = bagContent(vertex);
+        const htd::Bag & childBag = bagContent(child(vertex));
 
         ret = htd::has_non_empty_set_difference(childBag.begin(), childBag.end(), bag.begin(), bag.end());
     }
@@ -348,12 +348,12 @@ std::size_t htd::PathDecomposition::introduceNodeCount(void) const
 
     for (htd::vertex_t node : vertexVector())
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+        const htd::Bag & bag = bagContent(node);
 
         if (!isLeaf(node))
         {
-            const std::vector<htd::vertex_t> & bag = bagContent(node);
-            const std::vector<htd::vertex_t> & childBag = bagContent(child(node));
+            const htd::Bag & bag = bagContent(node);
+            const htd::Bag & childBag = bagContent(child(node));
 
             if (htd::has_non_empty_set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end()))
             {
@@ -385,11 +385,11 @@ void htd::PathDecomposition::copyIntroduceNodesTo(std::vector<htd::vertex_t> & t
 {
     for (htd::vertex_t node : vertexVector())
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+        const htd::Bag & bag = bagContent(node);
 
         if (!isLeaf(node))
         {
-            const std::vector<htd::vertex_t> & childBag = bagContent(child(node));
+            const htd::Bag & childBag = bagContent(child(node));
 
             if (htd::has_non_empty_set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end()))
             {
@@ -425,12 +425,12 @@ bool htd::PathDecomposition::isIntroduceNode(htd::vertex_t vertex) const
 
     bool ret = false;
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     if (!isLeaf(vertex))
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-        const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+        const htd::Bag & bag = bagContent(vertex);
+        const htd::Bag & childBag = bagContent(child(vertex));
 
         ret = htd::has_non_empty_set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end());
     }
@@ -450,8 +450,8 @@ std::size_t htd::PathDecomposition::exchangeNodeCount(void) const
     {
         if (!isLeaf(node))
         {
-            const std::vector<htd::vertex_t> & bag = bagContent(node);
-            const std::vector<htd::vertex_t> & childBag = bagContent(child(node));
+            const htd::Bag & bag = bagContent(node);
+            const htd::Bag & childBag = bagContent(child(node));
 
             std::pair<std::size_t, std::size_t> symmetricDifference = htd::symmetric_difference_sizes(bag, childBag);
 
@@ -480,8 +480,8 @@ void htd::PathDecomposition::copyExchangeNodesTo(std::vector<htd::vertex_t> & ta
     {
         if (!isLeaf(node))
         {
-            const std::vector<htd::vertex_t> & bag = bagContent(node);
-            const std::vector<htd::vertex_t> & childBag = bagContent(child(node));
+            const htd::Bag & bag = bagContent(node);
+            const htd::Bag & childBag = bagContent(child(node));
 
             std::pair<std::size_t, std::size_t> symmetricDifference = htd::symmetric_difference_sizes(bag, childBag);
 
@@ -514,8 +514,8 @@ bool htd::PathDecomposition::isExchangeNode(htd::vertex_t vertex) const
 
     if (!isLeaf(vertex))
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-        const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+        const htd::Bag & bag = bagContent(vertex);
+        const htd::Bag & childBag = bagContent(child(vertex));
 
         std::pair<std::size_t, std::size_t> symmetricDifference = htd::symmetric_difference_sizes(bag, childBag);
 
@@ -529,21 +529,35 @@ std::size_t htd::PathDecomposition::bagSize(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex).size();
+    return bagContent_.bagContent(vertex).size();
 }
 
 std::vector<htd::vertex_t> & htd::PathDecomposition::mutableBagContent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return bagContent_.mutableBagContent(vertex);
 }
 
-const std::vector<htd::vertex_t> & htd::PathDecomposition::bagContent(htd::vertex_t vertex) const
+void htd::PathDecomposition::setBagContent(htd::vertex_t vertex, const std::vector<htd::vertex_t> & content)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    bagContent_.setBagContent(vertex, content);
+}
+
+void htd::PathDecomposition::setBagContent(htd::vertex_t vertex, const htd::Bag & content)
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    bagContent_.setBagContent(vertex, content);
+}
+
+const htd::Bag & htd::PathDecomposition::bagContent(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return bagContent_.bagContent(vertex);
 }
 
 htd::FilteredHyperedgeCollection & htd::PathDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)
@@ -606,8 +620,8 @@ std::size_t htd::PathDecomposition::forgottenVertexCount(htd::vertex_t vertex) c
 
     if (!isLeaf(vertex))
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-        const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+        const htd::Bag & bag = bagContent(vertex);
+        const htd::Bag & childBag = bagContent(child(vertex));
 
         ret = htd::set_difference_size(childBag.begin(), childBag.end(), bag.begin(), bag.end());
     }
@@ -620,8 +634,8 @@ std::size_t htd::PathDecomposition::forgottenVertexCount(htd::vertex_t vertex, h
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     return htd::set_difference_size(childBag.begin(), childBag.end(), bag.begin(), bag.end());
 }
@@ -636,8 +650,8 @@ htd::ConstCollection<htd::vertex_t> htd::PathDecomposition::forgottenVertices(ht
     {
         auto & result = ret.container();
 
-        const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-        const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+        const htd::Bag & bag = bagContent(vertex);
+        const htd::Bag & childBag = bagContent(child(vertex));
 
         std::set_difference(childBag.begin(), childBag.end(), bag.begin(), bag.end(), std::back_inserter(result));
     }
@@ -654,8 +668,8 @@ htd::ConstCollection<htd::vertex_t> htd::PathDecomposition::forgottenVertices(ht
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_difference(childBag.begin(), childBag.end(), bag.begin(), bag.end(), std::back_inserter(result));
 
@@ -668,8 +682,8 @@ void htd::PathDecomposition::copyForgottenVerticesTo(htd::vertex_t vertex, std::
 
     if (!isLeaf(vertex))
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-        const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+        const htd::Bag & bag = bagContent(vertex);
+        const htd::Bag & childBag = bagContent(child(vertex));
 
         std::set_difference(childBag.begin(), childBag.end(), bag.begin(), bag.end(), std::back_inserter(target));
     }
@@ -680,8 +694,8 @@ void htd::PathDecomposition::copyForgottenVerticesTo(htd::vertex_t vertex, std::
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_difference(childBag.begin(), childBag.end(), bag.begin(), bag.end(), std::back_inserter(target));
 }
@@ -732,11 +746,11 @@ std::size_t htd::PathDecomposition::introducedVertexCount(htd::vertex_t vertex)
 
     std::size_t ret = 0;
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     if (!isLeaf(vertex))
     {
-        const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+        const htd::Bag & childBag = bagContent(child(vertex));
 
         ret = htd::set_difference_size(bag.begin(), bag.end(), childBag.begin(), childBag.end());
     }
@@ -753,8 +767,8 @@ std::size_t htd::PathDecomposition::introducedVertexCount(htd::vertex_t vertex,
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     return htd::set_difference_size(bag.begin(), bag.end(), childBag.begin(), childBag.end());
 }
@@ -767,11 +781,11 @@ htd::ConstCollection<htd::vertex_t> htd::PathDecomposition::introducedVertices(h
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     if (!isLeaf(vertex))
     {
-        const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+        const htd::Bag & childBag = bagContent(child(vertex));
 
         std::set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(result));
     }
@@ -792,8 +806,8 @@ htd::ConstCollection<htd::vertex_t> htd::PathDecomposition::introducedVertices(h
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(result));
 
@@ -804,11 +818,11 @@ void htd::PathDecomposition::copyIntroducedVerticesTo(htd::vertex_t vertex, std:
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     if (!isLeaf(vertex))
     {
-        const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+        const htd::Bag & childBag = bagContent(child(vertex));
 
         std::set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(target));
     }
@@ -823,8 +837,8 @@ void htd::PathDecomposition::copyIntroducedVerticesTo(htd::vertex_t vertex, std:
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(target));
 }
@@ -873,8 +887,8 @@ std::size_t htd::PathDecomposition::rememberedVertexCount(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child(vertex));
 
     return htd::set_intersection_size(bag.begin(), bag.end(), childBag.begin(), childBag.end());
 }
@@ -884,8 +898,8 @@ std::size_t htd::PathDecomposition::rememberedVertexCount(htd::vertex_t vertex,
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     return htd::set_intersection_size(bag.begin(), bag.end(), childBag.begin(), childBag.end());
 }
@@ -898,8 +912,8 @@ htd::ConstCollection<htd::vertex_t> htd::PathDecomposition::rememberedVertices(h
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child(vertex));
 
     std::set_intersection(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(result));
 
@@ -915,8 +929,8 @@ htd::ConstCollection<htd::vertex_t> htd::PathDecomposition::rememberedVertices(h
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_intersection(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(result));
 
@@ -927,8 +941,8 @@ void htd::PathDecomposition::copyRememberedVerticesTo(htd::vertex_t vertex, std:
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child(vertex));
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child(vertex));
 
     std::set_intersection(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(target));
 }
@@ -938,8 +952,8 @@ void htd::PathDecomposition::copyRememberedVerticesTo(htd::vertex_t vertex, std:
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_intersection(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(target));
 }
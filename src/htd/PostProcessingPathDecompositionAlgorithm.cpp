@@ -194,7 +194,7 @@ htd::IPathDecomposition * htd::PostProcessingPathDecompositionAlgorithm::compute
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
-            htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(ret->bagContent(vertex)), *labelCollection);
 
             delete labelCollection;
 
@@ -208,7 +208,7 @@ htd::IPathDecomposition * htd::PostProcessingPathDecompositionAlgorithm::compute
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
-            htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(ret->bagContent(vertex)), *labelCollection);
 
             delete labelCollection;
 
@@ -276,8 +276,11 @@ htd::IMutablePathDecomposition * htd::PostProcessingPathDecompositionAlgorithm::
 
         htd::vertex_t currentVertex = decomposition.root();
 
-        htd::vertex_t newVertex = ret->insertRoot(std::move(decomposition.mutableBagContent(currentVertex)),
-                                                  std::move(decomposition.mutableInducedHyperedges(currentVertex)));
+        htd::vertex_t newVertex = ret->insertRoot();
+
+        ret->setBagContent(newVertex, decomposition.bagContent(currentVertex));
+
+        ret->mutableInducedHyperedges(newVertex) = std::move(decomposition.mutableInducedHyperedges(currentVertex));
 
         for (const std::string & labelName : labelNames)
         {
@@ -291,9 +294,11 @@ htd::IMutablePathDecomposition * htd::PostProcessingPathDecompositionAlgorithm::
         {
             currentVertex = decomposition.childAtPosition(currentVertex, 0);
 
-            newVertex = ret->addChild(newVertex,
-                                      std::move(decomposition.mutableBagContent(currentVertex)),
-                                      std::move(decomposition.mutableInducedHyperedges(currentVertex)));
+            newVertex = ret->addChild(newVertex);
+
+            ret->setBagContent(newVertex, decomposition.bagContent(currentVertex));
+
+            ret->mutableInducedHyperedges(newVertex) = std::move(decomposition.mutableInducedHyperedges(currentVertex));
 
             for (const std::string & labelName : labelNames)
             {
@@ -32,6 +32,8 @@
 #include <htd/VectorAdapter.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <memory>
 #include <stack>
 #include <unordered_set>
 #include <vector>
@@ -57,7 +59,7 @@ struct htd::PreprocessedGraph::Implementation
                    std::vector<htd::vertex_t> && remainingVertices,
                    std::size_t inputGraphEdgeCount,
                    std::size_t minTreeWidth)
-        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount)
+        : names_(std::move(vertexNames)), neighborhood_(std::move(neighborhood)), eliminationSequence_(std::move(eliminationSequence)), remainingVertices_(std::move(remainingVertices)), minTreeWidth_(minTreeWidth), edgeCount_(0), inputGraphEdgeCount_(inputGraphEdgeCount), components_()
     {
         updateEdgeCount();
     }
@@ -68,7 +70,7 @@ struct htd::PreprocessedGraph::Implementation
      *  @param[in] original  The original implementation details structure.
      */
     Implementation(const Implementation & original)
-        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_)
+        : names_(original.names_), neighborhood_(original.neighborhood_), eliminationSequence_(original.eliminationSequence_), remainingVertices_(original.remainingVertices_), minTreeWidth_(original.minTreeWidth_), edgeCount_(original.edgeCount_), inputGraphEdgeCount_(original.inputGraphEdgeCount_), components_()
     {
 
     }
@@ -113,11 +115,18 @@ struct htd::PreprocessedGraph::Implementation
      */
     std::size_t inputGraphEdgeCount_;
 
+    /**
+     *  The vertices of the connected components of the preprocessed graph, computed on demand and discarded by every modification.
+     */
+    mutable std::shared_ptr<const std::vector<std::vector<htd::vertex_t>>> components_;
+
     /**
      *  Recompute the number of edges in the graph to update the result of the function edgeCount().
      */
     void updateEdgeCount(void)
     {
+        components_.reset();
+
         edgeCount_ = 0;
 
         for (htd::vertex_t vertex : remainingVertices_)
@@ -407,6 +416,8 @@ void htd::PreprocessedGraph::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex));
 
+    implementation_->components_.reset();
+
     std::vector<htd::vertex_t> & selectedNeighborhood = implementation_->neighborhood_[vertex];
 
     implementation_->edgeCount_ -= selectedNeighborhood.size();
@@ -441,6 +452,8 @@ htd::vertex_t htd::PreprocessedGraph::vertexName(htd::vertex_t vertex) const
 
 std::vector<std::vector<htd::vertex_t>> & htd::PreprocessedGraph::neighborhood(void) HTD_NOEXCEPT
 {
+    implementation_->components_.reset();
+
     return implementation_->neighborhood_;
 }
 
@@ -453,6 +466,8 @@ std::vector<htd::vertex_t> & htd::PreprocessedGraph::neighborhood(htd::vertex_t
 {
     HTD_ASSERT(vertex < implementation_->names_.size());
 
+    implementation_->components_.reset();
+
     return implementation_->neighborhood_[vertex];
 }
 
@@ -470,6 +485,8 @@ void htd::PreprocessedGraph::updateEdgeCount(void)
 
 std::vector<htd::vertex_t> & htd::PreprocessedGraph::eliminationSequence(void) HTD_NOEXCEPT
 {
+    implementation_->components_.reset();
+
     return implementation_->eliminationSequence_;
 }
 
@@ -499,6 +516,8 @@ void htd::PreprocessedGraph::setRemainingVertices(std::vector<htd::vertex_t> &&
 
 std::size_t & htd::PreprocessedGraph::minTreeWidth(void) HTD_NOEXCEPT
 {
+    implementation_->components_.reset();
+
     return implementation_->minTreeWidth_;
 }
 
@@ -507,6 +526,76 @@ std::size_t htd::PreprocessedGraph::minTreeWidth(void) const HTD_NOEXCEPT
     return implementation_->minTreeWidth_;
 }
 
+std::shared_ptr<const std::vector<std::vector<htd::vertex_t>>> htd::PreprocessedGraph::components(void) const
+{
+    std::shared_ptr<const std::vector<std::vector<htd::vertex_t>>> ret = std::atomic_load(&(implementation_->components_));
+
+    if (ret == nullptr)
+    {
+        const std::vector<std::vector<htd::vertex_t>> & neighborhood = implementation_->neighborhood_;
+
+        const std::vector<htd::vertex_t> & remainingVertices = implementation_->remainingVertices_;
+
+        std::shared_ptr<std::vector<std::vector<htd::vertex_t>>> components = std::make_shared<std::vector<std::vector<htd::vertex_t>>>();
+
+        std::vector<bool> visited(neighborhood.size(), false);
+
+        for (auto it = remainingVertices.begin(); it != remainingVertices.end() && (components->empty() || (*components)[0].size() < remainingVertices.size()); ++it)
+        {
+            htd::vertex_t vertex = *it;
+
+            if (!visited[vertex])
+            {
+                components->emplace_back(1, vertex);
+
+                std::vector<htd::vertex_t> & component = components->back();
+
+                visited[vertex] = true;
+
+                for (htd::index_t index = 0; index < component.size(); ++index)
+                {
+                    for (htd::vertex_t neighbor : neighborhood[component[index]])
+                    {
+                        if (!visited[neighbor])
+                        {
+                            visited[neighbor] = true;
+
+                            component.push_back(neighbor);
+                        }
+                    }
+                }
+            }
+        }
+
+        /* A connected graph serves as its own component, hence there is nothing to gain from splitting it. */
+        if (components->size() > 1)
+        {
+            for (std::vector<htd::vertex_t> & component : *components)
+            {
+                std::sort(component.begin(), component.end());
+            }
+        }
+        else
+        {
+            components->clear();
+        }
+
+        std::shared_ptr<const std::vector<std::vector<htd::vertex_t>>> expected;
+
+        /* Concurrent callers may compute the components at the same time, the first result which is published wins. */
+        if (std::atomic_compare_exchange_strong(&(implementation_->components_), &expected, std::shared_ptr<const std::vector<std::vector<htd::vertex_t>>>(components)))
+        {
+            ret = components;
+        }
+        else
+        {
+            ret = expected;
+        }
+    }
+
+    return ret;
+}
+
 htd::PreprocessedGraph * htd::PreprocessedGraph::clone(void) const
 {
     return new htd::PreprocessedGraph(*this);
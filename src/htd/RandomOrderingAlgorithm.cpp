@@ -32,7 +32,6 @@
 #include <htd/VertexOrdering.hpp>
 
 #include <algorithm>
-#include <random>
 
 /**
  *  Private implementation details of class htd::NaturalOrderingAlgorithm.
@@ -106,15 +105,16 @@ htd::IVertexOrdering * htd::RandomOrderingAlgorithm::computeOrdering(const htd::
         vertex = preprocessedGraph.vertexName(vertex);
     });
 
-    /* Coverity complains about std::rand() being not safe for security related operations. We are happy with a pseudo-random number here. */
-    // coverity[dont_call]
-    std::mt19937 g(static_cast<std::mt19937::result_type>(std::rand()));
-
-    std::shuffle(middle, ordering.end(), g);
+    std::shuffle(middle, ordering.end(), implementation_->managementInstance_->randomNumberGenerator());
 
     return new htd::VertexOrdering(std::move(ordering), 1);
 }
 
+bool htd::RandomOrderingAlgorithm::supportsComponentOrdering(void) const HTD_NOEXCEPT
+{
+    return true;
+}
+
 const htd::LibraryInstance * htd::RandomOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
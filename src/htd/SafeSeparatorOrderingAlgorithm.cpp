@@ -0,0 +1,1045 @@
+/*
+ * File:   SafeSeparatorOrderingAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_SAFESEPARATORORDERINGALGORITHM_CPP
+#define HTD_HTD_SAFESEPARATORORDERINGALGORITHM_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/SafeSeparatorOrderingAlgorithm.hpp>
+#include <htd/EnhancedMaximumCardinalitySearchOrderingAlgorithm.hpp>
+#include <htd/GraphPreprocessorFactory.hpp>
+#include <htd/IGraphPreprocessor.hpp>
+#include <htd/MaximumCardinalitySearchOrderingAlgorithm.hpp>
+#include <htd/MultiHypergraph.hpp>
+#include <htd/OrderingAlgorithmFactory.hpp>
+#include <htd/PreprocessedGraph.hpp>
+#include <htd/VertexOrdering.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+/**
+ *  Private implementation details of class htd::SafeSeparatorOrderingAlgorithm.
+ */
+struct htd::SafeSeparatorOrderingAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), orderingAlgorithm_(manager->orderingAlgorithmFactory().createInstance())
+    {
+
+    }
+
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->clone())
+    {
+
+    }
+#else
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_), orderingAlgorithm_(original.orderingAlgorithm_->cloneOrderingAlgorithm())
+    {
+
+    }
+#endif
+
+    virtual ~Implementation()
+    {
+        delete orderingAlgorithm_;
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  The ordering algorithm which shall be used to compute the vertex elimination orderings of the atoms.
+     */
+    htd::IOrderingAlgorithm * orderingAlgorithm_;
+
+    /**
+     *  The maximum product of the number of vertices and the number of edges of an atom for which the minimal triangulation is computed.
+     *
+     *  The running time of MCS-M is quadratic for sparse graphs, hence larger atoms are only split at their articulation points.
+     */
+    static const std::size_t MAXIMUM_SEARCH_EFFORT = static_cast<std::size_t>(1) << 28;
+
+    /**
+     *  Internal data structure representing an induced subgraph of the preprocessed graph whose separator vertices may have been completed to a clique.
+     *
+     *  The vertices of an atom are identified by their positions within the sorted vertex set of the atom.
+     */
+    struct Atom
+    {
+        /**
+         *  The sorted set of vertices of the atom, given by their identifiers within the preprocessed graph.
+         */
+        std::vector<htd::vertex_t> vertices;
+
+        /**
+         *  The sorted neighborhood of each vertex of the atom, given by the positions of the neighbors within the atom.
+         */
+        std::vector<std::vector<htd::vertex_t>> neighborhood;
+    };
+
+    /**
+     *  Create the subgraph of an atom which is induced by a set of its vertices.
+     *
+     *  @param[in] atom             The atom.
+     *  @param[in] neighborhood     The neighborhood of each vertex of the atom.
+     *  @param[in] members          The sorted set of vertices of the atom which shall be part of the induced subgraph.
+     *  @param[in,out] positions    Temporary vector mapping each vertex of the atom to its position within the induced subgraph.
+     *
+     *  @return The induced subgraph.
+     */
+    Atom induceAtom(const Atom & atom, const std::vector<std::vector<htd::vertex_t>> & neighborhood, const std::vector<htd::index_t> & members, std::vector<htd::index_t> & positions) const
+    {
+        static const htd::index_t UNDEFINED = (htd::index_t)-1;
+
+        Atom ret;
+
+        std::size_t size = members.size();
+
+        ret.vertices.reserve(size);
+
+        ret.neighborhood.resize(size);
+
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            positions[members[index]] = index;
+
+            ret.vertices.push_back(atom.vertices[members[index]]);
+        }
+
+        /* The positions preserve the order of the vertices, hence the neighborhoods stay sorted. */
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = ret.neighborhood[index];
+
+            for (htd::index_t neighbor : neighborhood[members[index]])
+            {
+                if (positions[neighbor] != UNDEFINED)
+                {
+                    currentNeighborhood.push_back(positions[neighbor]);
+                }
+            }
+        }
+
+        for (htd::index_t vertex : members)
+        {
+            positions[vertex] = UNDEFINED;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Collect the vertices of the connected component which contains the given vertex.
+     *
+     *  @param[in] neighborhood     The neighborhood of each vertex of the atom.
+     *  @param[in] vertex           The vertex whose component shall be collected.
+     *  @param[in] removed          The vertices which were already removed from the atom.
+     *  @param[in,out] blocked      The stamp array identifying the vertices which must not be visited. The vertices of the component are marked with the given stamp.
+     *  @param[in] stamp            The stamp marking the blocked vertices.
+     *  @param[out] target          The vector to which the sorted vertices of the component shall be written.
+     */
+    void collectComponent(const std::vector<std::vector<htd::vertex_t>> & neighborhood, htd::index_t vertex, const std::vector<bool> & removed, std::vector<std::size_t> & blocked, std::size_t stamp, std::vector<htd::index_t> & target) const
+    {
+        target.clear();
+
+        target.push_back(vertex);
+
+        blocked[vertex] = stamp;
+
+        for (htd::index_t index = 0; index < target.size(); ++index)
+        {
+            for (htd::index_t neighbor : neighborhood[target[index]])
+            {
+                if (blocked[neighbor] != stamp && !removed[neighbor])
+                {
+                    blocked[neighbor] = stamp;
+
+                    target.push_back(neighbor);
+                }
+            }
+        }
+
+        std::sort(target.begin(), target.end());
+    }
+
+    /**
+     *  Check whether each vertex of a separator is adjacent to the given component.
+     *
+     *  @param[in] neighborhood     The neighborhood of each vertex of the atom.
+     *  @param[in] component        The vertices of the component.
+     *  @param[in] separator        The sorted set of vertices of the separator.
+     *  @param[in,out] stamps       The stamp array used to identify the separator vertices which were already found.
+     *  @param[in,out] stamp        The last stamp which was used. It is increased by this function.
+     *
+     *  @return True if each vertex of the separator is adjacent to the component, false otherwise.
+     */
+    bool isFullComponent(const std::vector<std::vector<htd::vertex_t>> & neighborhood, const std::vector<htd::index_t> & component, const std::vector<htd::index_t> & separator, std::vector<std::size_t> & stamps, std::size_t & stamp) const
+    {
+        ++stamp;
+
+        std::size_t adjacentVertexCount = 0;
+
+        for (htd::index_t vertex : component)
+        {
+            for (htd::index_t neighbor : neighborhood[vertex])
+            {
+                if (stamps[neighbor] != stamp && std::binary_search(separator.begin(), separator.end(), neighbor))
+                {
+                    stamps[neighbor] = stamp;
+
+                    ++adjacentVertexCount;
+                }
+            }
+        }
+
+        return adjacentVertexCount == separator.size();
+    }
+
+    /**
+     *  Check whether a set of vertices is a clique or an almost-clique.
+     *
+     *  @param[in] neighborhood     The neighborhood of each vertex of the atom.
+     *  @param[in] vertices         The set of vertices.
+     *  @param[in,out] stamps       The stamp array used to identify the members of the given set.
+     *  @param[in,out] stamp        The last stamp which was used. It is increased by this function.
+     *  @param[out] almostClique    A boolean flag which is set to true if the set of vertices is an almost-clique, but not a clique.
+     *
+     *  @return True if the set of vertices is a clique or an almost-clique, i.e., if removing one of its vertices yields a clique, false otherwise.
+     */
+    bool isAlmostClique(const std::vector<std::vector<htd::vertex_t>> & neighborhood, const std::vector<htd::index_t> & vertices, std::vector<std::size_t> & stamps, std::size_t & stamp, bool & almostClique) const
+    {
+        ++stamp;
+
+        for (htd::index_t vertex : vertices)
+        {
+            stamps[vertex] = stamp;
+        }
+
+        std::size_t size = vertices.size();
+
+        std::vector<std::size_t> degrees(size, 0);
+
+        std::size_t deficientVertexCount = 0;
+
+        htd::index_t specialVertex = 0;
+
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            for (htd::index_t neighbor : neighborhood[vertices[index]])
+            {
+                if (stamps[neighbor] == stamp)
+                {
+                    ++degrees[index];
+                }
+            }
+
+            if (degrees[index] + 1 < size)
+            {
+                ++deficientVertexCount;
+
+                if (deficientVertexCount == 1 || degrees[index] < degrees[specialVertex])
+                {
+                    specialVertex = index;
+                }
+            }
+        }
+
+        almostClique = deficientVertexCount > 0;
+
+        if (!almostClique)
+        {
+            return true;
+        }
+
+        /* All missing edges must be incident to the special vertex, hence every other deficient vertex misses exactly the edge to the special vertex. */
+        if (deficientVertexCount != size - degrees[specialVertex])
+        {
+            return false;
+        }
+
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            if (index != specialVertex && degrees[index] + 2 < size)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     *  Complete a set of vertices to a clique.
+     *
+     *  @param[in,out] neighborhood The neighborhood of each vertex of the atom.
+     *  @param[in] vertices         The sorted set of vertices.
+     */
+    void completeClique(std::vector<std::vector<htd::vertex_t>> & neighborhood, const std::vector<htd::index_t> & vertices) const
+    {
+        std::vector<htd::vertex_t> completedNeighborhood;
+
+        for (htd::index_t vertex : vertices)
+        {
+            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+            completedNeighborhood.clear();
+
+            std::set_union(currentNeighborhood.begin(), currentNeighborhood.end(), vertices.begin(), vertices.end(), std::back_inserter(completedNeighborhood));
+
+            completedNeighborhood.erase(std::lower_bound(completedNeighborhood.begin(), completedNeighborhood.end(), vertex));
+
+            currentNeighborhood.swap(completedNeighborhood);
+        }
+    }
+
+    /**
+     *  Split an atom into its biconnected components, i.e., along its clique separators of size at most one.
+     *
+     *  @param[in] atom     The atom which shall be split.
+     *  @param[out] target  The vector to which the parts of the atom shall be appended.
+     *
+     *  @return True if the atom was split, false otherwise.
+     */
+    bool splitAtArticulationPoints(const Atom & atom, std::vector<Atom> & target) const
+    {
+        static const htd::index_t UNDEFINED = (htd::index_t)-1;
+
+        std::size_t size = atom.vertices.size();
+
+        std::vector<htd::index_t> discoveryTimes(size, UNDEFINED);
+
+        std::vector<htd::index_t> lowPoints(size, 0);
+
+        std::size_t time = 0;
+
+        /* The depth-first search is performed iteratively, each stack entry stores a vertex and the index of the next neighbor to visit. */
+        std::vector<std::pair<htd::index_t, htd::index_t>> stack;
+
+        std::vector<htd::index_t> visitedVertices;
+
+        std::vector<std::vector<htd::index_t>> blocks;
+
+        for (htd::index_t root = 0; root < size; ++root)
+        {
+            if (discoveryTimes[root] == UNDEFINED)
+            {
+                discoveryTimes[root] = time;
+                lowPoints[root] = time;
+
+                ++time;
+
+                if (atom.neighborhood[root].empty())
+                {
+                    blocks.emplace_back(1, root);
+                }
+
+                stack.emplace_back(root, 0);
+
+                while (!stack.empty())
+                {
+                    htd::index_t vertex = stack.back().first;
+
+                    htd::index_t & nextNeighbor = stack.back().second;
+
+                    if (nextNeighbor < atom.neighborhood[vertex].size())
+                    {
+                        htd::index_t neighbor = atom.neighborhood[vertex][nextNeighbor];
+
+                        ++nextNeighbor;
+
+                        if (discoveryTimes[neighbor] == UNDEFINED)
+                        {
+                            discoveryTimes[neighbor] = time;
+                            lowPoints[neighbor] = time;
+
+                            ++time;
+
+                            visitedVertices.push_back(neighbor);
+
+                            stack.emplace_back(neighbor, 0);
+                        }
+                        else
+                        {
+                            lowPoints[vertex] = std::min(lowPoints[vertex], discoveryTimes[neighbor]);
+                        }
+                    }
+                    else
+                    {
+                        stack.pop_back();
+
+                        if (!stack.empty())
+                        {
+                            htd::index_t parent = stack.back().first;
+
+                            lowPoints[parent] = std::min(lowPoints[parent], lowPoints[vertex]);
+
+                            /* The parent separates the vertices visited since the current vertex from the rest of the graph. */
+                            if (lowPoints[vertex] >= discoveryTimes[parent])
+                            {
+                                blocks.emplace_back(1, parent);
+
+                                std::vector<htd::index_t> & block = blocks.back();
+
+                                htd::index_t member = UNDEFINED;
+
+                                while (member != vertex)
+                                {
+                                    member = visitedVertices.back();
+
+                                    visitedVertices.pop_back();
+
+                                    block.push_back(member);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        if (blocks.size() < 2)
+        {
+            return false;
+        }
+
+        std::vector<htd::index_t> localPositions(size, UNDEFINED);
+
+        for (std::vector<htd::index_t> & block : blocks)
+        {
+            std::sort(block.begin(), block.end());
+
+            target.push_back(induceAtom(atom, atom.neighborhood, block, localPositions));
+        }
+
+        return true;
+    }
+
+    /**
+     *  Split an atom along its safe separators.
+     *
+     *  The minimal separators of the minimal triangulation computed by MCS-M are the sets of neighbors eliminated
+     *  later of the generators of the ordering. Since these separators do not cross each other, the atom can be
+     *  split along all of them which are cliques or almost-cliques in a single pass, following the atom computation
+     *  of Berry, Pogorelcnik and Simonet: Each separator splits off the component of its generator. An almost-clique
+     *  separator is completed to a clique in the remaining graph once it was used. Completing a separator which is
+     *  not safe only affects the width of the result, but never its validity.
+     *
+     *  Atoms which are too large for the computation of a minimal triangulation are only split at their articulation points.
+     *
+     *  @param[in] graph    The input graph.
+     *  @param[in] atom     The atom which shall be split.
+     *  @param[out] target  The vector to which the parts of the atom shall be appended.
+     *
+     *  @return True if the atom was split, false otherwise.
+     */
+    bool split(const htd::IMultiHypergraph & graph, const Atom & atom, std::vector<Atom> & target) const
+    {
+        std::size_t size = atom.vertices.size();
+
+        if (size < 2)
+        {
+            return false;
+        }
+
+        std::size_t edgeCount = 0;
+
+        for (const std::vector<htd::vertex_t> & currentNeighborhood : atom.neighborhood)
+        {
+            edgeCount += currentNeighborhood.size();
+        }
+
+        if (size * (edgeCount / 2) > MAXIMUM_SEARCH_EFFORT)
+        {
+            return splitAtArticulationPoints(atom, target);
+        }
+
+        std::vector<htd::vertex_t> atomVertices(size);
+
+        std::iota(atomVertices.begin(), atomVertices.end(), 0);
+
+        htd::PreprocessedGraph atomGraph(std::vector<htd::vertex_t>(atomVertices),
+                                         std::vector<std::vector<htd::vertex_t>>(atom.neighborhood),
+                                         std::vector<htd::vertex_t>(),
+                                         std::move(atomVertices),
+                                         0,
+                                         0);
+
+        htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(managementInstance_);
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, atomGraph, fillEdges);
+
+        std::vector<htd::index_t> sequence(ordering->sequence().begin(), ordering->sequence().end());
+
+        delete ordering;
+
+        std::vector<htd::index_t> positions(size);
+
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            positions[sequence[index]] = index;
+        }
+
+        /* The neighbors of each vertex within the minimal triangulation which are eliminated later. */
+        std::vector<std::vector<htd::index_t>> higherNeighbors(size);
+
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            for (htd::index_t neighbor : atom.neighborhood[vertex])
+            {
+                if (positions[neighbor] > positions[vertex])
+                {
+                    higherNeighbors[vertex].push_back(neighbor);
+                }
+            }
+        }
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+        {
+            if (positions[fillEdge.first] < positions[fillEdge.second])
+            {
+                higherNeighbors[fillEdge.first].push_back(fillEdge.second);
+            }
+            else
+            {
+                higherNeighbors[fillEdge.second].push_back(fillEdge.first);
+            }
+        }
+
+        for (std::vector<htd::index_t> & currentNeighbors : higherNeighbors)
+        {
+            std::sort(currentNeighbors.begin(), currentNeighbors.end());
+        }
+
+        /* The neighborhoods of the remaining graph, including the edges completing the almost-clique separators used so far. */
+        std::vector<std::vector<htd::vertex_t>> neighborhood(atom.neighborhood);
+
+        std::vector<std::size_t> stamps(size, 0);
+
+        std::vector<std::size_t> componentStamps(size, 0);
+
+        std::size_t stamp = 0;
+
+        std::size_t componentStamp = 0;
+
+        std::vector<bool> removed(size, false);
+
+        std::size_t remainingCount = size;
+
+        std::vector<htd::index_t> component;
+
+        std::vector<htd::index_t> members;
+
+        std::vector<htd::index_t> localPositions(size, (htd::index_t)-1);
+
+        /* A vertex is a generator if the number of its higher neighbors does not exceed the one of its successor, which is numbered before it by MCS-M. */
+        for (htd::index_t index = 0; index + 1 < size && !managementInstance_->isTerminated(); ++index)
+        {
+            htd::index_t vertex = sequence[index];
+
+            const std::vector<htd::index_t> & separator = higherNeighbors[vertex];
+
+            bool almostClique = false;
+
+            if (!removed[vertex] &&
+                separator.size() <= higherNeighbors[sequence[index + 1]].size() &&
+                std::none_of(separator.begin(), separator.end(), [&](htd::index_t neighbor) { return removed[neighbor]; }) &&
+                isAlmostClique(neighborhood, separator, stamps, stamp, almostClique))
+            {
+                ++componentStamp;
+
+                for (htd::index_t neighbor : separator)
+                {
+                    componentStamps[neighbor] = componentStamp;
+                }
+
+                collectComponent(neighborhood, vertex, removed, componentStamps, componentStamp, component);
+
+                bool safe = component.size() + separator.size() < remainingCount;
+
+                /* An almost-clique is only safe if it is a minimal separator. The component of the parent clique of the generator within the minimal triangulation is full, hence it suffices to check the component of the generator. */
+                if (safe && almostClique)
+                {
+                    safe = isFullComponent(neighborhood, component, separator, stamps, stamp);
+
+                    if (safe)
+                    {
+                        completeClique(neighborhood, separator);
+                    }
+                }
+
+                if (safe)
+                {
+                    members.clear();
+
+                    std::set_union(component.begin(), component.end(), separator.begin(), separator.end(), std::back_inserter(members));
+
+                    target.push_back(induceAtom(atom, neighborhood, members, localPositions));
+
+                    for (htd::index_t member : component)
+                    {
+                        removed[member] = true;
+                    }
+
+                    remainingCount -= component.size();
+                }
+            }
+        }
+
+        if (remainingCount == size)
+        {
+            return false;
+        }
+
+        members.clear();
+
+        for (htd::index_t vertex = 0; vertex < size; ++vertex)
+        {
+            if (!removed[vertex])
+            {
+                members.push_back(vertex);
+            }
+        }
+
+        target.push_back(induceAtom(atom, neighborhood, members, localPositions));
+
+        return true;
+    }
+
+    /**
+     *  Compute the edges of the triangulation of an atom which is induced by a vertex elimination ordering.
+     *
+     *  @param[in] atom         The atom.
+     *  @param[in] sequence     The vertex elimination ordering of the atom, given by the positions of the vertices within the atom.
+     *  @param[out] target      The vector to which the edges of the triangulation shall be appended. The edges refer to the identifiers of the vertices within the preprocessed graph.
+     */
+    void triangulate(const Atom & atom, const std::vector<htd::vertex_t> & sequence, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & target) const
+    {
+        std::size_t size = atom.vertices.size();
+
+        std::vector<htd::index_t> positions(size);
+
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            positions[sequence[index]] = index;
+        }
+
+        std::vector<std::vector<htd::vertex_t>> neighborhood(atom.neighborhood);
+
+        std::vector<std::size_t> stamps(size, 0);
+
+        std::vector<htd::index_t> higherNeighbors;
+
+        /* The neighbors eliminated later are passed on to the first of them, which avoids materializing the cliques of the eliminated vertices. */
+        for (htd::index_t index = 0; index < size; ++index)
+        {
+            htd::index_t vertex = sequence[index];
+
+            higherNeighbors.clear();
+
+            htd::index_t firstNeighbor = vertex;
+
+            for (htd::index_t neighbor : neighborhood[vertex])
+            {
+                if (positions[neighbor] > index && stamps[neighbor] != index + 1)
+                {
+                    stamps[neighbor] = index + 1;
+
+                    higherNeighbors.push_back(neighbor);
+
+                    if (firstNeighbor == vertex || positions[neighbor] < positions[firstNeighbor])
+                    {
+                        firstNeighbor = neighbor;
+                    }
+                }
+            }
+
+            for (htd::index_t neighbor : higherNeighbors)
+            {
+                target.emplace_back(atom.vertices[vertex], atom.vertices[neighbor]);
+
+                if (neighbor != firstNeighbor)
+                {
+                    neighborhood[firstNeighbor].push_back(neighbor);
+                }
+            }
+
+            std::vector<htd::vertex_t>().swap(neighborhood[vertex]);
+        }
+    }
+};
+
+const std::size_t htd::SafeSeparatorOrderingAlgorithm::Implementation::MAXIMUM_SEARCH_EFFORT;
+
+htd::SafeSeparatorOrderingAlgorithm::SafeSeparatorOrderingAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::SafeSeparatorOrderingAlgorithm::SafeSeparatorOrderingAlgorithm(const htd::SafeSeparatorOrderingAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::SafeSeparatorOrderingAlgorithm::~SafeSeparatorOrderingAlgorithm()
+{
+
+}
+
+htd::IVertexOrdering * htd::SafeSeparatorOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph) const HTD_NOEXCEPT
+{
+    htd::IGraphPreprocessor * preprocessor = implementation_->managementInstance_->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::IVertexOrdering * ret = computeOrdering(graph, *preprocessedGraph);
+
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+htd::IVertexOrdering * htd::SafeSeparatorOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
+{
+    std::vector<std::vector<htd::vertex_t>> atoms;
+
+    return computeOrdering(graph, preprocessedGraph, atoms);
+}
+
+htd::IVertexOrdering * htd::SafeSeparatorOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & atoms) const HTD_NOEXCEPT
+{
+    typedef htd::SafeSeparatorOrderingAlgorithm::Implementation::Atom Atom;
+
+    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+
+    const std::vector<std::vector<htd::vertex_t>> & neighborhood = preprocessedGraph.neighborhood();
+
+    std::vector<Atom> pendingAtoms(1);
+
+    Atom & initialAtom = pendingAtoms.back();
+
+    initialAtom.vertices.assign(preprocessedGraph.remainingVertices().begin(), preprocessedGraph.remainingVertices().end());
+
+    std::sort(initialAtom.vertices.begin(), initialAtom.vertices.end());
+
+    initialAtom.neighborhood.resize(initialAtom.vertices.size());
+
+    std::vector<htd::index_t> localIndices(neighborhood.size());
+
+    for (htd::index_t index = 0; index < initialAtom.vertices.size(); ++index)
+    {
+        localIndices[initialAtom.vertices[index]] = index;
+    }
+
+    /* The local identifiers preserve the order of the vertices, hence the neighborhoods stay sorted. */
+    for (htd::index_t index = 0; index < initialAtom.vertices.size(); ++index)
+    {
+        for (htd::vertex_t neighbor : neighborhood[initialAtom.vertices[index]])
+        {
+            initialAtom.neighborhood[index].push_back(localIndices[neighbor]);
+        }
+    }
+
+    std::vector<Atom> finalAtoms;
+
+    while (!pendingAtoms.empty())
+    {
+        Atom atom(std::move(pendingAtoms.back()));
+
+        pendingAtoms.pop_back();
+
+        if (managementInstance.isTerminated() || !implementation_->split(graph, atom, pendingAtoms))
+        {
+            finalAtoms.push_back(std::move(atom));
+        }
+    }
+
+    for (const Atom & atom : finalAtoms)
+    {
+        atoms.emplace_back();
+
+        std::vector<htd::vertex_t> & currentAtom = atoms.back();
+
+        for (htd::vertex_t vertex : atom.vertices)
+        {
+            currentAtom.push_back(preprocessedGraph.vertexName(vertex));
+        }
+
+        std::sort(currentAtom.begin(), currentAtom.end());
+    }
+
+    std::size_t atomCount = finalAtoms.size();
+
+    if (atomCount < 2)
+    {
+        return implementation_->orderingAlgorithm_->computeOrdering(graph, preprocessedGraph);
+    }
+
+    std::vector<htd::index_t> schedule(atomCount);
+
+    std::iota(schedule.begin(), schedule.end(), 0);
+
+    std::stable_sort(schedule.begin(), schedule.end(), [&](htd::index_t index1, htd::index_t index2)
+    {
+        return finalAtoms[index1].vertices.size() > finalAtoms[index2].vertices.size();
+    });
+
+    std::vector<std::vector<std::pair<htd::vertex_t, htd::vertex_t>>> triangulations(atomCount);
+
+    std::vector<std::size_t> requiredIterations(atomCount, 0);
+
+    std::atomic<std::size_t> nextAtom(0);
+
+    std::atomic<bool> supported(true);
+
+    htd::RandomNumberGenerator randomNumberGenerator = managementInstance.randomNumberGenerator().fork();
+
+    auto worker = [&](const htd::IOrderingAlgorithm & algorithm)
+    {
+        for (std::size_t position = nextAtom++; position < atomCount && supported && !managementInstance.isTerminated(); position = nextAtom++)
+        {
+            htd::index_t atomIndex = schedule[position];
+
+            const Atom & atom = finalAtoms[atomIndex];
+
+            std::size_t size = atom.vertices.size();
+
+            std::vector<std::pair<htd::vertex_t, htd::vertex_t>> atomEdges;
+
+            for (htd::index_t index = 0; index < size; ++index)
+            {
+                for (htd::vertex_t neighbor : atom.neighborhood[index])
+                {
+                    if (neighbor > index)
+                    {
+                        atomEdges.emplace_back(static_cast<htd::vertex_t>(index + htd::Vertex::FIRST), neighbor + htd::Vertex::FIRST);
+                    }
+                }
+            }
+
+            /* The ordering algorithms may access the input graph as well, hence the atom is also provided as a graph of its own. */
+            htd::MultiHypergraph atomInputGraph(&managementInstance, size);
+
+            atomInputGraph.addEdges(atomEdges);
+
+            std::vector<htd::vertex_t> atomVertexNames(size);
+
+            std::iota(atomVertexNames.begin(), atomVertexNames.end(), htd::Vertex::FIRST);
+
+            std::vector<htd::vertex_t> atomVertices(size);
+
+            std::iota(atomVertices.begin(), atomVertices.end(), 0);
+
+            htd::PreprocessedGraph atomGraph(std::move(atomVertexNames),
+                                             std::vector<std::vector<htd::vertex_t>>(atom.neighborhood),
+                                             std::vector<htd::vertex_t>(),
+                                             std::move(atomVertices),
+                                             atomInputGraph.edgeCount(),
+                                             preprocessedGraph.minTreeWidth());
+
+            htd::RandomNumberGenerator atomRandomNumberGenerator = randomNumberGenerator.substream(atomIndex);
+
+            htd::IVertexOrdering * ordering = nullptr;
+
+            {
+                htd::RandomNumberGeneratorBinding randomNumberGeneratorBinding(managementInstance, atomRandomNumberGenerator);
+
+                ordering = algorithm.computeOrdering(atomInputGraph, atomGraph);
+            }
+
+            /* Ordering algorithms which ignore the given graphs, e.g., because they return a static ordering, do not produce a result restricted to the atom. */
+            if (ordering == nullptr || ordering->sequence().size() != size)
+            {
+                supported = false;
+            }
+            else
+            {
+                /* The positions of the vertices within the atom. */
+                std::vector<htd::vertex_t> sequence;
+
+                sequence.reserve(size);
+
+                for (htd::vertex_t vertex : ordering->sequence())
+                {
+                    if (vertex < htd::Vertex::FIRST || vertex - htd::Vertex::FIRST >= size)
+                    {
+                        supported = false;
+
+                        break;
+                    }
+
+                    sequence.push_back(vertex - htd::Vertex::FIRST);
+                }
+
+                if (sequence.size() == size)
+                {
+                    implementation_->triangulate(atom, sequence, triangulations[atomIndex]);
+
+                    requiredIterations[atomIndex] = ordering->requiredIterations();
+                }
+            }
+
+            delete ordering;
+        }
+    };
+
+    std::size_t workerCount = std::min(managementInstance.threadCount(), atomCount);
+
+    std::vector<htd::IOrderingAlgorithm *> algorithms;
+
+    for (std::size_t index = 1; index < workerCount; ++index)
+    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+        algorithms.push_back(implementation_->orderingAlgorithm_->clone());
+#else
+        algorithms.push_back(implementation_->orderingAlgorithm_->cloneOrderingAlgorithm());
+#endif
+    }
+
+    htd::parallelInvoke(workerCount, [&](std::size_t threadIndex)
+    {
+        worker(threadIndex == 0 ? *(implementation_->orderingAlgorithm_) : *(algorithms[threadIndex - 1]));
+    });
+
+    for (htd::IOrderingAlgorithm * algorithm : algorithms)
+    {
+        delete algorithm;
+    }
+
+    if (!supported)
+    {
+        return implementation_->orderingAlgorithm_->computeOrdering(graph, preprocessedGraph);
+    }
+
+    /* The union of the triangulations of the atoms is a triangulation of the preprocessed graph. */
+    std::vector<std::vector<htd::vertex_t>> triangulatedNeighborhood(neighborhood.size());
+
+    for (std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & triangulation : triangulations)
+    {
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : triangulation)
+        {
+            triangulatedNeighborhood[edge.first].push_back(edge.second);
+            triangulatedNeighborhood[edge.second].push_back(edge.first);
+        }
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>>().swap(triangulation);
+    }
+
+    for (std::vector<htd::vertex_t> & currentNeighborhood : triangulatedNeighborhood)
+    {
+        std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+
+        currentNeighborhood.erase(std::unique(currentNeighborhood.begin(), currentNeighborhood.end()), currentNeighborhood.end());
+    }
+
+    std::vector<htd::vertex_t> vertexNames;
+    vertexNames.reserve(neighborhood.size());
+
+    for (htd::vertex_t vertex = 0; vertex < neighborhood.size(); ++vertex)
+    {
+        vertexNames.push_back(preprocessedGraph.vertexName(vertex));
+    }
+
+    htd::PreprocessedGraph triangulatedGraph(std::move(vertexNames),
+                                             std::move(triangulatedNeighborhood),
+                                             std::vector<htd::vertex_t>(preprocessedGraph.eliminationSequence().begin(), preprocessedGraph.eliminationSequence().end()),
+                                             std::vector<htd::vertex_t>(preprocessedGraph.remainingVertices().begin(), preprocessedGraph.remainingVertices().end()),
+                                             preprocessedGraph.inputGraphEdgeCount(),
+                                             preprocessedGraph.minTreeWidth());
+
+    htd::MaximumCardinalitySearchOrderingAlgorithm algorithm(implementation_->managementInstance_);
+
+    htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, triangulatedGraph);
+
+    std::vector<htd::vertex_t> sequence(ordering->sequence().begin(), ordering->sequence().end());
+
+    delete ordering;
+
+    return new htd::VertexOrdering(std::move(sequence), *std::max_element(requiredIterations.begin(), requiredIterations.end()));
+}
+
+bool htd::SafeSeparatorOrderingAlgorithm::supportsComponentOrdering(void) const HTD_NOEXCEPT
+{
+    return implementation_->orderingAlgorithm_->supportsComponentOrdering();
+}
+
+const htd::LibraryInstance * htd::SafeSeparatorOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::SafeSeparatorOrderingAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+void htd::SafeSeparatorOrderingAlgorithm::setOrderingAlgorithm(htd::IOrderingAlgorithm * algorithm)
+{
+    HTD_ASSERT(algorithm != nullptr)
+
+    delete implementation_->orderingAlgorithm_;
+
+    implementation_->orderingAlgorithm_ = algorithm;
+}
+
+htd::SafeSeparatorOrderingAlgorithm * htd::SafeSeparatorOrderingAlgorithm::clone(void) const
+{
+    return new htd::SafeSeparatorOrderingAlgorithm(*this);
+}
+
+#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+htd::IOrderingAlgorithm * htd::SafeSeparatorOrderingAlgorithm::cloneOrderingAlgorithm(void) const
+{
+    return new htd::SafeSeparatorOrderingAlgorithm(*this);
+}
+#endif
+
+#endif /* HTD_HTD_SAFESEPARATORORDERINGALGORITHM_CPP */
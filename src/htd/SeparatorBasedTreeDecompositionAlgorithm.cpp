@@ -227,7 +227,7 @@ htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::compute
             {
                 htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(ret->bagContent(vertex)), *labelCollection);
 
                 delete labelCollection;
 
@@ -241,7 +241,7 @@ htd::ITreeDecomposition * htd::SeparatorBasedTreeDecompositionAlgorithm::compute
             {
                 htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
-                htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+                htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(ret->bagContent(vertex)), *labelCollection);
 
                 delete labelCollection;
 
@@ -0,0 +1,478 @@
+/*
+ * File:   SetKernels.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_SETKERNELS_CPP
+#define HTD_HTD_SETKERNELS_CPP
+
+#include <htd/Globals.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/SetKernels.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define HTD_SET_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace
+{
+    /**
+     *  Ratio of the sizes of two sets from which on galloping search is used instead of merging.
+     */
+    const std::size_t GALLOPING_THRESHOLD = 32;
+
+    /**
+     *  Find the first position in a sorted range whose vertex is not less than the given vertex, starting with steps
+     *  of exponentially increasing size.
+     *
+     *  @param[in] first    A pointer to the first vertex of the range.
+     *  @param[in] last     A pointer past the last vertex of the range.
+     *  @param[in] vertex   The vertex which shall be found.
+     *
+     *  @return A pointer to the first vertex which is not less than the given vertex.
+     */
+    const htd::vertex_t * gallop(const htd::vertex_t * first, const htd::vertex_t * last, htd::vertex_t vertex)
+    {
+        std::size_t step = 1;
+
+        const htd::vertex_t * lower = first;
+
+        while (first + step < last && first[step] < vertex)
+        {
+            lower = first + step;
+
+            step <<= 1;
+        }
+
+        return std::lower_bound(lower, std::min(first + step + 1, last), vertex);
+    }
+
+    /**
+     *  Intersect a small set with a considerably larger set via galloping search.
+     *
+     *  @param[in] first1       A pointer to the first vertex of the smaller set.
+     *  @param[in] last1        A pointer past the last vertex of the smaller set.
+     *  @param[in] first2       A pointer to the first vertex of the larger set.
+     *  @param[in] last2        A pointer past the last vertex of the larger set.
+     *  @param[in] stopEarly    A boolean flag whether the computation shall stop after the first common vertex.
+     *
+     *  @return The number of common vertices.
+     */
+    std::size_t gallopingIntersectionSize(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                          const htd::vertex_t * first2, const htd::vertex_t * last2,
+                                          bool stopEarly)
+    {
+        std::size_t ret = 0;
+
+        while (first1 != last1 && first2 != last2 && !(stopEarly && ret > 0))
+        {
+            first2 = gallop(first2, last2, *first1);
+
+            if (first2 != last2 && *first2 == *first1)
+            {
+                ++ret;
+
+                ++first2;
+            }
+
+            ++first1;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Intersect two sets by merging them.
+     *
+     *  @param[in] first1       A pointer to the first vertex of the first set.
+     *  @param[in] last1        A pointer past the last vertex of the first set.
+     *  @param[in] first2       A pointer to the first vertex of the second set.
+     *  @param[in] last2        A pointer past the last vertex of the second set.
+     *  @param[in] stopEarly    A boolean flag whether the computation shall stop after the first common vertex.
+     *
+     *  @return The number of common vertices.
+     */
+    std::size_t scalarIntersectionSize(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                       const htd::vertex_t * first2, const htd::vertex_t * last2,
+                                       bool stopEarly)
+    {
+        std::size_t ret = 0;
+
+        while (first1 != last1 && first2 != last2 && !(stopEarly && ret > 0))
+        {
+            htd::vertex_t vertex1 = *first1;
+            htd::vertex_t vertex2 = *first2;
+
+            ret += vertex1 == vertex2;
+
+            first1 += vertex1 <= vertex2;
+            first2 += vertex2 <= vertex1;
+        }
+
+        return ret;
+    }
+
+#ifdef HTD_SET_KERNELS_X86
+    /**
+     *  Type tag describing the width of the vertex identifiers in bytes.
+     */
+    typedef std::integral_constant<std::size_t, sizeof(htd::vertex_t)> VertexWidth;
+
+    /**
+     *  Count the lanes of a 128-bit block of 32-bit vertices which are also found in a second block.
+     *
+     *  @param[in] block1   The first block.
+     *  @param[in] block2   The second block.
+     *
+     *  @return The number of lanes of the first block which are also found in the second block.
+     */
+    __attribute__((target("sse4.2")))
+    inline std::size_t sseMatchCount(__m128i block1, __m128i block2, std::integral_constant<std::size_t, 4>)
+    {
+        __m128i matches = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(block1, block2),
+                                                    _mm_cmpeq_epi32(block1, _mm_shuffle_epi32(block2, 0x39))),
+                                       _mm_or_si128(_mm_cmpeq_epi32(block1, _mm_shuffle_epi32(block2, 0x4E)),
+                                                    _mm_cmpeq_epi32(block1, _mm_shuffle_epi32(block2, 0x93))));
+
+        return htd::popcount(static_cast<std::uint64_t>(_mm_movemask_ps(_mm_castsi128_ps(matches))));
+    }
+
+    /**
+     *  Count the lanes of a 128-bit block of 64-bit vertices which are also found in a second block.
+     *
+     *  @param[in] block1   The first block.
+     *  @param[in] block2   The second block.
+     *
+     *  @return The number of lanes of the first block which are also found in the second block.
+     */
+    __attribute__((target("sse4.2")))
+    inline std::size_t sseMatchCount(__m128i block1, __m128i block2, std::integral_constant<std::size_t, 8>)
+    {
+        __m128i matches = _mm_or_si128(_mm_cmpeq_epi64(block1, block2),
+                                       _mm_cmpeq_epi64(block1, _mm_shuffle_epi32(block2, 0x4E)));
+
+        return htd::popcount(static_cast<std::uint64_t>(_mm_movemask_pd(_mm_castsi128_pd(matches))));
+    }
+
+    /**
+     *  Count the lanes of a 256-bit block of 32-bit vertices which are also found in a second block.
+     *
+     *  @param[in] block1   The first block.
+     *  @param[in] block2   The second block.
+     *
+     *  @return The number of lanes of the first block which are also found in the second block.
+     */
+    __attribute__((target("avx2")))
+    inline std::size_t avxMatchCount(__m256i block1, __m256i block2, std::integral_constant<std::size_t, 4>)
+    {
+        __m256i rotation = _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 0);
+
+        __m256i matches = _mm256_cmpeq_epi32(block1, block2);
+
+        for (int step = 1; step < 8; ++step)
+        {
+            block2 = _mm256_permutevar8x32_epi32(block2, rotation);
+
+            matches = _mm256_or_si256(matches, _mm256_cmpeq_epi32(block1, block2));
+        }
+
+        return htd::popcount(static_cast<std::uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(matches))));
+    }
+
+    /**
+     *  Count the lanes of a 256-bit block of 64-bit vertices which are also found in a second block.
+     *
+     *  @param[in] block1   The first block.
+     *  @param[in] block2   The second block.
+     *
+     *  @return The number of lanes of the first block which are also found in the second block.
+     */
+    __attribute__((target("avx2")))
+    inline std::size_t avxMatchCount(__m256i block1, __m256i block2, std::integral_constant<std::size_t, 8>)
+    {
+        __m256i matches = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi64(block1, block2),
+                                                          _mm256_cmpeq_epi64(block1, _mm256_permute4x64_epi64(block2, 0x39))),
+                                          _mm256_or_si256(_mm256_cmpeq_epi64(block1, _mm256_permute4x64_epi64(block2, 0x4E)),
+                                                          _mm256_cmpeq_epi64(block1, _mm256_permute4x64_epi64(block2, 0x93))));
+
+        return htd::popcount(static_cast<std::uint64_t>(_mm256_movemask_pd(_mm256_castsi256_pd(matches))));
+    }
+
+    /**
+     *  Intersect two sets by comparing 128-bit blocks of both sets at once.
+     *
+     *  @param[in] first1       A pointer to the first vertex of the first set.
+     *  @param[in] last1        A pointer past the last vertex of the first set.
+     *  @param[in] first2       A pointer to the first vertex of the second set.
+     *  @param[in] last2        A pointer past the last vertex of the second set.
+     *  @param[in] stopEarly    A boolean flag whether the computation shall stop after the first common vertex.
+     *
+     *  @return The number of common vertices.
+     */
+    __attribute__((target("sse4.2")))
+    std::size_t sseIntersectionSize(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                    const htd::vertex_t * first2, const htd::vertex_t * last2,
+                                    bool stopEarly)
+    {
+        const std::ptrdiff_t lanes = sizeof(__m128i) / sizeof(htd::vertex_t);
+
+        std::size_t ret = 0;
+
+        if (last1 - first1 >= lanes && last2 - first2 >= lanes)
+        {
+            const htd::vertex_t * blockEnd1 = first1 + ((last1 - first1) / lanes) * lanes;
+            const htd::vertex_t * blockEnd2 = first2 + ((last2 - first2) / lanes) * lanes;
+
+            while (first1 != blockEnd1 && first2 != blockEnd2 && !(stopEarly && ret > 0))
+            {
+                ret += sseMatchCount(_mm_loadu_si128(reinterpret_cast<const __m128i *>(first1)),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(first2)),
+                                     VertexWidth());
+
+                htd::vertex_t maximum1 = first1[lanes - 1];
+                htd::vertex_t maximum2 = first2[lanes - 1];
+
+                first1 += (maximum1 <= maximum2) * lanes;
+                first2 += (maximum2 <= maximum1) * lanes;
+            }
+        }
+
+        if (!(stopEarly && ret > 0))
+        {
+            ret += scalarIntersectionSize(first1, last1, first2, last2, stopEarly);
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Intersect two sets by comparing 256-bit blocks of both sets at once.
+     *
+     *  @param[in] first1       A pointer to the first vertex of the first set.
+     *  @param[in] last1        A pointer past the last vertex of the first set.
+     *  @param[in] first2       A pointer to the first vertex of the second set.
+     *  @param[in] last2        A pointer past the last vertex of the second set.
+     *  @param[in] stopEarly    A boolean flag whether the computation shall stop after the first common vertex.
+     *
+     *  @return The number of common vertices.
+     */
+    __attribute__((target("avx2")))
+    std::size_t avxIntersectionSize(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                    const htd::vertex_t * first2, const htd::vertex_t * last2,
+                                    bool stopEarly)
+    {
+        const std::ptrdiff_t lanes = sizeof(__m256i) / sizeof(htd::vertex_t);
+
+        std::size_t ret = 0;
+
+        if (last1 - first1 >= lanes && last2 - first2 >= lanes)
+        {
+            const htd::vertex_t * blockEnd1 = first1 + ((last1 - first1) / lanes) * lanes;
+            const htd::vertex_t * blockEnd2 = first2 + ((last2 - first2) / lanes) * lanes;
+
+            while (first1 != blockEnd1 && first2 != blockEnd2 && !(stopEarly && ret > 0))
+            {
+                ret += avxMatchCount(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(first1)),
+                                     _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first2)),
+                                     VertexWidth());
+
+                htd::vertex_t maximum1 = first1[lanes - 1];
+                htd::vertex_t maximum2 = first2[lanes - 1];
+
+                first1 += (maximum1 <= maximum2) * lanes;
+                first2 += (maximum2 <= maximum1) * lanes;
+            }
+        }
+
+        if (!(stopEarly && ret > 0))
+        {
+            ret += sseIntersectionSize(first1, last1, first2, last2, stopEarly);
+        }
+
+        return ret;
+    }
+#endif
+
+    /**
+     *  Signature of the kernel implementations.
+     */
+    typedef std::size_t (*IntersectionKernel)(const htd::vertex_t *, const htd::vertex_t *, const htd::vertex_t *, const htd::vertex_t *, bool);
+
+    /**
+     *  Getter for the function implementing a specific kernel.
+     *
+     *  @param[in] kernel   The kernel implementation.
+     *
+     *  @return The function implementing the given kernel.
+     */
+    IntersectionKernel intersectionKernel(htd::SetKernel kernel)
+    {
+#ifdef HTD_SET_KERNELS_X86
+        switch (kernel)
+        {
+            case htd::SetKernel::AVX2:
+            {
+                return &avxIntersectionSize;
+            }
+            case htd::SetKernel::SSE4_2:
+            {
+                return &sseIntersectionSize;
+            }
+            default:
+            {
+                return &scalarIntersectionSize;
+            }
+        }
+#else
+        HTD_UNUSED(kernel)
+
+        return &scalarIntersectionSize;
+#endif
+    }
+
+    /**
+     *  Determine the best kernel implementation supported by the CPU.
+     *
+     *  @return The best kernel implementation supported by the CPU.
+     */
+    htd::SetKernel detectSetKernel(void)
+    {
+        htd::SetKernel ret = htd::SetKernel::SCALAR;
+
+        if (htd::isSetKernelSupported(htd::SetKernel::AVX2))
+        {
+            ret = htd::SetKernel::AVX2;
+        }
+        else if (htd::isSetKernelSupported(htd::SetKernel::SSE4_2))
+        {
+            ret = htd::SetKernel::SSE4_2;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Getter for the function implementing the active kernel.
+     *
+     *  @note The kernel is selected on first use, so that the set operations may safely be called during static initialization.
+     *
+     *  @return The function implementing the active kernel.
+     */
+    IntersectionKernel activeIntersectionKernel(void)
+    {
+        static const IntersectionKernel ret = intersectionKernel(htd::activeSetKernel());
+
+        return ret;
+    }
+
+    /**
+     *  Compute the number of common vertices of two sets using a specific kernel function.
+     *
+     *  @param[in] first1       A pointer to the first vertex of the first set.
+     *  @param[in] last1        A pointer past the last vertex of the first set.
+     *  @param[in] first2       A pointer to the first vertex of the second set.
+     *  @param[in] last2        A pointer past the last vertex of the second set.
+     *  @param[in] stopEarly    A boolean flag whether the computation shall stop after the first common vertex.
+     *  @param[in] function     The kernel function.
+     *
+     *  @return The number of common vertices.
+     */
+    std::size_t intersectionSize(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                 const htd::vertex_t * first2, const htd::vertex_t * last2,
+                                 bool stopEarly, IntersectionKernel function)
+    {
+        std::size_t size1 = static_cast<std::size_t>(last1 - first1);
+        std::size_t size2 = static_cast<std::size_t>(last2 - first2);
+
+        if (size1 == 0 || size2 == 0 || *first1 > *(last2 - 1) || *first2 > *(last1 - 1))
+        {
+            return 0;
+        }
+
+        if (size1 * GALLOPING_THRESHOLD < size2)
+        {
+            return gallopingIntersectionSize(first1, last1, first2, last2, stopEarly);
+        }
+
+        if (size2 * GALLOPING_THRESHOLD < size1)
+        {
+            return gallopingIntersectionSize(first2, last2, first1, last1, stopEarly);
+        }
+
+        return function(first1, last1, first2, last2, stopEarly);
+    }
+}
+
+bool htd::isSetKernelSupported(htd::SetKernel kernel) HTD_NOEXCEPT
+{
+    bool ret = kernel == htd::SetKernel::SCALAR;
+
+#ifdef HTD_SET_KERNELS_X86
+    __builtin_cpu_init();
+
+    if (kernel == htd::SetKernel::SSE4_2)
+    {
+        ret = __builtin_cpu_supports("sse4.2");
+    }
+    else if (kernel == htd::SetKernel::AVX2)
+    {
+        ret = __builtin_cpu_supports("avx2");
+    }
+#endif
+
+    return ret;
+}
+
+htd::SetKernel htd::activeSetKernel(void) HTD_NOEXCEPT
+{
+    static const htd::SetKernel ret = detectSetKernel();
+
+    return ret;
+}
+
+std::size_t htd::set_intersection_size(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                       const htd::vertex_t * first2, const htd::vertex_t * last2,
+                                       htd::SetKernel kernel) HTD_NOEXCEPT
+{
+    HTD_ASSERT(htd::isSetKernelSupported(kernel))
+
+    return intersectionSize(first1, last1, first2, last2, false, intersectionKernel(kernel));
+}
+
+std::size_t htd::set_intersection_size(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                       const htd::vertex_t * first2, const htd::vertex_t * last2) HTD_NOEXCEPT
+{
+    return intersectionSize(first1, last1, first2, last2, false, activeIntersectionKernel());
+}
+
+bool htd::has_non_empty_set_intersection(const htd::vertex_t * first1, const htd::vertex_t * last1,
+                                         const htd::vertex_t * first2, const htd::vertex_t * last2) HTD_NOEXCEPT
+{
+    return intersectionSize(first1, last1, first2, last2, true, activeIntersectionKernel()) > 0;
+}
+
+#endif /* HTD_HTD_SETKERNELS_CPP */
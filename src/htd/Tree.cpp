@@ -26,22 +26,22 @@
 #define HTD_HTD_TREE_CPP
 
 #include <htd/Globals.hpp>
+#include <htd/DenseVertexMap.hpp>
 #include <htd/Helpers.hpp>
 #include <htd/Tree.hpp>
 #include <htd/VectorAdapter.hpp>
 #include <htd/PreOrderTreeTraversal.hpp>
 #include <htd/PostOrderTreeTraversal.hpp>
-#include <htd/HyperedgePointerDeque.hpp>
-#include <htd/ConstPointerIteratorWrapper.hpp>
+#include <htd/IHyperedgeCollection.hpp>
 
 #include <htd/Algorithm.hpp>
 
 #include <algorithm>
-#include <deque>
+#include <atomic>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
-#include <unordered_map>
 #include <utility>
 
 /**
@@ -65,42 +65,61 @@ struct htd::Tree::Implementation
         htd::vertex_t parent;
 
         /**
-         *  The collection of all edge identifiers containing the tree node.
+         *  The ID of the edge connecting the tree node with its parent.
          */
-        std::vector<htd::id_t> edges;
+        htd::id_t edge;
 
         /**
          *  The collection of all children of the tree node.
          */
         std::vector<htd::vertex_t> children;
 
+        /**
+         *  Constructor for an empty slot of the node storage.
+         */
+        Node(void) : id(htd::Vertex::UNKNOWN), parent(htd::Vertex::UNKNOWN), edge(htd::Id::UNKNOWN), children()
+        {
+
+        }
+
         /**
          *  Constructor for a tree node.
          *
          *  @param[in] id       The ID of the constructed tree node.
          *  @param[in] parent   The parent of the constructed tree node.
          */
-        Node(htd::id_t id, htd::vertex_t parent) : id(id), parent(parent), edges(), children()
+        Node(htd::id_t id, htd::vertex_t parent) : id(id), parent(parent), edge(htd::Id::UNKNOWN), children()
         {
 
         }
+    };
 
+    /**
+     *  Structure representing an edge of a tree.
+     */
+    struct Edge
+    {
         /**
-         *  Copy constructor for a tree node.
-         *
-         *  @param[in] original  The original tree node.
+         *  The hyperedge connecting a tree node with its parent.
          */
-        Node(const Node & original) : id(original.id), parent(original.parent), edges(original.edges), children(original.children)
+        htd::Hyperedge hyperedge;
+
+        /**
+         *  Constructor for an empty slot of the edge storage.
+         */
+        Edge(void) : hyperedge(htd::Id::UNKNOWN, std::vector<htd::vertex_t>())
         {
 
         }
 
         /**
-         *  Move constructor for a tree node.
+         *  Constructor for a tree edge.
          *
-         *  @param[in] original  The original tree node.
+         *  @param[in] id       The ID of the constructed tree edge.
+         *  @param[in] vertex1  The first endpoint of the constructed tree edge.
+         *  @param[in] vertex2  The second endpoint of the constructed tree edge.
          */
-        Node(Node && original) : id(original.id), parent(original.parent), edges(std::move(original.edges)), children(std::move(original.children))
+        Edge(htd::id_t id, htd::vertex_t vertex1, htd::vertex_t vertex2) : hyperedge(id, std::min(vertex1, vertex2), std::max(vertex1, vertex2))
         {
 
         }
@@ -111,22 +130,14 @@ struct htd::Tree::Implementation
      *
      *  @param[in] manager   The management instance to which the current object instance belongs.
      */
-    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), nodes_(), edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager), size_(0), root_(htd::Vertex::UNKNOWN), next_edge_(htd::Id::FIRST), next_vertex_(htd::Vertex::FIRST), vertices_(), verticesValid_(true), nodes_(), edges_(), edgeOrder_(std::make_shared<std::vector<htd::id_t>>()), edgeOrderValid_(true), orderMutex_()
     {
 
     }
 
     virtual ~Implementation()
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
 
-        for (htd::Hyperedge * edge : *edges_)
-        {
-            delete edge;
-        }
     }
 
     /**
@@ -141,20 +152,14 @@ struct htd::Tree::Implementation
           next_edge_(original.next_edge_),
           next_vertex_(original.next_vertex_),
           vertices_(original.vertices_),
-          nodes_(),
-          edges_(std::make_shared<std::deque<htd::Hyperedge *>>())
+          verticesValid_(original.verticesValid_.load()),
+          nodes_(original.nodes_),
+          edges_(original.edges_),
+          edgeOrder_(original.edgeOrder_),
+          edgeOrderValid_(original.edgeOrderValid_.load()),
+          orderMutex_()
     {
-        nodes_.reserve(original.nodes_.size());
-
-        for (const auto & node : original.nodes_)
-        {
-            nodes_.emplace(node.first, new Node(*(node.second)));
-        }
 
-        for (const htd::Hyperedge * edge : *(original.edges_))
-        {
-            edges_->emplace_back(new htd::Hyperedge(*edge));
-        }
     }
 
     /**
@@ -162,19 +167,11 @@ struct htd::Tree::Implementation
      */
     void reset(void)
     {
-        for (auto it = nodes_.begin(); it != nodes_.end(); it++)
-        {
-            delete it->second;
-        }
-
         nodes_.clear();
 
-        for (htd::Hyperedge * edge : *edges_)
-        {
-            delete edge;
-        }
+        edges_.clear();
 
-        edges_->clear();
+        clearEdgeOrder();
 
         size_ = 0;
 
@@ -185,6 +182,8 @@ struct htd::Tree::Implementation
         next_vertex_ = htd::Vertex::FIRST;
 
         vertices_.clear();
+
+        verticesValid_ = true;
     }
 
     /**
@@ -213,35 +212,447 @@ struct htd::Tree::Implementation
     htd::vertex_t next_vertex_;
 
     /**
-     *  The collection of all vertices of the tree in ascending order.
+     *  The collection of all vertices of the tree in ascending order. Removing a vertex other than the last one only
+     *  marks the collection as outdated, it is rebuilt from the node storage on the next access.
      */
-    std::vector<htd::vertex_t> vertices_;
+    mutable std::vector<htd::vertex_t> vertices_;
 
     /**
-     *  The map of pointers to all tree nodes. It maps vertex IDs to the corresponding node information.
+     *  Boolean flag indicating whether the collection of all vertices is up to date.
      */
-    std::unordered_map<htd::id_t, Node *> nodes_;
+    mutable std::atomic<bool> verticesValid_;
 
     /**
-     *  The collection of all hyperedges which exist in the tree.
+     *  The information about all tree nodes, indexed by the vertex IDs.
      */
-    std::shared_ptr<std::deque<htd::Hyperedge *>> edges_;
+    htd::DenseVertexMap<Node> nodes_;
 
     /**
-     *  Delete a node of the tree and perform an update of the internal state.
+     *  The hyperedges of the tree, indexed by their IDs. A hyperedge stays at its location until it is removed.
+     */
+    htd::DenseVertexMap<Edge> edges_;
+
+    /**
+     *  The IDs of all hyperedges of the tree in ascending order. The collection is shared with the hyperedge
+     *  collections handed out before, hence it is never modified while such a collection is alive. Instead, it is
+     *  marked as outdated and rebuilt from the edge storage on the next access, just like after removing an edge
+     *  other than the last one.
+     */
+    mutable std::shared_ptr<std::vector<htd::id_t>> edgeOrder_;
+
+    /**
+     *  Boolean flag indicating whether the collection of all hyperedge IDs is up to date.
+     */
+    mutable std::atomic<bool> edgeOrderValid_;
+
+    /**
+     *  The mutex which ensures that concurrent readers rebuild an outdated collection of vertices or hyperedge IDs only once.
+     */
+    mutable std::mutex orderMutex_;
+
+    /**
+     *  Add a new vertex to the collection of all vertices.
+     *
+     *  @param[in] vertex   The new vertex. It must be larger than all vertices of the tree.
+     */
+    void appendVertex(htd::vertex_t vertex)
+    {
+        if (verticesValid_)
+        {
+            vertices_.push_back(vertex);
+        }
+    }
+
+    /**
+     *  Remove a vertex from the collection of all vertices.
+     *
+     *  @param[in] vertex   The vertex which shall be removed.
+     */
+    void removeVertexFromOrder(htd::vertex_t vertex)
+    {
+        if (verticesValid_ && !vertices_.empty() && vertices_.back() == vertex)
+        {
+            vertices_.pop_back();
+        }
+        else
+        {
+            verticesValid_ = false;
+        }
+    }
+
+    /**
+     *  Access the collection of all vertices of the tree.
+     *
+     *  If the collection is outdated, it is rebuilt in place in time linear in the largest vertex ID of the tree.
+     *
+     *  @return The collection of all vertices of the tree in ascending order.
+     */
+    const std::vector<htd::vertex_t> & vertexOrder(void) const
+    {
+        if (!verticesValid_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(orderMutex_);
+
+            if (!verticesValid_.load(std::memory_order_relaxed))
+            {
+                vertices_.clear();
+
+                for (htd::vertex_t vertex = htd::Vertex::FIRST; vertex < next_vertex_; ++vertex)
+                {
+                    if (nodes_.contains(vertex))
+                    {
+                        vertices_.push_back(vertex);
+                    }
+                }
+
+                verticesValid_.store(true, std::memory_order_release);
+            }
+        }
+
+        return vertices_;
+    }
+
+    /**
+     *  Create a new edge connecting two vertices of the tree.
+     *
+     *  @param[in] vertex1  The first endpoint of the new edge.
+     *  @param[in] vertex2  The second endpoint of the new edge.
+     *
+     *  @return The ID of the new edge.
+     */
+    htd::id_t createEdge(htd::vertex_t vertex1, htd::vertex_t vertex2)
+    {
+        htd::id_t ret = next_edge_++;
+
+        edges_.emplace(ret, ret, vertex1, vertex2);
+
+        /* Edge IDs are assigned in ascending order, hence the new ID belongs to the end of the collection. */
+        if (edgeOrderValid_ && edgeOrder_.use_count() == 1)
+        {
+            edgeOrder_->push_back(ret);
+        }
+        else
+        {
+            edgeOrderValid_ = false;
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Remove the edge with the given ID from the tree.
+     *
+     *  @param[in] edgeId   The ID of the edge. If it is htd::Id::UNKNOWN, the tree remains unchanged.
+     */
+    void removeEdge(htd::id_t edgeId)
+    {
+        if (edgeId != htd::Id::UNKNOWN)
+        {
+            edges_.erase(edgeId);
+
+            if (edgeOrderValid_ && edgeOrder_.use_count() == 1 && !edgeOrder_->empty() && edgeOrder_->back() == edgeId)
+            {
+                edgeOrder_->pop_back();
+            }
+            else
+            {
+                edgeOrderValid_ = false;
+            }
+        }
+    }
+
+    /**
+     *  Remove all IDs from the collection of hyperedge IDs.
+     */
+    void clearEdgeOrder(void)
+    {
+        if (edgeOrder_.use_count() > 1)
+        {
+            edgeOrder_ = std::make_shared<std::vector<htd::id_t>>();
+        }
+        else
+        {
+            edgeOrder_->clear();
+        }
+
+        edgeOrderValid_ = true;
+    }
+
+    /**
+     *  Access the IDs of all hyperedges of the tree.
+     *
+     *  If the collection is outdated, it is rebuilt in time linear in the largest edge ID of the tree.
+     *
+     *  @return The IDs of all hyperedges of the tree in ascending order.
+     */
+    std::shared_ptr<std::vector<htd::id_t>> edgeOrder(void) const
+    {
+        if (!edgeOrderValid_.load(std::memory_order_acquire))
+        {
+            std::lock_guard<std::mutex> lock(orderMutex_);
+
+            if (!edgeOrderValid_.load(std::memory_order_relaxed))
+            {
+                if (edgeOrder_.use_count() > 1)
+                {
+                    edgeOrder_ = std::make_shared<std::vector<htd::id_t>>();
+                }
+                else
+                {
+                    edgeOrder_->clear();
+                }
+
+                edgeOrder_->reserve(edges_.size());
+
+                for (htd::id_t edgeId = htd::Id::FIRST; edgeId < next_edge_; ++edgeId)
+                {
+                    if (edges_.contains(edgeId))
+                    {
+                        edgeOrder_->push_back(edgeId);
+                    }
+                }
+
+                edgeOrderValid_.store(true, std::memory_order_release);
+            }
+        }
+
+        return edgeOrder_;
+    }
+
+    /**
+     *  Iterator over the hyperedges of the tree in ascending order of their IDs which yields the stored hyperedges without copying them.
+     */
+    class EdgeIterator : public htd::ConstIteratorBase<htd::Hyperedge>
+    {
+        public:
+            /**
+             *  Constructor for an iterator pointing to the hyperedge at the given position.
+             *
+             *  @param[in] implementation   The implementation details structure storing the hyperedges.
+             *  @param[in] edgeIds          The IDs of the hyperedges in ascending order.
+             *  @param[in] position         The position at which the iteration shall start.
+             */
+            EdgeIterator(const Implementation & implementation, const std::shared_ptr<std::vector<htd::id_t>> & edgeIds, htd::index_t position) HTD_NOEXCEPT : implementation_(&implementation), edgeIds_(edgeIds), position_(position)
+            {
+
+            }
+
+            /**
+             *  Copy constructor for an iterator.
+             *
+             *  @param[in] original  The original iterator.
+             */
+            EdgeIterator(const EdgeIterator & original) HTD_NOEXCEPT : implementation_(original.implementation_), edgeIds_(original.edgeIds_), position_(original.position_)
+            {
+
+            }
+
+            virtual ~EdgeIterator()
+            {
+
+            }
+
+            EdgeIterator & operator++(void) HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                ++position_;
+
+                return *this;
+            }
+
+            bool operator==(const htd::ConstIteratorBase<htd::Hyperedge> & rhs) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return position_ == static_cast<const EdgeIterator *>(&rhs)->position_;
+            }
+
+            bool operator!=(const htd::ConstIteratorBase<htd::Hyperedge> & rhs) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return position_ != static_cast<const EdgeIterator *>(&rhs)->position_;
+            }
+
+            const htd::Hyperedge * operator->(void) const HTD_OVERRIDE
+            {
+                return &(implementation_->edges_.at((*edgeIds_)[position_]).hyperedge);
+            }
+
+            const htd::Hyperedge & operator*(void) const HTD_OVERRIDE
+            {
+                return implementation_->edges_.at((*edgeIds_)[position_]).hyperedge;
+            }
+
+            EdgeIterator * clone(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            {
+                return new EdgeIterator(*this);
+            }
+
+        private:
+            /**
+             *  The implementation details structure storing the hyperedges.
+             */
+            const Implementation * implementation_;
+
+            /**
+             *  The IDs of the hyperedges in ascending order.
+             */
+            std::shared_ptr<std::vector<htd::id_t>> edgeIds_;
+
+            /**
+             *  The position of the current hyperedge.
+             */
+            htd::index_t position_;
+    };
+
+    /**
+     *  Collection of the hyperedges of the tree in ascending order of their IDs which provides the stored hyperedges without copying them.
+     */
+    class EdgeCollection : public htd::IHyperedgeCollection
+    {
+        public:
+            /**
+             *  Constructor for a collection of hyperedges.
+             *
+             *  @param[in] implementation   The implementation details structure storing the hyperedges.
+             *  @param[in] edgeIds          The IDs of the hyperedges in ascending order.
+             */
+            EdgeCollection(const Implementation & implementation, const std::shared_ptr<std::vector<htd::id_t>> & edgeIds) : implementation_(&implementation), edgeIds_(edgeIds)
+            {
+
+            }
+
+            virtual ~EdgeCollection()
+            {
+
+            }
+
+            bool empty(void) const HTD_OVERRIDE
+            {
+                return edgeIds_->empty();
+            }
+
+            std::size_t size(void) const HTD_OVERRIDE
+            {
+                return edgeIds_->size();
+            }
+
+            const htd::Hyperedge & at(htd::index_t index) const HTD_OVERRIDE
+            {
+                return implementation_->edges_.at(edgeIds_->at(index)).hyperedge;
+            }
+
+            htd::ConstIterator<htd::Hyperedge> begin(void) const HTD_OVERRIDE
+            {
+                return htd::ConstIterator<htd::Hyperedge>(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new EdgeIterator(*implementation_, edgeIds_, 0)));
+            }
+
+            htd::ConstIterator<htd::Hyperedge> end(void) const HTD_OVERRIDE
+            {
+                return htd::ConstIterator<htd::Hyperedge>(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new EdgeIterator(*implementation_, edgeIds_, edgeIds_->size())));
+            }
+
+            const htd::Hyperedge & operator[](htd::index_t index) const HTD_OVERRIDE
+            {
+                return at(index);
+            }
+
+            bool operator==(const htd::IHyperedgeCollection & rhs) const HTD_OVERRIDE
+            {
+                return rhs.size() == size() && htd::equal(rhs.begin(), rhs.end(), begin(), end());
+            }
+
+            bool operator!=(const htd::IHyperedgeCollection & rhs) const HTD_OVERRIDE
+            {
+                return !(*this == rhs);
+            }
+
+            EdgeCollection * clone(void) const HTD_OVERRIDE
+            {
+                return new EdgeCollection(*implementation_, edgeIds_);
+            }
+
+        private:
+            /**
+             *  The implementation details structure storing the hyperedges.
+             */
+            const Implementation * implementation_;
+
+            /**
+             *  The IDs of the hyperedges in ascending order.
+             */
+            std::shared_ptr<std::vector<htd::id_t>> edgeIds_;
+    };
+
+    /**
+     *  Access the hyperedge with the given ID.
+     *
+     *  @param[in] edgeId   The ID of the hyperedge.
+     *
+     *  @return A pointer to the hyperedge with the given ID or nullptr if no such hyperedge exists.
+     */
+    const htd::Hyperedge * edge(htd::id_t edgeId) const
+    {
+        return edges_.contains(edgeId) ? &(edges_.at(edgeId).hyperedge) : nullptr;
+    }
+
+    /**
+     *  Get the ID of the edge connecting the two given vertices.
+     *
+     *  @param[in] vertex1  The first vertex.
+     *  @param[in] vertex2  The second vertex.
+     *
+     *  @return The ID of the edge connecting the two given vertices or htd::Id::UNKNOWN if the vertices are not adjacent.
+     */
+    htd::id_t edgeId(htd::vertex_t vertex1, htd::vertex_t vertex2) const
+    {
+        htd::id_t ret = htd::Id::UNKNOWN;
+
+        if (nodes_.contains(vertex1) && nodes_.contains(vertex2))
+        {
+            const Node & node1 = nodes_.at(vertex1);
+            const Node & node2 = nodes_.at(vertex2);
+
+            if (node1.parent == vertex2)
+            {
+                ret = node1.edge;
+            }
+            else if (node2.parent == vertex1)
+            {
+                ret = node2.edge;
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     *  Copy the IDs of all edges containing a given vertex to the target vector.
      *
-     *  @param[in] node The node of the tree which shall be removed.
+     *  @param[in] vertex   The vertex.
+     *  @param[out] target  The target vector to which the edge IDs shall be appended in ascending order.
      */
-    void deleteNode(Node * node);
+    void copyIncidentEdgeIdsTo(htd::vertex_t vertex, std::vector<htd::id_t> & target) const
+    {
+        const Node & node = nodes_.at(vertex);
+
+        std::size_t size = target.size();
+
+        if (node.parent != htd::Vertex::UNKNOWN)
+        {
+            target.push_back(node.edge);
+        }
+
+        for (htd::vertex_t child : node.children)
+        {
+            target.push_back(nodes_.at(child).edge);
+        }
+
+        std::sort(target.begin() + size, target.end());
+    }
 
     /**
-     *  Updates the edge information for the nodes affected by a call to swapWithParent(htd::vertex_t).
+     *  Delete a node of the tree and perform an update of the internal state.
      *
-     *  @param[in] node             The node for which swapWithParent(htd::vertex_t) was called.
-     *  @param[in] parentNode       The parent node of the swapped node.
-     *  @param[in] grandParentNode  The grandparent node of the swapped node.
+     *  @param[in] vertex   The vertex of the tree which shall be removed.
      */
-    void updateEdgesAfterSwapWithParent(Node & node, Node & parentNode, Node & grandParentNode);
+    void deleteNode(htd::vertex_t vertex);
 };
 
 htd::Tree::Tree(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -291,7 +702,7 @@ std::size_t htd::Tree::vertexCount(htd::vertex_t subtreeRoot) const
 
 std::size_t htd::Tree::edgeCount(void) const
 {
-    return implementation_->edges_->size();
+    return implementation_->size_ > 0 ? implementation_->size_ - 1 : 0;
 }
 
 std::size_t htd::Tree::edgeCount(htd::vertex_t vertex) const
@@ -303,12 +714,12 @@ std::size_t htd::Tree::edgeCount(htd::vertex_t vertex) const
 
 bool htd::Tree::isVertex(htd::vertex_t vertex) const
 {
-    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->nodes_.count(vertex) == 1;
+    return vertex < implementation_->next_vertex_ && vertex != htd::Vertex::UNKNOWN && implementation_->nodes_.contains(vertex);
 }
 
 bool htd::Tree::isEdge(htd::id_t edgeId) const
 {
-    return edgeId > 0 && edgeId <= edgeCount();
+    return implementation_->edge(edgeId) != nullptr;
 }
 
 bool htd::Tree::isEdge(htd::vertex_t vertex1, htd::vertex_t vertex2) const
@@ -337,13 +748,13 @@ htd::ConstCollection<htd::id_t> htd::Tree::associatedEdgeIds(htd::vertex_t verte
 {
     htd::VectorAdapter<htd::id_t> ret;
 
-    auto & result = ret.container();
-
-    for (const htd::Hyperedge & edge : hyperedges())
+    if (vertex1 < vertex2)
     {
-        if (edge[0] == vertex1 && edge[1] == vertex2)
+        htd::id_t edgeId = implementation_->edgeId(vertex1, vertex2);
+
+        if (edgeId != htd::Id::UNKNOWN)
         {
-            result.emplace_back(edge.id());
+            ret.container().push_back(edgeId);
         }
     }
 
@@ -352,42 +763,22 @@ htd::ConstCollection<htd::id_t> htd::Tree::associatedEdgeIds(htd::vertex_t verte
 
 htd::ConstCollection<htd::id_t> htd::Tree::associatedEdgeIds(const std::vector<htd::vertex_t> & elements) const
 {
-    htd::VectorAdapter<htd::id_t> ret;
-
     if (elements.size() == 2)
     {
-        auto & result = ret.container();
-
-        for (const htd::Hyperedge & edge : hyperedges())
-        {
-            if (htd::equal(edge.begin(), edge.end(), elements.begin(), elements.end()))
-            {
-                result.emplace_back(edge.id());
-            }
-        }
+        return associatedEdgeIds(elements[0], elements[1]);
     }
 
-    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+    return htd::ConstCollection<htd::id_t>();
 }
 
 htd::ConstCollection<htd::id_t> htd::Tree::associatedEdgeIds(const htd::ConstCollection<htd::vertex_t> & elements) const
 {
-    htd::VectorAdapter<htd::id_t> ret;
-
     if (elements.size() == 2)
     {
-        auto & result = ret.container();
-
-        for (const htd::Hyperedge & edge : hyperedges())
-        {
-            if (htd::equal(edge.begin(), edge.end(), elements.begin(), elements.end()))
-            {
-                result.emplace_back(edge.id());
-            }
-        }
+        return associatedEdgeIds(elements[0], elements[1]);
     }
 
-    return htd::ConstCollection<htd::id_t>::getInstance(ret);
+    return htd::ConstCollection<htd::id_t>();
 }
 
 bool htd::Tree::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
@@ -397,7 +788,7 @@ bool htd::Tree::isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(neighbor))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->nodes_.at(vertex);
 
     const auto & children = node.children;
 
@@ -445,7 +836,7 @@ std::size_t htd::Tree::neighborCount(htd::vertex_t vertex) const
     
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->nodes_.at(vertex);
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
@@ -472,7 +863,7 @@ void htd::Tree::copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t>
 
     std::size_t size = target.size();
 
-    const auto & node = *(implementation_->nodes_.at(vertex));
+    const auto & node = implementation_->nodes_.at(vertex);
 
     const auto & children = node.children;
 
@@ -499,26 +890,26 @@ htd::vertex_t htd::Tree::neighborAtPosition(htd::vertex_t vertex, htd::index_t i
 
 htd::ConstCollection<htd::vertex_t> htd::Tree::vertices(void) const
 {
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertices_);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->vertexOrder());
 }
 
 const std::vector<htd::vertex_t> & htd::Tree::vertexVector(void) const
 {
-    return implementation_->vertices_;
+    return implementation_->vertexOrder();
 }
 
 void htd::Tree::copyVerticesTo(std::vector<htd::vertex_t> & target) const
 {
-    target.insert(target.end(),
-                  implementation_->vertices_.begin(),
-                  implementation_->vertices_.end());
+    const std::vector<htd::vertex_t> & vertices = implementation_->vertexOrder();
+
+    target.insert(target.end(), vertices.begin(), vertices.end());
 }
 
 htd::vertex_t htd::Tree::vertexAtPosition(htd::index_t index) const
 {
-    HTD_ASSERT(index < implementation_->vertices_.size())
+    HTD_ASSERT(index < implementation_->size_)
 
-    return implementation_->vertices_[index];
+    return implementation_->vertexOrder()[index];
 }
 
 std::size_t htd::Tree::isolatedVertexCount(void) const
@@ -563,62 +954,56 @@ bool htd::Tree::isIsolatedVertex(htd::vertex_t vertex) const
 
 htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(void) const
 {
-    return htd::ConstCollection<htd::Hyperedge>(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new htd::ConstPointerIteratorWrapper<std::deque<htd::Hyperedge *>::const_iterator, htd::Hyperedge>(implementation_->edges_->begin())),
-                                                static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new htd::ConstPointerIteratorWrapper<std::deque<htd::Hyperedge *>::const_iterator, htd::Hyperedge>(implementation_->edges_->end())));
+    std::shared_ptr<std::vector<htd::id_t>> edgeIds = implementation_->edgeOrder();
+
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new Implementation::EdgeIterator(*implementation_, edgeIds, 0)),
+                                                             static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new Implementation::EdgeIterator(*implementation_, edgeIds, edgeIds->size())),
+                                                             edgeIds->size());
 }
 
 htd::ConstCollection<htd::Hyperedge> htd::Tree::hyperedges(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::VectorAdapter<htd::Hyperedge> ret;
+    std::shared_ptr<std::vector<htd::id_t>> edgeIds = std::make_shared<std::vector<htd::id_t>>();
 
-    auto & result = ret.container();
+    implementation_->copyIncidentEdgeIdsTo(vertex, *edgeIds);
 
-    for (auto & edge : *(implementation_->edges_))
-    {
-        if (edge->contains(vertex))
-        {
-            result.emplace_back(*edge);
-        }
-    }
-
-    return htd::ConstCollection<htd::Hyperedge>::getInstance(ret);
+    return htd::ConstCollection<htd::Hyperedge>::getInstance(static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new Implementation::EdgeIterator(*implementation_, edgeIds, 0)),
+                                                             static_cast<htd::ConstIteratorBase<htd::Hyperedge> *>(new Implementation::EdgeIterator(*implementation_, edgeIds, edgeIds->size())),
+                                                             edgeIds->size());
 }
 
 const htd::Hyperedge & htd::Tree::hyperedge(htd::id_t edgeId) const
 {
-    auto it = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), edgeId);
+    const htd::Hyperedge * ret = implementation_->edge(edgeId);
 
-    if (it == implementation_->edges_->end())
+    if (ret == nullptr)
     {
         throw std::logic_error("const htd::Hyperedge & htd::Tree::hyperedge(htd::id_t) const");
     }
 
-    return **it;
+    return *ret;
 }
 
 const htd::Hyperedge & htd::Tree::hyperedgeAtPosition(htd::index_t index) const
 {
-    HTD_ASSERT(index < implementation_->edges_->size())
+    HTD_ASSERT(index < edgeCount())
 
-    return *(implementation_->edges_->at(index));
+    return implementation_->edges_.at(implementation_->edgeOrder()->at(index)).hyperedge;
 }
 
 const htd::Hyperedge & htd::Tree::hyperedgeAtPosition(htd::index_t index, htd::vertex_t vertex) const
 {
-    for (auto it = implementation_->edges_->begin(); it != implementation_->edges_->end(); ++it)
+    if (isVertex(vertex))
     {
-        const htd::Hyperedge & hyperedge = **it;
+        std::vector<htd::id_t> edgeIds;
 
-        if (hyperedge.contains(vertex))
-        {
-            if (index == 0)
-            {
-                return hyperedge;
-            }
+        implementation_->copyIncidentEdgeIdsTo(vertex, edgeIds);
 
-            --index;
+        if (index < edgeIds.size())
+        {
+            return *(implementation_->edge(edgeIds[index]));
         }
     }
 
@@ -630,11 +1015,11 @@ htd::FilteredHyperedgeCollection htd::Tree::hyperedgesAtPositions(const std::vec
     #ifndef NDEBUG
     for (htd::index_t index : indices)
     {
-        HTD_ASSERT(index < implementation_->edges_->size())
+        HTD_ASSERT(index < edgeCount())
     }
     #endif
 
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgePointerDeque(implementation_->edges_), indices);
+    return htd::FilteredHyperedgeCollection(new Implementation::EdgeCollection(*implementation_, implementation_->edgeOrder()), indices);
 }
 
 htd::FilteredHyperedgeCollection htd::Tree::hyperedgesAtPositions(std::vector<htd::index_t> && indices) const
@@ -642,11 +1027,11 @@ htd::FilteredHyperedgeCollection htd::Tree::hyperedgesAtPositions(std::vector<ht
     #ifndef NDEBUG
     for (htd::index_t index : indices)
     {
-        HTD_ASSERT(index < implementation_->edges_->size())
+        HTD_ASSERT(index < edgeCount())
     }
     #endif
 
-    return htd::FilteredHyperedgeCollection(new htd::HyperedgePointerDeque(implementation_->edges_), std::move(indices));
+    return htd::FilteredHyperedgeCollection(new Implementation::EdgeCollection(*implementation_, implementation_->edgeOrder()), std::move(indices));
 }
 
 htd::vertex_t htd::Tree::root(void) const
@@ -665,7 +1050,7 @@ htd::vertex_t htd::Tree::parent(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t ret = implementation_->nodes_.at(vertex).parent;
 
     HTD_ASSERT(ret != htd::Vertex::UNKNOWN)
     
@@ -677,28 +1062,28 @@ bool htd::Tree::isParent(htd::vertex_t vertex, htd::vertex_t parent) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(parent))
 
-    return implementation_->nodes_.at(vertex)->parent == parent;
+    return implementation_->nodes_.at(vertex).parent == parent;
 }
 
 std::size_t htd::Tree::childCount(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.size();
+    return implementation_->nodes_.at(vertex).children.size();
 }
 
 htd::ConstCollection<htd::vertex_t> htd::Tree::children(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodes_.at(vertex)->children);
+    return htd::ConstCollection<htd::vertex_t>::getInstance(implementation_->nodes_.at(vertex).children);
 }
 
 void htd::Tree::copyChildrenTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & childCollection = implementation_->nodes_.at(vertex)->children;
+    const std::vector<htd::vertex_t> & childCollection = implementation_->nodes_.at(vertex).children;
 
     target.insert(target.end(), childCollection.begin(), childCollection.end());
 }
@@ -707,7 +1092,7 @@ htd::vertex_t htd::Tree::childAtPosition(htd::vertex_t vertex, htd::index_t inde
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->nodes_.at(vertex).children;
 
     HTD_ASSERT(index < children.size())
 
@@ -719,7 +1104,7 @@ bool htd::Tree::isChild(htd::vertex_t vertex, htd::vertex_t child) const
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    const auto & children = implementation_->nodes_.at(vertex)->children;
+    const auto & children = implementation_->nodes_.at(vertex).children;
 
     return std::find(children.begin(), children.end(), child) != children.end();
 }
@@ -757,13 +1142,13 @@ std::size_t htd::Tree::depth(htd::vertex_t vertex) const
 
     std::size_t ret = 0;
 
-    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex)->parent;
+    htd::vertex_t currentVertex = implementation_->nodes_.at(vertex).parent;
 
     while (currentVertex != htd::Vertex::UNKNOWN)
     {
         ++ret;
 
-        currentVertex = implementation_->nodes_.at(currentVertex)->parent;
+        currentVertex = implementation_->nodes_.at(currentVertex).parent;
     }
 
     return ret;
@@ -783,115 +1168,35 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
-
-    auto end = implementation_->edges_->end();
-
-    for (auto it = node.edges.rbegin(); it != node.edges.rend(); ++it)
-    {
-        auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), end, *it);
-
-        for (htd::vertex_t currentVertex : (*position)->sortedElements())
-        {
-            if (currentVertex != vertex)
-            {
-                std::vector<htd::id_t> & currentEdges = implementation_->nodes_.at(currentVertex)->edges;
-
-                /* Because 'currentVertex' is a neighbor of 'vertex' and 'position' points to the
-                 * edge connecting the two vertices, std::lower_bound will always find the edge
-                 * with ID '*it' in the collection 'currentEdges'. */
-                // coverity[use_iterator]
-                currentEdges.erase(std::lower_bound(currentEdges.begin(), currentEdges.end(), *it));
-            }
-        }
-
-        delete *position;
-
-        end = implementation_->edges_->erase(position);
-    }
+    Implementation::Node & node = implementation_->nodes_.at(vertex);
 
     const auto & children = node.children;
 
     if (node.parent != htd::Vertex::UNKNOWN)
     {
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(node.parent));
+        Implementation::Node & parentNode = implementation_->nodes_.at(node.parent);
 
         auto & siblings = parentNode.children;
 
-        switch (children.size())
+        for (htd::vertex_t child : children)
         {
-            case 0:
-            {
-                break;
-            }
-            case 1:
-            {
-                htd::vertex_t child = children[0];
+            Implementation::Node & childNode = implementation_->nodes_.at(child);
 
-                Implementation::Node & childNode = *(implementation_->nodes_.at(child));
-
-                childNode.parent = node.parent;
-
-                auto position = std::lower_bound(siblings.begin(), siblings.end(), child);
-
-                if (position == siblings.end() || *position != child)
-                {
-                    siblings.insert(position, child);
-                }
-
-                if (node.parent < child)
-                {
-                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, child));
-                }
-                else
-                {
-                    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, node.parent));
-                }
+            childNode.parent = node.parent;
 
-                childNode.edges.emplace_back(implementation_->next_edge_);
+            implementation_->removeEdge(childNode.edge);
 
-                parentNode.edges.emplace_back(implementation_->next_edge_);
+            childNode.edge = implementation_->createEdge(child, node.parent);
 
-                ++implementation_->next_edge_;
+            auto position = std::lower_bound(siblings.begin(), siblings.end(), child);
 
-                break;
-            }
-            default:
+            if (position == siblings.end() || *position != child)
             {
-                for (htd::vertex_t child : children)
-                {
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
-
-                    childNode.parent = node.parent;
-
-                    auto position = std::lower_bound(siblings.begin(), siblings.end(), child);
-
-                    if (position == siblings.end() || *position != child)
-                    {
-                        siblings.insert(position, child);
-                    }
-
-                    if (node.parent < child)
-                    {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, node.parent, child));
-                    }
-                    else
-                    {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, node.parent));
-                    }
-
-                    childNode.edges.emplace_back(implementation_->next_edge_);
-
-                    parentNode.edges.emplace_back(implementation_->next_edge_);
-
-                    implementation_->next_edge_++;
-                }
-
-                break;
+                siblings.insert(position, child);
             }
         }
 
-        implementation_->deleteNode(implementation_->nodes_.at(vertex));
+        implementation_->deleteNode(vertex);
     }
     else
     {
@@ -904,19 +1209,30 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
                 implementation_->size_ = 0;
 
                 implementation_->nodes_.clear();
-                implementation_->edges_->clear();
 
                 implementation_->vertices_.clear();
 
+                implementation_->verticesValid_ = true;
+
+                implementation_->edges_.clear();
+
+                implementation_->clearEdgeOrder();
+
                 break;
             }
             case 1:
             {
                 implementation_->root_ = children[0];
 
-                implementation_->nodes_.at(implementation_->root_)->parent = htd::Vertex::UNKNOWN;
+                Implementation::Node & rootNode = implementation_->nodes_.at(implementation_->root_);
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                rootNode.parent = htd::Vertex::UNKNOWN;
+
+                implementation_->removeEdge(rootNode.edge);
+
+                rootNode.edge = htd::Id::UNKNOWN;
+
+                implementation_->deleteNode(vertex);
 
                 break;
             }
@@ -924,44 +1240,37 @@ void htd::Tree::removeVertex(htd::vertex_t vertex)
             {
                 implementation_->root_ = children[0];
 
-                Implementation::Node & rootNode = *(implementation_->nodes_.at(implementation_->root_));
+                Implementation::Node & rootNode = implementation_->nodes_.at(implementation_->root_);
 
                 rootNode.parent = htd::Vertex::UNKNOWN;
 
+                implementation_->removeEdge(rootNode.edge);
+
+                rootNode.edge = htd::Id::UNKNOWN;
+
                 std::vector<htd::vertex_t> & newRootChildren = rootNode.children;
 
                 for (auto it = children.begin() + 1; it != children.end(); ++it)
                 {
                     htd::vertex_t child = *it;
 
-                    Implementation::Node & childNode = *(implementation_->nodes_.at(child));
+                    Implementation::Node & childNode = implementation_->nodes_.at(child);
 
                     childNode.parent = implementation_->root_;
 
+                    implementation_->removeEdge(childNode.edge);
+
+                    childNode.edge = implementation_->createEdge(child, implementation_->root_);
+
                     auto position = std::lower_bound(newRootChildren.begin(), newRootChildren.end(), child);
 
                     if (position == newRootChildren.end() || *position != child)
                     {
                         newRootChildren.insert(position, child);
                     }
-
-                    if (implementation_->root_ < child)
-                    {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, implementation_->root_, child));
-                    }
-                    else
-                    {
-                        implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, child, implementation_->root_));
-                    }
-
-                    childNode.edges.emplace_back(implementation_->next_edge_);
-
-                    rootNode.edges.emplace_back(implementation_->next_edge_);
-
-                    implementation_->next_edge_++;
                 }
 
-                implementation_->deleteNode(implementation_->nodes_.at(vertex));
+                implementation_->deleteNode(vertex);
 
                 break;
             }
@@ -995,9 +1304,15 @@ htd::vertex_t htd::Tree::insertRoot(void)
         implementation_->next_vertex_ = implementation_->root_ + 1;
 
         implementation_->nodes_.clear();
-        implementation_->nodes_.emplace(implementation_->root_, new Implementation::Node(implementation_->root_, htd::Vertex::UNKNOWN));
+        implementation_->nodes_.emplace(implementation_->root_, implementation_->root_, htd::Vertex::UNKNOWN);
+
+        implementation_->edges_.clear();
+
+        implementation_->clearEdgeOrder();
+
+        implementation_->vertices_.assign(1, implementation_->root_);
 
-        implementation_->vertices_.emplace_back(implementation_->root_);
+        implementation_->verticesValid_ = true;
 
         implementation_->size_ = 1;
     }
@@ -1016,12 +1331,17 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
         htd::vertex_t lastVertex = htd::Vertex::UNKNOWN;
         htd::vertex_t nextVertex = htd::Vertex::UNKNOWN;
 
+        htd::id_t lastEdge = htd::Id::UNKNOWN;
+        htd::id_t nextEdge = htd::Id::UNKNOWN;
+
         while (vertex != htd::Vertex::UNKNOWN)
         {
-            Implementation::Node & node = *(implementation_->nodes_[vertex]);
+            Implementation::Node & node = implementation_->nodes_[vertex];
 
             nextVertex = node.parent;
 
+            nextEdge = node.edge;
+
             std::vector<htd::vertex_t> & currentChildren = node.children;
 
             if (lastVertex != htd::Vertex::UNKNOWN)
@@ -1036,8 +1356,12 @@ void htd::Tree::makeRoot(htd::vertex_t vertex)
 
             node.parent = lastVertex;
 
+            node.edge = lastEdge;
+
             lastVertex = vertex;
 
+            lastEdge = nextEdge;
+
             vertex = nextVertex;
         }
     }
@@ -1047,32 +1371,20 @@ htd::vertex_t htd::Tree::addChild(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    htd::vertex_t ret = htd::Vertex::UNKNOWN;
-
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
-
-    ret = implementation_->next_vertex_;
+    htd::vertex_t ret = implementation_->next_vertex_;
 
-    node.children.emplace_back(ret);
+    implementation_->nodes_.emplace(ret, ret, vertex);
 
-    Implementation::Node * newNode = new Implementation::Node(ret, vertex);
+    implementation_->nodes_.at(ret).edge = implementation_->createEdge(vertex, ret);
 
-    implementation_->nodes_.emplace(ret, newNode);
+    implementation_->nodes_.at(vertex).children.emplace_back(ret);
 
-    implementation_->vertices_.emplace_back(ret);
+    implementation_->appendVertex(ret);
 
     implementation_->next_vertex_++;
 
     implementation_->size_++;
 
-    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
-
-    node.edges.push_back(implementation_->next_edge_);
-
-    newNode->edges.push_back(implementation_->next_edge_);
-
-    implementation_->next_edge_++;
-
     return ret;
 }
 
@@ -1081,7 +1393,7 @@ void htd::Tree::removeChild(htd::vertex_t vertex, htd::vertex_t child)
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isVertex(child))
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = implementation_->nodes_.at(vertex);
 
     auto & children = node.children;
 
@@ -1112,19 +1424,13 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
 
     if (isRoot(vertex))
     {
-        auto & node = implementation_->nodes_.at(vertex);
-
         ret = implementation_->next_vertex_;
 
-        node->parent = ret;
-
-        Implementation::Node * newRootNode = new Implementation::Node(ret, htd::Vertex::UNKNOWN);
+        implementation_->nodes_.emplace(ret, ret, htd::Vertex::UNKNOWN);
 
-        newRootNode->children.emplace_back(vertex);
+        implementation_->nodes_.at(ret).children.emplace_back(vertex);
 
-        implementation_->nodes_.emplace(ret, newRootNode);
-
-        implementation_->vertices_.emplace_back(ret);
+        implementation_->appendVertex(ret);
 
         implementation_->next_vertex_++;
 
@@ -1136,45 +1442,11 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
     {
         htd::vertex_t parentVertex = parent(vertex);
 
-        Implementation::Node & parentNode = *(implementation_->nodes_.at(parentVertex));
-        Implementation::Node & selectedNode = *(implementation_->nodes_.at(vertex));
-
-        htd::id_t oldHyperedge = htd::Id::UNKNOWN;
-
-        auto it = selectedNode.edges.begin();
-
-        while (it != selectedNode.edges.end())
-        {
-            auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
-
-            HTD_ASSERT(position != implementation_->edges_->end())
-
-            if ((*position)->contains(parentVertex))
-            {
-                oldHyperedge = (*position)->id();
-
-                delete *position;
-
-                implementation_->edges_->erase(position);
-
-                it = selectedNode.edges.end();
-            }
-            else
-            {
-                ++it;
-            }
-        }
-
-        parentNode.edges.erase(std::lower_bound(parentNode.edges.begin(), parentNode.edges.end(), oldHyperedge));
-        selectedNode.edges.erase(std::lower_bound(selectedNode.edges.begin(), selectedNode.edges.end(), oldHyperedge));
-
         ret = htd::Tree::addChild(parentVertex);
 
-        auto & intermediateNode = *(implementation_->nodes_.at(ret));
-
-        intermediateNode.parent = parentVertex;
+        Implementation::Node & parentNode = implementation_->nodes_.at(parentVertex);
 
-        intermediateNode.children.emplace_back(vertex);
+        implementation_->nodes_.at(ret).children.emplace_back(vertex);
 
         auto position = std::find(parentNode.children.begin(), parentNode.children.end(), vertex);
 
@@ -1182,16 +1454,15 @@ htd::vertex_t htd::Tree::addParent(htd::vertex_t vertex)
         {
             parentNode.children.erase(position);
         }
-
-        selectedNode.parent = ret;
     }
 
-    implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, ret));
+    Implementation::Node & node = implementation_->nodes_.at(vertex);
 
-    implementation_->nodes_.at(vertex)->edges.push_back(implementation_->next_edge_);
-    implementation_->nodes_.at(ret)->edges.push_back(implementation_->next_edge_);
+    node.parent = ret;
 
-    implementation_->next_edge_++;
+    implementation_->removeEdge(node.edge);
+
+    node.edge = implementation_->createEdge(vertex, ret);
 
     return ret;
 }
@@ -1202,118 +1473,53 @@ void htd::Tree::setParent(htd::vertex_t vertex, htd::vertex_t newParent)
     HTD_ASSERT(isVertex(newParent))
     HTD_ASSERT(vertex != newParent)
 
-    auto & node = *(implementation_->nodes_.at(vertex));
+    auto & node = implementation_->nodes_.at(vertex);
 
     htd::vertex_t oldParent = node.parent;
 
     if (oldParent != newParent)
     {
-        auto & newParentNode = *(implementation_->nodes_.at(newParent));
+        auto & newParentNode = implementation_->nodes_.at(newParent);
 
         if (oldParent != htd::Vertex::UNKNOWN)
         {
-            auto & oldParentNode = *(implementation_->nodes_.at(oldParent));
+            auto & oldParentNode = implementation_->nodes_.at(oldParent);
 
             oldParentNode.children.erase(std::find(oldParentNode.children.begin(), oldParentNode.children.end(), vertex));
-
-            htd::id_t oldHyperedge = htd::Id::UNKNOWN;
-
-            auto it = oldParentNode.edges.begin();
-
-            while (it != oldParentNode.edges.end())
-            {
-                auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
-
-                HTD_ASSERT(position != implementation_->edges_->end())
-
-                if ((*position)->contains(vertex))
-                {
-                    oldHyperedge = (*position)->id();
-
-                    delete *position;
-
-                    implementation_->edges_->erase(position);
-
-                    it = oldParentNode.edges.end();
-                }
-                else
-                {
-                    ++it;
-                }
-            }
-
-            node.edges.erase(std::lower_bound(node.edges.begin(), node.edges.end(), oldHyperedge));
-            oldParentNode.edges.erase(std::lower_bound(oldParentNode.edges.begin(), oldParentNode.edges.end(), oldHyperedge));
         }
         else
         {
             htd::vertex_t relevantVertex = newParent;
 
-            while (implementation_->nodes_.at(relevantVertex)->parent != vertex)
+            while (implementation_->nodes_.at(relevantVertex).parent != vertex)
             {
-                relevantVertex = implementation_->nodes_.at(relevantVertex)->parent;
+                relevantVertex = implementation_->nodes_.at(relevantVertex).parent;
             }
 
             std::cout << "RELEVANT: " << relevantVertex << std::endl;
 
             implementation_->root_ = relevantVertex;
 
-            auto & relevantNode = *(implementation_->nodes_.at(relevantVertex));
+            auto & relevantNode = implementation_->nodes_.at(relevantVertex);
 
             relevantNode.parent = htd::Vertex::UNKNOWN;
 
-            node.children.erase(std::find(node.children.begin(), node.children.end(), relevantVertex));
-
-            htd::id_t oldHyperedge = htd::Id::UNKNOWN;
-
-            auto it = relevantNode.edges.begin();
-
-            while (it != relevantNode.edges.end())
-            {
-                auto position = htd::hyperedgePointerPosition(implementation_->edges_->begin(), implementation_->edges_->end(), *it);
-
-                HTD_ASSERT(position != implementation_->edges_->end())
+            implementation_->removeEdge(relevantNode.edge);
 
-                if ((*position)->contains(vertex))
-                {
-                    oldHyperedge = (*position)->id();
-
-                    delete *position;
-
-                    implementation_->edges_->erase(position);
-
-                    it = relevantNode.edges.end();
-                }
-                else
-                {
-                    ++it;
-                }
-            }
+            relevantNode.edge = htd::Id::UNKNOWN;
 
-            node.edges.erase(std::lower_bound(node.edges.begin(), node.edges.end(), oldHyperedge));
-            relevantNode.edges.erase(std::lower_bound(relevantNode.edges.begin(), relevantNode.edges.end(), oldHyperedge));
+            node.children.erase(std::find(node.children.begin(), node.children.end(), relevantVertex));
         }
 
         auto position = std::lower_bound(newParentNode.children.begin(), newParentNode.children.end(), vertex);
 
         newParentNode.children.insert(position, vertex);
 
-        newParentNode.edges.emplace_back(implementation_->next_edge_);
-
-        node.edges.emplace_back(implementation_->next_edge_);
-
         node.parent = newParent;
 
-        if (vertex < newParent)
-        {
-            implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, vertex, newParent));
-        }
-        else
-        {
-            implementation_->edges_->push_back(new htd::Hyperedge(implementation_->next_edge_, newParent, vertex));
-        }
+        implementation_->removeEdge(node.edge);
 
-        implementation_->next_edge_++;
+        node.edge = implementation_->createEdge(vertex, newParent);
     }
 }
 
@@ -1321,9 +1527,9 @@ std::size_t htd::Tree::leafCount(void) const HTD_NOEXCEPT
 {
     std::size_t ret = 0;
 
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertexOrder())
     {
-        if (node.second->children.empty())
+        if (implementation_->nodes_.at(vertex).children.empty())
         {
             ret++;
         }
@@ -1343,11 +1549,11 @@ htd::ConstCollection<htd::vertex_t> htd::Tree::leaves(void) const
 
 void htd::Tree::copyLeavesTo(std::vector<htd::vertex_t> & target) const
 {
-    for (const auto & node : implementation_->nodes_)
+    for (htd::vertex_t vertex : implementation_->vertexOrder())
     {
-        if (node.second->children.empty())
+        if (implementation_->nodes_.at(vertex).children.empty())
         {
-            target.emplace_back(node.first);
+            target.emplace_back(vertex);
         }
     }
 
@@ -1371,20 +1577,20 @@ bool htd::Tree::isLeaf(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return implementation_->nodes_.at(vertex)->children.empty();
+    return implementation_->nodes_.at(vertex).children.empty();
 }
 
 void htd::Tree::swapWithParent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    Implementation::Node & node = *(implementation_->nodes_.at(vertex));
+    Implementation::Node & node = implementation_->nodes_.at(vertex);
 
     htd::vertex_t parent = node.parent;
 
     HTD_ASSERT(parent != htd::Vertex::UNKNOWN)
 
-    Implementation::Node & parentNode = *(implementation_->nodes_.at(parent));
+    Implementation::Node & parentNode = implementation_->nodes_.at(parent);
 
     node.parent = parentNode.parent;
 
@@ -1392,19 +1598,25 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
 
     parentNode.parent = vertex;
 
+    implementation_->removeEdge(parentNode.edge);
+
+    parentNode.edge = node.edge;
+
     parentNode.children.erase(std::lower_bound(parentNode.children.begin(), parentNode.children.end(), vertex));
 
     if (node.parent == htd::Vertex::UNKNOWN)
     {
         implementation_->root_ = vertex;
+
+        node.edge = htd::Id::UNKNOWN;
     }
     else
     {
         htd::vertex_t grandParent = node.parent;
 
-        Implementation::Node & grandParentNode = *(implementation_->nodes_.at(grandParent));
+        Implementation::Node & grandParentNode = implementation_->nodes_.at(grandParent);
 
-        implementation_->updateEdgesAfterSwapWithParent(node, parentNode, grandParentNode);
+        node.edge = implementation_->createEdge(vertex, grandParent);
 
         grandParentNode.children.erase(std::lower_bound(grandParentNode.children.begin(), grandParentNode.children.end(), parent));
 
@@ -1412,26 +1624,24 @@ void htd::Tree::swapWithParent(htd::vertex_t vertex)
     }
 }
 
-void htd::Tree::Implementation::deleteNode(Node * node)
+void htd::Tree::Implementation::deleteNode(htd::vertex_t vertex)
 {
-    HTD_ASSERT(node != nullptr)
-
-    auto & parent = node->parent;
+    HTD_ASSERT(nodes_.contains(vertex))
 
-    htd::vertex_t vertex = node->id;
+    htd::vertex_t parent = nodes_.at(vertex).parent;
 
     if (parent != htd::Vertex::UNKNOWN)
     {
-        auto & children = nodes_.at(parent)->children;
+        auto & children = nodes_.at(parent).children;
 
         children.erase(std::lower_bound(children.begin(), children.end(), vertex));
     }
 
-    vertices_.erase(std::lower_bound(vertices_.begin(), vertices_.end(), vertex));
+    removeVertexFromOrder(vertex);
 
-    nodes_.erase(vertex);
+    removeEdge(nodes_.at(vertex).edge);
 
-    delete node;
+    nodes_.erase(vertex);
 
     size_--;
 }
@@ -1496,20 +1706,15 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
     {
         implementation_->reset();
 
-        implementation_->nodes_.reserve(original.implementation_->nodes_.size());
-
-        for (const auto & node : original.implementation_->nodes_)
-        {
-            implementation_->nodes_.emplace(node.first, new Implementation::Node(*(node.second)));
-        }
+        implementation_->nodes_ = original.implementation_->nodes_;
 
         implementation_->root_ = original.implementation_->root_;
 
         implementation_->size_ = original.implementation_->size_;
 
-        implementation_->vertices_.clear();
+        const std::vector<htd::vertex_t> & originalVertices = original.implementation_->vertexOrder();
 
-        std::copy(original.implementation_->vertices_.begin(), original.implementation_->vertices_.end(), std::back_inserter(implementation_->vertices_));
+        implementation_->vertices_.assign(originalVertices.begin(), originalVertices.end());
 
         if (original.implementation_->next_vertex_ >= htd::Vertex::FIRST)
         {
@@ -1520,12 +1725,13 @@ htd::Tree & htd::Tree::operator=(const htd::Tree & original)
             implementation_->next_vertex_ = htd::Vertex::FIRST;
         }
 
-        for (htd::Hyperedge * edge : *(original.implementation_->edges_))
-        {
-            implementation_->edges_->push_back(new htd::Hyperedge(*edge));
-        }
-
         implementation_->next_edge_ = original.implementation_->next_edge_;
+
+        implementation_->edges_ = original.implementation_->edges_;
+
+        implementation_->edgeOrder_ = original.implementation_->edgeOrder_;
+
+        implementation_->edgeOrderValid_ = original.implementation_->edgeOrderValid_.load();
     }
 
     return *this;
@@ -1549,24 +1755,22 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
             std::copy(vertexCollection.begin(), vertexCollection.end(), std::back_inserter(implementation_->vertices_));
 
+            implementation_->nodes_.reserve(implementation_->vertices_.back() + 1);
+
             for (htd::vertex_t vertex : implementation_->vertices_)
             {
-                Implementation::Node * newNode = nullptr;
-
                 if (original.isRoot(vertex))
                 {
-                    newNode = new Implementation::Node(vertex, htd::Vertex::UNKNOWN);
+                    implementation_->nodes_.emplace(vertex, vertex, htd::Vertex::UNKNOWN);
                 }
                 else
                 {
-                    newNode = new Implementation::Node(vertex, original.parent(vertex));
+                    implementation_->nodes_.emplace(vertex, vertex, original.parent(vertex));
                 }
 
                 const htd::ConstCollection<htd::vertex_t> & childCollection = original.children(vertex);
 
-                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(newNode->children));
-
-                implementation_->nodes_.emplace(vertex, newNode);
+                std::copy(childCollection.begin(), childCollection.end(), std::back_inserter(implementation_->nodes_.at(vertex).children));
 
                 if (vertex > maximumVertex)
                 {
@@ -1585,15 +1789,27 @@ htd::Tree & htd::Tree::operator=(const htd::ITree & original)
 
             const htd::ConstCollection<htd::Hyperedge> & originalEdges = original.hyperedges();
 
-            for (auto it = originalEdges.begin(); it != originalEdges.end(); ++it)
+            for (const htd::Hyperedge & edge : originalEdges)
             {
-                implementation_->edges_->push_back(new htd::Hyperedge(*it));
-            }
+                htd::vertex_t child = edge[0];
 
-            if (!implementation_->edges_->empty())
-            {
-                implementation_->next_edge_ = (*(implementation_->edges_->rbegin()))->id() + 1;
+                if (implementation_->nodes_.at(child).parent != edge[1])
+                {
+                    child = edge[1];
+                }
+
+                implementation_->nodes_.at(child).edge = edge.id();
+
+                implementation_->edges_.emplace(edge.id(), edge.id(), edge[0], edge[1]);
+
+                if (edge.id() >= implementation_->next_edge_)
+                {
+                    implementation_->next_edge_ = edge.id() + 1;
+                }
             }
+
+            /* The edge IDs of the original tree need not be in ascending order, so the collection is built on demand. */
+            implementation_->edgeOrderValid_ = false;
         }
     }
 
@@ -1607,48 +1823,6 @@ void htd::Tree::assign(const htd::ITree & original)
 }
 #endif
 
-void htd::Tree::Implementation::updateEdgesAfterSwapWithParent(Node & node, Node & parentNode, Node & grandParentNode)
-{
-    htd::vertex_t vertex = node.id;
-    htd::vertex_t parent = parentNode.id;
-    htd::vertex_t grandParent = grandParentNode.id;
-
-    auto relevantEdgePosition = edges_->end();
-
-    for (auto it = grandParentNode.edges.begin(); it != grandParentNode.edges.end() && relevantEdgePosition == edges_->end(); ++it)
-    {
-        auto edgePosition = htd::hyperedgePointerPosition(edges_->begin(), edges_->end(), *it);
-
-        if ((*edgePosition)->contains(parent))
-        {
-            relevantEdgePosition = edgePosition;
-        }
-    }
-
-    htd::id_t oldEdgeId = (*relevantEdgePosition)->id();
-
-    parentNode.edges.erase(std::lower_bound(parentNode.edges.begin(), parentNode.edges.end(), oldEdgeId));
-
-    grandParentNode.edges.erase(std::lower_bound(grandParentNode.edges.begin(), grandParentNode.edges.end(), oldEdgeId));
 
-    node.edges.emplace_back(next_edge_);
-
-    grandParentNode.edges.emplace_back(next_edge_);
-
-    (*relevantEdgePosition)->setId(next_edge_);
-
-    if (vertex < grandParent)
-    {
-        (*relevantEdgePosition)->setElements(vertex, grandParent);
-    }
-    else
-    {
-        (*relevantEdgePosition)->setElements(grandParent, vertex);
-    }
-
-    ++next_edge_;
-
-    std::rotate(relevantEdgePosition, relevantEdgePosition + 1, edges_->end());
-}
 
 #endif /* HTD_HTD_TREE_CPP */
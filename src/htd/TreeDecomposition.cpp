@@ -50,7 +50,7 @@ htd::TreeDecomposition::TreeDecomposition(const htd::ITree & original) : htd::La
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
+        bagContent_.setBagContent(vertex, std::vector<htd::vertex_t>());
 
         inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
     }
@@ -60,7 +60,7 @@ htd::TreeDecomposition::TreeDecomposition(const htd::ILabeledTree & original) :
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_.emplace(vertex, std::vector<htd::vertex_t>());
+        bagContent_.setBagContent(vertex, std::vector<htd::vertex_t>());
 
         inducedEdges_.emplace(vertex, htd::FilteredHyperedgeCollection());
     }
@@ -70,7 +70,7 @@ htd::TreeDecomposition::TreeDecomposition(const htd::ITreeDecomposition & origin
 {
     for (htd::vertex_t vertex : original.vertices())
     {
-        bagContent_[vertex] = original.bagContent(vertex);
+        bagContent_.setBagContent(vertex, original.bagContent(vertex));
 
         inducedEdges_[vertex] = original.inducedHyperedges(vertex);
     }
@@ -85,7 +85,7 @@ void htd::TreeDecomposition::removeVertex(htd::vertex_t vertex)
 {
     htd::Tree::removeVertex(vertex);
 
-    bagContent_.erase(vertex);
+    bagContent_.removeBag(vertex);
 
     inducedEdges_.erase(vertex);
 }
@@ -101,7 +101,7 @@ void htd::TreeDecomposition::removeSubtree(htd::vertex_t subtreeRoot)
         HTD_UNUSED(parent)
         HTD_UNUSED(distanceToSubtreeRoot)
 
-        bagContent_.erase(vertex);
+        bagContent_.removeBag(vertex);
 
         inducedEdges_.erase(vertex);
     }, subtreeRoot);
@@ -117,7 +117,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(void)
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::vector<htd::vertex_t>());
+        bagContent_.setBagContent(ret, std::vector<htd::vertex_t>());
 
         inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
     }
@@ -133,7 +133,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(const std::vector<htd::vertex_t
 
     if (inserted)
     {
-        bagContent_[ret] = bagContent;
+        bagContent_.setBagContent(ret, bagContent);
 
         inducedEdges_[ret] = inducedEdges;
     }
@@ -149,7 +149,7 @@ htd::vertex_t htd::TreeDecomposition::insertRoot(std::vector<htd::vertex_t> && b
 
     if (inserted)
     {
-        bagContent_.emplace(ret, std::move(bagContent));
+        bagContent_.setBagContent(ret, bagContent);
 
         inducedEdges_.emplace(ret, std::move(inducedEdges));
     }
@@ -161,7 +161,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
+    bagContent_.setBagContent(ret, std::vector<htd::vertex_t>());
 
     inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
 
@@ -172,7 +172,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, const std::
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_[ret] = bagContent;
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_[ret] = inducedEdges;
 
@@ -183,7 +183,7 @@ htd::vertex_t htd::TreeDecomposition::addChild(htd::vertex_t vertex, std::vector
 {
     htd::vertex_t ret = htd::Tree::addChild(vertex);
 
-    bagContent_.emplace(ret, std::move(bagContent));
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_.emplace(ret, std::move(inducedEdges));
 
@@ -194,7 +194,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex)
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_.emplace(ret, std::vector<htd::vertex_t>());
+    bagContent_.setBagContent(ret, std::vector<htd::vertex_t>());
 
     inducedEdges_.emplace(ret, htd::FilteredHyperedgeCollection());
 
@@ -205,7 +205,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, const std:
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_[ret] = bagContent;
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_[ret] = inducedEdges;
 
@@ -216,7 +216,7 @@ htd::vertex_t htd::TreeDecomposition::addParent(htd::vertex_t vertex, std::vecto
 {
     htd::vertex_t ret = htd::Tree::addParent(vertex);
 
-    bagContent_.emplace(ret, std::move(bagContent));
+    bagContent_.setBagContent(ret, bagContent);
 
     inducedEdges_.emplace(ret, std::move(inducedEdges));
 
@@ -227,7 +227,7 @@ void htd::TreeDecomposition::removeChild(htd::vertex_t vertex, htd::vertex_t chi
 {
     htd::Tree::removeChild(vertex, child);
 
-    bagContent_.erase(child);
+    bagContent_.removeBag(child);
 
     inducedEdges_.erase(child);
 }
@@ -293,7 +293,7 @@ std::size_t htd::TreeDecomposition::forgetNodeCount(void) const
 
     for (htd::vertex_t node : vertexVector())
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+        const htd::Bag & bag = bagContent(node);
 
         std::vector<htd::vertex_t> childBagContent;
 
@@ -321,7 +321,7 @@ void htd::TreeDecomposition::copyForgetNodesTo(std::vector<htd::vertex_t> & targ
 {
     for (htd::vertex_t node : vertexVector())
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+        const htd::Bag & bag = bagContent(node);
 
         std::vector<htd::vertex_t> childBagContent;
 
@@ -351,7 +351,7 @@ bool htd::TreeDecomposition::isForgetNode(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -366,7 +366,7 @@ std::size_t htd::TreeDecomposition::introduceNodeCount(void) const
 
     for (htd::vertex_t node : vertexVector())
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+        const htd::Bag & bag = bagContent(node);
 
         std::vector<htd::vertex_t> childBagContent;
 
@@ -394,7 +394,7 @@ void htd::TreeDecomposition::copyIntroduceNodesTo(std::vector<htd::vertex_t> & t
 {
     for (htd::vertex_t node : vertexVector())
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+        const htd::Bag & bag = bagContent(node);
 
         std::vector<htd::vertex_t> childBagContent;
 
@@ -424,7 +424,7 @@ bool htd::TreeDecomposition::isIntroduceNode(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -439,7 +439,7 @@ std::size_t htd::TreeDecomposition::exchangeNodeCount(void) const
 
     for (htd::vertex_t node : vertexVector())
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+        const htd::Bag & bag = bagContent(node);
 
         std::vector<htd::vertex_t> childBagContent;
 
@@ -469,7 +469,7 @@ void htd::TreeDecomposition::copyExchangeNodesTo(std::vector<htd::vertex_t> & ta
 {
     for (htd::vertex_t node : vertexVector())
     {
-        const std::vector<htd::vertex_t> & bag = bagContent(node);
+        const htd::Bag & bag = bagContent(node);
 
         std::vector<htd::vertex_t> childBagContent;
 
@@ -501,7 +501,7 @@ bool htd::TreeDecomposition::isExchangeNode(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -516,21 +516,35 @@ std::size_t htd::TreeDecomposition::bagSize(htd::vertex_t vertex) const
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex).size();
+    return bagContent_.bagContent(vertex).size();
 }
 
 std::vector<htd::vertex_t> & htd::TreeDecomposition::mutableBagContent(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    return bagContent_.mutableBagContent(vertex);
 }
 
-const std::vector<htd::vertex_t> & htd::TreeDecomposition::bagContent(htd::vertex_t vertex) const
+void htd::TreeDecomposition::setBagContent(htd::vertex_t vertex, const std::vector<htd::vertex_t> & content)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    return bagContent_.at(vertex);
+    bagContent_.setBagContent(vertex, content);
+}
+
+void htd::TreeDecomposition::setBagContent(htd::vertex_t vertex, const htd::Bag & content)
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    bagContent_.setBagContent(vertex, content);
+}
+
+const htd::Bag & htd::TreeDecomposition::bagContent(htd::vertex_t vertex) const
+{
+    HTD_ASSERT(isVertex(vertex))
+
+    return bagContent_.bagContent(vertex);
 }
 
 htd::FilteredHyperedgeCollection & htd::TreeDecomposition::mutableInducedHyperedges(htd::vertex_t vertex)
@@ -589,7 +603,7 @@ std::size_t htd::TreeDecomposition::forgottenVertexCount(htd::vertex_t vertex) c
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -603,8 +617,8 @@ std::size_t htd::TreeDecomposition::forgottenVertexCount(htd::vertex_t vertex, h
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     return htd::set_difference_size(childBag.begin(), childBag.end(), bag.begin(), bag.end());
 }
@@ -617,7 +631,7 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::forgottenVertices(ht
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -637,8 +651,8 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::forgottenVertices(ht
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_difference(childBag.begin(), childBag.end(), bag.begin(), bag.end(), std::back_inserter(result));
 
@@ -649,7 +663,7 @@ void htd::TreeDecomposition::copyForgottenVerticesTo(htd::vertex_t vertex, std::
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -663,8 +677,8 @@ void htd::TreeDecomposition::copyForgottenVerticesTo(htd::vertex_t vertex, std::
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_difference(childBag.begin(), childBag.end(), bag.begin(), bag.end(), std::back_inserter(target));
 }
@@ -713,7 +727,7 @@ std::size_t htd::TreeDecomposition::introducedVertexCount(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -727,8 +741,8 @@ std::size_t htd::TreeDecomposition::introducedVertexCount(htd::vertex_t vertex,
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     return htd::set_difference_size(bag.begin(), bag.end(), childBag.begin(), childBag.end());
 }
@@ -741,7 +755,7 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::introducedVertices(h
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -761,8 +775,8 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::introducedVertices(h
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(result));
 
@@ -773,7 +787,7 @@ void htd::TreeDecomposition::copyIntroducedVerticesTo(htd::vertex_t vertex, std:
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -787,8 +801,8 @@ void htd::TreeDecomposition::copyIntroducedVerticesTo(htd::vertex_t vertex, std:
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_difference(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(target));
 }
@@ -837,7 +851,7 @@ std::size_t htd::TreeDecomposition::rememberedVertexCount(htd::vertex_t vertex)
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -851,8 +865,8 @@ std::size_t htd::TreeDecomposition::rememberedVertexCount(htd::vertex_t vertex,
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     return htd::set_intersection_size(bag.begin(), bag.end(), childBag.begin(), childBag.end());
 }
@@ -865,7 +879,7 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::rememberedVertices(h
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -885,8 +899,8 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecomposition::rememberedVertices(h
 
     auto & result = ret.container();
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_intersection(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(result));
 
@@ -897,7 +911,7 @@ void htd::TreeDecomposition::copyRememberedVerticesTo(htd::vertex_t vertex, std:
 {
     HTD_ASSERT(isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
+    const htd::Bag & bag = bagContent(vertex);
 
     std::vector<htd::vertex_t> childBagContent;
 
@@ -911,8 +925,8 @@ void htd::TreeDecomposition::copyRememberedVerticesTo(htd::vertex_t vertex, std:
     HTD_ASSERT(isVertex(vertex))
     HTD_ASSERT(isChild(vertex, child))
 
-    const std::vector<htd::vertex_t> & bag = bagContent(vertex);
-    const std::vector<htd::vertex_t> & childBag = bagContent(child);
+    const htd::Bag & bag = bagContent(vertex);
+    const htd::Bag & childBag = bagContent(child);
 
     std::set_intersection(bag.begin(), bag.end(), childBag.begin(), childBag.end(), std::back_inserter(target));
 }
@@ -969,7 +983,7 @@ void htd::TreeDecomposition::getChildBagSetUnion(htd::vertex_t vertex, std::vect
         }
         case 1:
         {
-            const std::vector<htd::vertex_t> & childBag = bagContent(childAtPosition(vertex, 0));
+            const htd::Bag & childBag = bagContent(childAtPosition(vertex, 0));
 
             target.insert(target.end(), childBag.begin(), childBag.end());
 
@@ -977,7 +991,10 @@ void htd::TreeDecomposition::getChildBagSetUnion(htd::vertex_t vertex, std::vect
         }
         case 2:
         {
-            htd::set_union(bagContent(childAtPosition(vertex, 0)), bagContent(childAtPosition(vertex, 1)), target);
+            const htd::Bag & childBag1 = bagContent(childAtPosition(vertex, 0));
+            const htd::Bag & childBag2 = bagContent(childAtPosition(vertex, 1));
+
+            std::set_union(childBag1.begin(), childBag1.end(), childBag2.begin(), childBag2.end(), std::back_inserter(target));
 
             break;
         }
@@ -985,7 +1002,7 @@ void htd::TreeDecomposition::getChildBagSetUnion(htd::vertex_t vertex, std::vect
         {
             for (auto child : children(vertex))
             {
-                const std::vector<htd::vertex_t> & childBag = bagContent(child);
+                const htd::Bag & childBag = bagContent(child);
 
                 target.insert(target.end(), childBag.begin(), childBag.end());
             }
@@ -1089,7 +1106,7 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::TreeDecomp
 
         for (htd::vertex_t vertex : original.vertexVector())
         {
-            bagContent_[vertex] = original.bagContent(vertex);
+            bagContent_.setBagContent(vertex, original.bagContent(vertex));
 
             inducedEdges_[vertex] = original.inducedHyperedges(vertex);
         }
@@ -1106,7 +1123,7 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITree & or
 
         for (htd::vertex_t vertex : original.vertices())
         {
-            bagContent_[vertex] = std::vector<htd::vertex_t>();
+            bagContent_.setBagContent(vertex, std::vector<htd::vertex_t>());
 
             inducedEdges_[vertex] = htd::FilteredHyperedgeCollection();
         }
@@ -1123,7 +1140,7 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ILabeledTr
 
         for (htd::vertex_t vertex : original.vertices())
         {
-            bagContent_[vertex] = std::vector<htd::vertex_t>();
+            bagContent_.setBagContent(vertex, std::vector<htd::vertex_t>());
 
             inducedEdges_[vertex] = htd::FilteredHyperedgeCollection();
         }
@@ -1140,7 +1157,7 @@ htd::TreeDecomposition & htd::TreeDecomposition::operator=(const htd::ITreeDecom
 
         for (htd::vertex_t vertex : original.vertices())
         {
-            bagContent_[vertex] = original.bagContent(vertex);
+            bagContent_.setBagContent(vertex, original.bagContent(vertex));
 
             inducedEdges_[vertex] = original.inducedHyperedges(vertex);
         }
@@ -204,7 +204,7 @@ void htd::TreeDecompositionOptimizationOperation::apply(const htd::IMultiHypergr
             {
                 htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
 
-                htd::ILabel * newLabel = clone->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+                htd::ILabel * newLabel = clone->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(vertex)), *labelCollection);
 
                 delete labelCollection;
 
@@ -81,7 +81,7 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecompositionVerifier::violationsVe
     
     for (auto it1 = decomposition.vertices().begin(); !ok && it1 != decomposition.vertices().end(); it1++)
     {
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(*it1);
+        const htd::Bag & bag = decomposition.bagContent(*it1);
 
         for (auto it2 = bag.begin(); !ok && it2 != bag.end(); it2++)
         {
@@ -140,7 +140,7 @@ htd::ConstCollection<htd::Hyperedge> htd::TreeDecompositionVerifier::violationsH
 
         if (!ok)
         {
-            const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+            const htd::Bag & bag = decomposition.bagContent(vertex);
 
             index = 0;
 
@@ -198,7 +198,7 @@ htd::ConstCollection<htd::vertex_t> htd::TreeDecompositionVerifier::violationsCo
     {
         HTD_UNUSED(distanceToSubtreeRoot)
 
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+        const htd::Bag & bag = decomposition.bagContent(vertex);
 
         if (parent != htd::Vertex::UNKNOWN)
         {
@@ -0,0 +1,453 @@
+/*
+ * File:   TreeWidthLowerBoundAlgorithm.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_CPP
+#define HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_CPP
+
+#include <htd/Helpers.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+/**
+ *  Private implementation details of class htd::TreeWidthLowerBoundAlgorithm.
+ */
+struct htd::TreeWidthLowerBoundAlgorithm::Implementation
+{
+    /**
+     *  Constructor for the implementation details structure.
+     *
+     *  @param[in] manager   The management instance to which the current object instance belongs.
+     */
+    Implementation(const htd::LibraryInstance * const manager) : managementInstance_(manager)
+    {
+
+    }
+
+    /**
+     *  Copy constructor for the implementation details structure.
+     *
+     *  @param[in] original  The original implementation details structure.
+     */
+    Implementation(const Implementation & original) : managementInstance_(original.managementInstance_)
+    {
+
+    }
+
+    virtual ~Implementation()
+    {
+
+    }
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+
+    /**
+     *  Copy the neighborhood of the remaining vertices of a preprocessed graph.
+     *
+     *  @param[in] preprocessedGraph    The input graph in preprocessed format.
+     *  @param[out] neighborhood        The sorted neighborhood of each remaining vertex, given by the positions of the remaining vertices.
+     */
+    void copyNeighborhood(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & neighborhood) const;
+
+    /**
+     *  Compute a lower bound for the treewidth of a graph by repeatedly contracting a vertex of minimum degree into one of its neighbors.
+     *
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] leastCommonNeighbors     A boolean flag indicating whether the neighbor sharing the least number of common neighbors
+     *                                      with the contracted vertex shall be chosen. Otherwise the neighbor of minimum degree is chosen.
+     *
+     *  @return The largest minimum degree encountered during the contraction process.
+     */
+    std::size_t computeContractionBound(const htd::IPreprocessedGraph & preprocessedGraph, bool leastCommonNeighbors) const;
+};
+
+htd::TreeWidthLowerBoundAlgorithm::TreeWidthLowerBoundAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd::TreeWidthLowerBoundAlgorithm::TreeWidthLowerBoundAlgorithm(const htd::TreeWidthLowerBoundAlgorithm & original) : implementation_(new Implementation(*(original.implementation_)))
+{
+
+}
+
+htd::TreeWidthLowerBoundAlgorithm::~TreeWidthLowerBoundAlgorithm()
+{
+
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return computeLowerBound(preprocessedGraph, (std::size_t)-1);
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeLowerBound(const htd::IPreprocessedGraph & preprocessedGraph, std::size_t targetWidth) const
+{
+    std::size_t ret = computeDegeneracy(preprocessedGraph);
+
+    if (ret < targetWidth)
+    {
+        ret = std::max(ret, computeMinorMinWidth(preprocessedGraph));
+    }
+
+    if (ret < targetWidth)
+    {
+        ret = std::max(ret, computeContractionDegeneracy(preprocessedGraph));
+    }
+
+    return ret;
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeDegeneracy(const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    std::size_t ret = 0;
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood;
+
+    implementation_->copyNeighborhood(preprocessedGraph, neighborhood);
+
+    std::size_t size = neighborhood.size();
+
+    if (size == 0)
+    {
+        return ret;
+    }
+
+    /* The vertices are kept sorted by their current degree, bucketStart[d] is the position of the first vertex of degree d. */
+    std::vector<std::size_t> degree(size);
+
+    std::vector<htd::index_t> bucketStart(size + 1, 0);
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        degree[vertex] = neighborhood[vertex].size();
+
+        ++bucketStart[degree[vertex] + 1];
+    }
+
+    for (htd::index_t index = 1; index <= size; ++index)
+    {
+        bucketStart[index] += bucketStart[index - 1];
+    }
+
+    std::vector<htd::vertex_t> sortedVertices(size);
+
+    std::vector<htd::index_t> positions(size);
+
+    {
+        std::vector<htd::index_t> nextPosition(bucketStart.begin(), bucketStart.end() - 1);
+
+        for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+        {
+            positions[vertex] = nextPosition[degree[vertex]]++;
+
+            sortedVertices[positions[vertex]] = vertex;
+        }
+    }
+
+    for (htd::index_t index = 0; index < size; ++index)
+    {
+        htd::vertex_t vertex = sortedVertices[index];
+
+        ret = std::max(ret, degree[vertex]);
+
+        for (htd::vertex_t neighbor : neighborhood[vertex])
+        {
+            std::size_t neighborDegree = degree[neighbor];
+
+            if (neighborDegree > degree[vertex])
+            {
+                /* Swap the neighbor with the first vertex of its bucket and move the start of the bucket behind it. */
+                htd::index_t firstPosition = bucketStart[neighborDegree];
+
+                htd::vertex_t firstVertex = sortedVertices[firstPosition];
+
+                std::swap(sortedVertices[firstPosition], sortedVertices[positions[neighbor]]);
+
+                positions[firstVertex] = positions[neighbor];
+
+                positions[neighbor] = firstPosition;
+
+                ++bucketStart[neighborDegree];
+
+                --degree[neighbor];
+            }
+        }
+    }
+
+    return ret;
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeMinorMinWidth(const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return implementation_->computeContractionBound(preprocessedGraph, false);
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::computeContractionDegeneracy(const htd::IPreprocessedGraph & preprocessedGraph) const
+{
+    return implementation_->computeContractionBound(preprocessedGraph, true);
+}
+
+const htd::LibraryInstance * htd::TreeWidthLowerBoundAlgorithm::managementInstance(void) const HTD_NOEXCEPT
+{
+    return implementation_->managementInstance_;
+}
+
+void htd::TreeWidthLowerBoundAlgorithm::setManagementInstance(const htd::LibraryInstance * const manager)
+{
+    HTD_ASSERT(manager != nullptr)
+
+    implementation_->managementInstance_ = manager;
+}
+
+htd::TreeWidthLowerBoundAlgorithm * htd::TreeWidthLowerBoundAlgorithm::clone(void) const
+{
+    return new htd::TreeWidthLowerBoundAlgorithm(*this);
+}
+
+void htd::TreeWidthLowerBoundAlgorithm::Implementation::copyNeighborhood(const htd::IPreprocessedGraph & preprocessedGraph, std::vector<std::vector<htd::vertex_t>> & neighborhood) const
+{
+    const std::vector<htd::vertex_t> & remainingVertices = preprocessedGraph.remainingVertices();
+
+    std::vector<htd::vertex_t> positions(preprocessedGraph.neighborhood().size());
+
+    for (htd::index_t index = 0; index < remainingVertices.size(); ++index)
+    {
+        positions[remainingVertices[index]] = static_cast<htd::vertex_t>(index);
+    }
+
+    neighborhood.resize(remainingVertices.size());
+
+    for (htd::index_t index = 0; index < remainingVertices.size(); ++index)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[index];
+
+        const std::vector<htd::vertex_t> & originalNeighborhood = preprocessedGraph.neighborhood(remainingVertices[index]);
+
+        currentNeighborhood.reserve(originalNeighborhood.size());
+
+        for (htd::vertex_t neighbor : originalNeighborhood)
+        {
+            currentNeighborhood.push_back(positions[neighbor]);
+        }
+
+        std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+    }
+}
+
+std::size_t htd::TreeWidthLowerBoundAlgorithm::Implementation::computeContractionBound(const htd::IPreprocessedGraph & preprocessedGraph, bool leastCommonNeighbors) const
+{
+    std::size_t ret = 0;
+
+    std::vector<std::vector<htd::vertex_t>> neighborhood;
+
+    copyNeighborhood(preprocessedGraph, neighborhood);
+
+    std::size_t size = neighborhood.size();
+
+    if (size == 0)
+    {
+        return ret;
+    }
+
+    std::vector<std::size_t> degree(size);
+
+    /* A vertex is pushed into the bucket of its new degree whenever its degree changes, outdated entries are skipped when popping. */
+    std::vector<std::vector<htd::vertex_t>> buckets(size);
+
+    std::size_t minimumDegree = size;
+
+    for (htd::vertex_t vertex = 0; vertex < size; ++vertex)
+    {
+        degree[vertex] = neighborhood[vertex].size();
+
+        buckets[degree[vertex]].push_back(vertex);
+
+        minimumDegree = std::min(minimumDegree, degree[vertex]);
+    }
+
+    std::vector<bool> removed(size, false);
+
+    std::vector<std::uint32_t> marks(size, 0);
+
+    std::uint32_t stamp = 0;
+
+    std::vector<htd::vertex_t> newNeighbors;
+
+    std::size_t remainingVertexCount = size;
+
+    /* Contracted vertices are removed from the unsorted neighborhoods lazily, i.e., once the stale entries of a neighborhood outnumber its current ones. */
+    auto compact = [&](htd::vertex_t vertex)
+    {
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        if (currentNeighborhood.size() > 2 * degree[vertex] + 8)
+        {
+            currentNeighborhood.erase(std::remove_if(currentNeighborhood.begin(), currentNeighborhood.end(), [&](htd::vertex_t neighbor) { return removed[neighbor]; }), currentNeighborhood.end());
+        }
+    };
+
+    /* A graph with n vertices has treewidth at most n - 1, hence the bound cannot improve any further once n <= ret + 1. */
+    while (remainingVertexCount > ret + 1 && !managementInstance_->isTerminated())
+    {
+        htd::vertex_t vertex = 0;
+
+        bool found = false;
+
+        while (!found)
+        {
+            while (buckets[minimumDegree].empty())
+            {
+                ++minimumDegree;
+            }
+
+            vertex = buckets[minimumDegree].back();
+
+            buckets[minimumDegree].pop_back();
+
+            found = !removed[vertex] && degree[vertex] == minimumDegree;
+        }
+
+        ret = std::max(ret, minimumDegree);
+
+        std::vector<htd::vertex_t> & currentNeighborhood = neighborhood[vertex];
+
+        removed[vertex] = true;
+
+        --remainingVertexCount;
+
+        currentNeighborhood.erase(std::remove_if(currentNeighborhood.begin(), currentNeighborhood.end(), [&](htd::vertex_t neighbor) { return removed[neighbor]; }), currentNeighborhood.end());
+
+        if (currentNeighborhood.empty())
+        {
+            continue;
+        }
+
+        htd::vertex_t selectedNeighbor = currentNeighborhood[0];
+
+        if (leastCommonNeighbors)
+        {
+            ++stamp;
+
+            for (htd::vertex_t neighbor : currentNeighborhood)
+            {
+                marks[neighbor] = stamp;
+            }
+
+            std::size_t bestCommonNeighborCount = (std::size_t)-1;
+
+            for (htd::vertex_t neighbor : currentNeighborhood)
+            {
+                std::size_t commonNeighborCount = 0;
+
+                std::vector<htd::vertex_t> & otherNeighborhood = neighborhood[neighbor];
+
+                if (otherNeighborhood.size() > degree[neighbor])
+                {
+                    otherNeighborhood.erase(std::remove_if(otherNeighborhood.begin(), otherNeighborhood.end(), [&](htd::vertex_t otherNeighbor) { return removed[otherNeighbor]; }), otherNeighborhood.end());
+                }
+
+                for (auto it = neighborhood[neighbor].begin(); it != neighborhood[neighbor].end() && commonNeighborCount <= bestCommonNeighborCount; ++it)
+                {
+                    if (marks[*it] == stamp)
+                    {
+                        ++commonNeighborCount;
+                    }
+                }
+
+                if (commonNeighborCount < bestCommonNeighborCount || (commonNeighborCount == bestCommonNeighborCount && degree[neighbor] < degree[selectedNeighbor]))
+                {
+                    bestCommonNeighborCount = commonNeighborCount;
+
+                    selectedNeighbor = neighbor;
+                }
+            }
+        }
+        else
+        {
+            for (htd::vertex_t neighbor : currentNeighborhood)
+            {
+                if (degree[neighbor] < degree[selectedNeighbor])
+                {
+                    selectedNeighbor = neighbor;
+                }
+            }
+        }
+
+        /* Contract the edge between the vertex and the selected neighbor by merging the vertex into the neighbor. */
+        ++stamp;
+
+        for (htd::vertex_t neighbor : neighborhood[selectedNeighbor])
+        {
+            marks[neighbor] = stamp;
+        }
+
+        newNeighbors.clear();
+
+        for (htd::vertex_t neighbor : currentNeighborhood)
+        {
+            if (neighbor != selectedNeighbor)
+            {
+                if (marks[neighbor] == stamp)
+                {
+                    --degree[neighbor];
+
+                    buckets[degree[neighbor]].push_back(neighbor);
+
+                    minimumDegree = std::min(minimumDegree, degree[neighbor]);
+                }
+                else
+                {
+                    neighborhood[neighbor].push_back(selectedNeighbor);
+
+                    newNeighbors.push_back(neighbor);
+                }
+
+                compact(neighbor);
+            }
+        }
+
+        std::vector<htd::vertex_t> & selectedNeighborhood = neighborhood[selectedNeighbor];
+
+        selectedNeighborhood.insert(selectedNeighborhood.end(), newNeighbors.begin(), newNeighbors.end());
+
+        degree[selectedNeighbor] = degree[selectedNeighbor] - 1 + newNeighbors.size();
+
+        compact(selectedNeighbor);
+
+        buckets[degree[selectedNeighbor]].push_back(selectedNeighbor);
+
+        minimumDegree = std::min(minimumDegree, degree[selectedNeighbor]);
+
+        std::vector<htd::vertex_t>().swap(currentNeighborhood);
+    }
+
+    return ret;
+}
+
+#endif /* HTD_HTD_TREEWIDTHLOWERBOUNDALGORITHM_CPP */
@@ -30,21 +30,13 @@
 #include <htd/TriangulationMinimizationOrderingAlgorithm.hpp>
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
-#include <htd/IMutableGraph.hpp>
-#include <htd/IMutableMultiHypergraph.hpp>
-#include <htd/GraphFactory.hpp>
-#include <htd/MultiHypergraphFactory.hpp>
 #include <htd/VertexOrdering.hpp>
-#include <htd/VectorAdapter.hpp>
 #include <htd/OrderingAlgorithmFactory.hpp>
-#include <htd/EnhancedMaximumCardinalitySearchOrderingAlgorithm.hpp>
-#include <htd/MinFillOrderingAlgorithm.hpp>
 
 #include <algorithm>
-#include <numeric>
-#include <stack>
-#include <unordered_map>
-#include <unordered_set>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 /**
  *  Private implementation details of class htd::TriangulationMinimizationOrderingAlgorithm.
@@ -99,690 +91,564 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
     htd::IOrderingAlgorithm * orderingAlgorithm_;
 
     /**
-     *  Internal data structure representing a triangulated graph.
+     *  Internal data structure representing the triangulation of a graph which is induced by a vertex elimination ordering.
+     *
+     *  The vertices are identified by their positions within the elimination ordering. Hence, all vertex sets can be
+     *  stored in dense arrays and the vertices which are eliminated after a given vertex form a suffix of each sorted
+     *  neighborhood.
      */
-    class TriangulatedGraph : public htd::IGraphStructure
+    class Triangulation
     {
         public:
             /**
-             *  Constructor for a triangulated graph.
+             *  Constructor for a triangulation.
              *
              *  @param[in] graph                The graph which shall be triangulated.
              *  @param[in] eliminationSequence  A vertex elimination ordering for the given graph.
              */
-            TriangulatedGraph(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & eliminationSequence) : names_(), internalNames_(), vertices_(graph.vertexCount()), neighborhood_(graph.vertexCount()), edgeCount_(), positions_(graph.vertexCount()), fillEdges_(graph.vertexCount())
+            Triangulation(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & eliminationSequence) : names_(eliminationSequence), neighborhood_(eliminationSequence.size()), fillEdges_(eliminationSequence.size()), fillEdgeCount_(0)
             {
-                initialize(graph);
+                HTD_ASSERT(eliminationSequence.size() == graph.vertexCount())
 
-                triangulate(eliminationSequence);
+                initialize(graph);
 
-                std::iota(vertices_.begin(), vertices_.end(), 0);
+                triangulate();
             }
 
             /**
-             *  Copy constructor for a triangulated graph.
+             *  Getter for the number of vertices of the triangulation.
              *
-             *  @param[in] original The original triangulated graph.
+             *  @return The number of vertices of the triangulation.
              */
-            TriangulatedGraph(const TriangulatedGraph & original) : names_(original.names_), internalNames_(original.internalNames_), vertices_(original.vertices_), neighborhood_(original.neighborhood_), edgeCount_(original.edgeCount_), positions_(original.positions_), fillEdges_(original.fillEdges_)
+            std::size_t vertexCount(void) const HTD_NOEXCEPT
             {
-
+                return names_.size();
             }
 
             /**
-             *  Destructor for a triangulated graph.
+             *  Getter for the number of fill edges of the triangulation.
+             *
+             *  @return The number of fill edges of the triangulation.
              */
-            virtual ~TriangulatedGraph()
+            std::size_t fillEdgeCount(void) const HTD_NOEXCEPT
             {
-
+                return fillEdgeCount_;
             }
 
-            std::size_t vertexCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
-            {
-                return neighborhood_.size();
-            }
-
-            std::size_t edgeCount(void) const HTD_NOEXCEPT HTD_OVERRIDE
+            /**
+             *  Getter for the neighborhood of a vertex.
+             *
+             *  @note The neighborhood does not include the vertex itself and it is sorted in ascending order.
+             *
+             *  @param[in] vertex   The position of the vertex within the elimination ordering.
+             *
+             *  @return The positions of the neighbors of the vertex within the elimination ordering.
+             */
+            const std::vector<htd::index_t> & neighborhood(htd::index_t vertex) const
             {
-                return edgeCount_;
-            }
+                HTD_ASSERT(vertex < names_.size())
 
-            std::size_t edgeCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                return neighborCount(vertex);
+                return neighborhood_[vertex];
             }
 
-            htd::ConstCollection<htd::vertex_t> vertices(void) const HTD_OVERRIDE
+            /**
+             *  Getter for the fill edges which are introduced by the elimination of the given vertex.
+             *
+             *  @note The smaller endpoint of each fill edge is stored first.
+             *
+             *  @param[in] vertex   The position of the vertex within the elimination ordering.
+             *
+             *  @return The fill edges which are introduced by the elimination of the given vertex.
+             */
+            const std::vector<std::pair<htd::index_t, htd::index_t>> & fillEdges(htd::index_t vertex) const
             {
-                return htd::ConstCollection<htd::vertex_t>::getInstance(vertices_);
-            }
+                HTD_ASSERT(vertex < names_.size())
 
-            void copyVerticesTo(std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                target.insert(target.end(), vertices_.begin(), vertices_.end());
+                return fillEdges_[vertex];
             }
 
-            htd::vertex_t vertexAtPosition(htd::index_t index) const HTD_OVERRIDE
+            /**
+             *  Remove a fill edge from the triangulation.
+             *
+             *  @param[in] vertex1      The smaller endpoint of the fill edge.
+             *  @param[in] vertex2      The larger endpoint of the fill edge.
+             *  @param[in] activeVertex The vertex whose elimination introduced the fill edge.
+             */
+            void removeFillEdge(htd::index_t vertex1, htd::index_t vertex2, htd::index_t activeVertex)
             {
-                HTD_ASSERT(index < vertices_.size())
+                HTD_ASSERT(vertex1 < vertex2 && vertex2 < names_.size())
 
-                return vertices_[index];
-            }
+                std::vector<htd::index_t> & neighborhood1 = neighborhood_[vertex1];
+                std::vector<htd::index_t> & neighborhood2 = neighborhood_[vertex2];
 
-            bool isVertex(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                return vertex < vertexCount();
-            }
+                neighborhood1.erase(std::lower_bound(neighborhood1.begin(), neighborhood1.end(), vertex2));
+                neighborhood2.erase(std::lower_bound(neighborhood2.begin(), neighborhood2.end(), vertex1));
 
-            std::size_t isolatedVertexCount(void) const HTD_OVERRIDE
-            {
-                std::size_t ret = 0;
+                std::vector<std::pair<htd::index_t, htd::index_t>> & relevantEdges = fillEdges_[activeVertex];
 
-                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
-                {
-                    if (currentNeighborhood.empty())
-                    {
-                        ret++;
-                    }
-                }
+                relevantEdges.erase(std::find(relevantEdges.begin(), relevantEdges.end(), std::make_pair(vertex1, vertex2)));
 
-                return ret;
+                --fillEdgeCount_;
             }
 
-            htd::ConstCollection<htd::vertex_t> isolatedVertices(void) const HTD_OVERRIDE
+            /**
+             *  Compute a perfect elimination ordering of the triangulation via maximum-cardinality search.
+             *
+             *  @param[out] target  The vector to which the actual identifiers of the vertices shall be written in the order of their elimination.
+             */
+            void computePerfectEliminationOrdering(std::vector<htd::vertex_t> & target) const
             {
-                htd::VectorAdapter<htd::vertex_t> ret;
+                std::size_t size = names_.size();
 
-                auto & result = ret.container();
+                target.resize(size);
 
-                for (htd::vertex_t vertex : vertices_)
-                {
-                    if (neighborhood_[vertex].empty())
-                    {
-                        result.push_back(vertex);
-                    }
-                }
+                std::vector<std::size_t> weights(size, 0);
 
-                return htd::ConstCollection<htd::vertex_t>::getInstance(ret);
-            }
+                std::vector<bool> numbered(size, false);
 
-            htd::vertex_t isolatedVertexAtPosition(htd::index_t index) const HTD_OVERRIDE
-            {
-                const htd::ConstCollection<htd::vertex_t> & isolatedVertexCollection = isolatedVertices();
+                /* Buckets may contain outdated entries which are skipped, since each weight increase pushes the vertex again. */
+                std::vector<std::vector<htd::index_t>> buckets(size + 1);
 
-                HTD_ASSERT(index < isolatedVertexCollection.size())
+                buckets[0].resize(size);
 
-                htd::ConstIterator<htd::vertex_t> it = isolatedVertexCollection.begin();
+                for (htd::index_t vertex = 0; vertex < size; ++vertex)
+                {
+                    buckets[0][vertex] = size - vertex - 1;
+                }
 
-                std::advance(it, index);
+                std::size_t maximumWeight = 0;
 
-                return *it;
-            }
+                std::size_t remainder = size;
 
-            bool isIsolatedVertex(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
+                while (remainder > 0)
+                {
+                    while (buckets[maximumWeight].empty())
+                    {
+                        --maximumWeight;
+                    }
 
-                return neighborhood_[vertex].empty();
-            }
+                    htd::index_t vertex = buckets[maximumWeight].back();
 
-            std::size_t neighborCount(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
+                    buckets[maximumWeight].pop_back();
 
-                return neighborhood_[vertex].size();
-            }
+                    if (!numbered[vertex] && weights[vertex] == maximumWeight)
+                    {
+                        numbered[vertex] = true;
 
-            htd::ConstCollection<htd::vertex_t> neighbors(htd::vertex_t vertex) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
+                        --remainder;
 
-                return htd::ConstCollection<htd::vertex_t>::getInstance(neighborhood_[vertex]);
-            }
+                        target[remainder] = names_[vertex];
 
-            void copyNeighborsTo(htd::vertex_t vertex, std::vector<htd::vertex_t> & target) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
+                        for (htd::index_t neighbor : neighborhood_[vertex])
+                        {
+                            if (!numbered[neighbor])
+                            {
+                                std::size_t weight = ++weights[neighbor];
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+                                buckets[weight].push_back(neighbor);
 
-                target.insert(target.end(), currentNeighborhood.begin(), currentNeighborhood.end());
+                                if (weight > maximumWeight)
+                                {
+                                    maximumWeight = weight;
+                                }
+                            }
+                        }
+                    }
+                }
             }
 
-            htd::vertex_t neighborAtPosition(htd::vertex_t vertex, htd::index_t index) const HTD_OVERRIDE
-            {
-                HTD_ASSERT(isVertex(vertex))
+        private:
+            /**
+             *  The actual identifiers of the vertices, i.e., the underlying vertex elimination ordering.
+             */
+            std::vector<htd::vertex_t> names_;
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+            /**
+             *  A vector containing the neighborhood of each of the vertices.
+             */
+            std::vector<std::vector<htd::index_t>> neighborhood_;
 
-                HTD_ASSERT(index < currentNeighborhood.size())
+            /**
+             *  A vector containing the fill edges introduced by eliminating the vertex corresponding to the index within the vector.
+             */
+            std::vector<std::vector<std::pair<htd::index_t, htd::index_t>>> fillEdges_;
 
-                return currentNeighborhood[index];
-            }
+            /**
+             *  The number of fill edges of the triangulation.
+             */
+            std::size_t fillEdgeCount_;
 
-            bool isNeighbor(htd::vertex_t vertex, htd::vertex_t neighbor) const HTD_OVERRIDE
+            /**
+             *  Inititialize the neighborhoods of the vertices with the edges of the input graph.
+             *
+             *  @param[in] graph    The input graph.
+             */
+            void initialize(const htd::IMultiHypergraph & graph)
             {
-                HTD_ASSERT(isVertex(vertex) && isVertex(neighbor))
+                std::size_t size = names_.size();
 
-                const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[vertex];
+                if (size > 0)
+                {
+                    std::vector<htd::index_t> positions(*std::max_element(names_.begin(), names_.end()) + 1);
 
-                return std::binary_search(currentNeighborhood.begin(), currentNeighborhood.end(), neighbor);
-            }
+                    for (htd::index_t index = 0; index < size; ++index)
+                    {
+                        positions[names_[index]] = index;
+                    }
 
-            bool isConnected(void) const HTD_OVERRIDE
-            {
-                bool ret = true;
+                    std::vector<htd::vertex_t> neighbors;
 
-                if (!vertices_.empty())
-                {
-                    std::stack<htd::vertex_t> originStack;
+                    for (htd::index_t index = 0; index < size; ++index)
+                    {
+                        htd::vertex_t vertex = names_[index];
 
-                    std::unordered_set<htd::vertex_t> visitedVertices;
+                        neighbors.clear();
 
-                    htd::vertex_t currentVertex = vertices_[0];
+                        graph.copyNeighborsTo(vertex, neighbors);
 
-                    originStack.push(currentVertex);
+                        std::vector<htd::index_t> & currentNeighborhood = neighborhood_[index];
 
-                    while (!originStack.empty())
-                    {
-                        currentVertex = originStack.top();
+                        currentNeighborhood.reserve(neighbors.size());
 
-                        if (visitedVertices.count(currentVertex) == 0)
+                        for (htd::vertex_t neighbor : neighbors)
                         {
-                            visitedVertices.insert(currentVertex);
-
-                            originStack.pop();
-
-                            for (htd::vertex_t neighbor : neighborhood_[currentVertex])
+                            if (neighbor != vertex)
                             {
-                                if (visitedVertices.count(neighbor) == 0)
-                                {
-                                    originStack.push(neighbor);
-                                }
+                                currentNeighborhood.push_back(positions[neighbor]);
                             }
                         }
-                        else
-                        {
-                            originStack.pop();
-                        }
-                    }
 
-                    ret = visitedVertices.size() == vertices_.size();
-                }
-                else
-                {
-                    ret = true;
+                        std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+                    }
                 }
-
-                return ret;
             }
 
-            bool isConnected(htd::vertex_t vertex1, htd::vertex_t vertex2) const HTD_OVERRIDE
+            /**
+             *  Triangulate the graph by simulating the elimination of the vertices in the order of their positions.
+             */
+            void triangulate(void)
             {
-                HTD_ASSERT(isVertex(vertex1) && isVertex(vertex2))
+                std::size_t size = names_.size();
 
-                bool ret = false;
+                std::vector<std::size_t> stamps(size, 0);
 
-                if (vertex1 == vertex2)
-                {
-                    ret = true;
-                }
-                else
-                {
-                    std::vector<htd::vertex_t> newVertices;
-                    std::vector<htd::vertex_t> tmpVertices;
+                std::size_t stamp = 0;
+
+                std::vector<std::vector<htd::index_t>> additionalNeighbors(size);
 
-                    std::vector<bool> reachableVertices(vertices_.size());
+                for (htd::index_t vertex = 0; vertex < size; ++vertex)
+                {
+                    const std::vector<htd::index_t> & currentNeighborhood = neighborhood_[vertex];
 
-                    reachableVertices[vertex1] = true;
+                    auto first = std::upper_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
 
-                    newVertices.push_back(vertex1);
+                    std::vector<std::pair<htd::index_t, htd::index_t>> & currentFillEdges = fillEdges_[vertex];
 
-                    while (!ret && !newVertices.empty())
+                    for (auto it = first; it != currentNeighborhood.end(); ++it)
                     {
-                        std::swap(tmpVertices, newVertices);
+                        htd::index_t neighbor = *it;
+
+                        const std::vector<htd::index_t> & neighborNeighborhood = neighborhood_[neighbor];
 
-                        newVertices.resize(0);
+                        ++stamp;
 
-                        for (auto it = tmpVertices.begin(); !ret && it != tmpVertices.end(); it++)
+                        for (auto it2 = std::upper_bound(neighborNeighborhood.begin(), neighborNeighborhood.end(), neighbor); it2 != neighborNeighborhood.end(); ++it2)
                         {
-                            const std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[*it];
+                            stamps[*it2] = stamp;
+                        }
 
-                            for (auto it2 = currentNeighborhood.begin(); !ret && it2 != currentNeighborhood.end(); ++it2)
+                        for (auto it2 = it + 1; it2 != currentNeighborhood.end(); ++it2)
+                        {
+                            if (stamps[*it2] != stamp)
                             {
-                                htd::vertex_t neighbor = *it2;
-
-                                if (!reachableVertices[neighbor])
-                                {
-                                    reachableVertices[neighbor] = true;
-
-                                    newVertices.push_back(neighbor);
+                                currentFillEdges.emplace_back(neighbor, *it2);
 
-                                    if (neighbor == vertex2)
-                                    {
-                                        ret = true;
-                                    }
-                                }
+                                additionalNeighbors[neighbor].push_back(*it2);
+                                additionalNeighbors[*it2].push_back(neighbor);
                             }
                         }
                     }
-                }
 
-                return ret;
-            }
+                    /* The additional neighbors are collected in ascending order, so they can be merged into the sorted neighborhoods directly. */
+                    for (auto it = first; it != currentNeighborhood.end(); ++it)
+                    {
+                        std::vector<htd::index_t> & newNeighbors = additionalNeighbors[*it];
 
-            /**
-             *  Getter for the actual identifiers of the vertices.
-             *
-             *  @return The actual identifiers of the vertices.
-             */
-            const std::vector<htd::vertex_t> & vertexNames(void) const HTD_NOEXCEPT
-            {
-                return names_;
-            }
+                        if (!newNeighbors.empty())
+                        {
+                            htd::inplace_merge(neighborhood_[*it], newNeighbors);
 
-            /**
-             *  Getter for the actual identifier of the given vertex.
-             *
-             *  @param[in] vertex   The internal name of the vertex whose position shall be returned.
-             *
-             *  @return The actual identifier of the given vertex.
-             */
-            htd::vertex_t vertexName(htd::vertex_t vertex) const
-            {
-                HTD_ASSERT(vertex < names_.size());
+                            newNeighbors.clear();
+                        }
+                    }
 
-                return names_[vertex];
+                    fillEdgeCount_ += currentFillEdges.size();
+                }
             }
+    };
 
-            /**
-             *  Getter for the internal identifier of the given vertex.
-             *
-             *  @param[in] vertex   The name of the vertex whose internal identifier shall be returned.
-             *
-             *  @return The internal identifier of the given vertex.
-             */
-            htd::vertex_t internalVertexName(htd::vertex_t vertex) const
-            {
-                return internalNames_.at(vertex);
-            }
+    /**
+     *  Set a bit within a bitset.
+     *
+     *  @param[in] bitset   A pointer to the first word of the bitset.
+     *  @param[in] position The position of the bit.
+     */
+    static void setBit(std::uint64_t * bitset, std::size_t position) HTD_NOEXCEPT
+    {
+        bitset[position >> 6] |= static_cast<std::uint64_t>(1) << (position & 63);
+    }
 
-            /**
-             *  Getter for the position of the given vertex in the underlying vertex elimination ordering.
-             *
-             *  @param[in] vertex   The internal name of the vertex whose position shall be returned.
-             *
-             *  @return The position of the given vertex in the underlying vertex elimination ordering.
-             */
-            htd::index_t position(htd::vertex_t vertex) const
-            {
-                HTD_ASSERT(vertex < names_.size());
+    /**
+     *  Check whether a bit within a bitset is set.
+     *
+     *  @param[in] bitset   A pointer to the first word of the bitset.
+     *  @param[in] position The position of the bit.
+     *
+     *  @return True if the bit is set, false otherwise.
+     */
+    static bool isBitSet(const std::uint64_t * bitset, std::size_t position) HTD_NOEXCEPT
+    {
+        return (bitset[position >> 6] & (static_cast<std::uint64_t>(1) << (position & 63))) != 0;
+    }
 
-                return positions_[vertex];
-            }
+    /**
+     *  Compute a minimal triangulation of a graph given as an adjacency matrix via the MCS-M algorithm.
+     *
+     *  @param[in] vertexCount          The number of vertices of the graph.
+     *  @param[in] wordCount            The number of words of each row of the adjacency matrix.
+     *  @param[in,out] adjacencyMatrix  The rows of the adjacency matrix, stored consecutively. The fill edges of the computed minimal triangulation are added to the matrix.
+     */
+    static void triangulateMinimally(std::size_t vertexCount, std::size_t wordCount, std::vector<std::uint64_t> & adjacencyMatrix)
+    {
+        std::vector<std::uint64_t> edges(adjacencyMatrix);
 
-            /**
-             *  Updatable getter for the vector containing the preprocessed neighborhood of each of the vertices.
-             *
-             *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
-             *
-             *  @return The updatable vector containing the preprocessed neighborhood of each of the vertices.
-             */
-            std::vector<std::vector<htd::vertex_t>> & neighborhood(void) HTD_NOEXCEPT
-            {
-                return neighborhood_;
-            }
+        std::vector<std::size_t> weights(vertexCount, 0);
 
-            /**
-             *  Getter for the vector containing the preprocessed neighborhood of each of the vertices.
-             *
-             *  @note The neighborhood of each vertex returned by this data structure does not include the respective vertex itself.
-             *
-             *  @return The vector containing the preprocessed neighborhood of each of the vertices.
-             */
-            const std::vector<std::vector<htd::vertex_t>> & neighborhood(void) const HTD_NOEXCEPT
-            {
-                return neighborhood_;
-            }
+        std::vector<std::uint64_t> numbered(wordCount, 0);
 
-            /**
-             *  Updatable getter for the vector containing the preprocessed neighborhood of a vertex.
-             *
-             *  @note The neighborhood returned by this data structure does not include the vertex itself.
-             *
-             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
-             *
-             *  @return The updatable vector containing the preprocessed neighborhood of the requested vertex.
-             */
-            std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex)
-            {
-                HTD_ASSERT(vertex < names_.size());
+        std::vector<std::uint64_t> visited(wordCount, 0);
 
-                return neighborhood_[vertex];
-            }
+        std::vector<std::vector<htd::index_t>> reachedVertices(vertexCount);
 
-            /**
-             *  Getter for the vector containing the preprocessed neighborhood of a vertex.
-             *
-             *  @note The neighborhood returned by this data structure does not include the vertex itself.
-             *
-             *  @param[in] vertex   The vertex whose neighborhood shall be returned.
-             *
-             *  @return The vector containing the preprocessed neighborhood of the requested vertex.
-             */
-            const std::vector<htd::vertex_t> & neighborhood(htd::vertex_t vertex) const
-            {
-                HTD_ASSERT(vertex < names_.size());
+        std::vector<htd::index_t> updatedVertices;
 
-                return neighborhood_[vertex];
-            }
+        for (std::size_t step = 0; step < vertexCount; ++step)
+        {
+            htd::index_t selectedVertex = vertexCount;
 
-            /**
-             *  Remove an edge from the graph.
-             *
-             *  @param[in] vertex1      The first endpoint of the edge.
-             *  @param[in] vertex2      The second endpoint of the edge.
-             *  @param[in] activeVertex The currently investigated vertex.
-             */
-            void removeFillEdge(htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t activeVertex)
+            for (htd::index_t vertex = 0; vertex < vertexCount; ++vertex)
             {
-                HTD_ASSERT(vertex1 < names_.size() && vertex2 < names_.size());
-
-                std::vector<htd::vertex_t> & neighborhood1 = neighborhood_[vertex1];
-                std::vector<htd::vertex_t> & neighborhood2 = neighborhood_[vertex2];
-
-                auto position = std::lower_bound(neighborhood1.begin(), neighborhood1.end(), vertex2);
-
-                if (position != neighborhood1.end() && *position == vertex2)
+                if (!isBitSet(numbered.data(), vertex) && (selectedVertex == vertexCount || weights[vertex] > weights[selectedVertex]))
                 {
-                    neighborhood1.erase(position);
-                    neighborhood2.erase(std::lower_bound(neighborhood2.begin(), neighborhood2.end(), vertex1));
+                    selectedVertex = vertex;
                 }
+            }
 
-                std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & relevantEdges = fillEdges_[activeVertex];
+            setBit(numbered.data(), selectedVertex);
 
-                auto edgePosition =
-                    std::find_if(relevantEdges.begin(), relevantEdges.end(), [&](const std::pair<htd::vertex_t, htd::vertex_t> & currentFillEdge)
-                    {
-                       return currentFillEdge.first == vertex1 && currentFillEdge.second == vertex2;
-                    });
+            const std::uint64_t * selectedRow = edges.data() + selectedVertex * wordCount;
 
-                if (edgePosition != relevantEdges.end())
-                {
-                    relevantEdges.erase(edgePosition);
-                }
-            }
+            updatedVertices.clear();
 
-            /**
-             *  Getter for the fill edges which are introduced by the elimination of the given vertex.
-             *
-             *  @param[in] vertex   The vertex.
-             *
-             *  @return The fill edges which are introduced by the elimination of the given vertex.
-             */
-            const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges(htd::vertex_t vertex) const
+            for (std::size_t index = 0; index < wordCount; ++index)
             {
-                HTD_ASSERT(vertex < names_.size());
+                visited[index] = numbered[index] | selectedRow[index];
 
-                return fillEdges_[vertex];
-            }
+                for (std::uint64_t word = selectedRow[index] & ~numbered[index]; word != 0; word &= word - 1)
+                {
+                    htd::index_t neighbor = (index << 6) + htd::countTrailingZeros(word);
 
-            /**
-             *  Recompute the number of edges in the graph to update the result of the function edgeCount().
-             */
-            void updateEdgeCount(void)
-            {
-                edgeCount_ = 0;
+                    updatedVertices.push_back(neighbor);
 
-                for (const std::vector<htd::vertex_t> & currentNeighborhood : neighborhood_)
-                {
-                    edgeCount_ += currentNeighborhood.size();
+                    reachedVertices[weights[neighbor]].push_back(neighbor);
                 }
-
-                edgeCount_ = edgeCount_ >> 1;
             }
 
-#ifdef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
-            /**
-             *  Create a deep copy of the current graph structure.
-             *
-             *  @return A new TriangulatedGraph object identical to the current graph structure.
-             */
-            TriangulatedGraph * clone(void) const
+            /* Each vertex which is reached via a path of strictly lighter vertices, but is not adjacent to the selected vertex, induces a fill edge. */
+            for (std::size_t currentWeight = 0; currentWeight < vertexCount; ++currentWeight)
             {
-                return new TriangulatedGraph(*this);
-            }
+                std::vector<htd::index_t> & currentBucket = reachedVertices[currentWeight];
 
-            htd::IGraphStructure * cloneGraphStructure(void) const HTD_OVERRIDE
-            {
-                return clone();
-            }
-#else
-            TriangulatedGraph * clone(void) const HTD_OVERRIDE
-            {
-                return new TriangulatedGraph(*this);
-            }
-#endif
+                while (!currentBucket.empty())
+                {
+                    htd::index_t vertex = currentBucket.back();
 
-        private:
-            /**
-             *  The actual identifiers of the vertices.
-             */
-            std::vector<htd::vertex_t> names_;
+                    currentBucket.pop_back();
 
-            /**
-             *  A map which maps to each vertex its internal counterpart.
-             */
-            std::unordered_map<htd::vertex_t, htd::vertex_t> internalNames_;
+                    const std::uint64_t * row = edges.data() + vertex * wordCount;
 
-            /**
-             *  The vertices of the triangulated graph.
-             */
-            std::vector<htd::vertex_t> vertices_;
+                    for (std::size_t index = 0; index < wordCount; ++index)
+                    {
+                        std::uint64_t word = row[index] & ~visited[index];
 
-            /**
-             *  A vector containing the neighborhood of each of the vertices.
-             */
-            std::vector<std::vector<htd::vertex_t>> neighborhood_;
+                        visited[index] |= word;
 
-            /**
-             *  The number of edges in the triangulated graph.
-             */
-            std::size_t edgeCount_;
+                        for (; word != 0; word &= word - 1)
+                        {
+                            htd::index_t neighbor = (index << 6) + htd::countTrailingZeros(word);
 
-            /**
-             *  The positions of the vertices within the elimination ordering.
-             */
-            std::vector<htd::index_t> positions_;
+                            std::size_t neighborWeight = weights[neighbor];
 
-            /**
-             *  A vector containing the fill edges introduced by eliminating the vertex corresponding to the index within the vector.
-             */
-            std::vector<std::vector<std::pair<htd::vertex_t, htd::vertex_t>>> fillEdges_;
+                            if (neighborWeight > currentWeight)
+                            {
+                                updatedVertices.push_back(neighbor);
 
-            /**
-             *  Register a given vertex and return its index.
-             *
-             *  @param[in] vertex   The vertex which shall be registered.
-             *
-             *  @return The index of the vertex within the (updated) vector vertexNames.
-             */
-            htd::vertex_t registerVertex(htd::vertex_t vertex)
-            {
-                auto result = internalNames_.emplace(vertex, names_.size());
+                                reachedVertices[neighborWeight].push_back(neighbor);
 
-                if (result.second)
-                {
-                    names_.push_back(vertex);
+                                setBit(adjacencyMatrix.data() + selectedVertex * wordCount, neighbor);
+                                setBit(adjacencyMatrix.data() + neighbor * wordCount, selectedVertex);
+                            }
+                            else
+                            {
+                                currentBucket.push_back(neighbor);
+                            }
+                        }
+                    }
                 }
-
-                return result.first->second;
             }
 
-            /**
-             *  Inititialize the data structure.
-             *
-             *  @param[in] graph    The input graph.
-             */
-            void initialize(const htd::IMultiHypergraph & graph)
+            for (htd::index_t vertex : updatedVertices)
             {
-                std::size_t size = graph.vertexCount();
+                ++weights[vertex];
+            }
+        }
+    }
 
-                if (size > 0)
-                {
-                    names_.reserve(size);
+    /**
+     *  Remove redundant fill edges from a triangulation via the MinimalChordal algorithm.
+     *
+     *  The vertices are processed in reverse elimination order. A fill edge introduced by the elimination of the
+     *  current vertex is a candidate for removal if each common neighbor of its endpoints which is eliminated later
+     *  is adjacent to the current vertex. The candidates which are not part of a minimal triangulation of the
+     *  subgraph induced by their endpoints are removed. All sets are stored as bitsets over local indices which are
+     *  only assigned to the vertices touched by the fill edges of the current vertex.
+     *
+     *  @param[in,out] triangulation    The triangulation which shall be minimized.
+     *
+     *  @return The number of removed fill edges.
+     */
+    std::size_t minimize(Triangulation & triangulation) const
+    {
+        std::size_t ret = 0;
 
-                    if (graph.vertexAtPosition(size - 1) == static_cast<htd::vertex_t>(size))
-                    {
-                        for (htd::index_t index = 0; index < size; ++index)
-                        {
-                            htd::vertex_t vertex = static_cast<htd::vertex_t>(index) + 1;
+        std::size_t size = triangulation.vertexCount();
 
-                            htd::vertex_t mappedVertex = static_cast<htd::vertex_t>(index);
+        /* The stamp arrays identify the members of the vertex sets of the current iteration without clearing them. */
+        std::vector<std::size_t> neighborStamps(size, 0);
+        std::vector<std::size_t> endpointStamps(size, 0);
+        std::vector<std::size_t> outsideStamps(size, 0);
 
-                            names_.push_back(vertex);
+        std::vector<htd::index_t> localPositions(size, 0);
+        std::vector<htd::index_t> outsidePositions(size, 0);
 
-                            internalNames_[vertex] = mappedVertex;
+        std::size_t stamp = 0;
 
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
+        std::vector<htd::index_t> endpoints;
 
-                            graph.copyNeighborsTo(vertex, currentNeighborhood);
+        std::vector<std::pair<htd::index_t, htd::index_t>> memberships;
 
-                            auto position = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex);
+        std::vector<std::uint64_t> outsideNeighbors;
 
-                            if (position != currentNeighborhood.end() && *position == mappedVertex)
-                            {
-                                currentNeighborhood.erase(position);
-                            }
+        std::vector<std::pair<htd::index_t, htd::index_t>> candidateEdges;
 
-                            std::for_each(currentNeighborhood.begin(), currentNeighborhood.end(), [](htd::vertex_t & neighbor){ --neighbor; });
-                        }
-                    }
-                    else
-                    {
-                        const htd::ConstCollection<htd::vertex_t> & vertexCollection = graph.vertices();
+        std::vector<std::uint64_t> localGraph;
 
-                        auto position = vertexCollection.begin();
+        for (htd::index_t vertex = size; vertex-- > 0 && !managementInstance_->isTerminated();)
+        {
+            const std::vector<std::pair<htd::index_t, htd::index_t>> & fillEdges = triangulation.fillEdges(vertex);
 
-                        for (std::size_t remainder = vertexCollection.size(); remainder > 0; --remainder)
-                        {
-                            htd::vertex_t vertex = *position;
+            if (!fillEdges.empty())
+            {
+                ++stamp;
 
-                            htd::vertex_t mappedVertex = registerVertex(vertex);
+                neighborStamps[vertex] = stamp;
 
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[mappedVertex];
+                for (htd::index_t neighbor : triangulation.neighborhood(vertex))
+                {
+                    neighborStamps[neighbor] = stamp;
+                }
 
-                            const htd::ConstCollection<htd::vertex_t> & neighborCollection = graph.neighbors(vertex);
+                endpoints.clear();
 
-                            auto position2 = neighborCollection.begin();
+                for (const std::pair<htd::index_t, htd::index_t> & fillEdge : fillEdges)
+                {
+                    for (htd::index_t endpoint : { fillEdge.first, fillEdge.second })
+                    {
+                        if (endpointStamps[endpoint] != stamp)
+                        {
+                            endpointStamps[endpoint] = stamp;
 
-                            currentNeighborhood.reserve(neighborCollection.size() + 1);
+                            localPositions[endpoint] = endpoints.size();
 
-                            for (std::size_t remainder2 = neighborCollection.size(); remainder2 > 0; --remainder2)
-                            {
-                                currentNeighborhood.push_back(registerVertex(*position2));
+                            endpoints.push_back(endpoint);
+                        }
+                    }
+                }
 
-                                ++position2;
-                            }
+                /* Collect the neighbors of the endpoints which are eliminated later, but are not adjacent to the current vertex. */
+                std::size_t outsideCount = 0;
+
+                memberships.clear();
 
-                            std::sort(currentNeighborhood.begin(), currentNeighborhood.end());
+                for (htd::index_t index = 0; index < endpoints.size(); ++index)
+                {
+                    const std::vector<htd::index_t> & currentNeighborhood = triangulation.neighborhood(endpoints[index]);
 
-                            auto position3 = std::lower_bound(currentNeighborhood.begin(), currentNeighborhood.end(), mappedVertex);
+                    for (auto it = std::upper_bound(currentNeighborhood.begin(), currentNeighborhood.end(), vertex); it != currentNeighborhood.end(); ++it)
+                    {
+                        htd::index_t neighbor = *it;
 
-                            if (position3 != currentNeighborhood.end() && *position3 == mappedVertex)
+                        if (neighborStamps[neighbor] != stamp)
+                        {
+                            if (outsideStamps[neighbor] != stamp)
                             {
-                                currentNeighborhood.erase(position3);
+                                outsideStamps[neighbor] = stamp;
+
+                                outsidePositions[neighbor] = outsideCount;
+
+                                ++outsideCount;
                             }
 
-                            ++position;
+                            memberships.emplace_back(index, outsidePositions[neighbor]);
                         }
                     }
                 }
-            }
 
-            /**
-             *  Triangulate the graph.
-             *
-             *  @param[in] eliminationSequence  A vertex elimination ordering for the given graph.
-             */
-            void triangulate(const std::vector<htd::vertex_t> & eliminationSequence)
-            {
-                HTD_ASSERT(eliminationSequence.size() == vertexCount())
+                std::size_t wordCount = (outsideCount + 63) / 64;
 
-                htd::index_t position = 0;
+                outsideNeighbors.assign(endpoints.size() * wordCount, 0);
 
-                for (htd::vertex_t vertex : eliminationSequence)
+                for (const std::pair<htd::index_t, htd::index_t> & membership : memberships)
                 {
-                    positions_[internalNames_.at(vertex)] = position;
-
-                    ++position;
+                    setBit(outsideNeighbors.data() + membership.first * wordCount, membership.second);
                 }
 
-                for (htd::vertex_t vertex : eliminationSequence)
-                {
-                    htd::vertex_t internalVertex = internalNames_.at(vertex);
+                candidateEdges.clear();
 
-                    htd::index_t currentPosition = positions_[internalVertex];
+                for (const std::pair<htd::index_t, htd::index_t> & fillEdge : fillEdges)
+                {
+                    const std::uint64_t * row1 = outsideNeighbors.data() + localPositions[fillEdge.first] * wordCount;
+                    const std::uint64_t * row2 = outsideNeighbors.data() + localPositions[fillEdge.second] * wordCount;
 
-                    std::vector<htd::vertex_t> relevantNeighbors;
+                    bool candidate = true;
 
-                    for (htd::vertex_t neighbor : neighborhood_[internalVertex])
+                    for (std::size_t index = 0; candidate && index < wordCount; ++index)
                     {
-                        if (positions_[neighbor] > currentPosition)
-                        {
-                            relevantNeighbors.push_back(neighbor);
-                        }
+                        candidate = (row1[index] & row2[index]) == 0;
                     }
 
-                    if (relevantNeighbors.size() > 1)
+                    if (candidate)
                     {
-                        for (auto it = relevantNeighbors.begin(); it != relevantNeighbors.end(); ++it)
-                        {
-                            std::vector<htd::vertex_t> & currentNeighborhood = neighborhood_[*it];
-
-                            std::vector<htd::vertex_t> missingNeighbors;
-
-                            std::set_difference(it + 1, relevantNeighbors.end(), currentNeighborhood.begin(), currentNeighborhood.end(), std::back_inserter(missingNeighbors));
-
-                            if (!missingNeighbors.empty())
-                            {
-                                htd::inplace_merge(currentNeighborhood, missingNeighbors);
-
-                                for (htd::vertex_t missingNeighbor : missingNeighbors)
-                                {
-                                    fillEdges_[internalVertex].emplace_back(*it, missingNeighbor);
-
-                                    std::vector<htd::vertex_t> & currentNeighborhood2 = neighborhood_[missingNeighbor];
-
-                                    currentNeighborhood2.insert(std::lower_bound(currentNeighborhood2.begin(), currentNeighborhood2.end(), *it), *it);
-                                }
-                            }
-                        }
+                        candidateEdges.push_back(fillEdge);
                     }
                 }
-            }
-    };
 
-    /**
-     *  Check whether the given fill edge is a candidate for removal from the given triangulated graph.
-     *
-     *  @param[in] vertex1      The first endpoint of the edge.
-     *  @param[in] vertex2      The second endpoint of the edge.
-     *  @param[in] activeVertex The currently investigated vertex.
-     *  @param[in] position     The position of the currently investigated vertex within the elimination ordering.
-     *  @param[in] graph        The triangulated graph.
-     *
-     *  @return True if the given fill edge is a candidate for removal from the given triangulated graph, false otherwise.
-     */
-    bool isCandidateEdge(htd::vertex_t vertex1, htd::vertex_t vertex2, htd::vertex_t activeVertex, htd::index_t position, const TriangulatedGraph & graph) const
-    {
-        bool ret = true;
+                if (!candidateEdges.empty())
+                {
+                    ++stamp;
 
-        for (htd::vertex_t neighbor : graph.neighborhood(vertex1))
-        {
-            if (graph.position(neighbor) > position && graph.isNeighbor(vertex2, neighbor) && !graph.isNeighbor(activeVertex, neighbor))
-            {
-                ret = false;
+                    ret += removeRedundantFillEdges(triangulation, vertex, candidateEdges, endpointStamps, localPositions, stamp, endpoints, localGraph);
+                }
             }
         }
 
@@ -790,42 +656,80 @@ struct htd::TriangulationMinimizationOrderingAlgorithm::Implementation
     }
 
     /**
-     *  Compute the set of fill edges which can be safely removed.
+     *  Remove the candidate fill edges which are not part of a minimal triangulation of the subgraph induced by their endpoints.
+     *
+     *  @param[in,out] triangulation    The triangulation.
+     *  @param[in] vertex               The vertex whose elimination introduced the candidate fill edges.
+     *  @param[in] candidateEdges       The candidate fill edges.
+     *  @param[in,out] stamps           The stamp array used to identify the endpoints of the candidate fill edges.
+     *  @param[in,out] localPositions   The array storing the local index of each endpoint.
+     *  @param[in] stamp                The stamp identifying the endpoints of the candidate fill edges.
+     *  @param[in,out] endpoints        Temporary vector for the endpoints of the candidate fill edges.
+     *  @param[in,out] localGraph       Temporary vector for the adjacency matrix of the induced subgraph.
      *
-     *  @param[in] graph                    The input graph.
-     *  @param[in] candidateFillEdges       The fill edges which shall be checked.
-     *  @param[in] vertices                 The actual identifier (as used for the candidate fill edges) of the vertices of the input graph.
-     *  @param[in,out] redundantFillEdges   The vector of redundant fill edges which shall be updated.
+     *  @return The number of removed fill edges.
      */
-    void computeRedundantFillEdges(const htd::IGraph & graph, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & candidateFillEdges, const std::vector<htd::vertex_t> & vertices, std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & redundantFillEdges) const
+    std::size_t removeRedundantFillEdges(Triangulation & triangulation, htd::index_t vertex, const std::vector<std::pair<htd::index_t, htd::index_t>> & candidateEdges, std::vector<std::size_t> & stamps, std::vector<htd::index_t> & localPositions, std::size_t stamp, std::vector<htd::index_t> & endpoints, std::vector<std::uint64_t> & localGraph) const
     {
-        htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(managementInstance_);
+        std::size_t ret = 0;
 
-        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+        endpoints.clear();
 
-        TriangulatedGraph triangulatedGraph(graph, ordering->sequence());
+        for (const std::pair<htd::index_t, htd::index_t> & candidateEdge : candidateEdges)
+        {
+            for (htd::index_t endpoint : { candidateEdge.first, candidateEdge.second })
+            {
+                if (stamps[endpoint] != stamp)
+                {
+                    stamps[endpoint] = stamp;
 
-        delete ordering;
+                    localPositions[endpoint] = endpoints.size();
+
+                    endpoints.push_back(endpoint);
+                }
+            }
+        }
 
-        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+        std::size_t wordCount = (endpoints.size() + 63) / 64;
 
-        for (htd::vertex_t vertex : triangulatedGraph.vertices())
+        localGraph.assign(endpoints.size() * wordCount, 0);
+
+        for (htd::index_t index = 0; index < endpoints.size(); ++index)
         {
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : triangulatedGraph.fillEdges(vertex))
+            std::uint64_t * row = localGraph.data() + index * wordCount;
+
+            for (htd::index_t neighbor : triangulation.neighborhood(endpoints[index]))
             {
-                fillEdges.push_back(std::make_pair(vertices[fillEdge.first], vertices[fillEdge.second]));
+                if (stamps[neighbor] == stamp)
+                {
+                    setBit(row, localPositions[neighbor]);
+                }
             }
         }
 
-        std::sort(fillEdges.begin(), fillEdges.end());
+        /* The candidate fill edges are removed from the subgraph before it is triangulated minimally. */
+        for (const std::pair<htd::index_t, htd::index_t> & candidateEdge : candidateEdges)
+        {
+            htd::index_t position1 = localPositions[candidateEdge.first];
+            htd::index_t position2 = localPositions[candidateEdge.second];
 
-        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : candidateFillEdges)
+            localGraph[position1 * wordCount + (position2 >> 6)] &= ~(static_cast<std::uint64_t>(1) << (position2 & 63));
+            localGraph[position2 * wordCount + (position1 >> 6)] &= ~(static_cast<std::uint64_t>(1) << (position1 & 63));
+        }
+
+        triangulateMinimally(endpoints.size(), wordCount, localGraph);
+
+        for (const std::pair<htd::index_t, htd::index_t> & candidateEdge : candidateEdges)
         {
-            if (!std::binary_search(fillEdges.begin(), fillEdges.end(), fillEdge))
+            if (!isBitSet(localGraph.data() + localPositions[candidateEdge.first] * wordCount, localPositions[candidateEdge.second]))
             {
-                redundantFillEdges.push_back(fillEdge);
+                triangulation.removeFillEdge(candidateEdge.first, candidateEdge.second, vertex);
+
+                ++ret;
             }
         }
+
+        return ret;
     }
 };
 
@@ -860,108 +764,33 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
 
 htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph) const HTD_NOEXCEPT
 {
-    htd::IVertexOrdering * ordering = implementation_->orderingAlgorithm_->computeOrdering(graph, preprocessedGraph);
-
-    htd::TriangulationMinimizationOrderingAlgorithm::Implementation::TriangulatedGraph triangulatedGraph(graph, ordering->sequence());
-
-    htd::index_t position = ordering->sequence().size() - 1;
-
-    bool fillEdgeRemoved = false;
-
-    for (auto it = ordering->sequence().rbegin(); it != ordering->sequence().rend(); ++it)
-    {
-        htd::vertex_t vertex = triangulatedGraph.internalVertexName(*it);
-
-        const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges = triangulatedGraph.fillEdges(vertex);
-
-        std::unordered_set<htd::vertex_t> candidateVertices;
-
-        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> candidateEdges;
-
-        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
-        {
-            if (implementation_->isCandidateEdge(fillEdge.first, fillEdge.second, vertex, position, triangulatedGraph))
-            {
-                candidateEdges.push_back(fillEdge);
-
-                candidateVertices.insert(fillEdge.first);
-                candidateVertices.insert(fillEdge.second);
-            }
-        }
-
-        if (!candidateEdges.empty())
-        {
-            std::vector<htd::vertex_t> relevantVertices(candidateVertices.begin(), candidateVertices.end());
-
-            std::sort(relevantVertices.begin(), relevantVertices.end());
-
-            htd::IMutableGraph * localGraph = implementation_->managementInstance_->graphFactory().createInstance(relevantVertices.size());
-
-            std::unordered_map<htd::vertex_t, htd::vertex_t> localMapping;
+    std::size_t initialFillEdgeCount = 0;
+    std::size_t removedFillEdgeCount = 0;
 
-            htd::index_t localPosition = 1;
-
-            for (htd::vertex_t relevantVertex : relevantVertices)
-            {
-                localMapping.emplace(relevantVertex, localPosition);
-
-                ++localPosition;
-            }
-
-            for (auto it2 = relevantVertices.begin(); it2 != relevantVertices.end(); ++it2)
-            {
-                for (auto it3 = it2 + 1; it3 != relevantVertices.end(); ++it3)
-                {
-                    localGraph->addEdge(localMapping.at(*it2), localMapping.at(*it3));
-                }
-            }
-
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : candidateEdges)
-            {
-                localGraph->removeEdge(localMapping.at(candidate.first), localMapping.at(candidate.second));
-            }
-
-            std::vector<std::pair<htd::vertex_t, htd::vertex_t>> redundantFillEdges;
+    return computeOrdering(graph, preprocessedGraph, initialFillEdgeCount, removedFillEdgeCount);
+}
 
-            implementation_->computeRedundantFillEdges(*localGraph, candidateEdges, relevantVertices, redundantFillEdges);
+htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeOrdering(const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph, std::size_t & initialFillEdgeCount, std::size_t & removedFillEdgeCount) const HTD_NOEXCEPT
+{
+    htd::IVertexOrdering * ordering = implementation_->orderingAlgorithm_->computeOrdering(graph, preprocessedGraph);
 
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & candidate : redundantFillEdges)
-            {
-                triangulatedGraph.removeFillEdge(candidate.first, candidate.second, vertex);
+    htd::TriangulationMinimizationOrderingAlgorithm::Implementation::Triangulation triangulation(graph, ordering->sequence());
 
-                fillEdgeRemoved = true;
-            }
+    initialFillEdgeCount = triangulation.fillEdgeCount();
 
-            delete localGraph;
-        }
-
-        --position;
-    }
+    removedFillEdgeCount = implementation_->minimize(triangulation);
 
     htd::IVertexOrdering * ret = nullptr;
 
-    if (fillEdgeRemoved)
+    if (removedFillEdgeCount > 0)
     {
         delete ordering;
 
-        htd::IMutableMultiHypergraph * optimizedGraph = implementation_->managementInstance_->multiHypergraphFactory().createInstance(graph);
-
-        for (htd::vertex_t vertex : triangulatedGraph.vertices())
-        {
-            for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : triangulatedGraph.fillEdges(vertex))
-            {
-                htd::vertex_t vertex1 = triangulatedGraph.vertexName(fillEdge.first);
-                htd::vertex_t vertex2 = triangulatedGraph.vertexName(fillEdge.second);
-
-                optimizedGraph->addEdge(vertex1, vertex2);
-            }
-        }
-
-        htd::MinFillOrderingAlgorithm finalOrderingAlgorithm(implementation_->managementInstance_);
+        std::vector<htd::vertex_t> sequence;
 
-        ret = finalOrderingAlgorithm.computeOrdering(*optimizedGraph);
+        triangulation.computePerfectEliminationOrdering(sequence);
 
-        delete optimizedGraph;
+        ret = new htd::VertexOrdering(std::move(sequence), 1);
     }
     else
     {
@@ -971,6 +800,11 @@ htd::IVertexOrdering * htd::TriangulationMinimizationOrderingAlgorithm::computeO
     return ret;
 }
 
+bool htd::TriangulationMinimizationOrderingAlgorithm::supportsComponentOrdering(void) const HTD_NOEXCEPT
+{
+    return implementation_->orderingAlgorithm_->supportsComponentOrdering();
+}
+
 const htd::LibraryInstance * htd::TriangulationMinimizationOrderingAlgorithm::managementInstance(void) const HTD_NOEXCEPT
 {
     return implementation_->managementInstance_;
@@ -221,7 +221,7 @@ htd::ITreeDecomposition * htd::TrivialTreeDecompositionAlgorithm::computeDecompo
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
-            htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(ret->bagContent(vertex)), *labelCollection);
 
             delete labelCollection;
 
@@ -235,7 +235,7 @@ htd::ITreeDecomposition * htd::TrivialTreeDecompositionAlgorithm::computeDecompo
         {
             htd::ILabelCollection * labelCollection = ret->labelings().exportVertexLabelCollection(vertex);
 
-            htd::ILabel * newLabel = labelingFunction->computeLabel(ret->bagContent(vertex), *labelCollection);
+            htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(ret->bagContent(vertex)), *labelCollection);
 
             delete labelCollection;
 
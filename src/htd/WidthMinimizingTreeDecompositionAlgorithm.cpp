@@ -27,12 +27,16 @@
 
 #include <htd/WidthMinimizingTreeDecompositionAlgorithm.hpp>
 #include <htd/BucketEliminationTreeDecompositionAlgorithm.hpp>
+#include <htd/Helpers.hpp>
+#include <htd/TreeWidthLowerBoundAlgorithm.hpp>
 
 #include <htd/GraphPreprocessorFactory.hpp>
 #include <htd/IGraphPreprocessor.hpp>
 
 #include <cstdarg>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 
 /**
  *  Private implementation details of class htd::WidthMinimizingTreeDecompositionAlgorithm.
@@ -96,6 +100,200 @@ struct htd::WidthMinimizingTreeDecompositionAlgorithm::Implementation
      *  The maximum number of iterations without improvement after which the algorithm shall terminate.
      */
     std::size_t nonImprovementLimit_;
+
+    /**
+     *  Compute the decomposition of minimal width found by several worker threads, each of them repeatedly calling its own copy of the decomposition algorithm.
+     *
+     *  The workers share the iteration limit, the non-improvement limit and the width of the best decomposition found
+     *  so far. The latter is passed as upper bound for the maximum bag size to each new iteration, so that iterations
+     *  which cannot lead to an improvement are aborted early. Every iteration uses a random number generator derived
+     *  from its index and among decompositions of equal width, the one of the earliest iteration is kept. Hence, the
+     *  result is reproducible for a given seed as long as no non-improvement limit is set. The worker which finds the
+     *  first decomposition computes a lower bound for the treewidth while the other workers continue, and all workers
+     *  stop as soon as the best decomposition found so far matches this bound.
+     *
+     *  @param[in] graph                    The input graph to decompose.
+     *  @param[in] preprocessedGraph        The input graph in preprocessed format.
+     *  @param[in] manipulationOperations   The manipulation operations which shall be applied to each decomposition.
+     *  @param[in] progressCallback         A callback function which is invoked for each decomposition of the underlying algorithm.
+     *  @param[in] maxBagSize               The upper bound for the maximum bag size of the decomposition.
+     *  @param[in] threadCount              The number of worker threads.
+     *
+     *  @return The decomposition of minimal width found by the workers or a null-pointer in case that no decomposition with an appropriate maximum bag size could be found.
+     */
+    htd::ITreeDecomposition * computeImprovedDecompositionInParallel(const htd::IMultiHypergraph & graph,
+                                                                     const htd::IPreprocessedGraph & preprocessedGraph,
+                                                                     const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
+                                                                     const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback,
+                                                                     std::size_t maxBagSize, std::size_t threadCount) const
+    {
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
+
+        htd::ITreeDecomposition * ret = nullptr;
+
+        std::size_t bestMaxBagSize = 0;
+
+        std::size_t bestIteration = 0;
+
+        std::size_t startedIterations = 0;
+
+        std::size_t nonImprovedIterations = 0;
+
+        /* A decomposition whose width matches the lower bound for the treewidth cannot be improved any further. */
+        std::atomic<std::size_t> minimumMaxBagSize(preprocessedGraph.minTreeWidth() + 1);
+
+        bool lowerBoundRequested = false;
+
+        htd::TreeWidthLowerBoundAlgorithm lowerBoundAlgorithm(managementInstance_);
+
+        std::mutex mutex;
+
+        /* Each iteration draws its random numbers from its own substream, so that the result does not depend on the scheduling of the threads. */
+        htd::RandomNumberGenerator randomNumberGenerator = managementInstance.randomNumberGenerator().fork();
+
+        auto worker = [&](const htd::BucketEliminationTreeDecompositionAlgorithm & algorithm)
+        {
+            bool finished = false;
+
+            while (!finished)
+            {
+                std::size_t iteration = 0;
+
+                std::size_t bagSizeBound = maxBagSize;
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    finished = managementInstance.isTerminated() ||
+                               (iterationCount_ > 0 && startedIterations >= iterationCount_) ||
+                               nonImprovedIterations >= nonImprovementLimit_ ||
+                               (ret != nullptr && bestMaxBagSize <= minimumMaxBagSize.load());
+
+                    if (!finished)
+                    {
+                        iteration = startedIterations++;
+
+                        /* Ties are broken in favor of the earlier iteration, hence later iterations must find a strictly smaller width. */
+                        if (ret != nullptr)
+                        {
+                            bagSizeBound = iteration < bestIteration || bestMaxBagSize == 0 ? bestMaxBagSize : bestMaxBagSize - 1;
+                        }
+                    }
+                }
+
+                if (!finished)
+                {
+                    std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
+
+                    for (const htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+                    {
+#ifndef HTD_USE_VISUAL_STUDIO_COMPATIBILITY_MODE
+                        clonedManipulationOperations.push_back(operation->clone());
+#else
+                        clonedManipulationOperations.push_back(operation->cloneDecompositionManipulationOperation());
+#endif
+                    }
+
+                    htd::RandomNumberGenerator iterationRandomNumberGenerator = randomNumberGenerator.substream(iteration);
+
+                    std::pair<htd::ITreeDecomposition *, std::size_t> decompositionResult(nullptr, 0);
+
+                    {
+                        htd::RandomNumberGeneratorBinding randomNumberGeneratorBinding(managementInstance, iterationRandomNumberGenerator);
+
+                        decompositionResult = algorithm.computeDecomposition(graph, preprocessedGraph, clonedManipulationOperations, bagSizeBound, 1);
+                    }
+
+                    htd::ITreeDecomposition * currentDecomposition = decompositionResult.first;
+
+                    /* The upper bound which is passed to the computation of the lower bound, 0 if this worker does not compute it. */
+                    std::size_t lowerBoundLimit = 0;
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+
+                        bool improved = false;
+
+                        if (currentDecomposition != nullptr && !managementInstance.isTerminated())
+                        {
+                            std::size_t currentMaxBagSize = currentDecomposition->maximumBagSize();
+
+                            progressCallback(graph, *currentDecomposition, htd::FitnessEvaluation(1, -(static_cast<double>(currentMaxBagSize))));
+
+                            if (currentMaxBagSize <= maxBagSize &&
+                                (ret == nullptr || currentMaxBagSize < bestMaxBagSize || (currentMaxBagSize == bestMaxBagSize && iteration < bestIteration)))
+                            {
+                                delete ret;
+
+                                ret = currentDecomposition;
+
+                                bestMaxBagSize = currentMaxBagSize;
+
+                                bestIteration = iteration;
+
+                                improved = true;
+                            }
+                        }
+
+                        if (improved)
+                        {
+                            nonImprovedIterations = 0;
+                        }
+                        else
+                        {
+                            delete currentDecomposition;
+
+                            nonImprovedIterations += decompositionResult.second;
+                        }
+
+                        /* The lower bound is computed once, by the worker which finds the first decomposition, and without holding the lock, so that the other workers continue meanwhile. */
+                        if (ret != nullptr && !lowerBoundRequested && bestMaxBagSize > minimumMaxBagSize.load() &&
+                            (iterationCount_ == 0 || startedIterations < iterationCount_) && nonImprovedIterations < nonImprovementLimit_)
+                        {
+                            lowerBoundLimit = bestMaxBagSize - 1;
+
+                            lowerBoundRequested = true;
+                        }
+                    }
+
+                    if (lowerBoundLimit > 0)
+                    {
+                        std::size_t lowerBound = lowerBoundAlgorithm.computeLowerBound(preprocessedGraph, lowerBoundLimit) + 1;
+
+                        /* This is the only worker which updates the bound, hence a plain store suffices. */
+                        if (lowerBound > minimumMaxBagSize.load())
+                        {
+                            minimumMaxBagSize.store(lowerBound);
+                        }
+                    }
+                }
+            }
+        };
+
+        std::vector<htd::BucketEliminationTreeDecompositionAlgorithm *> algorithms;
+
+        for (std::size_t index = 1; index < threadCount; ++index)
+        {
+            algorithms.push_back(algorithm_->clone());
+        }
+
+        htd::parallelInvoke(threadCount, [&](std::size_t threadIndex)
+        {
+            worker(threadIndex == 0 ? *algorithm_ : *(algorithms[threadIndex - 1]));
+        });
+
+        for (htd::BucketEliminationTreeDecompositionAlgorithm * algorithm : algorithms)
+        {
+            delete algorithm;
+        }
+
+        for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
+        {
+            delete operation;
+        }
+
+        return ret;
+    }
 };
 
 htd::WidthMinimizingTreeDecompositionAlgorithm::WidthMinimizingTreeDecompositionAlgorithm(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
@@ -271,6 +469,18 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
                                                                                                        const std::vector<htd::IDecompositionManipulationOperation *> & manipulationOperations,
                                                                                                        const std::function<void(const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)> & progressCallback, std::size_t maxBagSize) const
 {
+    std::size_t threadCount = implementation_->managementInstance_->threadCount();
+
+    if (implementation_->iterationCount_ > 0)
+    {
+        threadCount = std::min(threadCount, implementation_->iterationCount_);
+    }
+
+    if (threadCount > 1)
+    {
+        return implementation_->computeImprovedDecompositionInParallel(graph, preprocessedGraph, manipulationOperations, progressCallback, maxBagSize, threadCount);
+    }
+
     std::size_t bestMaxBagSize = maxBagSize + 1;
 
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
@@ -279,7 +489,13 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
 
     htd::index_t iteration = 0;
 
-    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && !managementInstance.isTerminated())
+    /* A decomposition whose width matches the lower bound for the treewidth cannot be improved any further. */
+    std::size_t minimumMaxBagSize = preprocessedGraph.minTreeWidth() + 1;
+
+    bool lowerBoundComputed = false;
+
+    while ((iteration == 0 || implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_) && !managementInstance.isTerminated() &&
+           (ret == nullptr || bestMaxBagSize > minimumMaxBagSize))
     {
         std::vector<htd::IDecompositionManipulationOperation *> clonedManipulationOperations;
 
@@ -348,6 +564,16 @@ htd::ITreeDecomposition * htd::WidthMinimizingTreeDecompositionAlgorithm::comput
                 delete currentDecomposition;
             }
         }
+
+        /* The lower bound only pays off once a decomposition exists and further iterations may follow. */
+        if (ret != nullptr && !lowerBoundComputed && bestMaxBagSize > minimumMaxBagSize && (implementation_->iterationCount_ == 0 || iteration < implementation_->iterationCount_))
+        {
+            htd::TreeWidthLowerBoundAlgorithm lowerBoundAlgorithm(implementation_->managementInstance_);
+
+            minimumMaxBagSize = std::max(minimumMaxBagSize, lowerBoundAlgorithm.computeLowerBound(preprocessedGraph, bestMaxBagSize - 1) + 1);
+
+            lowerBoundComputed = true;
+        }
     }
 
     for (htd::IDecompositionManipulationOperation * operation : manipulationOperations)
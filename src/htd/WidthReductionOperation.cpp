@@ -101,7 +101,7 @@ struct htd::WidthReductionOperation::Implementation
              *  @param[in] graph            The graph for which the induced graph shall be constructed.
              *  @param[in] relevantVertices The vertices of the induced graph.
              */
-            InducedGraph(const htd::IMultiHypergraph & graph, const std::vector<htd::vertex_t> & relevantVertices) : baseGraphToInducedGraphMapping_(), inducedGraphToBaseGraphMapping_(relevantVertices), graph_(graph.managementInstance()->multiGraphFactory().createInstance(relevantVertices.size()))
+            InducedGraph(const htd::IMultiHypergraph & graph, const htd::Bag & relevantVertices) : baseGraphToInducedGraphMapping_(), inducedGraphToBaseGraphMapping_(relevantVertices.begin(), relevantVertices.end()), graph_(graph.managementInstance()->multiGraphFactory().createInstance(relevantVertices.size()))
             {
                 #ifndef NDEBUG
                 for (htd::vertex_t vertex : relevantVertices)
@@ -385,7 +385,7 @@ void htd::WidthReductionOperation::apply(const htd::IMultiHypergraph & graph, ht
                     {
                         htd::ILabelCollection * labelCollection = decomposition.labelings().exportVertexLabelCollection(vertex);
 
-                        htd::ILabel * newLabel = labelingFunction->computeLabel(decomposition.bagContent(vertex), *labelCollection);
+                        htd::ILabel * newLabel = labelingFunction->computeLabel(htd::ConstCollection<htd::vertex_t>::getInstance(decomposition.bagContent(vertex)), *labelCollection);
 
                         delete labelCollection;
 
@@ -496,7 +496,7 @@ bool htd::WidthReductionOperation::Implementation::processDecompositionNode(cons
 
     bool ret = false;
 
-    const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(vertex);
+    const htd::Bag & bagContent = decomposition.bagContent(vertex);
 
     htd::WidthReductionOperation::Implementation::InducedGraph * inducedGraph = createCorrespondingGraph(graph, decomposition, vertex);
 
@@ -540,7 +540,7 @@ bool htd::WidthReductionOperation::Implementation::processDecompositionNode(cons
             auto position =
                 std::find_if(neighbors.begin(), neighbors.end(), [&](htd::vertex_t neighbor)
                              {
-                                const std::vector<htd::vertex_t> & neighborBagContent = decomposition.bagContent(neighbor);
+                                const htd::Bag & neighborBagContent = decomposition.bagContent(neighbor);
 
                                 return std::includes(neighborBagContent.begin(), neighborBagContent.end(), newBag.begin(), newBag.end());
                              });
@@ -567,11 +567,11 @@ bool htd::WidthReductionOperation::Implementation::processDecompositionNode(cons
 
         decomposition.mutableInducedHyperedges(vertex).restrictTo(*separator);
 
-        decomposition.mutableBagContent(vertex) = std::move(*separator);
+        decomposition.setBagContent(vertex, *separator);
 
         for (htd::vertex_t neighbor : neighbors)
         {
-            const std::vector<htd::vertex_t> & neighborBagContent = decomposition.bagContent(neighbor);
+            const htd::Bag & neighborBagContent = decomposition.bagContent(neighbor);
 
             auto position =
                 std::find_if(components.begin(), components.end(), [&](const std::vector<htd::vertex_t> & component)
@@ -604,7 +604,7 @@ bool htd::WidthReductionOperation::Implementation::processDecompositionNode(cons
         auto position =
             std::find_if(neighbors.begin(), neighbors.end(), [&](htd::vertex_t neighbor)
                          {
-                            const std::vector<htd::vertex_t> & neighborBagContent = decomposition.bagContent(neighbor);
+                            const htd::Bag & neighborBagContent = decomposition.bagContent(neighbor);
 
                             return std::includes(neighborBagContent.begin(), neighborBagContent.end(), bagContent.begin(), bagContent.end());
                          });
@@ -700,7 +700,7 @@ htd::WidthReductionOperation::Implementation::InducedGraph * htd::WidthReduction
 {
     HTD_ASSERT(decomposition.isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bagContent = decomposition.bagContent(vertex);
+    const htd::Bag & bagContent = decomposition.bagContent(vertex);
 
     htd::WidthReductionOperation::Implementation::InducedGraph * ret = new htd::WidthReductionOperation::Implementation::InducedGraph(graph, bagContent);
 
@@ -709,7 +709,7 @@ htd::WidthReductionOperation::Implementation::InducedGraph * htd::WidthReduction
 
     for (htd::vertex_t neighbor : neighbors)
     {
-        const std::vector<htd::vertex_t> & neighborBagContent = decomposition.bagContent(neighbor);
+        const htd::Bag & neighborBagContent = decomposition.bagContent(neighbor);
 
         std::vector<htd::vertex_t> relevantBagContent;
 
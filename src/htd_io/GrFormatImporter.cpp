@@ -28,6 +28,7 @@
 #include <htd_io/GrFormatImporter.hpp>
 
 #include <htd/MultiGraphFactory.hpp>
+#include <htd/MultiHypergraphBuilder.hpp>
 
 #include <fstream>
 #include <string>
@@ -54,136 +55,182 @@ struct htd_io::GrFormatImporter::Implementation
     }
 
     /**
-     *  The management instance to which the current object instance belongs.
+     *  Read the vertex count and the edges of an instance from a given stream.
+     *
+     *  @param[in] stream       The input stream from which the information can be read.
+     *  @param[out] builder     The builder which shall collect the edges of the instance.
+     *  @param[out] vertexCount The number of vertices of the instance.
+     *
+     *  @return True if the instance was read successfully, false otherwise. If the program was terminated in the meantime, no edges are collected.
      */
-    const htd::LibraryInstance * managementInstance_;
-};
-
-htd_io::GrFormatImporter::GrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
-
-}
-
-htd_io::GrFormatImporter::~GrFormatImporter(void)
-{
-
-}
-
-htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) const
-{
-    std::ifstream stream(path);
-
-    return import(stream);
-}
-
-htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
-{
-    std::size_t vertexCount = 0;
-    std::size_t edgeCount = 0;
-
-    bool firstLine = true;
+    bool parse(std::istream & stream, htd::MultiHypergraphBuilder & builder, std::size_t & vertexCount) const
+    {
+        vertexCount = 0;
+        std::size_t edgeCount = 0;
 
-    bool error = false;
+        bool firstLine = true;
 
-    htd::IMutableMultiGraph * ret = implementation_->managementInstance_->multiGraphFactory().createInstance();
+        bool error = false;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
 
-    if (stream.good())
-    {
-        std::string line;
+        if (stream.good())
+        {
+            std::string line;
 
-        std::size_t pos = 0;
+            std::size_t pos = 0;
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
-        {
-            if (line.empty())
+            while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
             {
-                error = true;
-            }
-            else
-            {
-                if (line[line.size() - 1] == '\r')
+                if (line.empty())
                 {
-                    line.pop_back();
+                    error = true;
                 }
-
-                if (line[0] != 'c')
+                else
                 {
-                    if (firstLine)
+                    if (line[line.size() - 1] == '\r')
                     {
-                        if (line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
-
-                        line = line.substr(5);
-
-                        vertexCount = std::stol(line, &pos);
+                        line.pop_back();
+                    }
 
-                        if (line[pos] != ' ')
+                    if (line[0] != 'c')
+                    {
+                        if (firstLine)
                         {
-                            error = true;
-                        }
+                            if (line.compare(0, 5, "p tw ") != 0)
+                            {
+                                error = true;
+                            }
 
-                        line = line.substr(pos + 1);
+                            line = line.substr(5);
 
-                        edgeCount = std::stol(line, &pos);
+                            vertexCount = std::stol(line, &pos);
 
-                        if (pos != line.length())
-                        {
-                            error = true;
-                        }
+                            if (line[pos] != ' ')
+                            {
+                                error = true;
+                            }
 
-                        ret->addVertices(vertexCount);
+                            line = line.substr(pos + 1);
 
-                        firstLine = false;
-                    }
-                    else
-                    {
-                        htd::vertex_t vertex1 = std::stoul(line, &pos);
+                            edgeCount = std::stol(line, &pos);
 
-                        if (line[pos] != ' ')
-                        {
-                            error = true;
+                            if (pos != line.length())
+                            {
+                                error = true;
+                            }
+
+                            firstLine = false;
                         }
                         else
                         {
-                            line = line.substr(pos + 1);
-
-                            htd::vertex_t vertex2 = std::stoul(line, &pos);
+                            htd::vertex_t vertex1 = std::stoul(line, &pos);
 
-                            if (pos != line.length())
+                            if (line[pos] != ' ')
                             {
                                 error = true;
                             }
+                            else
+                            {
+                                line = line.substr(pos + 1);
+
+                                htd::vertex_t vertex2 = std::stoul(line, &pos);
+
+                                if (pos != line.length())
+                                {
+                                    error = true;
+                                }
 
-                            ret->addEdge(vertex1, vertex2);
+                                builder.addEdge(vertex1, vertex2);
 
-                            edgeCount--;
+                                edgeCount--;
+                            }
                         }
                     }
                 }
             }
-        }
 
-        if (edgeCount != 0 && !managementInstance.isTerminated())
+            if (edgeCount != 0 && !managementInstance.isTerminated())
+            {
+                error = true;
+            }
+
+            if (managementInstance.isTerminated())
+            {
+                builder.clear();
+            }
+        }
+        else
         {
             error = true;
         }
+
+        return !firstLine && !error;
     }
-    else
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+};
+
+htd_io::GrFormatImporter::GrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::GrFormatImporter::~GrFormatImporter(void)
+{
+
+}
+
+htd::IMultiGraph * htd_io::GrFormatImporter::import(const std::string & path) const
+{
+    std::ifstream stream(path);
+
+    return import(stream);
+}
+
+htd::IMultiGraph * htd_io::GrFormatImporter::import(std::istream & stream) const
+{
+    std::size_t vertexCount = 0;
+
+    htd::IMutableMultiGraph * ret = nullptr;
+
+    htd::MultiHypergraphBuilder builder;
+
+    if (implementation_->parse(stream, builder, vertexCount))
     {
-        error = true;
+        ret = implementation_->managementInstance_->multiGraphFactory().createInstance();
+
+        ret->addVertices(vertexCount);
+
+        builder.populate(*ret);
     }
 
-    if (firstLine || error)
-    {
-        delete ret;
+    return ret;
+}
+
+htd::CompactHypergraph * htd_io::GrFormatImporter::importCompact(const std::string & path) const
+{
+    std::ifstream stream(path);
+
+    return importCompact(stream);
+}
 
-        ret = nullptr;
+htd::CompactHypergraph * htd_io::GrFormatImporter::importCompact(std::istream & stream) const
+{
+    std::size_t vertexCount = 0;
+
+    htd::CompactHypergraph * ret = nullptr;
+
+    htd::MultiHypergraphBuilder builder;
+
+    if (implementation_->parse(stream, builder, vertexCount))
+    {
+        ret = builder.freeze(implementation_->managementInstance_, vertexCount);
     }
-    
+
     return ret;
 }
 
@@ -27,6 +27,7 @@
 
 #include <htd_io/HgrFormatImporter.hpp>
 
+#include <htd/MultiHypergraphBuilder.hpp>
 #include <htd/MultiHypergraphFactory.hpp>
 
 #include <fstream>
@@ -54,141 +55,187 @@ struct htd_io::HgrFormatImporter::Implementation
     }
 
     /**
-     *  The management instance to which the current object instance belongs.
+     *  Read the vertex count and the edges of an instance from a given stream.
+     *
+     *  @param[in] stream       The input stream from which the information can be read.
+     *  @param[out] builder     The builder which shall collect the edges of the instance.
+     *  @param[out] vertexCount The number of vertices of the instance.
+     *
+     *  @return True if the instance was read successfully, false otherwise. If the program was terminated in the meantime, no edges are collected.
      */
-    const htd::LibraryInstance * managementInstance_;
-};
-
-htd_io::HgrFormatImporter::HgrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
-{
-
-}
-
-htd_io::HgrFormatImporter::~HgrFormatImporter(void)
-{
-
-}
-
-htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(const std::string & path) const
-{
-    std::ifstream stream(path);
-
-    return import(stream);
-}
-
-htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream) const
-{
-    std::size_t vertexCount = 0;
-    std::size_t edgeCount = 0;
-
-    bool firstLine = true;
-
-    bool error = false;
+    bool parse(std::istream & stream, htd::MultiHypergraphBuilder & builder, std::size_t & vertexCount) const
+    {
+        vertexCount = 0;
+        std::size_t edgeCount = 0;
 
-    htd::IMutableMultiHypergraph * ret = implementation_->managementInstance_->multiHypergraphFactory().createInstance();
+        bool firstLine = true;
 
-    const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
+        bool error = false;
 
-    if (stream.good())
-    {
-        std::string line;
+        const htd::LibraryInstance & managementInstance = *managementInstance_;
 
-        while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
+        if (stream.good())
         {
-            if (line.empty())
-            {
-                error = true;
-            }
-            else
+            std::string line;
+
+            while (!error && std::getline(stream, line) && !managementInstance.isTerminated())
             {
-                if (line[line.size() - 1] == '\r')
+                if (line.empty())
                 {
-                    line.pop_back();
+                    error = true;
                 }
-
-                if (line[0] != 'c')
+                else
                 {
-                    if (firstLine)
+                    if (line[line.size() - 1] == '\r')
                     {
-                        if (line.length() < 5 || line.compare(0, 5, "p tw ") != 0)
-                        {
-                            error = true;
-                        }
-                        else
-                        {
-                            line = line.substr(5);
-
-                            std::size_t pos = 0;
-
-                            vertexCount = std::stol(line, &pos);
+                        line.pop_back();
+                    }
 
-                            if (line[pos] != ' ')
+                    if (line[0] != 'c')
+                    {
+                        if (firstLine)
+                        {
+                            if (line.length() < 5 || line.compare(0, 5, "p tw ") != 0)
                             {
                                 error = true;
                             }
+                            else
+                            {
+                                line = line.substr(5);
 
-                            line = line.substr(pos + 1);
+                                std::size_t pos = 0;
 
-                            edgeCount = std::stol(line, &pos);
+                                vertexCount = std::stol(line, &pos);
 
-                            if (pos != line.length())
-                            {
-                                error = true;
-                            }
+                                if (line[pos] != ' ')
+                                {
+                                    error = true;
+                                }
 
-                            ret->addVertices(vertexCount);
+                                line = line.substr(pos + 1);
 
-                            firstLine = false;
-                        }
-                    }
-                    else
-                    {
-                        std::size_t pos = 0;
+                                edgeCount = std::stol(line, &pos);
 
-                        std::vector<htd::vertex_t> vertices;
+                                if (pos != line.length())
+                                {
+                                    error = true;
+                                }
 
-                        while (!error && pos != line.length())
+                                firstLine = false;
+                            }
+                        }
+                        else
                         {
-                            vertices.push_back(std::stoul(line, &pos));
+                            std::size_t pos = 0;
+
+                            std::vector<htd::vertex_t> vertices;
 
-                            if (pos != line.length())
+                            while (!error && pos != line.length())
                             {
-                                if (line[pos] != ' ')
-                                {
-                                    error = true;
-                                }
-                                else
-                                {
-                                    line = line.substr(pos + 1);
+                                vertices.push_back(std::stoul(line, &pos));
 
-                                    pos = 0;
+                                if (pos != line.length())
+                                {
+                                    if (line[pos] != ' ')
+                                    {
+                                        error = true;
+                                    }
+                                    else
+                                    {
+                                        line = line.substr(pos + 1);
+
+                                        pos = 0;
+                                    }
                                 }
                             }
-                        }
 
-                        ret->addEdge(std::move(vertices));
+                            builder.addEdge(std::move(vertices));
 
-                        edgeCount--;
+                            edgeCount--;
+                        }
                     }
                 }
             }
-        }
 
-        if (edgeCount != 0 && !managementInstance.isTerminated())
+            if (edgeCount != 0 && !managementInstance.isTerminated())
+            {
+                error = true;
+            }
+
+            if (managementInstance.isTerminated())
+            {
+                builder.clear();
+            }
+        }
+        else
         {
             error = true;
         }
+
+        return !firstLine && !error;
     }
-    else
+
+    /**
+     *  The management instance to which the current object instance belongs.
+     */
+    const htd::LibraryInstance * managementInstance_;
+};
+
+htd_io::HgrFormatImporter::HgrFormatImporter(const htd::LibraryInstance * const manager) : implementation_(new Implementation(manager))
+{
+
+}
+
+htd_io::HgrFormatImporter::~HgrFormatImporter(void)
+{
+
+}
+
+htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(const std::string & path) const
+{
+    std::ifstream stream(path);
+
+    return import(stream);
+}
+
+htd::IMultiHypergraph * htd_io::HgrFormatImporter::import(std::istream & stream) const
+{
+    std::size_t vertexCount = 0;
+
+    htd::IMutableMultiHypergraph * ret = nullptr;
+
+    htd::MultiHypergraphBuilder builder;
+
+    if (implementation_->parse(stream, builder, vertexCount))
     {
-        error = true;
+        ret = implementation_->managementInstance_->multiHypergraphFactory().createInstance();
+
+        ret->addVertices(vertexCount);
+
+        builder.populate(*ret);
     }
 
-    if (firstLine || error)
-    {
-        delete ret;
+    return ret;
+}
 
-        ret = nullptr;
+htd::CompactHypergraph * htd_io::HgrFormatImporter::importCompact(const std::string & path) const
+{
+    std::ifstream stream(path);
+
+    return importCompact(stream);
+}
+
+htd::CompactHypergraph * htd_io::HgrFormatImporter::importCompact(std::istream & stream) const
+{
+    std::size_t vertexCount = 0;
+
+    htd::CompactHypergraph * ret = nullptr;
+
+    htd::MultiHypergraphBuilder builder;
+
+    if (implementation_->parse(stream, builder, vertexCount))
+    {
+        ret = builder.freeze(implementation_->managementInstance_, vertexCount);
     }
 
     return ret;
@@ -39,7 +39,7 @@ htd_io::HumanReadableExporter::~HumanReadableExporter()
 
 }
 
-void printBagContent(const std::vector<htd::vertex_t> & bag, std::ostream & outputStream)
+void printBagContent(const htd::Bag & bag, std::ostream & outputStream)
 {
     outputStream << "[ ";
 
@@ -63,7 +63,7 @@ void printBagContent(const std::vector<htd::vertex_t> & bag, std::ostream & outp
     }
 }
 
-void printBagContent(const std::vector<htd::vertex_t> & bag, std::ostream & outputStream, const htd::NamedMultiHypergraph<std::string, std::string> & graph)
+void printBagContent(const htd::Bag & bag, std::ostream & outputStream, const htd::NamedMultiHypergraph<std::string, std::string> & graph)
 {
     outputStream << "[ ";
 
@@ -91,7 +91,7 @@ void printHyperedge(const htd::Hyperedge & hyperedge, std::ostream & outputStrea
 {
     outputStream << "HYPEREDGE " << hyperedge.id() << ": [ ";
 
-    const std::vector<htd::vertex_t> & elements = hyperedge.elements();
+    const htd::VertexSpan & elements = hyperedge.elements();
 
     if (elements.empty())
     {
@@ -117,7 +117,7 @@ void printHyperedge(const htd::Hyperedge & hyperedge, std::ostream & outputStrea
 {
     outputStream << "HYPEREDGE " << hyperedge.id() << ": [ ";
 
-    const std::vector<htd::vertex_t> & elements = hyperedge.elements();
+    const htd::VertexSpan & elements = hyperedge.elements();
 
     if (elements.empty())
     {
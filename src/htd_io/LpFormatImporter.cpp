@@ -87,6 +87,8 @@ htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::
 
     htd::NamedMultiHypergraph<std::string, std::string> * ret = new htd::NamedMultiHypergraph<std::string, std::string>(implementation_->managementInstance_);
 
+    std::vector<std::vector<std::string>> hyperedges;
+
     const htd::LibraryInstance & managementInstance = *(implementation_->managementInstance_);
 
     if (stream.good())
@@ -142,7 +144,9 @@ htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::
 
                     if (hyperedge.size() > 0)
                     {
-                        ret->addEdge(hyperedge);
+                        ret->addVertices(hyperedge);
+
+                        hyperedges.emplace_back(std::move(hyperedge));
                     }
                 }
             }
@@ -168,6 +172,11 @@ htd::NamedMultiHypergraph<std::string, std::string> * htd_io::LpFormatImporter::
                 }
             }
         }
+
+        if (!managementInstance.isTerminated())
+        {
+            ret->addEdges(hyperedges);
+        }
     }
     else
     {
@@ -52,6 +52,10 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(seedOption, "General Options");
 
+        htd_cli::SingleValueOption * threadOption = new htd_cli::SingleValueOption("threads", "Set the maximum number of threads to <count> (0 = number of hardware threads). (Default: 1)", "count");
+
+        manager->registerOption(threadOption, "General Options");
+
         htd_cli::Choice * decompositionTypeChoice = new htd_cli::Choice("type", "Compute a graph decomposition of type <type>.", "type");
 
         decompositionTypeChoice->addPossibility("tree", "Compute a tree decomposition of the input graph.");
@@ -94,6 +98,7 @@ htd_cli::OptionManager * createOptionManager(void)
         strategyChoice->addPossibility("random", "Use a random vertex ordering.");
         strategyChoice->addPossibility("min-fill", "Minimum fill ordering algorithm");
         strategyChoice->addPossibility("min-degree", "Minimum degree ordering algorithm");
+        strategyChoice->addPossibility("approximate-min-degree", "Approximate minimum degree ordering algorithm (AMD)");
         strategyChoice->addPossibility("min-separator", "Minimum separating vertex set heuristic");
         strategyChoice->addPossibility("max-cardinality", "Maximum cardinality search ordering algorithm");
         strategyChoice->addPossibility("max-cardinality-enhanced", "Enhanced maximum cardinality search ordering algorithm (MCS-M)");
@@ -118,6 +123,10 @@ htd_cli::OptionManager * createOptionManager(void)
 
         manager->registerOption(triangulationMinimizationOption, "Algorithm Options");
 
+        htd_cli::Option * safeSeparatorOption = new htd_cli::Option("safe-separators", "Split the input graph along safe separators before computing the vertex elimination ordering.");
+
+        manager->registerOption(safeSeparatorOption, "Algorithm Options");
+
         htd_cli::Choice * optimizationChoice = new htd_cli::Choice("opt", "Iteratively compute a decomposition which optimizes <criterion>.", "criterion");
 
         optimizationChoice->addPossibility("none", "Do not perform any optimization.");
@@ -134,6 +143,10 @@ htd_cli::OptionManager * createOptionManager(void)
         htd_cli::SingleValueOption * patienceOption = new htd_cli::SingleValueOption("patience", "Terminate the algorithm if more than <amount> iterations did not lead to an improvement (-1 = infinite). (Default: -1)", "amount");
 
         manager->registerOption(patienceOption, "Optimization Options");
+
+        htd_cli::SingleValueOption * exactThresholdOption = new htd_cli::SingleValueOption("exact-threshold", "Add an exact algorithm for connected components of at most <size> vertices to strategy \"challenge\". (Default: disabled)", "size");
+
+        manager->registerOption(exactThresholdOption, "Optimization Options");
    		
 		htd_cli::SingleValueOption * provideOrderingOption = new htd_cli::SingleValueOption("provideOrdering", "Bypass the OrderingAlgorithms, provide a static ordering.", "ordering", 'p');
         manager->registerOption(provideOrderingOption, "Option to provide static ordering");
@@ -177,6 +190,8 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
     const htd_cli::SingleValueOption & seedOption = optionManager.accessSingleValueOption("seed");
 
+    const htd_cli::SingleValueOption & threadOption = optionManager.accessSingleValueOption("threads");
+
     const htd_cli::SingleValueOption & instanceOption = optionManager.accessSingleValueOption("instance");
 
     const htd_cli::Choice & optimizationChoice = optionManager.accessChoice("opt");
@@ -184,11 +199,15 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
     const htd_cli::SingleValueOption & iterationOption = optionManager.accessSingleValueOption("iterations");
 
     const htd_cli::SingleValueOption & patienceOption = optionManager.accessSingleValueOption("patience");
+
+    const htd_cli::SingleValueOption & exactThresholdOption = optionManager.accessSingleValueOption("exact-threshold");
     
 	const htd_cli::SingleValueOption & provideOrderingOption = optionManager.accessSingleValueOption("provideOrdering");
 
     const htd_cli::Option & triangulationMinimizationOption = optionManager.accessOption("triangulation-minimization");
 
+    const htd_cli::Option & safeSeparatorOption = optionManager.accessOption("safe-separators");
+
     if (ret && helpOption.used())
     {
         std::cout << "VERSION: htd_main " << htd_version() << std::endl << std::endl;
@@ -234,13 +253,46 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
                 }
                 else
                 {
-                    srand(seed);
+                    libraryInstance->randomNumberGenerator().seed(seed);
                 }
             }
         }
         else
         {
-            srand(static_cast<unsigned int>(time(NULL)));
+            libraryInstance->randomNumberGenerator().seed(static_cast<std::uint64_t>(time(NULL)));
+        }
+    }
+
+    if (ret)
+    {
+        if (threadOption.used())
+        {
+            std::size_t index = 0;
+
+            const std::string & value = threadOption.value();
+
+            if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+            {
+                std::cerr << "INVALID NUMBER OF THREADS: " << threadOption.value() << std::endl;
+
+                ret = false;
+            }
+
+            if (ret)
+            {
+                unsigned long threadCount = std::stoul(value, &index, 10);
+
+                if (index != value.length())
+                {
+                    std::cerr << "INVALID NUMBER OF THREADS: " << value << std::endl;
+
+                    ret = false;
+                }
+                else
+                {
+                    libraryInstance->setThreadCount(threadCount);
+                }
+            }
         }
     }
 
@@ -271,6 +323,10 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         {
             manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::MinDegreeOrderingAlgorithm(manager));
         }
+        else if (value == "approximate-min-degree")
+        {
+            manager->orderingAlgorithmFactory().setConstructionTemplate(new htd::ApproximateMinimumDegreeOrderingAlgorithm(manager));
+        }
         else if (value == "min-separator")
         {
             if (optimizationChoice.used() && std::string(optimizationChoice.value()) == "width")
@@ -286,6 +342,13 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
 
                 ret = false;
             }
+
+            if (ret && safeSeparatorOption.used())
+            {
+                std::cerr << "INVALID USE OF PROGRAM OPTION: Safe separators may only be applied when using a decomposition strategy based on vertex elimination orderings!" << std::endl;
+
+                ret = false;
+            }
         }
         else if (value == "max-cardinality")
         {
@@ -409,6 +472,44 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         }
     }
 
+    if (ret)
+    {
+        if (exactThresholdOption.used())
+        {
+            if (strategyChoice.used() && std::string(strategyChoice.value()) == "challenge")
+            {
+                std::size_t index = 0;
+
+                const std::string & value = exactThresholdOption.value();
+
+                if (value.empty() || value.find_first_not_of("01234567890") != std::string::npos)
+                {
+                    std::cerr << "INVALID EXACT THRESHOLD: " << exactThresholdOption.value() << std::endl;
+
+                    ret = false;
+                }
+
+                if (ret)
+                {
+                    std::stoul(value, &index, 10);
+
+                    if (index != value.length())
+                    {
+                        std::cerr << "INVALID EXACT THRESHOLD: " << value << std::endl;
+
+                        ret = false;
+                    }
+                }
+            }
+            else
+            {
+                std::cerr << "INVALID PROGRAM CALL: Option --exact-threshold may only be used when option --strategy is set to \"challenge\"!" << std::endl;
+
+                ret = false;
+            }
+        }
+    }
+
 	if (ret) 
 	{
 		if (provideOrderingOption.used())
@@ -435,6 +536,16 @@ bool handleOptions(int argc, const char * const * const argv, htd_cli::OptionMan
         manager->orderingAlgorithmFactory().setConstructionTemplate(algorithm);
     }
 
+    if (ret && safeSeparatorOption.used())
+    {
+        htd::SafeSeparatorOrderingAlgorithm * algorithm =
+            new htd::SafeSeparatorOrderingAlgorithm(libraryInstance);
+
+        algorithm->setOrderingAlgorithm(manager->orderingAlgorithmFactory().createInstance());
+
+        manager->orderingAlgorithmFactory().setConstructionTemplate(algorithm);
+    }
+
     return ret;
 }
 
@@ -544,7 +655,7 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     {
         htd_io::GrFormatImporter importer(manager);
 
-        decompose(*manager, algorithm, importer.import(std::cin), exporter);
+        decompose(*manager, algorithm, importer.importCompact(std::cin), exporter);
     }
     else if (inputFormat == "lp")
     {
@@ -556,7 +667,7 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     {
         htd_io::HgrFormatImporter importer(manager);
 
-        decompose(*manager, algorithm, importer.import(std::cin), exporter);
+        decompose(*manager, algorithm, importer.importCompact(std::cin), exporter);
     }
 }
 
@@ -567,7 +678,7 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     {
         htd_io::GrFormatImporter importer(manager);
 
-        decompose(*manager, algorithm, importer.import(instanceFile), exporter);
+        decompose(*manager, algorithm, importer.importCompact(instanceFile), exporter);
     }
     else if (inputFormat == "lp")
     {
@@ -579,7 +690,7 @@ void run(const DecompositionAlgorithm & algorithm, const Exporter & exporter, co
     {
         htd_io::HgrFormatImporter importer(manager);
 
-        decompose(*manager, algorithm, importer.import(instanceFile), exporter);
+        decompose(*manager, algorithm, importer.importCompact(instanceFile), exporter);
     }
 }
 
@@ -638,6 +749,8 @@ int main(int argc, const char * const * const argv)
         const htd_cli::SingleValueOption & instanceOption = optionManager->accessSingleValueOption("instance");
 
         const htd_cli::SingleValueOption & patienceOption = optionManager->accessSingleValueOption("patience");
+
+        const htd_cli::SingleValueOption & exactThresholdOption = optionManager->accessSingleValueOption("exact-threshold");
         
 		const htd_cli::SingleValueOption & provideOrderingOption = optionManager->accessSingleValueOption("provideOrdering");
 
@@ -776,13 +889,16 @@ int main(int argc, const char * const * const argv)
 
                         algorithm3->setOrderingAlgorithm(new htd::MaximumCardinalitySearchOrderingAlgorithm(libraryInstance));
 
-                        adaptiveAlgorithm->addDecompositionAlgorithm(algorithm3,
-                                                                     [](const htd::IMultiHypergraph & graph, const htd::IPreprocessedGraph & preprocessedGraph)
+                        adaptiveAlgorithm->addDecompositionAlgorithm(algorithm3);
+
+                        if (exactThresholdOption.used())
                         {
-                            HTD_UNUSED(graph)
+                            htd::ExactTreeDecompositionAlgorithm * algorithm4 = new htd::ExactTreeDecompositionAlgorithm(libraryInstance);
 
-                            return preprocessedGraph.vertexCount() <= 10240;
-                        });
+                            algorithm4->setMaximumComponentSize(std::stoul(exactThresholdOption.value(), nullptr, 10));
+
+                            adaptiveAlgorithm->addDecompositionAlgorithm(algorithm4);
+                        }
 
                         if (iterationOption.used())
                         {
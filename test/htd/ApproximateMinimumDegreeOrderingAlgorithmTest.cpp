@@ -0,0 +1,261 @@
+/*
+ * File:   ApproximateMinimumDegreeOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include "ChordalityTestHelpers.hpp"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+class ApproximateMinimumDegreeOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        ApproximateMinimumDegreeOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~ApproximateMinimumDegreeOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+std::size_t eliminationBagSize(htd::MultiHypergraph & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        std::vector<htd::vertex_t> neighbors(graph.neighbors(vertex).begin(), graph.neighbors(vertex).end());
+
+        ret = std::max(ret, neighbors.size() + 1);
+
+        for (htd::vertex_t neighbor1 : neighbors)
+        {
+            for (htd::vertex_t neighbor2 : neighbors)
+            {
+                if (neighbor1 < neighbor2 && !graph.isNeighbor(neighbor1, neighbor2))
+                {
+                    graph.addEdge(neighbor1, neighbor2);
+                }
+            }
+        }
+
+        graph.removeVertex(vertex);
+    }
+
+    return ret;
+}
+
+void checkOrdering(htd::LibraryInstance * libraryInstance, const htd::MultiHypergraph & graph)
+{
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IWidthLimitedVertexOrdering * ordering = algorithm.computeOrdering(graph, (std::size_t)-1, 1);
+
+    std::vector<htd::vertex_t> sequence(ordering->sequence());
+
+    ASSERT_EQ(graph.vertexCount(), sequence.size());
+
+    std::sort(sequence.begin(), sequence.end());
+
+    std::vector<htd::vertex_t> vertices(graph.vertices().begin(), graph.vertices().end());
+
+    ASSERT_EQ(vertices, sequence);
+
+    htd::MultiHypergraph eliminationGraph(graph);
+
+    ASSERT_EQ(eliminationBagSize(eliminationGraph, ordering->sequence()), ordering->maximumBagSize());
+
+    delete ordering;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckCloneMethod)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance1);
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm * clonedAlgorithm = algorithm.clone();
+
+    ASSERT_EQ(libraryInstance1, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    algorithm.setManagementInstance(libraryInstance2);
+
+    ASSERT_EQ(libraryInstance2, algorithm.managementInstance());
+    ASSERT_EQ(libraryInstance1, clonedAlgorithm->managementInstance());
+
+    delete libraryInstance1;
+    delete libraryInstance2;
+    delete clonedAlgorithm;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+    ASSERT_EQ((std::size_t)1, ordering->requiredIterations());
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckSize1Graph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 1);
+
+    htd::ApproximateMinimumDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ((std::size_t)1, ordering->sequence().size());
+    ASSERT_EQ((htd::vertex_t)1, ordering->sequence()[0]);
+
+    delete libraryInstance;
+    delete ordering;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckSimpleGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(2, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(2, 5);
+    graph.addEdge(2, 6);
+    graph.addEdge(3, 4);
+    graph.addEdge(3, 7);
+
+    checkOrdering(libraryInstance, graph);
+
+    delete libraryInstance;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckCliqueWithPendantVertices)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 10);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 6; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 6; ++vertex2)
+        {
+            graph.addEdge(vertex1, vertex2);
+        }
+    }
+
+    graph.addEdge(1, 7);
+    graph.addEdge(2, 8);
+    graph.addEdge(7, 9);
+    graph.addEdge(8, 10);
+
+    checkOrdering(libraryInstance, graph);
+
+    delete libraryInstance;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    const std::size_t size = 8;
+
+    htd::MultiHypergraph graph(libraryInstance, size * size);
+
+    for (htd::vertex_t row = 0; row < size; ++row)
+    {
+        for (htd::vertex_t column = 0; column < size; ++column)
+        {
+            htd::vertex_t vertex = row * size + column + 1;
+
+            if (column + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + size);
+            }
+        }
+    }
+
+    checkOrdering(libraryInstance, graph);
+
+    delete libraryInstance;
+}
+
+TEST(ApproximateMinimumDegreeOrderingAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(1234);
+
+    for (std::size_t iteration = 0; iteration < 20; ++iteration)
+    {
+        htd::MultiHypergraph graph = createRandomGraph(libraryInstance, 40, 80 + iteration * 10, generator, false);
+
+        checkOrdering(libraryInstance, graph);
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -68,7 +68,7 @@ TEST(BucketEliminationGraphDecompositionAlgorithmTest, CheckResultEmptyGraph)
 
     EXPECT_EQ(decomposition->edgeCount(), (std::size_t)0);
 
-    const std::vector<htd::vertex_t> & bag = decomposition->bagContent(1);
+    const htd::Bag & bag = decomposition->bagContent(1);
 
     EXPECT_EQ(bag.size(), (std::size_t)0);
 
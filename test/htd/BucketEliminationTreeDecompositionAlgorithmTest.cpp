@@ -70,7 +70,7 @@ TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultEmptyGraph)
 
     ASSERT_EQ(decomposition->root(), (htd::vertex_t)1);
 
-    const std::vector<htd::vertex_t> & bag = decomposition->bagContent(1);
+    const htd::Bag & bag = decomposition->bagContent(1);
 
     EXPECT_EQ(bag.size(), (std::size_t)0);
 
@@ -415,6 +415,171 @@ TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultSimpleGraphWith
     delete libraryInstance;
 }
 
+TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultComponentsInParallel)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(205);
+
+    /* 20 cycles of length 10 with a chord each, followed by 5 isolated vertices. */
+    for (htd::vertex_t offset = 0; offset < 200; offset += 10)
+    {
+        for (htd::vertex_t vertex = 1; vertex < 10; ++vertex)
+        {
+            graph.addEdge(offset + vertex, offset + vertex + 1);
+        }
+
+        graph.addEdge(offset + 10, offset + 1);
+
+        graph.addEdge(offset + 1, offset + 5);
+    }
+
+    htd::TreeDecompositionVerifier verifier;
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> bags;
+
+    for (std::size_t threadCount : { 1, 2, 4 })
+    {
+        libraryInstance->setThreadCount(threadCount);
+
+        libraryInstance->randomNumberGenerator().seed(3);
+
+        htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        EXPECT_FALSE(algorithm.isComponentOrderingEnabled());
+
+        /* With a single thread, the components are only ordered separately on request. */
+        algorithm.setComponentOrderingEnabled(threadCount == 1);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+        EXPECT_EQ((std::size_t)3, decomposition->maximumBagSize());
+
+        ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+        bags.emplace_back();
+
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            const htd::Bag & bag = decomposition->bagContent(vertex);
+
+            bags.back().emplace_back(bag.begin(), bag.end());
+        }
+
+        delete decomposition;
+    }
+
+    /* Each component is ordered with its own random number generator, hence the result does not depend on the number of threads. */
+    EXPECT_EQ(bags[0], bags[1]);
+    EXPECT_EQ(bags[0], bags[2]);
+
+    /* By default, a single thread orders the graph as a whole. */
+    libraryInstance->setThreadCount(1);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm serialAlgorithm(libraryInstance);
+
+    htd::ITreeDecomposition * serialDecomposition = serialAlgorithm.computeDecomposition(graph);
+
+    ASSERT_NE(serialDecomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(graph, *serialDecomposition));
+
+    delete serialDecomposition;
+
+    /* Ordering algorithms which do not support the ordering of components are applied to the graph as a whole. */
+    htd::NaturalOrderingAlgorithm * orderingAlgorithm = new htd::NaturalOrderingAlgorithm(libraryInstance);
+
+    EXPECT_FALSE(orderingAlgorithm->supportsComponentOrdering());
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(orderingAlgorithm);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    delete decomposition;
+
+    delete libraryInstance;
+}
+
+TEST(BucketEliminationTreeDecompositionAlgorithmTest, CheckResultComponentsInParallelWithTriangulationMinimization)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->setThreadCount(2);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(180);
+
+    /* 6 grids of 5 x 6 vertices with a diagonal in each cell of the first row. */
+    for (htd::vertex_t offset = 0; offset < 180; offset += 30)
+    {
+        for (htd::vertex_t row = 0; row < 5; ++row)
+        {
+            for (htd::vertex_t column = 0; column < 6; ++column)
+            {
+                htd::vertex_t vertex = offset + row * 6 + column + 1;
+
+                if (column + 1 < 6)
+                {
+                    graph.addEdge(vertex, vertex + 1);
+
+                    if (row == 0)
+                    {
+                        graph.addEdge(vertex, vertex + 7);
+                    }
+                }
+
+                if (row + 1 < 5)
+                {
+                    graph.addEdge(vertex, vertex + 6);
+                }
+            }
+        }
+    }
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(3);
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::TriangulationMinimizationOrderingAlgorithm * orderingAlgorithm = new htd::TriangulationMinimizationOrderingAlgorithm(libraryInstance);
+
+    orderingAlgorithm->setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(libraryInstance));
+
+    EXPECT_TRUE(orderingAlgorithm->supportsComponentOrdering());
+
+    algorithm.setOrderingAlgorithm(orderingAlgorithm);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+    ASSERT_NE(decomposition, nullptr);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(graph, *decomposition));
+
+    EXPECT_EQ(decomposition->edgeCount(), decomposition->vertexCount() - 1);
+
+    delete decomposition;
+    delete preprocessedGraph;
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
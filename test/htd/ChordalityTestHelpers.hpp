@@ -0,0 +1,152 @@
+/*
+ * File:   ChordalityTestHelpers.hpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HTD_TEST_HTD_CHORDALITYTESTHELPERS_HPP
+#define HTD_TEST_HTD_CHORDALITYTESTHELPERS_HPP
+
+#include <htd/main.hpp>
+
+#include <random>
+#include <utility>
+#include <vector>
+
+/* Creates a graph with the given number of vertices and draws the given number of edges between two vertices chosen uniformly at random.
+ * Draws yielding a self-loop and, unless duplicate edges are allowed, draws yielding an existing edge are skipped. */
+inline htd::MultiHypergraph createRandomGraph(const htd::LibraryInstance * const libraryInstance, std::size_t vertexCount, std::size_t edgeCount, std::mt19937 & generator, bool allowDuplicateEdges = true)
+{
+    htd::MultiHypergraph ret(libraryInstance, vertexCount);
+
+    std::uniform_int_distribution<htd::vertex_t> distribution(htd::Vertex::FIRST, static_cast<htd::vertex_t>(vertexCount));
+
+    for (std::size_t index = 0; index < edgeCount; ++index)
+    {
+        htd::vertex_t vertex1 = distribution(generator);
+        htd::vertex_t vertex2 = distribution(generator);
+
+        if (vertex1 != vertex2 && (allowDuplicateEdges || !ret.isNeighbor(vertex1, vertex2)))
+        {
+            ret.addEdge(vertex1, vertex2);
+        }
+    }
+
+    return ret;
+}
+
+/* Adjacency matrix of a graph whose vertices are numbered consecutively starting at 1, row and column 0 are unused. */
+typedef std::vector<std::vector<bool>> AdjacencyMatrix;
+
+/* Creates the adjacency matrix of the primal graph of the given graph, extended by the given fill edges. */
+inline AdjacencyMatrix createAdjacencyMatrix(const htd::IMultiHypergraph & graph, const std::vector<std::pair<htd::vertex_t, htd::vertex_t>> & fillEdges)
+{
+    AdjacencyMatrix ret(graph.vertexCount() + 1, std::vector<bool>(graph.vertexCount() + 1));
+
+    for (const htd::Hyperedge & edge : graph.hyperedges())
+    {
+        for (htd::vertex_t vertex1 : edge)
+        {
+            for (htd::vertex_t vertex2 : edge)
+            {
+                if (vertex1 != vertex2)
+                {
+                    ret[vertex1][vertex2] = true;
+                }
+            }
+        }
+    }
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+    {
+        ret[fillEdge.first][fillEdge.second] = true;
+        ret[fillEdge.second][fillEdge.first] = true;
+    }
+
+    return ret;
+}
+
+/* Checks whether eliminating the vertices in the given order introduces no fill edges. */
+inline bool isPerfectEliminationOrdering(const AdjacencyMatrix & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    bool ret = true;
+
+    std::vector<bool> eliminated(graph.size());
+
+    for (auto it = ordering.begin(); ret && it != ordering.end(); ++it)
+    {
+        htd::vertex_t vertex = *it;
+
+        eliminated[vertex] = true;
+
+        for (htd::vertex_t neighbor1 = 1; ret && neighbor1 < graph.size(); ++neighbor1)
+        {
+            for (htd::vertex_t neighbor2 = neighbor1 + 1; ret && neighbor2 < graph.size(); ++neighbor2)
+            {
+                if (!eliminated[neighbor1] && !eliminated[neighbor2] && graph[vertex][neighbor1] && graph[vertex][neighbor2])
+                {
+                    ret = graph[neighbor1][neighbor2];
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/* Checks whether the given graph is chordal by testing the reverse of a maximum cardinality search ordering. */
+inline bool isChordal(const AdjacencyMatrix & graph)
+{
+    std::vector<std::size_t> weights(graph.size());
+
+    std::vector<bool> numbered(graph.size());
+
+    std::vector<htd::vertex_t> ordering;
+
+    for (std::size_t index = 1; index < graph.size(); ++index)
+    {
+        htd::vertex_t selectedVertex = 0;
+
+        for (htd::vertex_t vertex = 1; vertex < graph.size(); ++vertex)
+        {
+            if (!numbered[vertex] && (selectedVertex == 0 || weights[vertex] > weights[selectedVertex]))
+            {
+                selectedVertex = vertex;
+            }
+        }
+
+        numbered[selectedVertex] = true;
+
+        for (htd::vertex_t vertex = 1; vertex < graph.size(); ++vertex)
+        {
+            if (graph[selectedVertex][vertex])
+            {
+                ++weights[vertex];
+            }
+        }
+
+        ordering.insert(ordering.begin(), selectedVertex);
+    }
+
+    return isPerfectEliminationOrdering(graph, ordering);
+}
+
+#endif /* HTD_TEST_HTD_CHORDALITYTESTHELPERS_HPP */
@@ -0,0 +1,276 @@
+/*
+ * File:   CompactHypergraphTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include <vector>
+
+class CompactHypergraphTest : public ::testing::Test
+{
+    public:
+        CompactHypergraphTest(void)
+        {
+
+        }
+
+        virtual ~CompactHypergraphTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(CompactHypergraphTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::CompactHypergraph * compactGraph = graph.freeze();
+
+    ASSERT_EQ((std::size_t)0, compactGraph->vertexCount());
+    ASSERT_EQ((std::size_t)0, compactGraph->edgeCount());
+
+    ASSERT_EQ((std::size_t)0, compactGraph->vertices().size());
+    ASSERT_EQ((std::size_t)0, compactGraph->hyperedges().size());
+
+    ASSERT_EQ((std::size_t)0, compactGraph->isolatedVertexCount());
+    ASSERT_EQ((std::size_t)0, compactGraph->isolatedVertices().size());
+
+    ASSERT_TRUE(compactGraph->isConnected());
+
+    ASSERT_EQ((htd::vertex_t)1, compactGraph->nextVertex());
+    ASSERT_EQ((htd::id_t)1, compactGraph->nextEdgeId());
+
+    ASSERT_EQ(libraryInstance, compactGraph->managementInstance());
+
+    delete compactGraph;
+
+    delete libraryInstance;
+}
+
+TEST(CompactHypergraphTest, CheckFrozenGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 6);
+
+    graph.addEdge(1, 2);
+    graph.addEdge(2, 1);
+    graph.addEdge(std::vector<htd::vertex_t> { 4, 2, 3 });
+    graph.addEdge(3, 3);
+    graph.addEdge(std::vector<htd::vertex_t> { 5 });
+    graph.addEdge(2, 3);
+
+    graph.removeVertex(6);
+
+    graph.removeEdge(1);
+
+    htd::CompactHypergraph * compactGraph = graph.freeze();
+
+    ASSERT_EQ(graph.vertexCount(), compactGraph->vertexCount());
+    ASSERT_EQ(graph.edgeCount(), compactGraph->edgeCount());
+    ASSERT_EQ(graph.nextVertex(), compactGraph->nextVertex());
+    ASSERT_EQ(graph.nextEdgeId(), compactGraph->nextEdgeId());
+
+    ASSERT_FALSE(compactGraph->isVertex(0));
+    ASSERT_FALSE(compactGraph->isVertex(6));
+    ASSERT_FALSE(compactGraph->isVertex(7));
+
+    ASSERT_EQ(graph.vertices(), compactGraph->vertices());
+    ASSERT_EQ(graph.isolatedVertices(), compactGraph->isolatedVertices());
+    ASSERT_EQ(graph.isolatedVertexCount(), compactGraph->isolatedVertexCount());
+
+    ASSERT_EQ(graph.isConnected(), compactGraph->isConnected());
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        ASSERT_TRUE(compactGraph->isVertex(vertex));
+
+        ASSERT_EQ(graph.neighborCount(vertex), compactGraph->neighborCount(vertex));
+        ASSERT_EQ(graph.neighbors(vertex), compactGraph->neighbors(vertex));
+        ASSERT_EQ(graph.edgeCount(vertex), compactGraph->edgeCount(vertex));
+        ASSERT_EQ(graph.isIsolatedVertex(vertex), compactGraph->isIsolatedVertex(vertex));
+
+        std::vector<htd::vertex_t> neighborhood;
+
+        compactGraph->copyNeighborsTo(vertex, neighborhood);
+
+        ASSERT_EQ(graph.neighbors(vertex), htd::ConstCollection<htd::vertex_t>::getInstance(neighborhood));
+
+        const htd::ConstCollection<htd::Hyperedge> & expectedHyperedges = graph.hyperedges(vertex);
+        const htd::ConstCollection<htd::Hyperedge> & actualHyperedges = compactGraph->hyperedges(vertex);
+
+        ASSERT_EQ(expectedHyperedges.size(), actualHyperedges.size());
+
+        for (htd::index_t index = 0; index < expectedHyperedges.size(); ++index)
+        {
+            ASSERT_EQ(expectedHyperedges[index], actualHyperedges[index]);
+            ASSERT_EQ(expectedHyperedges[index], compactGraph->hyperedgeAtPosition(index, vertex));
+        }
+
+        for (htd::vertex_t vertex2 : graph.vertices())
+        {
+            ASSERT_EQ(graph.isNeighbor(vertex, vertex2), compactGraph->isNeighbor(vertex, vertex2));
+            ASSERT_EQ(graph.isEdge(vertex, vertex2), compactGraph->isEdge(vertex, vertex2));
+            ASSERT_EQ(graph.isConnected(vertex, vertex2), compactGraph->isConnected(vertex, vertex2));
+            ASSERT_EQ(graph.associatedEdgeIds(vertex, vertex2), compactGraph->associatedEdgeIds(vertex, vertex2));
+        }
+    }
+
+    for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+    {
+        ASSERT_TRUE(compactGraph->isEdge(hyperedge.id()));
+        ASSERT_TRUE(compactGraph->isEdge(hyperedge.elements().toVector()));
+
+        ASSERT_EQ(hyperedge, compactGraph->hyperedge(hyperedge.id()));
+
+        ASSERT_EQ(graph.associatedEdgeIds(hyperedge.elements().toVector()), compactGraph->associatedEdgeIds(hyperedge.elements().toVector()));
+    }
+
+    ASSERT_FALSE(compactGraph->isEdge((htd::id_t)1));
+    ASSERT_FALSE(compactGraph->isEdge(std::vector<htd::vertex_t> { 2, 3, 4 }));
+
+    ASSERT_EQ((std::size_t)0, compactGraph->associatedEdgeIds(1, 2).size());
+    ASSERT_EQ((std::size_t)1, compactGraph->associatedEdgeIds(2, 1).size());
+    ASSERT_EQ((std::size_t)1, compactGraph->associatedEdgeIds(2, 3).size());
+
+    ASSERT_EQ((std::size_t)2, compactGraph->hyperedgesAtPositions(std::vector<htd::index_t> { 0, 2 }).size());
+
+    delete compactGraph;
+
+    delete libraryInstance;
+}
+
+TEST(CompactHypergraphTest, CheckIndependenceOfSnapshot)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 3);
+
+    graph.addEdge(1, 2);
+
+    htd::CompactHypergraph * compactGraph = graph.freeze();
+
+    graph.addEdge(2, 3);
+
+    graph.removeVertex(1);
+
+    ASSERT_EQ((std::size_t)3, compactGraph->vertexCount());
+    ASSERT_EQ((std::size_t)1, compactGraph->edgeCount());
+
+    ASSERT_TRUE(compactGraph->isNeighbor(1, 2));
+    ASSERT_FALSE(compactGraph->isNeighbor(2, 3));
+
+    ASSERT_EQ((std::size_t)1, compactGraph->isolatedVertexCount());
+    ASSERT_EQ((htd::vertex_t)3, compactGraph->isolatedVertexAtPosition(0));
+
+    htd::CompactHypergraph * clonedGraph = compactGraph->clone();
+
+    /* Copies share the immutable graph data. */
+    ASSERT_EQ(&(compactGraph->vertexVector()), &(clonedGraph->vertexVector()));
+
+    delete compactGraph;
+
+    ASSERT_EQ((std::size_t)3, clonedGraph->vertexCount());
+    ASSERT_EQ((std::size_t)1, clonedGraph->edgeCount());
+    ASSERT_EQ((std::size_t)1, clonedGraph->hyperedges((htd::vertex_t)1).size());
+    ASSERT_FALSE(clonedGraph->isConnected());
+
+    delete clonedGraph;
+
+    delete libraryInstance;
+}
+
+TEST(CompactHypergraphTest, CheckGraphFrozenByBuilder)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraphBuilder builder;
+
+    builder.addEdge(1, 2);
+    builder.addEdge(2, 1);
+    builder.addEdge(std::vector<htd::vertex_t> { 4, 2, 3 });
+    builder.addEdge(3, 3);
+    builder.addEdge(std::vector<htd::vertex_t> { 5 });
+    builder.addEdge(std::vector<htd::vertex_t> { 5, 4, 5 });
+    builder.addEdge(2, 3);
+
+    htd::MultiHypergraphBuilder copy(builder);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    copy.populate(graph);
+
+    htd::CompactHypergraph * compactGraph = builder.freeze(libraryInstance, 7);
+
+    ASSERT_EQ((std::size_t)0, builder.edgeCount());
+
+    ASSERT_EQ(libraryInstance, compactGraph->managementInstance());
+
+    ASSERT_EQ(graph.vertexCount(), compactGraph->vertexCount());
+    ASSERT_EQ(graph.edgeCount(), compactGraph->edgeCount());
+    ASSERT_EQ(graph.nextVertex(), compactGraph->nextVertex());
+    ASSERT_EQ(graph.nextEdgeId(), compactGraph->nextEdgeId());
+
+    ASSERT_EQ(graph.vertices(), compactGraph->vertices());
+    ASSERT_EQ(graph.isolatedVertices(), compactGraph->isolatedVertices());
+
+    for (htd::vertex_t vertex : graph.vertices())
+    {
+        ASSERT_EQ(graph.neighbors(vertex), compactGraph->neighbors(vertex));
+        ASSERT_EQ(graph.edgeCount(vertex), compactGraph->edgeCount(vertex));
+    }
+
+    ASSERT_TRUE(compactGraph->isNeighbor(3, 3));
+    ASSERT_TRUE(compactGraph->isNeighbor(5, 5));
+    ASSERT_FALSE(compactGraph->isNeighbor(2, 2));
+
+    for (htd::index_t index = 0; index < graph.edgeCount(); ++index)
+    {
+        ASSERT_EQ(graph.hyperedgeAtPosition(index), compactGraph->hyperedgeAtPosition(index));
+    }
+
+    delete compactGraph;
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,170 @@
+/*
+ * File:   EnhancedMaximumCardinalitySearchOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include "ChordalityTestHelpers.hpp"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+class EnhancedMaximumCardinalitySearchOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        EnhancedMaximumCardinalitySearchOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~EnhancedMaximumCardinalitySearchOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+TEST(EnhancedMaximumCardinalitySearchOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+    ASSERT_EQ((std::size_t)1, ordering->requiredIterations());
+
+    delete ordering;
+    delete libraryInstance;
+}
+
+TEST(EnhancedMaximumCardinalitySearchOrderingAlgorithmTest, CheckCycle)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 10);
+
+    for (htd::vertex_t vertex = 1; vertex < 10; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+    }
+
+    graph.addEdge(10, 1);
+
+    htd::IGraphPreprocessor * preprocessor = libraryInstance->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+
+    htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph, fillEdges);
+
+    ASSERT_EQ((std::size_t)10, ordering->sequence().size());
+    ASSERT_EQ((std::size_t)7, fillEdges.size());
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+    {
+        ASSERT_LT(fillEdge.first, fillEdge.second);
+    }
+
+    ASSERT_TRUE(isPerfectEliminationOrdering(createAdjacencyMatrix(graph, fillEdges), ordering->sequence()));
+
+    delete ordering;
+    delete preprocessedGraph;
+    delete preprocessor;
+    delete libraryInstance;
+}
+
+TEST(EnhancedMaximumCardinalitySearchOrderingAlgorithmTest, CheckMinimalTriangulationOfRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::IGraphPreprocessor * preprocessor = libraryInstance->graphPreprocessorFactory().createInstance();
+
+    htd::EnhancedMaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+    std::mt19937 generator(11);
+
+    for (std::size_t round = 0; round < 20; ++round)
+    {
+        std::size_t vertexCount = 5 + round;
+
+        htd::MultiHypergraph graph = createRandomGraph(libraryInstance, vertexCount, vertexCount * 2, generator);
+
+        htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+        std::vector<std::pair<htd::vertex_t, htd::vertex_t>> fillEdges;
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph, fillEdges);
+
+        ASSERT_EQ(vertexCount, ordering->sequence().size());
+
+        AdjacencyMatrix triangulation = createAdjacencyMatrix(graph, fillEdges);
+
+        ASSERT_TRUE(isPerfectEliminationOrdering(triangulation, ordering->sequence()));
+
+        for (const std::pair<htd::vertex_t, htd::vertex_t> & fillEdge : fillEdges)
+        {
+            ASSERT_FALSE(graph.isNeighbor(fillEdge.first, fillEdge.second));
+
+            triangulation[fillEdge.first][fillEdge.second] = false;
+            triangulation[fillEdge.second][fillEdge.first] = false;
+
+            ASSERT_FALSE(isChordal(triangulation));
+
+            triangulation[fillEdge.first][fillEdge.second] = true;
+            triangulation[fillEdge.second][fillEdge.first] = true;
+        }
+
+        delete ordering;
+        delete preprocessedGraph;
+    }
+
+    delete preprocessor;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,445 @@
+/*
+ * File:   ExactTreeDecompositionAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include "ChordalityTestHelpers.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+class ExactTreeDecompositionAlgorithmTest : public ::testing::Test
+{
+    public:
+        ExactTreeDecompositionAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~ExactTreeDecompositionAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+std::size_t computeMaximumBagSize(const htd::LibraryInstance * const libraryInstance, const htd::IMultiHypergraph & graph)
+{
+    std::size_t ret = 0;
+
+    htd::ExactTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    EXPECT_NE(nullptr, decomposition);
+
+    if (decomposition != nullptr)
+    {
+        htd::TreeDecompositionVerifier verifier;
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        ret = decomposition->maximumBagSize();
+
+        delete decomposition;
+    }
+
+    return ret;
+}
+
+/* Computes the maximum bag size of an optimal decomposition via the dynamic program over vertex subsets by Bodlaender et al. */
+std::size_t computeOptimalMaximumBagSize(const htd::IMultiHypergraph & graph)
+{
+    std::size_t vertexCount = graph.vertexCount();
+
+    std::vector<std::uint32_t> neighborhoods(vertexCount, 0);
+
+    for (const htd::Hyperedge & edge : graph.hyperedges())
+    {
+        neighborhoods[edge[0] - 1] |= 1u << (edge[1] - 1);
+        neighborhoods[edge[1] - 1] |= 1u << (edge[0] - 1);
+    }
+
+    std::vector<std::size_t> widths(std::size_t(1) << vertexCount, 0);
+
+    for (std::uint32_t set = 1; set < widths.size(); ++set)
+    {
+        widths[set] = (std::size_t)-1;
+
+        for (std::size_t vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            if ((set & (1u << vertex)) != 0)
+            {
+                std::uint32_t remainder = set & ~(1u << vertex);
+
+                std::uint32_t reachable = 1u << vertex;
+
+                std::uint32_t frontier = reachable;
+
+                while (frontier != 0)
+                {
+                    std::uint32_t next = 0;
+
+                    for (std::size_t current = 0; current < vertexCount; ++current)
+                    {
+                        if ((frontier & (1u << current)) != 0)
+                        {
+                            next |= neighborhoods[current];
+                        }
+                    }
+
+                    next &= ~reachable;
+
+                    reachable |= next;
+
+                    frontier = next & remainder;
+                }
+
+                std::size_t neighborCount = 0;
+
+                for (std::size_t current = 0; current < vertexCount; ++current)
+                {
+                    if ((reachable & ~set & (1u << current)) != 0)
+                    {
+                        ++neighborCount;
+                    }
+                }
+
+                widths[set] = std::min(widths[set], std::max(widths[remainder], neighborCount + 1));
+            }
+        }
+    }
+
+    return widths.back();
+}
+
+TEST(ExactTreeDecompositionAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::ExactTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(nullptr, decomposition);
+
+    EXPECT_EQ((std::size_t)1, decomposition->vertexCount());
+
+    EXPECT_EQ((std::size_t)0, decomposition->maximumBagSize());
+
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(ExactTreeDecompositionAlgorithmTest, CheckKnownGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph cycle(libraryInstance, 12);
+
+    for (htd::vertex_t vertex = 1; vertex <= 12; ++vertex)
+    {
+        cycle.addEdge(vertex, vertex % 12 + 1);
+    }
+
+    EXPECT_EQ((std::size_t)3, computeMaximumBagSize(libraryInstance, cycle));
+
+    htd::MultiHypergraph clique(libraryInstance, 7);
+
+    for (htd::vertex_t vertex = 1; vertex <= 7; ++vertex)
+    {
+        for (htd::vertex_t neighbor = vertex + 1; neighbor <= 7; ++neighbor)
+        {
+            clique.addEdge(vertex, neighbor);
+        }
+    }
+
+    EXPECT_EQ((std::size_t)7, computeMaximumBagSize(libraryInstance, clique));
+
+    for (std::size_t size : { 4, 5, 6 })
+    {
+        htd::MultiHypergraph grid(libraryInstance, size * size);
+
+        for (htd::vertex_t row = 0; row < size; ++row)
+        {
+            for (htd::vertex_t column = 0; column < size; ++column)
+            {
+                htd::vertex_t vertex = row * size + column + 1;
+
+                if (column + 1 < size)
+                {
+                    grid.addEdge(vertex, vertex + 1);
+                }
+
+                if (row + 1 < size)
+                {
+                    grid.addEdge(vertex, vertex + size);
+                }
+            }
+        }
+
+        EXPECT_EQ(size + 1, computeMaximumBagSize(libraryInstance, grid));
+    }
+
+    htd::MultiHypergraph petersenGraph(libraryInstance, 10);
+
+    for (htd::vertex_t vertex = 1; vertex <= 5; ++vertex)
+    {
+        petersenGraph.addEdge(vertex, vertex % 5 + 1);
+        petersenGraph.addEdge(vertex, vertex + 5);
+        petersenGraph.addEdge(vertex + 5, (vertex + 1) % 5 + 6);
+    }
+
+    EXPECT_EQ((std::size_t)5, computeMaximumBagSize(libraryInstance, petersenGraph));
+
+    delete libraryInstance;
+}
+
+TEST(ExactTreeDecompositionAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(11);
+
+    for (std::size_t round = 0; round < 40; ++round)
+    {
+        std::size_t vertexCount = 6 + round % 8;
+
+        htd::MultiHypergraph graph = createRandomGraph(libraryInstance, vertexCount, vertexCount + round % 4 * vertexCount / 2, generator, false);
+
+        EXPECT_EQ(computeOptimalMaximumBagSize(graph), computeMaximumBagSize(libraryInstance, graph));
+    }
+
+    delete libraryInstance;
+}
+
+TEST(ExactTreeDecompositionAlgorithmTest, CheckMaximumComponentSize)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 10);
+
+    for (htd::vertex_t vertex = 1; vertex <= 5; ++vertex)
+    {
+        graph.addEdge(vertex, vertex % 5 + 1);
+        graph.addEdge(vertex, vertex + 5);
+        graph.addEdge(vertex + 5, (vertex + 1) % 5 + 6);
+    }
+
+    htd::IGraphPreprocessor * preprocessor = libraryInstance->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::ExactOrderingAlgorithm orderingAlgorithm(libraryInstance);
+
+    bool optimal = false;
+
+    htd::IVertexOrdering * ordering = orderingAlgorithm.computeOrdering(graph, *preprocessedGraph, optimal);
+
+    EXPECT_TRUE(optimal);
+
+    EXPECT_EQ((std::size_t)10, ordering->sequence().size());
+
+    delete ordering;
+
+    orderingAlgorithm.setMaximumComponentSize(9);
+
+    ordering = orderingAlgorithm.computeOrdering(graph, *preprocessedGraph, optimal);
+
+    /* The component is too large for the exact search, hence the min-fill ordering is returned. */
+    EXPECT_FALSE(optimal);
+
+    EXPECT_EQ((std::size_t)10, ordering->sequence().size());
+
+    delete ordering;
+
+    htd::ExactTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setMaximumComponentSize(9);
+
+    EXPECT_EQ(nullptr, algorithm.computeDecomposition(graph, *preprocessedGraph));
+
+    algorithm.setMaximumComponentSize(10);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+    ASSERT_NE(nullptr, decomposition);
+
+    EXPECT_EQ((std::size_t)5, decomposition->maximumBagSize());
+
+    delete decomposition;
+    delete preprocessedGraph;
+    delete preprocessor;
+    delete libraryInstance;
+}
+
+TEST(ExactTreeDecompositionAlgorithmTest, CheckAdaptivePortfolio)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::size_t size = 6;
+
+    htd::MultiHypergraph graph(libraryInstance, size * size);
+
+    for (htd::vertex_t row = 0; row < size; ++row)
+    {
+        for (htd::vertex_t column = 0; column < size; ++column)
+        {
+            htd::vertex_t vertex = row * size + column + 1;
+
+            if (column + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + size);
+            }
+        }
+    }
+
+    htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    htd::BucketEliminationTreeDecompositionAlgorithm * algorithm1 = new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance);
+
+    algorithm1->setOrderingAlgorithm(new htd::MaximumCardinalitySearchOrderingAlgorithm(libraryInstance));
+
+    algorithm.addDecompositionAlgorithm(algorithm1);
+
+    htd::ExactTreeDecompositionAlgorithm * algorithm2 = new htd::ExactTreeDecompositionAlgorithm(libraryInstance);
+
+    algorithm2->setMaximumComponentSize(size * size);
+
+    algorithm.addDecompositionAlgorithm(algorithm2);
+
+    algorithm.setIterationCount(1);
+
+    algorithm.setDecisionRounds(5);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(nullptr, decomposition);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+    EXPECT_EQ(size + 1, decomposition->maximumBagSize());
+
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(ExactTreeDecompositionAlgorithmTest, CheckMemoryLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::size_t size = 6;
+
+    htd::MultiHypergraph graph(libraryInstance, size * size);
+
+    for (htd::vertex_t row = 0; row < size; ++row)
+    {
+        for (htd::vertex_t column = 0; column < size; ++column)
+        {
+            htd::vertex_t vertex = row * size + column + 1;
+
+            if (column + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < size)
+            {
+                graph.addEdge(vertex, vertex + size);
+            }
+        }
+    }
+
+    htd::IGraphPreprocessor * preprocessor = libraryInstance->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::ExactOrderingAlgorithm orderingAlgorithm(libraryInstance);
+
+    orderingAlgorithm.setMemoryLimit(1024);
+
+    EXPECT_EQ((std::size_t)1024, orderingAlgorithm.memoryLimit());
+
+    bool optimal = true;
+
+    htd::IVertexOrdering * ordering = orderingAlgorithm.computeOrdering(graph, *preprocessedGraph, optimal);
+
+    /* The search gives up as soon as its feasible sets and partial blocks exceed the memory limit, hence the best ordering found so far is returned. */
+    EXPECT_FALSE(optimal);
+
+    ASSERT_NE(nullptr, ordering);
+
+    EXPECT_EQ(size * size, ordering->sequence().size());
+
+    delete ordering;
+
+    htd::ExactTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setMemoryLimit(1024);
+
+    EXPECT_EQ(nullptr, algorithm.computeDecomposition(graph, *preprocessedGraph));
+
+    algorithm.setMemoryLimit(static_cast<std::size_t>(1) << 30);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+    ASSERT_NE(nullptr, decomposition);
+
+    EXPECT_EQ(size + 1, decomposition->maximumBagSize());
+
+    delete decomposition;
+    delete preprocessedGraph;
+    delete preprocessor;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
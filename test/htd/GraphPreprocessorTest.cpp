@@ -1457,6 +1457,111 @@ TEST(GraphPreprocessorTest, CheckSize50Graph2)
     delete preprocessedGraph;
 }
 
+TEST(GraphPreprocessorTest, CheckLargeGraphOfTreeWidthTwo)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(5000);
+
+    /* A long cycle with pendant paths and chords forming nested triangles has treewidth at most 2. */
+    for (htd::vertex_t vertex = 1; vertex < 2000; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+    }
+
+    graph.addEdge(2000, 1);
+
+    for (htd::vertex_t vertex = 2001; vertex <= 4000; ++vertex)
+    {
+        graph.addEdge(vertex, vertex % 2 == 0 ? vertex - 2000 : vertex - 1);
+    }
+
+    for (htd::vertex_t vertex = 4001; vertex <= 5000; ++vertex)
+    {
+        htd::vertex_t base = 2 * (vertex - 4000) - 1;
+
+        graph.addEdge(vertex, base);
+        graph.addEdge(vertex, base + 1);
+    }
+
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(1);
+
+    const htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    ASSERT_EQ((std::size_t)0, preprocessedGraph->remainingVertices().size());
+
+    ASSERT_EQ((std::size_t)2, preprocessedGraph->minTreeWidth());
+
+    ASSERT_TRUE(isValidOrdering(graph, preprocessedGraph->eliminationSequence()));
+
+    delete libraryInstance;
+    delete preprocessedGraph;
+}
+
+TEST(GraphPreprocessorTest, CheckConnectedComponents)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    /* A triangle on the vertices 0, 2 and 4 and an edge between the vertices 1 and 3. */
+    htd::PreprocessedGraph preprocessedGraph(std::vector<htd::vertex_t> { 11, 12, 13, 14, 15 },
+                                             std::vector<std::vector<htd::vertex_t>> { { 2, 4 }, { 3 }, { 0, 4 }, { 1 }, { 0, 2 } },
+                                             std::vector<htd::vertex_t>(),
+                                             std::vector<htd::vertex_t> { 0, 1, 2, 3, 4 },
+                                             4,
+                                             1);
+
+    std::shared_ptr<const std::vector<std::vector<htd::vertex_t>>> components = preprocessedGraph.components();
+
+    ASSERT_EQ((std::size_t)2, components->size());
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 0, 2, 4 }), components->at(0));
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 3 }), components->at(1));
+
+    htd::ConnectedComponentGraph component1(libraryInstance, preprocessedGraph, components->at(0));
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 0, 2, 4 }), component1.vertices());
+
+    EXPECT_EQ((htd::vertex_t)11, component1.vertexName(1));
+    EXPECT_EQ((htd::vertex_t)13, component1.vertexName(2));
+    EXPECT_EQ((htd::vertex_t)15, component1.vertexName(3));
+
+    EXPECT_EQ((std::size_t)3, component1.graph().vertexCount());
+    EXPECT_EQ((std::size_t)3, component1.graph().edgeCount());
+    EXPECT_TRUE(component1.graph().isEdge(std::vector<htd::vertex_t> { 1, 3 }));
+
+    EXPECT_EQ((std::size_t)3, component1.preprocessedGraph().vertexCount());
+    EXPECT_EQ((std::size_t)3, component1.preprocessedGraph().edgeCount());
+    EXPECT_TRUE(component1.preprocessedGraph().eliminationSequence().empty());
+    EXPECT_EQ((std::size_t)1, component1.preprocessedGraph().minTreeWidth());
+
+    htd::ConnectedComponentGraph component2(libraryInstance, preprocessedGraph, components->at(1));
+
+    EXPECT_EQ(std::vector<htd::vertex_t>({ 1, 3 }), component2.vertices());
+
+    EXPECT_EQ((htd::vertex_t)12, component2.vertexName(1));
+    EXPECT_EQ((htd::vertex_t)14, component2.vertexName(2));
+
+    EXPECT_EQ((std::size_t)1, component2.graph().edgeCount());
+
+    /* The components are computed once and reused until the graph is modified. */
+    EXPECT_EQ(components.get(), preprocessedGraph.components().get());
+
+    preprocessedGraph.removeVertex(1);
+    preprocessedGraph.removeVertex(3);
+
+    /* A connected graph has no components worth separating. */
+    EXPECT_TRUE(preprocessedGraph.components()->empty());
+
+    /* The components computed before the modification remain accessible. */
+    EXPECT_EQ((std::size_t)2, components->size());
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
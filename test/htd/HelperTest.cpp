@@ -26,6 +26,14 @@
 
 #include <htd/main.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
 #include <vector>
 
 class HelperTest : public ::testing::Test
@@ -714,6 +722,377 @@ TEST(HelperTest, CheckSymmetricDifferenceSizes3)
     ASSERT_EQ((std::size_t)3, result.second);
 }
 
+TEST(HelperTest, CheckBucketPriorityQueue)
+{
+    htd::BucketPriorityQueue<htd::vertex_t, std::greater<std::size_t>> priorityQueue;
+
+    ASSERT_TRUE(priorityQueue.empty());
+
+    priorityQueue.push(1, 3);
+    priorityQueue.push(2, 1);
+    priorityQueue.push(3, 1);
+    priorityQueue.push(5, 4);
+
+    ASSERT_EQ((std::size_t)4, priorityQueue.size());
+    ASSERT_EQ((std::size_t)1, priorityQueue.topPriority());
+    ASSERT_EQ((std::size_t)2, priorityQueue.topCollection().size());
+    ASSERT_FALSE(priorityQueue.contains(4));
+
+    ASSERT_FALSE(priorityQueue.eraseFromTopCollection(1));
+    ASSERT_TRUE(priorityQueue.eraseFromTopCollection(2));
+    ASSERT_FALSE(priorityQueue.contains(2));
+
+    ASSERT_EQ((std::size_t)3, priorityQueue.top());
+
+    priorityQueue.updatePriority(5, 4, 0);
+
+    ASSERT_EQ((std::size_t)0, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)5, priorityQueue.top());
+
+    priorityQueue.pop();
+
+    ASSERT_EQ((std::size_t)1, priorityQueue.topPriority());
+
+    priorityQueue.updatePriority(3, 1, 7);
+
+    ASSERT_EQ((std::size_t)3, priorityQueue.topPriority());
+    ASSERT_EQ((htd::vertex_t)1, priorityQueue.top());
+
+    ASSERT_FALSE(priorityQueue.erase(3, 1));
+    ASSERT_TRUE(priorityQueue.erase(3, 7));
+    ASSERT_TRUE(priorityQueue.erase(1));
+    ASSERT_FALSE(priorityQueue.erase(1));
+
+    ASSERT_TRUE(priorityQueue.empty());
+}
+
+TEST(HelperTest, CheckBucketPriorityQueueAgainstPriorityQueue)
+{
+    htd::BucketPriorityQueue<htd::vertex_t, std::less<std::size_t>> bucketQueue;
+
+    htd::PriorityQueue<htd::vertex_t, std::size_t, std::less<std::size_t>> heapQueue;
+
+    std::vector<std::size_t> priorities(100);
+
+    std::srand(42);
+
+    for (htd::vertex_t vertex = 0; vertex < priorities.size(); ++vertex)
+    {
+        priorities[vertex] = std::rand() % 10;
+
+        bucketQueue.push(vertex, priorities[vertex]);
+
+        heapQueue.push(vertex, priorities[vertex]);
+    }
+
+    for (std::size_t iteration = 0; iteration < 1000; ++iteration)
+    {
+        htd::vertex_t vertex = std::rand() % priorities.size();
+
+        std::size_t newPriority = std::rand() % 20;
+
+        bucketQueue.updatePriority(vertex, priorities[vertex], newPriority);
+
+        heapQueue.updatePriority(vertex, priorities[vertex], newPriority);
+
+        priorities[vertex] = newPriority;
+
+        ASSERT_EQ(heapQueue.topPriority(), bucketQueue.topPriority());
+        ASSERT_EQ(heapQueue.topCollection().size(), bucketQueue.topCollection().size());
+    }
+
+    while (!heapQueue.empty())
+    {
+        ASSERT_EQ(heapQueue.size(), bucketQueue.size());
+        ASSERT_EQ(heapQueue.topPriority(), bucketQueue.topPriority());
+
+        htd::vertex_t vertex = bucketQueue.top();
+
+        ASSERT_TRUE(heapQueue.eraseFromTopCollection(vertex));
+        ASSERT_TRUE(bucketQueue.eraseFromTopCollection(vertex));
+    }
+
+    ASSERT_TRUE(bucketQueue.empty());
+}
+
+TEST(HelperTest, CheckSetKernels)
+{
+    std::vector<htd::SetKernel> kernels { htd::SetKernel::SCALAR, htd::SetKernel::SSE4_2, htd::SetKernel::AVX2 };
+
+    ASSERT_TRUE(htd::isSetKernelSupported(htd::SetKernel::SCALAR));
+    ASSERT_TRUE(htd::isSetKernelSupported(htd::activeSetKernel()));
+
+    std::srand(42);
+
+    for (std::size_t iteration = 0; iteration < 500; ++iteration)
+    {
+        std::vector<htd::vertex_t> set1;
+        std::vector<htd::vertex_t> set2;
+
+        std::size_t range = 1 + std::rand() % 200;
+
+        std::size_t density1 = std::rand() % 101;
+        std::size_t density2 = iteration % 5 == 0 ? std::rand() % 5 : std::rand() % 101;
+
+        htd::vertex_t offset = iteration % 7 == 0 ? range : 0;
+
+        for (htd::vertex_t vertex = 0; vertex < range; ++vertex)
+        {
+            if (static_cast<std::size_t>(std::rand() % 100) < density1)
+            {
+                set1.push_back(vertex);
+            }
+
+            if (static_cast<std::size_t>(std::rand() % 100) < density2)
+            {
+                set2.push_back(vertex + offset);
+            }
+        }
+
+        std::vector<htd::vertex_t> intersection;
+        std::vector<htd::vertex_t> setUnion;
+        std::vector<htd::vertex_t> difference;
+
+        std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end(), std::back_inserter(intersection));
+        std::set_union(set1.begin(), set1.end(), set2.begin(), set2.end(), std::back_inserter(setUnion));
+        std::set_difference(set1.begin(), set1.end(), set2.begin(), set2.end(), std::back_inserter(difference));
+
+        const htd::vertex_t * begin1 = set1.data();
+        const htd::vertex_t * begin2 = set2.data();
+
+        for (htd::SetKernel kernel : kernels)
+        {
+            if (htd::isSetKernelSupported(kernel))
+            {
+                ASSERT_EQ(intersection.size(), htd::set_intersection_size(begin1, begin1 + set1.size(), begin2, begin2 + set2.size(), kernel));
+                ASSERT_EQ(intersection.size(), htd::set_intersection_size(begin2, begin2 + set2.size(), begin1, begin1 + set1.size(), kernel));
+            }
+        }
+
+        ASSERT_EQ(intersection.size(), htd::set_intersection_size(set1.begin(), set1.end(), set2.cbegin(), set2.cend()));
+        ASSERT_EQ(setUnion.size(), htd::set_union_size(set1.begin(), set1.end(), set2.begin(), set2.end()));
+        ASSERT_EQ(difference.size(), htd::set_difference_size(set1.begin(), set1.end(), set2.begin(), set2.end()));
+        ASSERT_EQ(!intersection.empty(), htd::has_non_empty_set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end()));
+
+        std::tuple<std::size_t, std::size_t, std::size_t> analysis = htd::analyze_sets(set1, set2);
+
+        ASSERT_EQ(difference.size(), std::get<0>(analysis));
+        ASSERT_EQ(intersection.size(), std::get<1>(analysis));
+        ASSERT_EQ(set2.size() - intersection.size(), std::get<2>(analysis));
+    }
+}
+
+TEST(HelperTest, CheckParallelFor)
+{
+    for (std::size_t count : { 0, 1, 63, 64, 1000, 100000 })
+    {
+        for (std::size_t threadCount : { 1, 2, 4 })
+        {
+            std::vector<std::size_t> visits(count, 0);
+
+            htd::parallelFor(count, threadCount, [&](std::size_t first, std::size_t last)
+            {
+                ASSERT_LT(first, last);
+                ASSERT_LE(last, count);
+
+                for (std::size_t index = first; index < last; ++index)
+                {
+                    ++visits[index];
+                }
+            });
+
+            ASSERT_EQ(count, static_cast<std::size_t>(std::count(visits.begin(), visits.end(), 1)));
+        }
+    }
+}
+
+TEST(HelperTest, CheckParallelInvoke)
+{
+    for (std::size_t threadCount : { 1, 2, 4 })
+    {
+        std::vector<std::size_t> invocations(threadCount, 0);
+
+        std::vector<std::size_t> nestedInvocations(threadCount, 0);
+
+        std::vector<std::size_t> nestedChunks(threadCount, 0);
+
+        htd::parallelInvoke(threadCount, [&](std::size_t threadIndex)
+        {
+            ASSERT_LT(threadIndex, threadCount);
+
+            ++invocations[threadIndex];
+
+            /* Nested parallel regions are executed by the invoking thread alone. */
+            htd::parallelInvoke(4, [&](std::size_t nestedThreadIndex)
+            {
+                ASSERT_EQ((std::size_t)0, nestedThreadIndex);
+
+                ++nestedInvocations[threadIndex];
+            });
+
+            htd::parallelFor(100000, 4, [&](std::size_t first, std::size_t last)
+            {
+                ASSERT_EQ((std::size_t)0, first);
+                ASSERT_EQ((std::size_t)100000, last);
+
+                ++nestedChunks[threadIndex];
+            });
+        });
+
+        ASSERT_EQ(threadCount, static_cast<std::size_t>(std::count(invocations.begin(), invocations.end(), 1)));
+        ASSERT_EQ(threadCount, static_cast<std::size_t>(std::count(nestedInvocations.begin(), nestedInvocations.end(), 1)));
+        ASSERT_EQ(threadCount, static_cast<std::size_t>(std::count(nestedChunks.begin(), nestedChunks.end(), 1)));
+    }
+}
+
+TEST(HelperTest, CheckParallelExceptions)
+{
+    for (std::size_t threadCount : { 1, 2, 4 })
+    {
+        for (std::size_t failingIndex : { (std::size_t)0, threadCount - 1 })
+        {
+            std::atomic<std::size_t> invocations(0);
+
+            /* Exceptions of the calling thread as well as of the additional threads are rethrown after all threads have finished. */
+            ASSERT_THROW(htd::parallelInvoke(threadCount, [&](std::size_t threadIndex)
+            {
+                ++invocations;
+
+                if (threadIndex == failingIndex)
+                {
+                    throw std::runtime_error("Abort");
+                }
+            }), std::runtime_error);
+
+            ASSERT_EQ(threadCount, invocations.load());
+        }
+
+        ASSERT_THROW(htd::parallelFor(100000, threadCount, [&](std::size_t first, std::size_t last)
+        {
+            if (first <= 50000 && 50000 < last)
+            {
+                throw std::bad_alloc();
+            }
+        }), std::bad_alloc);
+    }
+}
+
+TEST(HelperTest, CheckRandomNumberGenerator)
+{
+    htd::RandomNumberGenerator generator1(42);
+    htd::RandomNumberGenerator generator2(42);
+    htd::RandomNumberGenerator generator3(43);
+
+    std::vector<std::uint64_t> sequence1;
+    std::vector<std::uint64_t> sequence3;
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        std::uint64_t value = generator1();
+
+        ASSERT_EQ(value, generator2());
+
+        sequence1.push_back(value);
+        sequence3.push_back(generator3());
+    }
+
+    ASSERT_NE(sequence1, sequence3);
+
+    generator1.seed(42);
+
+    ASSERT_EQ(sequence1[0], generator1());
+
+    for (std::size_t bound : { 1, 2, 3, 10, 1000 })
+    {
+        for (std::size_t index = 0; index < 100; ++index)
+        {
+            ASSERT_LT(generator1.nextIndex(bound), bound);
+        }
+    }
+
+    htd::RandomNumberGenerator parent1(7);
+    htd::RandomNumberGenerator parent2(7);
+
+    htd::RandomNumberGenerator child1 = parent1.fork();
+    htd::RandomNumberGenerator child2 = parent2.fork();
+
+    htd::RandomNumberGenerator substream1 = parent1.substream(3);
+    htd::RandomNumberGenerator substream2 = parent2.substream(3);
+    htd::RandomNumberGenerator substream3 = parent2.substream(4);
+
+    std::uint64_t childValue = child1();
+    std::uint64_t parentValue = parent1();
+    std::uint64_t substreamValue = substream1();
+
+    ASSERT_EQ(childValue, child2());
+    ASSERT_EQ(parentValue, parent2());
+    ASSERT_EQ(substreamValue, substream2());
+
+    ASSERT_NE(childValue, parentValue);
+    ASSERT_NE(substreamValue, substream3());
+}
+
+TEST(HelperTest, CheckRandomNumberGeneratorBinding)
+{
+    htd::LibraryInstance * libraryInstance1 = htd::createManagementInstance(htd::Id::FIRST);
+    htd::LibraryInstance * libraryInstance2 = htd::createManagementInstance(htd::Id::FIRST + 1);
+
+    htd::RandomNumberGenerator & instanceGenerator1 = libraryInstance1->randomNumberGenerator();
+    htd::RandomNumberGenerator & instanceGenerator2 = libraryInstance2->randomNumberGenerator();
+
+    htd::RandomNumberGenerator threadGenerator1(5);
+    htd::RandomNumberGenerator threadGenerator2(6);
+    htd::RandomNumberGenerator nestedGenerator(7);
+
+    {
+        htd::RandomNumberGeneratorBinding binding1(*libraryInstance1, threadGenerator1);
+
+        ASSERT_EQ(&threadGenerator1, &(libraryInstance1->randomNumberGenerator()));
+
+        ASSERT_EQ(&instanceGenerator2, &(libraryInstance2->randomNumberGenerator()));
+
+        std::thread thread([&]()
+        {
+            ASSERT_EQ(&instanceGenerator1, &(libraryInstance1->randomNumberGenerator()));
+        });
+
+        thread.join();
+
+        {
+            /* A binding for a different management instance does not affect the existing one. */
+            htd::RandomNumberGeneratorBinding binding2(*libraryInstance2, threadGenerator2);
+
+            ASSERT_EQ(&threadGenerator1, &(libraryInstance1->randomNumberGenerator()));
+            ASSERT_EQ(&threadGenerator2, &(libraryInstance2->randomNumberGenerator()));
+        }
+
+        ASSERT_EQ(&threadGenerator1, &(libraryInstance1->randomNumberGenerator()));
+        ASSERT_EQ(&instanceGenerator2, &(libraryInstance2->randomNumberGenerator()));
+
+        try
+        {
+            htd::RandomNumberGeneratorBinding nestedBinding(*libraryInstance1, nestedGenerator);
+
+            ASSERT_EQ(&nestedGenerator, &(libraryInstance1->randomNumberGenerator()));
+
+            throw std::runtime_error("Abort");
+        }
+        catch (const std::runtime_error &)
+        {
+
+        }
+
+        /* The nested binding is undone during stack unwinding. */
+        ASSERT_EQ(&threadGenerator1, &(libraryInstance1->randomNumberGenerator()));
+    }
+
+    ASSERT_EQ(&instanceGenerator1, &(libraryInstance1->randomNumberGenerator()));
+    ASSERT_EQ(&instanceGenerator2, &(libraryInstance2->randomNumberGenerator()));
+
+    delete libraryInstance1;
+    delete libraryInstance2;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -942,6 +942,110 @@ TEST(HyperedgeTest, CheckSetElements)
     ASSERT_EQ((htd::vertex_t)1, hyperedge1.sortedElements()[0]);
 }
 
+TEST(HyperedgeTest, CheckCopyAndMove)
+{
+    htd::Hyperedge hyperedge1((htd::id_t)1, std::vector<htd::vertex_t> { 3, 1, 3, 2 });
+
+    htd::Hyperedge hyperedge2(hyperedge1);
+
+    ASSERT_EQ((htd::id_t)1, hyperedge2.id());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 1, 3, 2 }), hyperedge2.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), hyperedge2.sortedElements());
+
+    htd::Hyperedge hyperedge3(std::move(hyperedge2));
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 1, 3, 2 }), hyperedge3.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), hyperedge3.sortedElements());
+
+    htd::Hyperedge hyperedge4((htd::id_t)4, 1, 2);
+
+    ASSERT_EQ(hyperedge4.elements(), hyperedge4.sortedElements());
+
+    hyperedge4 = std::move(hyperedge3);
+
+    ASSERT_EQ((htd::id_t)1, hyperedge4.id());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), hyperedge4.sortedElements());
+    ASSERT_TRUE(hyperedge3.empty());
+    ASSERT_TRUE(hyperedge3.sortedElements().empty());
+
+    hyperedge4.erase(3);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), hyperedge4.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), hyperedge4.sortedElements());
+    ASSERT_FALSE(hyperedge4.contains(3));
+
+    hyperedge3 = hyperedge1;
+
+    hyperedge3.setElements(2, 2);
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 2 }), hyperedge3.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2 }), hyperedge3.sortedElements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), hyperedge1.sortedElements());
+}
+
+bool isStoredInline(const htd::Hyperedge & hyperedge)
+{
+    const char * begin = reinterpret_cast<const char *>(&hyperedge);
+
+    const char * data = reinterpret_cast<const char *>(hyperedge.elements().data());
+
+    return data >= begin && data < begin + sizeof(htd::Hyperedge);
+}
+
+TEST(HyperedgeTest, CheckInlineStorage)
+{
+    htd::Hyperedge hyperedge1((htd::id_t)1, 2, 1);
+
+    ASSERT_TRUE(isStoredInline(hyperedge1));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 1 }), hyperedge1.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), hyperedge1.sortedElements());
+
+    htd::Hyperedge hyperedge2((htd::id_t)2, std::vector<htd::vertex_t> { 1, 2, 3, 4 });
+
+    ASSERT_TRUE(isStoredInline(hyperedge2));
+    ASSERT_EQ(hyperedge2.elements().data(), hyperedge2.sortedElements().data());
+
+    htd::Hyperedge hyperedge3((htd::id_t)3, std::vector<htd::vertex_t> { 3, 1, 2 });
+
+    ASSERT_FALSE(isStoredInline(hyperedge3));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 1, 2 }), hyperedge3.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3 }), hyperedge3.sortedElements());
+
+    hyperedge3.erase(1);
+
+    ASSERT_TRUE(isStoredInline(hyperedge3));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 2 }), hyperedge3.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 3 }), hyperedge3.sortedElements());
+
+    hyperedge1 = hyperedge3;
+
+    hyperedge3.setElements(std::vector<htd::vertex_t> { 5, 4, 3, 2, 1 });
+
+    ASSERT_FALSE(isStoredInline(hyperedge3));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 2 }), hyperedge1.elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5 }), hyperedge3.sortedElements());
+
+    const htd::Hyperedge & self = hyperedge3;
+
+    hyperedge3 = self;
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 5, 4, 3, 2, 1 }), hyperedge3.elements());
+
+    const htd::vertex_t * heapContent = hyperedge3.elements().data();
+
+    hyperedge2 = std::move(hyperedge3);
+
+    ASSERT_EQ(heapContent, hyperedge2.elements().data());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5 }), hyperedge2.sortedElements());
+    ASSERT_TRUE(hyperedge3.empty());
+
+    hyperedge2.setElements(7, 7);
+
+    ASSERT_TRUE(isStoredInline(hyperedge2));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 7 }), hyperedge2.sortedElements());
+    ASSERT_THROW(hyperedge2.at(2), std::out_of_range);
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
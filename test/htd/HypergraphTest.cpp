@@ -212,13 +212,13 @@ TEST(HypergraphTest, CheckSizeInitializedGraph2)
     ASSERT_TRUE(hyperedge1.contains((htd::vertex_t)2));
     ASSERT_FALSE(hyperedge1.contains((htd::vertex_t)3));
 
-    const std::vector<htd::vertex_t> & hyperedgeElements1 = hyperedge1.elements();
+    const htd::VertexSpan & hyperedgeElements1 = hyperedge1.elements();
 
     ASSERT_EQ((std::size_t)2, hyperedgeElements1.size());
     ASSERT_EQ((htd::vertex_t)2, hyperedgeElements1[0]);
     ASSERT_EQ((htd::vertex_t)1, hyperedgeElements1[1]);
 
-    const std::vector<htd::vertex_t> & sortedHyperedgeElements1 = hyperedge1.sortedElements();
+    const htd::VertexSpan & sortedHyperedgeElements1 = hyperedge1.sortedElements();
 
     ASSERT_EQ((std::size_t)2, sortedHyperedgeElements1.size());
     ASSERT_EQ((htd::vertex_t)1, sortedHyperedgeElements1[0]);
@@ -280,14 +280,14 @@ TEST(HypergraphTest, CheckSizeInitializedGraph2)
     ASSERT_TRUE(hyperedge2.contains((htd::vertex_t)2));
     ASSERT_TRUE(hyperedge2.contains((htd::vertex_t)3));
 
-    const std::vector<htd::vertex_t> & hyperedgeElements2 = hyperedge2.elements();
+    const htd::VertexSpan & hyperedgeElements2 = hyperedge2.elements();
 
     ASSERT_EQ((std::size_t)3, hyperedgeElements2.size());
     ASSERT_EQ((htd::vertex_t)1, hyperedgeElements2[0]);
     ASSERT_EQ((htd::vertex_t)2, hyperedgeElements2[1]);
     ASSERT_EQ((htd::vertex_t)3, hyperedgeElements2[2]);
 
-    const std::vector<htd::vertex_t> & sortedHyperedgeElements2 = hyperedge2.sortedElements();
+    const htd::VertexSpan & sortedHyperedgeElements2 = hyperedge2.sortedElements();
 
     ASSERT_EQ((std::size_t)3, sortedHyperedgeElements2.size());
     ASSERT_EQ((htd::vertex_t)1, sortedHyperedgeElements2[0]);
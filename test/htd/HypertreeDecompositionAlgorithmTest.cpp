@@ -60,7 +60,7 @@ bool isValidHypertreeDecomposition(const htd::IMultiHypergraph & graph, const ht
 
     for (htd::vertex_t vertex : decomposition.vertices())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+        const htd::Bag & bag = decomposition.bagContent(vertex);
         const std::vector<htd::Hyperedge> & coveringEdges = decomposition.coveringEdges(vertex);
 
         std::unordered_set<htd::vertex_t> missingVertices(bag.begin(), bag.end());
@@ -109,7 +109,7 @@ TEST(HypertreeDecompositionAlgorithmTest, CheckResultEmptyGraph)
 
     ASSERT_EQ(decomposition->root(), (htd::vertex_t)1);
 
-    const std::vector<htd::vertex_t> & bag = decomposition->bagContent(1);
+    const htd::Bag & bag = decomposition->bagContent(1);
 
     EXPECT_EQ(bag.size(), (std::size_t)0);
 
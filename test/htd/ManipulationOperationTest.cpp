@@ -642,7 +642,7 @@ bool isValidInducedEdgeLabel(const htd::IMultiHypergraph & graph, const htd::ITr
 
     HTD_ASSERT(decomposition.isVertex(vertex))
 
-    const std::vector<htd::vertex_t> & bag = decomposition.bagContent(vertex);
+    const htd::Bag & bag = decomposition.bagContent(vertex);
 
     std::vector<htd::Hyperedge> requiredEdges;
 
@@ -651,7 +651,7 @@ bool isValidInducedEdgeLabel(const htd::IMultiHypergraph & graph, const htd::ITr
 
     for (const htd::Hyperedge & edge : graph.hyperedges())
     {
-        const std::vector<htd::vertex_t> & elements = edge.sortedElements();
+        const htd::VertexSpan & elements = edge.sortedElements();
 
         if (std::includes(bag.begin(), bag.end(), elements.begin(), elements.end()))
         {
@@ -1051,11 +1051,11 @@ TEST(ManipulationOperationTest, CheckJoinNodeNormalizationOperation1)
 
     for (htd::vertex_t vertex : decomposition->joinNodes())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
+        const htd::Bag & bag = decomposition->bagContent(vertex);
 
         for (htd::vertex_t child : decomposition->children(vertex))
         {
-            const std::vector<htd::vertex_t> & childBag = decomposition->bagContent(child);
+            const htd::Bag & childBag = decomposition->bagContent(child);
 
             ASSERT_TRUE(childBag == bag);
         }
@@ -1069,11 +1069,11 @@ TEST(ManipulationOperationTest, CheckJoinNodeNormalizationOperation1)
 
     for (htd::vertex_t vertex : decomposition->joinNodes())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
+        const htd::Bag & bag = decomposition->bagContent(vertex);
 
         for (htd::vertex_t child : decomposition->children(vertex))
         {
-            const std::vector<htd::vertex_t> & childBag = decomposition->bagContent(child);
+            const htd::Bag & childBag = decomposition->bagContent(child);
 
             ASSERT_TRUE(childBag == bag);
         }
@@ -1132,11 +1132,11 @@ TEST(ManipulationOperationTest, CheckJoinNodeNormalizationOperation2)
 
     for (htd::vertex_t vertex : decomposition->joinNodes())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
+        const htd::Bag & bag = decomposition->bagContent(vertex);
 
         for (htd::vertex_t child : decomposition->children(vertex))
         {
-            const std::vector<htd::vertex_t> & childBag = decomposition->bagContent(child);
+            const htd::Bag & childBag = decomposition->bagContent(child);
 
             ASSERT_TRUE(childBag == bag);
         }
@@ -1155,11 +1155,11 @@ TEST(ManipulationOperationTest, CheckJoinNodeNormalizationOperation2)
 
     for (htd::vertex_t vertex : decomposition->joinNodes())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
+        const htd::Bag & bag = decomposition->bagContent(vertex);
 
         for (htd::vertex_t child : decomposition->children(vertex))
         {
-            const std::vector<htd::vertex_t> & childBag = decomposition->bagContent(child);
+            const htd::Bag & childBag = decomposition->bagContent(child);
 
             ASSERT_TRUE(childBag == bag);
         }
@@ -2662,8 +2662,8 @@ TEST(ManipulationOperationTest, CheckAddIdenticalJoinNodeParentOperation1)
 
     for (htd::vertex_t vertex : decomposition->joinNodes())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
-        const std::vector<htd::vertex_t> & parentBag = decomposition->bagContent(decomposition->parent(vertex));
+        const htd::Bag & bag = decomposition->bagContent(vertex);
+        const htd::Bag & parentBag = decomposition->bagContent(decomposition->parent(vertex));
 
         ASSERT_TRUE(parentBag == bag);
     }
@@ -2676,9 +2676,9 @@ TEST(ManipulationOperationTest, CheckAddIdenticalJoinNodeParentOperation1)
 
     for (htd::vertex_t vertex : decomposition->joinNodes())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
-        const std::vector<htd::vertex_t> & parentBag = decomposition->bagContent(decomposition->parent(vertex));
-        const std::vector<htd::vertex_t> & grandparentBag = decomposition->bagContent(decomposition->parent(decomposition->parent(vertex)));
+        const htd::Bag & bag = decomposition->bagContent(vertex);
+        const htd::Bag & parentBag = decomposition->bagContent(decomposition->parent(vertex));
+        const htd::Bag & grandparentBag = decomposition->bagContent(decomposition->parent(decomposition->parent(vertex)));
 
         ASSERT_TRUE(parentBag == bag);
         ASSERT_TRUE(grandparentBag == bag);
@@ -2732,8 +2732,8 @@ TEST(ManipulationOperationTest, CheckAddIdenticalJoinNodeParentOperation2)
 
     for (htd::vertex_t vertex : decomposition->joinNodes())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
-        const std::vector<htd::vertex_t> & parentBag = decomposition->bagContent(decomposition->parent(vertex));
+        const htd::Bag & bag = decomposition->bagContent(vertex);
+        const htd::Bag & parentBag = decomposition->bagContent(decomposition->parent(vertex));
 
         ASSERT_TRUE(parentBag == bag);
     }
@@ -2751,9 +2751,9 @@ TEST(ManipulationOperationTest, CheckAddIdenticalJoinNodeParentOperation2)
 
     for (htd::vertex_t vertex : decomposition->joinNodes())
     {
-        const std::vector<htd::vertex_t> & bag = decomposition->bagContent(vertex);
-        const std::vector<htd::vertex_t> & parentBag = decomposition->bagContent(decomposition->parent(vertex));
-        const std::vector<htd::vertex_t> & grandparentBag = decomposition->bagContent(decomposition->parent(decomposition->parent(vertex)));
+        const htd::Bag & bag = decomposition->bagContent(vertex);
+        const htd::Bag & parentBag = decomposition->bagContent(decomposition->parent(vertex));
+        const htd::Bag & grandparentBag = decomposition->bagContent(decomposition->parent(decomposition->parent(vertex)));
 
         ASSERT_TRUE(parentBag == bag);
         ASSERT_TRUE(grandparentBag == bag);
@@ -3971,13 +3971,13 @@ TEST(ManipulationOperationTest, CheckTreeDecompositionCompressionOperation1)
     {
         bool supersetFound = false;
 
-        const std::vector<htd::vertex_t> & bag1 = decomposition->bagContent(vertex1);
+        const htd::Bag & bag1 = decomposition->bagContent(vertex1);
 
         for (htd::vertex_t vertex2 : decomposition->vertices())
         {
             if (vertex1 != vertex2)
             {
-                const std::vector<htd::vertex_t> & bag2 = decomposition->bagContent(vertex2);
+                const htd::Bag & bag2 = decomposition->bagContent(vertex2);
 
                 supersetFound = supersetFound || std::includes(bag2.begin(), bag2.end(), bag1.begin(), bag1.end());
             }
@@ -4036,13 +4036,13 @@ TEST(ManipulationOperationTest, CheckPathDecompositionCompressionOperation1)
     {
         bool supersetFound = false;
 
-        const std::vector<htd::vertex_t> & bag1 = decomposition->bagContent(vertex1);
+        const htd::Bag & bag1 = decomposition->bagContent(vertex1);
 
         for (htd::vertex_t vertex2 : decomposition->vertices())
         {
             if (vertex1 != vertex2)
             {
-                const std::vector<htd::vertex_t> & bag2 = decomposition->bagContent(vertex2);
+                const htd::Bag & bag2 = decomposition->bagContent(vertex2);
 
                 supersetFound = supersetFound || std::includes(bag2.begin(), bag2.end(), bag1.begin(), bag1.end());
             }
@@ -4096,13 +4096,13 @@ TEST(ManipulationOperationTest, CheckTreeDecompositionCompressionOperation2)
     {
         bool supersetFound = false;
 
-        const std::vector<htd::vertex_t> & bag1 = decomposition->bagContent(vertex1);
+        const htd::Bag & bag1 = decomposition->bagContent(vertex1);
 
         for (htd::vertex_t vertex2 : decomposition->vertices())
         {
             if (vertex1 != vertex2)
             {
-                const std::vector<htd::vertex_t> & bag2 = decomposition->bagContent(vertex2);
+                const htd::Bag & bag2 = decomposition->bagContent(vertex2);
 
                 supersetFound = supersetFound || std::includes(bag2.begin(), bag2.end(), bag1.begin(), bag1.end());
             }
@@ -4143,13 +4143,13 @@ TEST(ManipulationOperationTest, CheckPathDecompositionCompressionOperation2)
     {
         bool supersetFound = false;
 
-        const std::vector<htd::vertex_t> & bag1 = decomposition->bagContent(vertex1);
+        const htd::Bag & bag1 = decomposition->bagContent(vertex1);
 
         for (htd::vertex_t vertex2 : decomposition->vertices())
         {
             if (vertex1 != vertex2)
             {
-                const std::vector<htd::vertex_t> & bag2 = decomposition->bagContent(vertex2);
+                const htd::Bag & bag2 = decomposition->bagContent(vertex2);
 
                 supersetFound = supersetFound || std::includes(bag2.begin(), bag2.end(), bag1.begin(), bag1.end());
             }
@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include "ChordalityTestHelpers.hpp"
+
+#include <random>
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
@@ -771,6 +774,30 @@ TEST(MaximumCardinalitySearchOrderingAlgorithmTest, CheckSize50Graph)
     delete libraryInstance;
 }
 
+TEST(MaximumCardinalitySearchOrderingAlgorithmTest, CheckRepeatedInvocations)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MaximumCardinalitySearchOrderingAlgorithm algorithm(libraryInstance);
+
+    std::mt19937 generator(7);
+
+    for (std::size_t vertexCount : { 300, 20, 1, 300 })
+    {
+        htd::MultiHypergraph graph = createRandomGraph(libraryInstance, vertexCount, vertexCount * 4, generator);
+
+        const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+        ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+        ASSERT_TRUE(isValidOrdering(graph, ordering->sequence()));
+
+        delete ordering;
+    }
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
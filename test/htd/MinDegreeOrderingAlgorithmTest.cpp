@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include "ChordalityTestHelpers.hpp"
+
+#include <random>
 #include <vector>
 
 class MinDegreeOrderingAlgorithmTest : public ::testing::Test
@@ -1278,6 +1281,37 @@ TEST(MinDegreeOrderingAlgorithmTest, CheckSize50Graph2)
     delete libraryInstance;
 }
 
+TEST(MinDegreeOrderingAlgorithmTest, CheckMultiThreadedInitialization)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(11);
+
+    htd::MultiHypergraph graph = createRandomGraph(libraryInstance, 500, 2000, generator);
+
+    htd::MinDegreeOrderingAlgorithm algorithm(libraryInstance);
+
+    libraryInstance->randomNumberGenerator().seed(13);
+
+    const htd::IVertexOrdering * ordering1 = algorithm.computeOrdering(graph);
+
+    libraryInstance->setThreadCount(4);
+
+    libraryInstance->randomNumberGenerator().seed(13);
+
+    const htd::IVertexOrdering * ordering2 = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ(graph.vertexCount(), ordering1->sequence().size());
+
+    ASSERT_TRUE(isValidOrdering(graph, ordering1->sequence()));
+
+    ASSERT_EQ(ordering1->sequence(), ordering2->sequence());
+
+    delete ordering1;
+    delete ordering2;
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
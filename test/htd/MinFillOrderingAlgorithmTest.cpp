@@ -26,6 +26,9 @@
 
 #include <htd/main.hpp>
 
+#include "ChordalityTestHelpers.hpp"
+
+#include <random>
 #include <vector>
 
 class MinFillOrderingAlgorithmTest : public ::testing::Test
@@ -1296,6 +1299,58 @@ TEST(MinFillOrderingAlgorithmTest, CheckSize50Graph2)
     delete libraryInstance;
 }
 
+TEST(MinFillOrderingAlgorithmTest, CheckDenseGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(7);
+
+    /* Twice as many draws as vertex pairs cover about 86% of the pairs. */
+    htd::MultiHypergraph graph = createRandomGraph(libraryInstance, 90, 90 * 89, generator, false);
+
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    const htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+    ASSERT_TRUE(isValidOrdering(graph, ordering->sequence()));
+
+    delete ordering;
+    delete libraryInstance;
+}
+
+TEST(MinFillOrderingAlgorithmTest, CheckMultiThreadedInitialization)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(11);
+
+    htd::MultiHypergraph graph = createRandomGraph(libraryInstance, 500, 2000, generator);
+
+    htd::MinFillOrderingAlgorithm algorithm(libraryInstance);
+
+    libraryInstance->randomNumberGenerator().seed(13);
+
+    const htd::IVertexOrdering * ordering1 = algorithm.computeOrdering(graph);
+
+    libraryInstance->setThreadCount(4);
+
+    libraryInstance->randomNumberGenerator().seed(13);
+
+    const htd::IVertexOrdering * ordering2 = algorithm.computeOrdering(graph);
+
+    ASSERT_EQ(graph.vertexCount(), ordering1->sequence().size());
+
+    ASSERT_TRUE(isValidOrdering(graph, ordering1->sequence()));
+
+    ASSERT_EQ(ordering1->sequence(), ordering2->sequence());
+
+    delete ordering1;
+    delete ordering2;
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -239,13 +239,13 @@ TEST(MultiHypergraphTest, CheckSizeInitializedGraph2)
     ASSERT_TRUE(hyperedge1.contains((htd::vertex_t)2));
     ASSERT_FALSE(hyperedge1.contains((htd::vertex_t)3));
 
-    const std::vector<htd::vertex_t> & hyperedgeElements1 = hyperedge1.elements();
+    const htd::VertexSpan & hyperedgeElements1 = hyperedge1.elements();
 
     ASSERT_EQ((std::size_t)2, hyperedgeElements1.size());
     ASSERT_EQ((htd::vertex_t)2, hyperedgeElements1[0]);
     ASSERT_EQ((htd::vertex_t)1, hyperedgeElements1[1]);
 
-    const std::vector<htd::vertex_t> & sortedHyperedgeElements1 = hyperedge1.sortedElements();
+    const htd::VertexSpan & sortedHyperedgeElements1 = hyperedge1.sortedElements();
 
     ASSERT_EQ((std::size_t)2, sortedHyperedgeElements1.size());
     ASSERT_EQ((htd::vertex_t)1, sortedHyperedgeElements1[0]);
@@ -312,14 +312,14 @@ TEST(MultiHypergraphTest, CheckSizeInitializedGraph2)
     ASSERT_TRUE(hyperedge2.contains((htd::vertex_t)2));
     ASSERT_TRUE(hyperedge2.contains((htd::vertex_t)3));
 
-    const std::vector<htd::vertex_t> & hyperedgeElements2 = hyperedge2.elements();
+    const htd::VertexSpan & hyperedgeElements2 = hyperedge2.elements();
 
     ASSERT_EQ((std::size_t)3, hyperedgeElements2.size());
     ASSERT_EQ((htd::vertex_t)1, hyperedgeElements2[0]);
     ASSERT_EQ((htd::vertex_t)2, hyperedgeElements2[1]);
     ASSERT_EQ((htd::vertex_t)3, hyperedgeElements2[2]);
 
-    const std::vector<htd::vertex_t> & sortedHyperedgeElements2 = hyperedge2.sortedElements();
+    const htd::VertexSpan & sortedHyperedgeElements2 = hyperedge2.sortedElements();
 
     ASSERT_EQ((std::size_t)3, sortedHyperedgeElements2.size());
     ASSERT_EQ((htd::vertex_t)1, sortedHyperedgeElements2[0]);
@@ -804,6 +804,572 @@ TEST(MultiHypergraphTest, CheckCopyConstructors)
     delete libraryInstance;
 }
 
+TEST(MultiHypergraphTest, CheckBatchInsertion)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph1(libraryInstance, 6);
+    htd::MultiHypergraph graph2(libraryInstance, 6);
+
+    std::vector<std::pair<htd::vertex_t, htd::vertex_t>> edges { { 1, 2 }, { 2, 1 }, { 5, 5 }, { 3, 1 } };
+
+    std::vector<std::vector<htd::vertex_t>> hyperedges { { 4 }, { 6, 2, 4, 2 }, { 2, 3 }, { 1, 4, 6 } };
+
+    graph1.addEdge(2, 4);
+    graph2.addEdge(2, 4);
+
+    for (const std::pair<htd::vertex_t, htd::vertex_t> & edge : edges)
+    {
+        graph1.addEdge(edge.first, edge.second);
+    }
+
+    for (const std::vector<htd::vertex_t> & hyperedge : hyperedges)
+    {
+        graph1.addEdge(hyperedge);
+    }
+
+    ASSERT_EQ((htd::id_t)2, graph2.addEdges(edges));
+    ASSERT_EQ((htd::id_t)6, graph2.addEdges(hyperedges));
+    ASSERT_EQ((htd::id_t)9, graph2.addEdges(std::vector<std::vector<htd::vertex_t>>()));
+
+    ASSERT_EQ(graph1.edgeCount(), graph2.edgeCount());
+    ASSERT_EQ(graph1.nextEdgeId(), graph2.nextEdgeId());
+
+    for (htd::index_t index = 0; index < graph1.edgeCount(); ++index)
+    {
+        ASSERT_EQ(graph1.hyperedgeAtPosition(index), graph2.hyperedgeAtPosition(index));
+    }
+
+    for (htd::vertex_t vertex : graph1.vertices())
+    {
+        ASSERT_EQ(graph1.neighbors(vertex), graph2.neighbors(vertex));
+
+        for (htd::vertex_t vertex2 : graph1.vertices())
+        {
+            ASSERT_EQ(graph1.isNeighbor(vertex, vertex2), graph2.isNeighbor(vertex, vertex2));
+        }
+    }
+
+    ASSERT_TRUE(graph2.isNeighbor(2, 2));
+    ASSERT_TRUE(graph2.isNeighbor(5, 5));
+    ASSERT_FALSE(graph2.isNeighbor(4, 4));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckBuilder)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 4);
+
+    htd::MultiHypergraphBuilder builder;
+
+    ASSERT_EQ((htd::id_t)0, builder.populate(graph));
+
+    builder.addEdge(1, 2);
+    builder.addEdge(std::vector<htd::vertex_t> { 3, 2, 1 });
+    builder.addEdge(std::vector<htd::vertex_t> { 4, 3 });
+    builder.addEdge(2, 2);
+
+    ASSERT_EQ((std::size_t)4, builder.edgeCount());
+
+    ASSERT_EQ((htd::id_t)1, builder.populate(graph));
+
+    ASSERT_EQ((std::size_t)0, builder.edgeCount());
+
+    ASSERT_EQ((std::size_t)4, graph.edgeCount());
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), graph.hyperedge(1).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 2, 1 }), graph.hyperedge(2).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 4, 3 }), graph.hyperedge(3).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 2 }), graph.hyperedge(4).elements());
+
+    ASSERT_EQ((std::size_t)2, graph.neighborCount(1));
+    ASSERT_EQ((std::size_t)3, graph.neighborCount(2));
+    ASSERT_EQ((std::size_t)3, graph.neighborCount(3));
+    ASSERT_EQ((std::size_t)1, graph.neighborCount(4));
+
+    ASSERT_TRUE(graph.isNeighbor(2, 2));
+    ASSERT_TRUE(graph.isNeighbor(3, 4));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckBuilderWithMixedRuns)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph1(libraryInstance, 100);
+    htd::MultiHypergraph graph2(libraryInstance, 100);
+
+    htd::MultiHypergraphBuilder builder;
+
+    std::vector<std::vector<htd::vertex_t>> edges { { 1, 100 }, { 50, 2 }, { 7, 90, 7 }, { 3 }, { 100, 100 }, { 4, 5 }, { 5, 4 }, { 4, 6, 5, 3 }, { 90, 1 } };
+
+    for (const std::vector<htd::vertex_t> & edge : edges)
+    {
+        graph1.addEdge(edge);
+
+        builder.addEdge(std::vector<htd::vertex_t>(edge));
+    }
+
+    ASSERT_EQ((htd::id_t)1, builder.populate(graph2));
+
+    ASSERT_EQ(graph1.edgeCount(), graph2.edgeCount());
+    ASSERT_EQ(graph1.nextEdgeId(), graph2.nextEdgeId());
+
+    for (htd::index_t index = 0; index < graph1.edgeCount(); ++index)
+    {
+        ASSERT_EQ(graph1.hyperedgeAtPosition(index), graph2.hyperedgeAtPosition(index));
+    }
+
+    for (htd::vertex_t vertex : graph1.vertices())
+    {
+        ASSERT_EQ(graph1.neighbors(vertex), graph2.neighbors(vertex));
+    }
+
+    ASSERT_TRUE(graph2.isNeighbor(7, 7));
+    ASSERT_TRUE(graph2.isNeighbor(100, 100));
+    ASSERT_FALSE(graph2.isNeighbor(3, 3));
+    ASSERT_TRUE(graph2.isNeighbor(90, 1));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckEdgeLookup)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 4);
+
+    graph.addEdge(std::vector<htd::vertex_t> { 4, 2, 3 });
+    graph.addEdge(3, 3);
+    graph.addEdge(2, 3);
+    graph.addEdge(std::vector<htd::vertex_t> { 3, 2, 4 });
+    graph.addEdge(2, 3);
+    graph.addEdge(1, 2);
+
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 4, 2, 3 }));
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 3, 2, 4 }));
+    ASSERT_FALSE(graph.isEdge(std::vector<htd::vertex_t> { 2, 3, 4 }));
+    ASSERT_FALSE(graph.isEdge(std::vector<htd::vertex_t> { 3, 2 }));
+    ASSERT_TRUE(graph.isEdge(2, 3));
+    ASSERT_FALSE(graph.isEdge(3, 2));
+
+    htd::ConstCollection<htd::id_t> edgeIds1 = graph.associatedEdgeIds(2, 3);
+    htd::ConstCollection<htd::id_t> edgeIds2 = graph.associatedEdgeIds(std::vector<htd::vertex_t> { 3, 2, 4 });
+
+    ASSERT_EQ(std::vector<htd::id_t>({ 3, 5 }), std::vector<htd::id_t>(edgeIds1.begin(), edgeIds1.end()));
+    ASSERT_EQ(std::vector<htd::id_t>({ 4 }), std::vector<htd::id_t>(edgeIds2.begin(), edgeIds2.end()));
+
+    graph.removeEdge(3);
+
+    ASSERT_FALSE(graph.isEdge((htd::id_t)3));
+    ASSERT_TRUE(graph.isEdge((htd::id_t)4));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 2, 4 }), graph.hyperedge(4).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), graph.hyperedge(6).elements());
+    ASSERT_TRUE(graph.isNeighbor(3, 3));
+    ASSERT_TRUE(graph.isNeighbor(2, 3));
+
+    graph.removeEdge(2);
+
+    ASSERT_FALSE(graph.isNeighbor(3, 3));
+    ASSERT_EQ((std::size_t)2, graph.neighborCount(3));
+
+    graph.removeEdge(1);
+    graph.removeEdge(4);
+
+    ASSERT_TRUE(graph.isNeighbor(2, 3));
+    ASSERT_FALSE(graph.isNeighbor(2, 4));
+    ASSERT_TRUE(graph.isIsolatedVertex(4));
+    ASSERT_EQ((std::size_t)1, graph.neighborCount(3));
+
+    graph.removeVertex(3);
+
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 2 }));
+    ASSERT_FALSE(graph.isEdge(std::vector<htd::vertex_t> { 2, 3 }));
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 1, 2 }));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2 }), graph.hyperedge(5).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2 }), graph.hyperedge(6).elements());
+    ASSERT_EQ((std::size_t)2, graph.edgeCount());
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckEdgePositionsAfterRemoval)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 11);
+
+    for (htd::vertex_t vertex = 1; vertex <= 10; ++vertex)
+    {
+        graph.addEdge(vertex, vertex + 1);
+    }
+
+    auto checkEdges = [&](const std::vector<htd::id_t> & expectedEdgeIds)
+    {
+        ASSERT_EQ(expectedEdgeIds.size(), graph.edgeCount());
+
+        std::vector<htd::id_t> edgeIds;
+
+        for (const htd::Hyperedge & hyperedge : graph.hyperedges())
+        {
+            edgeIds.push_back(hyperedge.id());
+        }
+
+        ASSERT_EQ(expectedEdgeIds, edgeIds);
+
+        std::vector<htd::index_t> positions;
+
+        edgeIds.clear();
+
+        for (htd::index_t index = 0; index < expectedEdgeIds.size(); ++index)
+        {
+            ASSERT_EQ(expectedEdgeIds[index], graph.hyperedgeAtPosition(index).id());
+            ASSERT_EQ(expectedEdgeIds[index], graph.hyperedge(expectedEdgeIds[index]).id());
+
+            positions.push_back(expectedEdgeIds.size() - index - 1);
+        }
+
+        for (const htd::Hyperedge & hyperedge : graph.hyperedgesAtPositions(positions))
+        {
+            edgeIds.push_back(hyperedge.id());
+        }
+
+        ASSERT_EQ(std::vector<htd::id_t>(expectedEdgeIds.rbegin(), expectedEdgeIds.rend()), edgeIds);
+    };
+
+    checkEdges(std::vector<htd::id_t> { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 });
+
+    graph.removeEdge(2);
+    graph.removeEdge(6);
+    graph.removeEdge(5);
+
+    ASSERT_FALSE(graph.isEdge((htd::id_t)5));
+
+    checkEdges(std::vector<htd::id_t> { 1, 3, 4, 7, 8, 9, 10 });
+
+    ASSERT_EQ((htd::id_t)11, graph.addEdge(1, 11));
+
+    checkEdges(std::vector<htd::id_t> { 1, 3, 4, 7, 8, 9, 10, 11 });
+
+    graph.removeVertex(8);
+
+    checkEdges(std::vector<htd::id_t> { 1, 3, 4, 7, 8, 9, 10, 11 });
+
+    graph.removeEdge(1);
+    graph.removeEdge(9);
+    graph.removeEdge(3);
+
+    ASSERT_FALSE(graph.isNeighbor(7, 9));
+    ASSERT_TRUE(graph.isNeighbor(10, 11));
+
+    checkEdges(std::vector<htd::id_t> { 4, 7, 8, 10, 11 });
+
+    graph.removeVertex(7);
+
+    checkEdges(std::vector<htd::id_t> { 4, 8, 10, 11 });
+
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 9 }), graph.hyperedge(8).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 11 }), graph.hyperedge(11).elements());
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckIncidentHyperedges)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 5);
+
+    graph.addEdge(std::vector<htd::vertex_t> { 1, 2, 3 });
+    graph.addEdge(2, 2);
+    graph.addEdge(4, 5);
+    graph.addEdge(std::vector<htd::vertex_t> { 2 });
+    graph.addEdge(std::vector<htd::vertex_t> { 5, 2, 4 });
+
+    ASSERT_EQ((std::size_t)1, graph.edgeCount(1));
+    ASSERT_EQ((std::size_t)4, graph.edgeCount(2));
+    ASSERT_EQ((std::size_t)2, graph.edgeCount(5));
+
+    const htd::ConstCollection<htd::Hyperedge> & hyperedges = graph.hyperedges(2);
+
+    ASSERT_EQ((std::size_t)4, hyperedges.size());
+
+    std::vector<htd::id_t> edgeIds;
+
+    for (const htd::Hyperedge & hyperedge : hyperedges)
+    {
+        edgeIds.push_back(hyperedge.id());
+    }
+
+    ASSERT_EQ(std::vector<htd::id_t>({ 1, 2, 4, 5 }), edgeIds);
+
+    ASSERT_EQ((htd::id_t)4, graph.hyperedgeAtPosition(2, 2).id());
+    ASSERT_EQ((htd::id_t)5, graph.hyperedgeAtPosition(1, 5).id());
+    ASSERT_THROW(graph.hyperedgeAtPosition(2, 5), std::out_of_range);
+
+    graph.removeEdge(2);
+
+    ASSERT_EQ((std::size_t)3, graph.edgeCount(2));
+    ASSERT_FALSE(graph.isNeighbor(2, 2));
+
+    graph.removeVertex(2);
+
+    ASSERT_FALSE(graph.isEdge((htd::id_t)4));
+    ASSERT_EQ((std::size_t)3, graph.edgeCount());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3 }), graph.hyperedge(1).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 5, 4 }), graph.hyperedge(5).elements());
+    ASSERT_EQ((std::size_t)1, graph.edgeCount(1));
+    ASSERT_EQ((std::size_t)2, graph.edgeCount(4));
+
+    graph.removeEdge(3);
+
+    ASSERT_TRUE(graph.isNeighbor(4, 5));
+    ASSERT_EQ((std::size_t)1, graph.hyperedges(4).size());
+    ASSERT_EQ((htd::id_t)5, graph.hyperedges(4)[0].id());
+
+    graph.removeEdge(5);
+
+    ASSERT_TRUE(graph.isIsolatedVertex(4));
+    ASSERT_EQ((std::size_t)0, graph.hyperedges(4).size());
+    ASSERT_EQ((std::size_t)2, graph.isolatedVertexCount());
+    ASSERT_EQ((std::size_t)2, graph.isolatedVertices().size());
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckSharedCopies)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph1(libraryInstance, 4);
+
+    graph1.addEdge(1, 2);
+    graph1.addEdge(std::vector<htd::vertex_t> { 2, 3, 4 });
+
+    htd::MultiHypergraph graph2(graph1);
+
+    htd::MultiHypergraph * graph3 = graph1.clone();
+
+    graph2.addEdge(3, 3);
+    graph2.removeEdge(1);
+
+    ASSERT_EQ((std::size_t)2, graph1.edgeCount());
+    ASSERT_TRUE(graph1.isNeighbor(1, 2));
+    ASSERT_FALSE(graph1.isNeighbor(3, 3));
+
+    ASSERT_EQ((std::size_t)2, graph2.edgeCount());
+    ASSERT_FALSE(graph2.isNeighbor(1, 2));
+    ASSERT_TRUE(graph2.isNeighbor(3, 3));
+
+    graph1.removeVertex(2);
+
+    ASSERT_EQ((std::size_t)3, graph1.vertexCount());
+    ASSERT_EQ((std::size_t)4, graph2.vertexCount());
+    ASSERT_EQ((std::size_t)4, graph3->vertexCount());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), graph3->hyperedge(2).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), graph2.hyperedge(2).elements());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 3, 4 }), graph1.hyperedge(2).elements());
+
+    graph1 = *graph3;
+
+    graph3->addVertex();
+
+    ASSERT_EQ((std::size_t)4, graph1.vertexCount());
+    ASSERT_EQ((std::size_t)5, graph3->vertexCount());
+    ASSERT_TRUE(graph1.isNeighbor(1, 2));
+
+    graph2 = static_cast<const htd::IMultiHypergraph &>(graph1);
+
+    ASSERT_EQ((std::size_t)2, graph2.edgeCount());
+    ASSERT_EQ(graph1.hyperedge(1), graph2.hyperedge(1));
+
+    delete graph3;
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckReferencesAfterDetach)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph1(libraryInstance, 4);
+
+    graph1.addEdge(1, 2);
+    graph1.addEdge(std::vector<htd::vertex_t> { 2, 3, 4 });
+
+    /* Without a copy, modifications take place in place and references remain valid. */
+    const htd::Hyperedge & edge1 = graph1.hyperedge(1);
+
+    graph1.addVertex();
+
+    ASSERT_EQ(&edge1, &(graph1.hyperedge(1)));
+
+    htd::MultiHypergraph * graph2 = new htd::MultiHypergraph(graph1);
+
+    const htd::Hyperedge & edge2 = graph1.hyperedge(2);
+
+    htd::ConstCollection<htd::vertex_t> vertices = graph1.vertices();
+    htd::ConstCollection<htd::vertex_t> neighbors = graph1.neighbors(2);
+    htd::ConstCollection<htd::Hyperedge> edges = graph1.hyperedges();
+    htd::ConstCollection<htd::Hyperedge> incidentEdges = graph1.hyperedges(3);
+
+    /* The first modification moves graph1 to a private copy, references obtained before refer to the state shared with graph2. */
+    graph1.addVertex();
+    graph1.removeEdge(1);
+
+    ASSERT_EQ(&edge2, &(graph2->hyperedge(2)));
+    ASSERT_NE(&edge2, &(graph1.hyperedge(2)));
+
+    /* The collections keep the shared state alive after graph2 is destroyed. */
+    delete graph2;
+
+    ASSERT_EQ((std::size_t)5, vertices.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 2, 3, 4, 5 }), std::vector<htd::vertex_t>(vertices.begin(), vertices.end()));
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 1, 3, 4 }), std::vector<htd::vertex_t>(neighbors.begin(), neighbors.end()));
+
+    ASSERT_EQ((std::size_t)2, edges.size());
+    ASSERT_EQ((htd::id_t)1, edges[0].id());
+    ASSERT_EQ((htd::id_t)2, edges[1].id());
+
+    ASSERT_EQ((std::size_t)1, incidentEdges.size());
+    ASSERT_EQ(std::vector<htd::vertex_t>({ 2, 3, 4 }), (*(incidentEdges.begin())).elements());
+
+    ASSERT_EQ((std::size_t)6, graph1.vertexCount());
+    ASSERT_EQ((std::size_t)1, graph1.edgeCount());
+
+    /* Collections do not count as sharers, hence a graph which is only referred to by collections is modified in place. */
+    const htd::Hyperedge & edge3 = graph1.hyperedge(2);
+
+    htd::ConstCollection<htd::Hyperedge> remainingEdges = graph1.hyperedges();
+
+    graph1.addVertex();
+
+    ASSERT_EQ(&edge3, &(graph1.hyperedge(2)));
+    ASSERT_EQ(&edge3, &(remainingEdges[0]));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckSelfLoopAndDeletionTracking)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(5);
+
+    htd::id_t selfLoop = graph.addEdge(std::vector<htd::vertex_t> { 2, 2, 3 });
+
+    graph.addEdge(1, 2);
+    graph.addEdge(3, 4);
+    graph.addEdge(4, 5);
+
+    ASSERT_TRUE(graph.isNeighbor(2, 2));
+    ASSERT_FALSE(graph.isNeighbor(3, 3));
+    ASSERT_TRUE(graph.isConnected());
+
+    graph.removeEdge(selfLoop);
+
+    ASSERT_FALSE(graph.isNeighbor(2, 2));
+    ASSERT_FALSE(graph.isConnected());
+
+    graph.addEdge(2, 3);
+
+    ASSERT_TRUE(graph.isConnected());
+
+    graph.removeVertex(4);
+
+    ASSERT_FALSE(graph.isVertex(4));
+    ASSERT_TRUE(graph.isVertex(5));
+    ASSERT_FALSE(graph.isVertex(6));
+    ASSERT_FALSE(graph.isConnected());
+
+    ASSERT_EQ((htd::vertex_t)6, graph.addVertex());
+
+    ASSERT_TRUE(graph.isVertex(6));
+    ASSERT_FALSE(graph.isVertex(4));
+
+    graph.addEdge(6, 6);
+
+    ASSERT_TRUE(graph.isNeighbor(6, 6));
+    ASSERT_FALSE(graph.isNeighbor(5, 5));
+
+    htd::MultiHypergraph copy(libraryInstance);
+
+    copy = static_cast<const htd::IMultiHypergraph &>(graph);
+
+    ASSERT_EQ((std::size_t)5, copy.vertexCount());
+    ASSERT_FALSE(copy.isVertex(4));
+    ASSERT_TRUE(copy.isNeighbor(6, 6));
+
+    delete libraryInstance;
+}
+
+TEST(MultiHypergraphTest, CheckEdgeLookupByEndpoints)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    graph.addVertices(20);
+
+    std::vector<htd::vertex_t> largeEdge;
+
+    for (htd::vertex_t vertex = 20; vertex >= 1; --vertex)
+    {
+        largeEdge.push_back(vertex);
+    }
+
+    htd::id_t edgeId1 = graph.addEdge(2, 1);
+    htd::id_t edgeId2 = graph.addEdge(3, 3);
+    htd::id_t edgeId3 = graph.addEdge(std::vector<htd::vertex_t> { 5, 4, 5, 6 });
+    htd::id_t edgeId4 = graph.addEdge(largeEdge);
+    htd::id_t edgeId5 = graph.addEdge(std::vector<htd::vertex_t> { 4, 5, 6 });
+    htd::id_t edgeId6 = graph.addEdge(1, 2);
+
+    ASSERT_TRUE(graph.isEdge(2, 1));
+    ASSERT_TRUE(graph.isEdge(1, 2));
+    ASSERT_TRUE(graph.isEdge(3, 3));
+    ASSERT_FALSE(graph.isEdge(3, 4));
+    ASSERT_FALSE(graph.isEdge(std::vector<htd::vertex_t> { 3 }));
+
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 5, 4, 5, 6 }));
+    ASSERT_TRUE(graph.isEdge(std::vector<htd::vertex_t> { 4, 5, 6 }));
+    ASSERT_FALSE(graph.isEdge(std::vector<htd::vertex_t> { 6, 5, 4 }));
+    ASSERT_TRUE(graph.isEdge(largeEdge));
+    ASSERT_TRUE(graph.isEdge(htd::ConstCollection<htd::vertex_t>::getInstance(largeEdge)));
+
+    std::reverse(largeEdge.begin(), largeEdge.end());
+
+    ASSERT_FALSE(graph.isEdge(largeEdge));
+
+    htd::ConstCollection<htd::id_t> edgeIds1 = graph.associatedEdgeIds(2, 1);
+    htd::ConstCollection<htd::id_t> edgeIds2 = graph.associatedEdgeIds(1, 2);
+
+    ASSERT_EQ(std::vector<htd::id_t>({ edgeId1 }), std::vector<htd::id_t>(edgeIds1.begin(), edgeIds1.end()));
+    ASSERT_EQ(std::vector<htd::id_t>({ edgeId6 }), std::vector<htd::id_t>(edgeIds2.begin(), edgeIds2.end()));
+    ASSERT_EQ((std::size_t)1, graph.associatedEdgeIds(3, 3).size());
+    ASSERT_EQ(edgeId2, graph.associatedEdgeIds(3, 3)[0]);
+    ASSERT_EQ((std::size_t)1, graph.associatedEdgeIds(std::vector<htd::vertex_t> { 5, 4, 5, 6 }).size());
+    ASSERT_EQ(edgeId3, graph.associatedEdgeIds(std::vector<htd::vertex_t> { 5, 4, 5, 6 })[0]);
+    ASSERT_EQ(edgeId5, graph.associatedEdgeIds(std::vector<htd::vertex_t> { 4, 5, 6 })[0]);
+
+    std::reverse(largeEdge.begin(), largeEdge.end());
+
+    ASSERT_EQ(edgeId4, graph.associatedEdgeIds(largeEdge)[0]);
+
+    graph.removeEdge(edgeId1);
+
+    ASSERT_FALSE(graph.isEdge(2, 1));
+    ASSERT_TRUE(graph.isEdge(1, 2));
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -70,7 +70,7 @@ TEST(PostProcessingPathDecompositionAlgorithmTest, CheckResultEmptyGraph)
 
     ASSERT_EQ(decomposition->root(), (htd::vertex_t)1);
 
-    const std::vector<htd::vertex_t> & bag = decomposition->bagContent(1);
+    const htd::Bag & bag = decomposition->bagContent(1);
 
     EXPECT_EQ(bag.size(), (std::size_t)0);
 
@@ -0,0 +1,360 @@
+/*
+ * File:   SafeSeparatorOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include "ChordalityTestHelpers.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+class SafeSeparatorOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        SafeSeparatorOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~SafeSeparatorOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+std::vector<std::vector<htd::vertex_t>> computeAtoms(const htd::LibraryInstance * const libraryInstance, const htd::IMultiHypergraph & graph, std::size_t & maximumBagSize)
+{
+    std::vector<std::vector<htd::vertex_t>> ret;
+
+    htd::IGraphPreprocessor * preprocessor = libraryInstance->graphPreprocessorFactory().createInstance();
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+    htd::SafeSeparatorOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(new htd::MinFillOrderingAlgorithm(libraryInstance));
+
+    htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph, ret);
+
+    EXPECT_EQ(graph.vertexCount(), ordering->sequence().size());
+
+    std::sort(ret.begin(), ret.end());
+
+    htd::BucketEliminationTreeDecompositionAlgorithm decompositionAlgorithm(libraryInstance);
+
+    decompositionAlgorithm.setOrderingAlgorithm(algorithm.clone());
+
+    htd::ITreeDecomposition * decomposition = decompositionAlgorithm.computeDecomposition(graph);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+    maximumBagSize = decomposition->maximumBagSize();
+
+    delete decomposition;
+    delete ordering;
+    delete preprocessedGraph;
+    delete preprocessor;
+
+    return ret;
+}
+
+TEST(SafeSeparatorOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::SafeSeparatorOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+
+    delete ordering;
+    delete libraryInstance;
+}
+
+TEST(SafeSeparatorOrderingAlgorithmTest, CheckCliqueSeparators)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 9);
+
+    /* A clique of size four which shares an edge with a triangle and a vertex with a pendant edge, and a separate triangle. */
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+    graph.addEdge(1, 4);
+    graph.addEdge(2, 3);
+    graph.addEdge(2, 4);
+    graph.addEdge(3, 4);
+
+    graph.addEdge(3, 5);
+    graph.addEdge(4, 5);
+
+    graph.addEdge(1, 6);
+
+    graph.addEdge(7, 8);
+    graph.addEdge(8, 9);
+    graph.addEdge(9, 7);
+
+    std::size_t maximumBagSize = 0;
+
+    std::vector<std::vector<htd::vertex_t>> atoms = computeAtoms(libraryInstance, graph, maximumBagSize);
+
+    std::vector<std::vector<htd::vertex_t>> expectedAtoms { { 1, 2, 3, 4 }, { 1, 6 }, { 3, 4, 5 }, { 7, 8, 9 } };
+
+    EXPECT_EQ(expectedAtoms, atoms);
+
+    EXPECT_EQ((std::size_t)4, maximumBagSize);
+
+    delete libraryInstance;
+}
+
+TEST(SafeSeparatorOrderingAlgorithmTest, CheckAlmostCliqueSeparators)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 7);
+
+    /* The separator {1, 2, 3} misses only the edge between 2 and 3 and each of its sides forms a clique of size five with it. */
+    graph.addEdge(1, 2);
+    graph.addEdge(1, 3);
+
+    for (htd::vertex_t vertex : { 4, 6 })
+    {
+        for (htd::vertex_t neighbor : { 1, 2, 3 })
+        {
+            graph.addEdge(vertex, neighbor);
+            graph.addEdge(vertex + 1, neighbor);
+        }
+
+        graph.addEdge(vertex, vertex + 1);
+    }
+
+    std::size_t maximumBagSize = 0;
+
+    std::vector<std::vector<htd::vertex_t>> atoms = computeAtoms(libraryInstance, graph, maximumBagSize);
+
+    std::vector<std::vector<htd::vertex_t>> expectedAtoms { { 1, 2, 3, 4, 5 }, { 1, 2, 3, 6, 7 } };
+
+    EXPECT_EQ(expectedAtoms, atoms);
+
+    EXPECT_EQ((std::size_t)5, maximumBagSize);
+
+    delete libraryInstance;
+}
+
+TEST(SafeSeparatorOrderingAlgorithmTest, CheckLargeGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::size_t triangleCount = 10000;
+
+    htd::MultiHypergraph graph(libraryInstance, 2 * triangleCount + 1);
+
+    /* A chain of triangles which is too large for the computation of a minimal triangulation, hence it is split at its articulation points. */
+    for (htd::vertex_t vertex = 1; vertex < 2 * triangleCount; vertex += 2)
+    {
+        graph.addEdge(vertex, vertex + 1);
+        graph.addEdge(vertex + 1, vertex + 2);
+        graph.addEdge(vertex + 2, vertex);
+    }
+
+    std::size_t maximumBagSize = 0;
+
+    std::vector<std::vector<htd::vertex_t>> atoms = computeAtoms(libraryInstance, graph, maximumBagSize);
+
+    ASSERT_EQ(triangleCount, atoms.size());
+
+    EXPECT_EQ((std::vector<htd::vertex_t> { 1, 2, 3 }), atoms[0]);
+
+    EXPECT_EQ((std::size_t)3, maximumBagSize);
+
+    delete libraryInstance;
+}
+
+TEST(SafeSeparatorOrderingAlgorithmTest, CheckTriangulationMinimization)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::size_t gridSize = 5;
+
+    htd::MultiHypergraph graph(libraryInstance, 2 * gridSize * gridSize);
+
+    /* Two grids which are joined by a triangle, i.e., by a clique separator. */
+    for (htd::vertex_t offset : { (htd::vertex_t)0, (htd::vertex_t)(gridSize * gridSize) })
+    {
+        for (htd::vertex_t row = 0; row < gridSize; ++row)
+        {
+            for (htd::vertex_t column = 0; column < gridSize; ++column)
+            {
+                htd::vertex_t vertex = offset + row * gridSize + column + 1;
+
+                if (column + 1 < gridSize)
+                {
+                    graph.addEdge(vertex, vertex + 1);
+                }
+
+                if (row + 1 < gridSize)
+                {
+                    graph.addEdge(vertex, vertex + gridSize);
+                }
+            }
+        }
+    }
+
+    graph.addEdge(gridSize * gridSize, gridSize * gridSize + 1);
+    graph.addEdge(gridSize * gridSize - 1, gridSize * gridSize + 1);
+
+    for (std::size_t threadCount : { 1, 2 })
+    {
+        libraryInstance->setThreadCount(threadCount);
+
+        htd::SafeSeparatorOrderingAlgorithm algorithm(libraryInstance);
+
+        /* The wrapped algorithm triangulates the input graph, hence it must receive the graph of the atom, too. */
+        algorithm.setOrderingAlgorithm(new htd::TriangulationMinimizationOrderingAlgorithm(libraryInstance));
+
+        std::vector<std::vector<htd::vertex_t>> atoms;
+
+        htd::IGraphPreprocessor * preprocessor = libraryInstance->graphPreprocessorFactory().createInstance();
+
+        htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph, atoms);
+
+        EXPECT_LT((std::size_t)1, atoms.size());
+
+        std::vector<htd::vertex_t> sequence(ordering->sequence().begin(), ordering->sequence().end());
+
+        std::sort(sequence.begin(), sequence.end());
+
+        std::vector<htd::vertex_t> expectedSequence(graph.vertexCount());
+
+        std::iota(expectedSequence.begin(), expectedSequence.end(), htd::Vertex::FIRST);
+
+        EXPECT_EQ(expectedSequence, sequence);
+
+        htd::BucketEliminationTreeDecompositionAlgorithm decompositionAlgorithm(libraryInstance);
+
+        decompositionAlgorithm.setOrderingAlgorithm(algorithm.clone());
+
+        htd::ITreeDecomposition * decomposition = decompositionAlgorithm.computeDecomposition(graph);
+
+        htd::TreeDecompositionVerifier verifier;
+
+        EXPECT_TRUE(verifier.verify(graph, *decomposition));
+
+        EXPECT_GE((std::size_t)7, decomposition->maximumBagSize());
+
+        delete decomposition;
+        delete ordering;
+        delete preprocessedGraph;
+        delete preprocessor;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(SafeSeparatorOrderingAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(7);
+
+    for (std::size_t round = 0; round < 20; ++round)
+    {
+        std::size_t vertexCount = 10 + 3 * round;
+
+        htd::MultiHypergraph graph = createRandomGraph(libraryInstance, vertexCount, vertexCount + vertexCount / 2, generator);
+
+        std::vector<std::vector<htd::vertex_t>> sequences;
+
+        for (std::size_t threadCount : { 1, 3 })
+        {
+            libraryInstance->setThreadCount(threadCount);
+
+            std::size_t maximumBagSize = 0;
+
+            std::vector<std::vector<htd::vertex_t>> atoms = computeAtoms(libraryInstance, graph, maximumBagSize);
+
+            /* Each edge of the input graph is contained in at least one atom. */
+            for (const htd::Hyperedge & edge : graph.hyperedges())
+            {
+                EXPECT_TRUE(std::any_of(atoms.begin(), atoms.end(), [&](const std::vector<htd::vertex_t> & atom)
+                {
+                    return std::includes(atom.begin(), atom.end(), edge.sortedElements().begin(), edge.sortedElements().end());
+                }));
+            }
+
+            libraryInstance->randomNumberGenerator().seed(round);
+
+            htd::SafeSeparatorOrderingAlgorithm algorithm(libraryInstance);
+
+            htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+            std::vector<htd::vertex_t> sequence(ordering->sequence().begin(), ordering->sequence().end());
+
+            std::sort(sequence.begin(), sequence.end());
+
+            ASSERT_EQ(graph.vertexCount(), sequence.size());
+
+            ASSERT_TRUE(std::unique(sequence.begin(), sequence.end()) == sequence.end());
+
+            sequences.emplace_back(ordering->sequence().begin(), ordering->sequence().end());
+
+            delete ordering;
+        }
+
+        /* Each atom is ordered with its own random number generator, hence the result does not depend on the number of threads. */
+        EXPECT_EQ(sequences[0], sequences[1]);
+    }
+
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
@@ -565,7 +565,7 @@ TEST(TreeDecompositionOptimizationTest, CheckResultEmptyGraph)
 
     ASSERT_EQ(decomposition->root(), (htd::vertex_t)1);
 
-    const std::vector<htd::vertex_t> & bag = decomposition->bagContent(1);
+    const htd::Bag & bag = decomposition->bagContent(1);
 
     EXPECT_EQ(bag.size(), (std::size_t)0);
 
@@ -609,7 +609,7 @@ TEST(TreeDecompositionOptimizationTest, CheckWidthMinimizationResultEmptyGraph)
 
     ASSERT_EQ(decomposition->root(), (htd::vertex_t)1);
 
-    const std::vector<htd::vertex_t> & bag = decomposition->bagContent(1);
+    const htd::Bag & bag = decomposition->bagContent(1);
 
     EXPECT_EQ(bag.size(), (std::size_t)0);
 
@@ -671,7 +671,7 @@ TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultEmpt
 
     ASSERT_EQ(decomposition->root(), (htd::vertex_t)1);
 
-    const std::vector<htd::vertex_t> & bag = decomposition->bagContent(1);
+    const htd::Bag & bag = decomposition->bagContent(1);
 
     EXPECT_EQ(bag.size(), (std::size_t)0);
 
@@ -1902,6 +1902,137 @@ TEST(TreeDecompositionOptimizationTest, CheckCombinedWidthMinimizationResultComp
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionOptimizationTest, CheckParallelWidthMinimizationResultComplexGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->setThreadCount(4);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setIterationCount(20);
+
+    algorithm.addManipulationOperation(new BagSizeLabelingFunction(libraryInstance));
+
+    htd::TreeDecompositionVerifier verifier;
+
+    std::size_t minimalWidth = (std::size_t)-1;
+
+    std::size_t reportedDecompositions = 0;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph, { new BagSizeLabelingFunction2(libraryInstance) },
+                                       [&](const htd::IMultiHypergraph & currentGraph, const htd::ITreeDecomposition & currentDecomposition, const htd::FitnessEvaluation & fitness){
+        ASSERT_EQ(graph, &currentGraph);
+
+        ASSERT_TRUE(verifier.verify(currentGraph, currentDecomposition));
+
+        std::size_t currentWidth = currentDecomposition.maximumBagSize();
+
+        ASSERT_EQ(currentWidth, static_cast<std::size_t>(-fitness.at(0)));
+
+        if (currentWidth < minimalWidth)
+        {
+            minimalWidth = currentWidth;
+        }
+
+        ++reportedDecompositions;
+    });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_GE(reportedDecompositions, (std::size_t)1);
+    ASSERT_LE(reportedDecompositions, (std::size_t)20);
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    ASSERT_EQ(minimalWidth, decomposition->maximumBagSize());
+
+    for (htd::vertex_t vertex : decomposition->vertices())
+    {
+        ASSERT_EQ(decomposition->bagSize(vertex), htd::accessLabel<std::size_t>(decomposition->vertexLabel("BAG_SIZE", vertex)));
+        ASSERT_EQ(decomposition->bagSize(vertex) * 2, htd::accessLabel<std::size_t>(decomposition->vertexLabel("BAG_SIZE_TIMES_2", vertex)));
+    }
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelWidthMinimizationNonImprovementLimit)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->setThreadCount(3);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setIterationCount(0);
+
+    algorithm.setNonImprovementLimit(8);
+
+    std::size_t reportedDecompositions = 0;
+
+    htd::ITreeDecomposition * decomposition =
+        algorithm.computeDecomposition(*graph, [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &){
+        ++reportedDecompositions;
+    });
+
+    ASSERT_NE(decomposition, nullptr);
+
+    ASSERT_GE(reportedDecompositions, (std::size_t)1);
+
+    htd::TreeDecompositionVerifier verifier;
+
+    ASSERT_TRUE(verifier.verify(*graph, *decomposition));
+
+    delete graph;
+    delete decomposition;
+    delete libraryInstance;
+}
+
+TEST(TreeDecompositionOptimizationTest, CheckParallelWidthMinimizationIsReproducible)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->setThreadCount(4);
+
+    htd::IMultiHypergraph * graph = createInputGraph(libraryInstance);
+
+    htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.setIterationCount(30);
+
+    std::vector<std::vector<std::vector<htd::vertex_t>>> bags(2);
+
+    for (std::vector<std::vector<htd::vertex_t>> & currentBags : bags)
+    {
+        libraryInstance->randomNumberGenerator().seed(5);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(*graph);
+
+        ASSERT_NE(decomposition, nullptr);
+
+        for (htd::vertex_t vertex : decomposition->vertices())
+        {
+            const htd::Bag & bag = decomposition->bagContent(vertex);
+
+            currentBags.emplace_back(bag.begin(), bag.end());
+        }
+
+        delete decomposition;
+    }
+
+    ASSERT_EQ(bags[0], bags[1]);
+
+    delete graph;
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -1267,6 +1267,179 @@ TEST(TreeDecompositionTest, TestEdgeLabelModifications)
     delete libraryInstance;
 }
 
+TEST(TreeDecompositionTest, CheckBagArena)
+{
+    htd::BagArena arena;
+
+    arena.setBagContent(1, std::vector<htd::vertex_t> { 1, 2, 3 });
+    arena.setBagContent(2, std::vector<htd::vertex_t> { 1, 2 });
+    arena.setBagContent(3, std::vector<htd::vertex_t> { 3, 4 });
+
+    ASSERT_EQ((std::size_t)3, arena.bagCount());
+    ASSERT_EQ((std::size_t)7, arena.contentSize());
+
+    ASSERT_TRUE(arena.isBag(1));
+    ASSERT_FALSE(arena.isBag(4));
+
+    ASSERT_THROW(arena.bagContent(4), std::out_of_range);
+
+    const htd::Bag & bag1 = arena.bagContent(1);
+
+    arena.setBagContent(1, std::vector<htd::vertex_t> { 2 });
+
+    ASSERT_EQ(std::vector<htd::vertex_t> { 2 }, bag1);
+    ASSERT_EQ((std::size_t)5, arena.contentSize());
+
+    const htd::vertex_t * content3 = arena.bagContent(3).data();
+
+    arena.setBagContent(3, std::vector<htd::vertex_t> { 3, 4, 5 });
+
+    ASSERT_EQ(content3, arena.bagContent(3).data());
+
+    arena.setBagContent(2, std::vector<htd::vertex_t> { 1, 2, 5, 6 });
+
+    ASSERT_EQ((std::vector<htd::vertex_t> { 1, 2, 5, 6 }), arena.bagContent(2));
+
+    arena.mutableBagContent(1).push_back(7);
+
+    ASSERT_EQ((std::vector<htd::vertex_t> { 2, 7 }), bag1);
+    ASSERT_EQ((std::size_t)9, arena.contentSize());
+
+    arena.setBagContent(1, arena.bagContent(1));
+
+    ASSERT_EQ((std::vector<htd::vertex_t> { 2, 7 }), bag1);
+    ASSERT_EQ((std::size_t)9, arena.contentSize());
+
+    arena.compact();
+
+    ASSERT_EQ((std::size_t)9, arena.storageSize());
+    ASSERT_EQ((std::vector<htd::vertex_t> { 2, 7 }), bag1);
+    ASSERT_EQ((std::vector<htd::vertex_t> { 3, 4, 5 }), arena.bagContent(3));
+
+    arena.removeBag(3);
+
+    ASSERT_EQ((std::size_t)2, arena.bagCount());
+    ASSERT_FALSE(arena.isBag(3));
+
+    htd::BagArena copy(arena);
+
+    ASSERT_EQ((std::size_t)6, copy.contentSize());
+    ASSERT_EQ((std::size_t)6, copy.storageSize());
+    ASSERT_EQ(arena.bagContent(1), copy.bagContent(1));
+    ASSERT_EQ(arena.bagContent(2), copy.bagContent(2));
+    ASSERT_FALSE(copy.isBag(3));
+}
+
+TEST(TreeDecompositionTest, CheckBagArenaGarbageCollection)
+{
+    htd::BagArena arena;
+
+    for (htd::vertex_t vertex = 1; vertex <= 1000; ++vertex)
+    {
+        arena.setBagContent(vertex, std::vector<htd::vertex_t> { vertex, vertex + 1 });
+    }
+
+    const htd::Bag & bag1 = arena.bagContent(1);
+
+    std::vector<htd::vertex_t> content1 = bag1.toVector();
+
+    for (htd::vertex_t vertex = 1; vertex <= 1000; ++vertex)
+    {
+        arena.mutableBagContent(vertex).push_back(vertex + 2);
+    }
+
+    for (htd::vertex_t vertex = 1; vertex <= 1000; ++vertex)
+    {
+        arena.setBagContent(vertex, arena.bagContent(vertex));
+    }
+
+    std::vector<const htd::vertex_t *> evenContents;
+
+    for (htd::vertex_t vertex = 2; vertex <= 1000; vertex += 2)
+    {
+        evenContents.push_back(arena.bagContent(vertex).data());
+    }
+
+    for (htd::vertex_t vertex = 1; vertex <= 1000; vertex += 2)
+    {
+        arena.setBagContent(vertex, std::vector<htd::vertex_t> { vertex, vertex + 1, vertex + 2, vertex + 3 });
+    }
+
+    for (htd::vertex_t vertex = 2; vertex <= 1000; vertex += 2)
+    {
+        ASSERT_EQ(evenContents[vertex / 2 - 1], arena.bagContent(vertex).data());
+        ASSERT_EQ((std::vector<htd::vertex_t> { vertex, vertex + 1, vertex + 2 }), arena.bagContent(vertex));
+    }
+
+    for (htd::vertex_t vertex = 2; vertex <= 1000; vertex += 2)
+    {
+        arena.removeBag(vertex);
+    }
+
+    ASSERT_EQ((std::size_t)500, arena.bagCount());
+    ASSERT_EQ((std::size_t)2000, arena.contentSize());
+    ASSERT_LT((std::size_t)2000, arena.storageSize());
+
+    arena.compact();
+
+    ASSERT_EQ((std::size_t)2000, arena.storageSize());
+
+    ASSERT_EQ((std::vector<htd::vertex_t> { 1, 2 }), content1);
+    ASSERT_EQ((std::vector<htd::vertex_t> { 1, 2, 3, 4 }), bag1);
+    ASSERT_EQ((std::vector<htd::vertex_t> { 999, 1000, 1001, 1002 }), arena.bagContent(999));
+
+    for (htd::vertex_t vertex = 1; vertex <= 1000; vertex += 2)
+    {
+        arena.removeBag(vertex);
+    }
+
+    ASSERT_EQ((std::size_t)0, arena.bagCount());
+    ASSERT_EQ((std::size_t)0, arena.storageSize());
+}
+
+TEST(TreeDecompositionTest, CheckBagReferencesAfterModifications)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::TreeDecomposition decomposition(libraryInstance);
+
+    htd::vertex_t root = decomposition.insertRoot();
+
+    decomposition.mutableBagContent(root) = std::vector<htd::vertex_t> { 1, 2, 3 };
+
+    const htd::Bag & rootBag = decomposition.bagContent(root);
+
+    for (htd::index_t index = 0; index < 100; ++index)
+    {
+        decomposition.addChild(root, std::vector<htd::vertex_t> { 1, 2, static_cast<htd::vertex_t>(index + 4) }, htd::FilteredHyperedgeCollection());
+    }
+
+    ASSERT_EQ((std::vector<htd::vertex_t> { 1, 2, 3 }), rootBag);
+
+    decomposition.mutableBagContent(root).push_back(4);
+
+    ASSERT_EQ((std::vector<htd::vertex_t> { 1, 2, 3, 4 }), rootBag);
+    ASSERT_EQ((std::size_t)4, decomposition.bagSize(root));
+
+    htd::vertex_t child = decomposition.childAtPosition(root, 0);
+
+    decomposition.setBagContent(child, rootBag);
+
+    decomposition.setBagContent(root, std::vector<htd::vertex_t> { 1, 2, 3, 4, 5 });
+
+    ASSERT_EQ((std::vector<htd::vertex_t> { 1, 2, 3, 4, 5 }), rootBag);
+    ASSERT_EQ((std::vector<htd::vertex_t> { 1, 2, 3, 4 }), decomposition.bagContent(child));
+
+    htd::TreeDecomposition copy(decomposition);
+
+    for (htd::vertex_t vertex : decomposition.vertices())
+    {
+        ASSERT_EQ(decomposition.bagContent(vertex), copy.bagContent(vertex));
+    }
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
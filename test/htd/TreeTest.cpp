@@ -26,6 +26,7 @@
 
 #include <htd/main.hpp>
 
+#include <thread>
 #include <vector>
 
 class TreeTest : public ::testing::Test
@@ -692,6 +693,270 @@ TEST(TreeTest, CheckMakeRootFunctionality1)
     delete libraryInstance;
 }
 
+TEST(TreeTest, CheckNodeStorageAfterRemoval)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t root = tree.insertRoot();
+
+    std::vector<htd::vertex_t> children;
+
+    for (int index = 0; index < 100; ++index)
+    {
+        children.push_back(tree.addChild(root));
+    }
+
+    htd::vertex_t intermediate = tree.addParent(children[50]);
+
+    ASSERT_EQ((std::size_t)102, tree.vertexCount());
+    ASSERT_EQ((std::size_t)101, tree.edgeCount());
+
+    ASSERT_TRUE(tree.isParent(children[50], intermediate));
+    ASSERT_TRUE(tree.isParent(intermediate, root));
+    ASSERT_FALSE(tree.isChild(root, children[50]));
+
+    for (int index = 0; index < 100; index += 2)
+    {
+        tree.removeVertex(children[index]);
+    }
+
+    ASSERT_EQ((std::size_t)52, tree.vertexCount());
+    ASSERT_EQ((std::size_t)51, tree.edgeCount());
+    ASSERT_EQ((std::size_t)51, tree.leafCount());
+
+    ASSERT_FALSE(tree.isVertex(children[0]));
+    ASSERT_TRUE(tree.isVertex(children[1]));
+
+    ASSERT_TRUE(tree.isLeaf(intermediate));
+    ASSERT_EQ((std::size_t)51, tree.childCount(root));
+
+    htd::vertex_t newChild = tree.addChild(children[1]);
+
+    ASSERT_EQ(intermediate + 1, newChild);
+    ASSERT_TRUE(tree.isParent(newChild, children[1]));
+
+    htd::Tree copy(tree);
+
+    tree.removeVertex(children[1]);
+
+    ASSERT_TRUE(tree.isParent(newChild, root));
+
+    ASSERT_TRUE(copy.isVertex(children[1]));
+    ASSERT_TRUE(copy.isParent(newChild, children[1]));
+    ASSERT_EQ((std::size_t)53, copy.vertexCount());
+
+    delete libraryInstance;
+}
+
+TEST(TreeTest, CheckVertexAndEdgeOrderAfterRemoval)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t root = tree.insertRoot();
+
+    std::vector<htd::vertex_t> children;
+
+    for (int index = 0; index < 10; ++index)
+    {
+        children.push_back(tree.addChild(root));
+    }
+
+    const htd::ConstCollection<htd::Hyperedge> & edges = tree.hyperedges();
+
+    tree.removeVertex(children[3]);
+    tree.removeVertex(children[9]);
+
+    htd::vertex_t newChild = tree.addChild(children[4]);
+
+    tree.removeVertex(children[4]);
+
+    ASSERT_EQ((std::size_t)10, edges.size());
+    ASSERT_EQ((htd::id_t)6, edges[5].id());
+
+    std::vector<htd::vertex_t> expectedVertices { root, children[0], children[1], children[2], children[5], children[6], children[7], children[8], newChild };
+
+    ASSERT_EQ(expectedVertices, tree.vertexVector());
+    ASSERT_EQ(children[5], tree.vertexAtPosition(4));
+    ASSERT_EQ(newChild, tree.vertexAtPosition(8));
+
+    std::vector<htd::id_t> edgeIds;
+
+    for (const htd::Hyperedge & edge : tree.hyperedges())
+    {
+        edgeIds.push_back(edge.id());
+    }
+
+    ASSERT_EQ((std::vector<htd::id_t> { 1, 2, 3, 6, 7, 8, 9, 12 }), edgeIds);
+    ASSERT_EQ((htd::id_t)12, tree.hyperedgeAtPosition(7).id());
+    ASSERT_EQ(root, tree.hyperedgeAtPosition(7)[0]);
+    ASSERT_EQ(newChild, tree.hyperedgeAtPosition(7)[1]);
+
+    delete libraryInstance;
+}
+
+TEST(TreeTest, CheckEdgesFollowParentLinks)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t node1 = tree.insertRoot();
+    htd::vertex_t node2 = tree.addChild(node1);
+    htd::vertex_t node3 = tree.addChild(node1);
+    htd::vertex_t node4 = tree.addChild(node2);
+
+    ASSERT_EQ((std::size_t)3, tree.edgeCount());
+
+    ASSERT_EQ((htd::id_t)1, tree.associatedEdgeIds(node1, node2)[0]);
+    ASSERT_EQ((htd::id_t)2, tree.associatedEdgeIds(node1, node3)[0]);
+    ASSERT_EQ((htd::id_t)3, tree.associatedEdgeIds(node2, node4)[0]);
+
+    ASSERT_TRUE(tree.associatedEdgeIds(node2, node1).empty());
+    ASSERT_TRUE(tree.associatedEdgeIds(node3, node4).empty());
+
+    ASSERT_EQ(node3, tree.hyperedge(2)[1]);
+
+    ASSERT_EQ((std::size_t)2, tree.hyperedges(node2).size());
+    ASSERT_EQ((htd::id_t)3, tree.hyperedgeAtPosition(1, node2).id());
+
+    tree.removeVertex(node2);
+
+    ASSERT_EQ((std::size_t)2, tree.edgeCount());
+    ASSERT_FALSE(tree.isEdge((htd::id_t)1));
+    ASSERT_FALSE(tree.isEdge((htd::id_t)3));
+    ASSERT_TRUE(tree.isEdge((htd::id_t)4));
+
+    ASSERT_EQ((htd::id_t)2, tree.hyperedgeAtPosition(0).id());
+    ASSERT_EQ((htd::id_t)4, tree.hyperedgeAtPosition(1).id());
+    ASSERT_EQ(node1, tree.hyperedge(4)[0]);
+    ASSERT_EQ(node4, tree.hyperedge(4)[1]);
+
+    htd::vertex_t node5 = tree.addParent(node4);
+
+    ASSERT_EQ((std::size_t)3, tree.edgeCount());
+    ASSERT_EQ((htd::id_t)5, tree.associatedEdgeIds(node1, node5)[0]);
+    ASSERT_EQ((htd::id_t)6, tree.associatedEdgeIds(node4, node5)[0]);
+
+    tree.swapWithParent(node4);
+
+    ASSERT_TRUE(tree.isParent(node5, node4));
+    ASSERT_TRUE(tree.isParent(node4, node1));
+    ASSERT_EQ((htd::id_t)6, tree.associatedEdgeIds(node4, node5)[0]);
+    ASSERT_EQ((htd::id_t)7, tree.associatedEdgeIds(node1, node4)[0]);
+    ASSERT_FALSE(tree.isEdge((htd::id_t)5));
+
+    tree.makeRoot(node5);
+
+    ASSERT_TRUE(tree.isRoot(node5));
+    ASSERT_EQ((std::size_t)3, tree.edgeCount());
+    ASSERT_EQ((htd::id_t)6, tree.associatedEdgeIds(node4, node5)[0]);
+    ASSERT_EQ((htd::id_t)7, tree.associatedEdgeIds(node1, node4)[0]);
+    ASSERT_EQ((htd::id_t)2, tree.associatedEdgeIds(node1, node3)[0]);
+
+    htd::Tree copy(libraryInstance);
+
+    copy = static_cast<const htd::ITree &>(tree);
+
+    ASSERT_EQ(tree.hyperedges(), copy.hyperedges());
+    ASSERT_EQ(tree.nextEdgeId(), copy.nextEdgeId());
+
+    delete libraryInstance;
+}
+
+TEST(TreeTest, CheckEdgeCollectionsAfterModifications)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::Tree tree(libraryInstance);
+
+    htd::vertex_t root = tree.insertRoot();
+
+    std::vector<htd::vertex_t> children;
+
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        children.push_back(tree.addChild(root));
+    }
+
+    const htd::ConstCollection<htd::Hyperedge> & edges = tree.hyperedges();
+
+    ASSERT_EQ((std::size_t)100, edges.size());
+
+    const htd::Hyperedge & edge = tree.hyperedge(100);
+
+    for (std::size_t index = 0; index < 60; ++index)
+    {
+        tree.removeVertex(children[index]);
+    }
+
+    htd::vertex_t child = tree.addChild(children[99]);
+
+    /* The hyperedge is not affected by the modifications, hence the reference remains valid. */
+    ASSERT_EQ(&edge, &(tree.hyperedge(100)));
+
+    /* Collections of hyperedges keep the positions of the tree at the time they were requested and refer to the
+     * stored hyperedges, hence they remain valid for all hyperedges which were not removed in the meantime. */
+    ASSERT_EQ((std::size_t)100, edges.size());
+    ASSERT_EQ((htd::id_t)61, edges[60].id());
+    ASSERT_EQ(children[60], edges[60][1]);
+    ASSERT_EQ(&edge, &(edges[99]));
+    ASSERT_EQ(&edge, &(tree.hyperedges(root)[39]));
+    ASSERT_EQ(&edge, &(tree.hyperedges()[39]));
+    ASSERT_EQ(&edge, &(*(tree.hyperedgesAtPositions(std::vector<htd::index_t> { 39 }).begin())));
+
+    ASSERT_EQ((htd::id_t)100, edge.id());
+    ASSERT_EQ(root, edge[0]);
+    ASSERT_EQ(children[99], edge[1]);
+
+    ASSERT_FALSE(tree.isEdge((htd::id_t)60));
+    ASSERT_TRUE(tree.isEdge((htd::id_t)61));
+
+    ASSERT_EQ((std::size_t)41, tree.edgeCount());
+
+    for (std::size_t index = 60; index < 90; ++index)
+    {
+        tree.removeVertex(children[index]);
+    }
+
+    std::vector<std::vector<htd::id_t>> edgeIds(4);
+
+    /* Concurrent readers of the same tree observe the same hyperedges. */
+    std::vector<std::thread> threads;
+
+    for (std::size_t threadIndex = 0; threadIndex < edgeIds.size(); ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex]()
+        {
+            for (const htd::Hyperedge & currentEdge : tree.hyperedges())
+            {
+                edgeIds[threadIndex].push_back(currentEdge.id());
+            }
+
+            edgeIds[threadIndex].push_back(tree.hyperedgeAtPosition(edgeIds[threadIndex].size() - 1).id());
+        });
+    }
+
+    for (std::thread & thread : threads)
+    {
+        thread.join();
+    }
+
+    std::vector<htd::id_t> expectedEdgeIds { 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 101 };
+
+    for (const std::vector<htd::id_t> & currentEdgeIds : edgeIds)
+    {
+        EXPECT_EQ(expectedEdgeIds, currentEdgeIds);
+    }
+
+    ASSERT_TRUE(tree.isParent(child, children[99]));
+
+    delete libraryInstance;
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,322 @@
+/*
+ * File:   TreeWidthLowerBoundAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include "ChordalityTestHelpers.hpp"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+class TreeWidthLowerBoundAlgorithmTest : public ::testing::Test
+{
+    public:
+        TreeWidthLowerBoundAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~TreeWidthLowerBoundAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+struct LowerBounds
+{
+    std::size_t degeneracy;
+
+    std::size_t minorMinWidth;
+
+    std::size_t contractionDegeneracy;
+
+    std::size_t lowerBound;
+};
+
+LowerBounds computeLowerBounds(const htd::LibraryInstance * const libraryInstance, const htd::IMultiHypergraph & graph)
+{
+    htd::GraphPreprocessor preprocessor(libraryInstance);
+
+    preprocessor.setPreprocessingStrategy(0);
+
+    htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+    htd::TreeWidthLowerBoundAlgorithm algorithm(libraryInstance);
+
+    LowerBounds ret;
+
+    ret.degeneracy = algorithm.computeDegeneracy(*preprocessedGraph);
+    ret.minorMinWidth = algorithm.computeMinorMinWidth(*preprocessedGraph);
+    ret.contractionDegeneracy = algorithm.computeContractionDegeneracy(*preprocessedGraph);
+    ret.lowerBound = algorithm.computeLowerBound(*preprocessedGraph);
+
+    EXPECT_EQ(ret.lowerBound, std::max(ret.degeneracy, std::max(ret.minorMinWidth, ret.contractionDegeneracy)));
+
+    /* The bounds are computed in the order of their running time and only as long as the target width is not reached. */
+    EXPECT_EQ(ret.degeneracy, algorithm.computeLowerBound(*preprocessedGraph, 0));
+    EXPECT_EQ(ret.lowerBound, algorithm.computeLowerBound(*preprocessedGraph, ret.lowerBound + 1));
+
+    /* The preprocessing does not compute the lower bound on its own. */
+    EXPECT_EQ((std::size_t)0, preprocessedGraph->minTreeWidth());
+
+    delete preprocessedGraph;
+
+    return ret;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    LowerBounds lowerBounds = computeLowerBounds(libraryInstance, graph);
+
+    EXPECT_EQ((std::size_t)0, lowerBounds.lowerBound);
+
+    graph.addVertices(5);
+
+    lowerBounds = computeLowerBounds(libraryInstance, graph);
+
+    EXPECT_EQ((std::size_t)0, lowerBounds.lowerBound);
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckSimpleGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph tree(libraryInstance, 7);
+
+    for (htd::vertex_t vertex = 2; vertex <= 7; ++vertex)
+    {
+        tree.addEdge(vertex / 2, vertex);
+    }
+
+    EXPECT_EQ((std::size_t)1, computeLowerBounds(libraryInstance, tree).lowerBound);
+
+    htd::MultiHypergraph cycle(libraryInstance, 10);
+
+    for (htd::vertex_t vertex = 1; vertex <= 10; ++vertex)
+    {
+        cycle.addEdge(vertex, vertex % 10 + 1);
+    }
+
+    EXPECT_EQ((std::size_t)2, computeLowerBounds(libraryInstance, cycle).lowerBound);
+
+    htd::MultiHypergraph clique(libraryInstance, 6);
+
+    for (htd::vertex_t vertex1 = 1; vertex1 <= 6; ++vertex1)
+    {
+        for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= 6; ++vertex2)
+        {
+            clique.addEdge(vertex1, vertex2);
+        }
+    }
+
+    LowerBounds lowerBounds = computeLowerBounds(libraryInstance, clique);
+
+    EXPECT_EQ((std::size_t)5, lowerBounds.degeneracy);
+    EXPECT_EQ((std::size_t)5, lowerBounds.minorMinWidth);
+    EXPECT_EQ((std::size_t)5, lowerBounds.contractionDegeneracy);
+
+    /* A single hyperedge induces a clique in the primal graph. */
+    htd::MultiHypergraph hypergraph(libraryInstance, 4);
+
+    hypergraph.addEdge(std::vector<htd::vertex_t> { 1, 2, 3, 4 });
+
+    EXPECT_EQ((std::size_t)3, computeLowerBounds(libraryInstance, hypergraph).lowerBound);
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckGridGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::size_t dimension = 8;
+
+    htd::MultiHypergraph graph(libraryInstance, dimension * dimension);
+
+    for (htd::vertex_t row = 0; row < dimension; ++row)
+    {
+        for (htd::vertex_t column = 0; column < dimension; ++column)
+        {
+            htd::vertex_t vertex = 1 + row * dimension + column;
+
+            if (column + 1 < dimension)
+            {
+                graph.addEdge(vertex, vertex + 1);
+            }
+
+            if (row + 1 < dimension)
+            {
+                graph.addEdge(vertex, vertex + dimension);
+            }
+        }
+    }
+
+    LowerBounds lowerBounds = computeLowerBounds(libraryInstance, graph);
+
+    /* Each subgraph of a grid contains a vertex of degree at most two, but contractions lead to vertices of higher degree. */
+    EXPECT_EQ((std::size_t)2, lowerBounds.degeneracy);
+
+    EXPECT_LT((std::size_t)2, lowerBounds.minorMinWidth);
+
+    EXPECT_LE(lowerBounds.lowerBound, dimension);
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    std::mt19937 generator(11);
+
+    for (std::size_t round = 0; round < 20; ++round)
+    {
+        std::size_t vertexCount = 10 + 2 * round;
+
+        htd::MultiHypergraph graph = createRandomGraph(libraryInstance, vertexCount, 3 * vertexCount, generator);
+
+        LowerBounds lowerBounds = computeLowerBounds(libraryInstance, graph);
+
+        htd::GraphPreprocessor preprocessor(libraryInstance);
+
+        preprocessor.setPreprocessingStrategy(3);
+
+        htd::IPreprocessedGraph * preprocessedGraph = preprocessor.prepare(graph);
+
+        htd::BucketEliminationTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        /* The lower bound never exceeds the width of any decomposition of the graph. */
+        for (std::size_t iteration = 0; iteration < 10; ++iteration)
+        {
+            htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, *preprocessedGraph);
+
+            ASSERT_NE(nullptr, decomposition);
+
+            EXPECT_LE(preprocessedGraph->minTreeWidth() + 1, decomposition->maximumBagSize());
+
+            EXPECT_LE(lowerBounds.lowerBound + 1, decomposition->maximumBagSize());
+
+            delete decomposition;
+        }
+
+        delete preprocessedGraph;
+    }
+
+    delete libraryInstance;
+}
+
+TEST(TreeWidthLowerBoundAlgorithmTest, CheckWidthMinimizationStopsAtLowerBound)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance, 12);
+
+    /* Two cliques of size five connected by a path, hence each decomposition computed by bucket elimination is optimal. */
+    for (htd::vertex_t base : { 1, 8 })
+    {
+        for (htd::vertex_t vertex1 = base; vertex1 < base + 5; ++vertex1)
+        {
+            for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 < base + 5; ++vertex2)
+            {
+                graph.addEdge(vertex1, vertex2);
+            }
+        }
+    }
+
+    graph.addEdge(5, 6);
+    graph.addEdge(6, 7);
+    graph.addEdge(7, 8);
+
+    for (std::size_t threadCount : { 1, 3 })
+    {
+        libraryInstance->setThreadCount(threadCount);
+
+        std::size_t decompositionCount = 0;
+
+        htd::WidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+        /* Without the lower bound, an iteration count of 0 would lead to an infinite loop. */
+        algorithm.setIterationCount(0);
+
+        htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph, [&](const htd::IMultiHypergraph &, const htd::ITreeDecomposition &, const htd::FitnessEvaluation &)
+        {
+            ++decompositionCount;
+        });
+
+        ASSERT_NE(nullptr, decomposition);
+
+        EXPECT_EQ((std::size_t)5, decomposition->maximumBagSize());
+
+        EXPECT_LE(decompositionCount, threadCount);
+
+        delete decomposition;
+    }
+
+    libraryInstance->setThreadCount(1);
+
+    htd::AdaptiveWidthMinimizingTreeDecompositionAlgorithm algorithm(libraryInstance);
+
+    algorithm.addDecompositionAlgorithm(new htd::BucketEliminationTreeDecompositionAlgorithm(libraryInstance));
+
+    algorithm.setDecisionRounds(3);
+
+    algorithm.setIterationCount((std::size_t)-1);
+
+    htd::ITreeDecomposition * decomposition = algorithm.computeDecomposition(graph);
+
+    ASSERT_NE(nullptr, decomposition);
+
+    EXPECT_EQ((std::size_t)5, decomposition->maximumBagSize());
+
+    delete decomposition;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}
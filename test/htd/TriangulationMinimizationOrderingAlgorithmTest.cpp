@@ -0,0 +1,177 @@
+/*
+ * File:   TriangulationMinimizationOrderingAlgorithmTest.cpp
+ *
+ * Author: ABSEHER Michael (abseher@dbai.tuwien.ac.at)
+ *
+ * Copyright 2015-2017, Michael Abseher
+ *    E-Mail: <abseher@dbai.tuwien.ac.at>
+ *
+ * This file is part of htd.
+ *
+ * htd is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * htd is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public
+ * License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with htd.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <gtest/gtest.h>
+
+#include <htd/main.hpp>
+
+#include "ChordalityTestHelpers.hpp"
+
+#include <random>
+#include <utility>
+#include <vector>
+
+class TriangulationMinimizationOrderingAlgorithmTest : public ::testing::Test
+{
+    public:
+        TriangulationMinimizationOrderingAlgorithmTest(void)
+        {
+
+        }
+
+        virtual ~TriangulationMinimizationOrderingAlgorithmTest()
+        {
+
+        }
+
+        void SetUp()
+        {
+
+        }
+
+        void TearDown()
+        {
+
+        }
+};
+
+std::size_t triangulate(AdjacencyMatrix & graph, const std::vector<htd::vertex_t> & ordering)
+{
+    std::size_t ret = 0;
+
+    std::vector<bool> eliminated(graph.size());
+
+    for (htd::vertex_t vertex : ordering)
+    {
+        eliminated[vertex] = true;
+
+        for (htd::vertex_t neighbor1 = 1; neighbor1 < graph.size(); ++neighbor1)
+        {
+            for (htd::vertex_t neighbor2 = neighbor1 + 1; neighbor2 < graph.size(); ++neighbor2)
+            {
+                if (!eliminated[neighbor1] && !eliminated[neighbor2] && graph[vertex][neighbor1] && graph[vertex][neighbor2] && !graph[neighbor1][neighbor2])
+                {
+                    graph[neighbor1][neighbor2] = true;
+                    graph[neighbor2][neighbor1] = true;
+
+                    ++ret;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+TEST(TriangulationMinimizationOrderingAlgorithmTest, CheckEmptyGraph)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    htd::MultiHypergraph graph(libraryInstance);
+
+    htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+    htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph);
+
+    ASSERT_TRUE(ordering->sequence().empty());
+
+    delete ordering;
+    delete libraryInstance;
+}
+
+TEST(TriangulationMinimizationOrderingAlgorithmTest, CheckMinimalTriangulationOfRandomGraphs)
+{
+    htd::LibraryInstance * libraryInstance = htd::createManagementInstance(htd::Id::FIRST);
+
+    libraryInstance->randomNumberGenerator().seed(3);
+
+    htd::IGraphPreprocessor * preprocessor = libraryInstance->graphPreprocessorFactory().createInstance();
+
+    htd::TriangulationMinimizationOrderingAlgorithm algorithm(libraryInstance);
+
+    algorithm.setOrderingAlgorithm(new htd::RandomOrderingAlgorithm(libraryInstance));
+
+    std::size_t totalRemovedFillEdgeCount = 0;
+
+    std::mt19937 generator(5);
+
+    for (std::size_t round = 0; round < 20; ++round)
+    {
+        std::size_t vertexCount = 5 + 2 * round;
+
+        htd::MultiHypergraph graph = createRandomGraph(libraryInstance, vertexCount, vertexCount * 2, generator);
+
+        AdjacencyMatrix adjacencyMatrix = createAdjacencyMatrix(graph, std::vector<std::pair<htd::vertex_t, htd::vertex_t>>());
+
+        htd::IPreprocessedGraph * preprocessedGraph = preprocessor->prepare(graph);
+
+        std::size_t initialFillEdgeCount = 0;
+        std::size_t removedFillEdgeCount = 0;
+
+        htd::IVertexOrdering * ordering = algorithm.computeOrdering(graph, *preprocessedGraph, initialFillEdgeCount, removedFillEdgeCount);
+
+        ASSERT_EQ(vertexCount, ordering->sequence().size());
+
+        ASSERT_LE(removedFillEdgeCount, initialFillEdgeCount);
+
+        AdjacencyMatrix triangulation(adjacencyMatrix);
+
+        ASSERT_EQ(initialFillEdgeCount - removedFillEdgeCount, triangulate(triangulation, ordering->sequence()));
+
+        for (htd::vertex_t vertex1 = 1; vertex1 <= vertexCount; ++vertex1)
+        {
+            for (htd::vertex_t vertex2 = vertex1 + 1; vertex2 <= vertexCount; ++vertex2)
+            {
+                if (triangulation[vertex1][vertex2] && !adjacencyMatrix[vertex1][vertex2])
+                {
+                    triangulation[vertex1][vertex2] = false;
+                    triangulation[vertex2][vertex1] = false;
+
+                    ASSERT_FALSE(isChordal(triangulation));
+
+                    triangulation[vertex1][vertex2] = true;
+                    triangulation[vertex2][vertex1] = true;
+                }
+            }
+        }
+
+        totalRemovedFillEdgeCount += removedFillEdgeCount;
+
+        delete ordering;
+        delete preprocessedGraph;
+    }
+
+    ASSERT_GT(totalRemovedFillEdgeCount, (std::size_t)0);
+
+    delete preprocessor;
+    delete libraryInstance;
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    return RUN_ALL_TESTS();
+}